@@ -0,0 +1,367 @@
+#include "IO/fortranio/interface.hpp"
+#include "kokkos_abstractions.h"
+#include "mesh/mesh.hpp"
+#include "specfem_mpi/interface.hpp"
+#include "specfem_setup.hpp"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Time reading a large synthetic Fortran mesh database, and compare decoding
+// its control nodes from a memory-mapped file with reading them from a
+// std::ifstream
+
+namespace {
+
+constexpr int ngnod = 9;
+
+// Write Fortran unformatted sequential records
+class fortran_writer {
+public:
+  fortran_writer(const std::string &filename)
+      : stream(filename, std::ios::binary) {
+    if (!stream.is_open()) {
+      std::ostringstream message;
+      message << "Could not open " << filename << " for writing.";
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  template <typename... Args> void write_line(const Args &...values) {
+    const int length = (0 + ... + size(values));
+    write_raw(length);
+    (write(values), ...);
+    write_raw(length);
+  }
+
+private:
+  static int size(const int) { return fint; }
+  static int size(const bool) { return fbool; }
+  static int size(const double) { return fdouble; }
+  static int size(const std::string &) { return fchar; }
+  static int size(const std::vector<int> &value) {
+    return value.size() * fint;
+  }
+
+  template <typename T> void write_raw(const T &value) {
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  void write(const int value) { write_raw(value); }
+  void write(const bool value) { write_raw(static_cast<int>(value)); }
+  void write(const double value) { write_raw(value); }
+  void write(const std::string &value) {
+    std::string padded = value;
+    padded.resize(fchar, ' ');
+    stream.write(padded.data(), fchar);
+  }
+  void write(const std::vector<int> &value) {
+    stream.write(reinterpret_cast<const char *>(value.data()),
+                 value.size() * fint);
+  }
+
+  std::ofstream stream;
+};
+
+// Types of the values of every record of the database header, as read by
+// specfem::mesh::IO::fortran::read_mesh_database_header. i : int, b : bool,
+// d : double, s : string
+const std::vector<std::string> header_records = {
+  "s", "ib", "i", "ii", "bb", "i", "i", "i", "b", "b", "d", "d", "d", "d", "d",
+  "b", "b", "i", "iii", "bb", "bbbdid", "d", "b", "bbbb", "si", "s", "s", "s",
+  "bbib", "b", "bbb", "b", "b", "bb", "b", "b", "b", "i", "b", "b", "b", "dd",
+  "b", "b", "d", "b", "d", "b", "b", "b", "d", "b", "d", "i", "b", "d", "b",
+  "i", "id", "i", "b", "i", "b", "bb"
+};
+
+void write_header(fortran_writer &writer, const int nspec, const int npgeo) {
+  const int nrecords = header_records.size();
+  for (int irecord = 0; irecord < nrecords; irecord++) {
+    if (irecord == 2) {
+      writer.write_line(nspec);
+      continue;
+    }
+    if (irecord == 3) {
+      writer.write_line(npgeo, 1);
+      continue;
+    }
+
+    // Every other header value is skipped by the reader, so the record is
+    // filled with zeros
+    const std::string &types = header_records[irecord];
+    int length = 0;
+    for (const char type : types) {
+      length += (type == 'i') ? fint
+                : (type == 'b') ? fbool
+                : (type == 'd') ? fdouble
+                                : fchar;
+    }
+    std::vector<int> padding(length / fint, 0);
+    writer.write_line(padding);
+  }
+}
+
+// Coordinates of the control nodes of a structured mesh of nx by nz 9-node
+// elements. Nodes are numbered row by row, starting at 1
+void write_coordinates(fortran_writer &writer, const int nx, const int nz,
+                       const double element_size) {
+  const int nnodes_x = 2 * nx + 1;
+  const int nnodes_z = 2 * nz + 1;
+
+  for (int iz = 0; iz < nnodes_z; iz++) {
+    for (int ix = 0; ix < nnodes_x; ix++) {
+      writer.write_line(iz * nnodes_x + ix + 1, 0.5 * element_size * ix,
+                        0.5 * element_size * iz);
+    }
+  }
+}
+
+// Material and control nodes of every element of the structured mesh
+void write_elements(fortran_writer &writer, const int nx, const int nz) {
+  const int nnodes_x = 2 * nx + 1;
+
+  // Corners counter-clockwise from the bottom left, then the middle of the
+  // edges and the center
+  const int offset_x[ngnod] = { 0, 2, 2, 0, 1, 2, 1, 0, 1 };
+  const int offset_z[ngnod] = { 0, 0, 2, 2, 0, 1, 2, 1, 1 };
+
+  std::vector<int> knods(ngnod);
+  for (int iz = 0; iz < nz; iz++) {
+    for (int ix = 0; ix < nx; ix++) {
+      for (int inode = 0; inode < ngnod; inode++) {
+        knods[inode] = (2 * iz + offset_z[inode]) * nnodes_x + 2 * ix +
+                       offset_x[inode] + 1;
+      }
+      // element, material, control nodes, PML region
+      writer.write_line(iz * nx + ix + 1, 1, knods, 0);
+    }
+  }
+}
+
+// Write a database of a single elastic material without boundaries
+void write_database(const std::string &filename, const int nx, const int nz,
+                    const double element_size) {
+  const int nspec = nx * nz;
+  const int npgeo = (2 * nx + 1) * (2 * nz + 1);
+
+  fortran_writer writer(filename);
+  write_header(writer, nspec, npgeo);
+  write_coordinates(writer, nx, nz, element_size);
+  // numat, ngnod, nspec, pointsdisp, plot_lowerleft_corner_only
+  writer.write_line(1, ngnod, nspec, 6, 1);
+  // Number of boundary elements, interface edges, tangential and axial nodes
+  writer.write_line(0, 0, 0, 0, 0, 0, 0, 0);
+  // Attenuation
+  writer.write_line(1, 5.196, false);
+  // Material 1 : elastic with density, cp and cs. The remaining values are
+  // unused for elastic isotropic materials
+  writer.write_line(1, 1, 2700.0, 3000.0, 1732.051, 0.0, 0.0, 9999.0, 9999.0,
+                    0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+  write_elements(writer, nx, nz);
+  // MPI interfaces
+  writer.write_line(0, 0);
+  // Tangential elements
+  writer.write_line(false, false);
+}
+
+// Write the coordinates and the control nodes of the elements on their own
+void write_control_nodes(const std::string &filename, const int nx,
+                         const int nz, const double element_size) {
+  fortran_writer writer(filename);
+  write_coordinates(writer, nx, nz, element_size);
+  write_elements(writer, nx, nz);
+}
+
+// Decode the records of a control node file, either from a std::ifstream or
+// from a fortran_reader. Returns a checksum of the decoded values
+template <typename ReaderType>
+double read_control_nodes(ReaderType &reader, const int nx, const int nz) {
+  const int nspec = nx * nz;
+  const int npgeo = (2 * nx + 1) * (2 * nz + 1);
+
+  double checksum = 0.0;
+
+  int ipoin;
+  type_real x, z;
+  for (int i = 0; i < npgeo; i++) {
+    specfem::IO::fortran_read_line(reader, &ipoin, &x, &z);
+    checksum += ipoin + x + z;
+  }
+
+  int n, kmato, pml;
+  std::vector<int> knods(ngnod);
+  for (int ispec = 0; ispec < nspec; ispec++) {
+    specfem::IO::fortran_read_line(reader, &n, &kmato, &knods, &pml);
+    checksum += n + knods[0] + knods[ngnod - 1];
+  }
+
+  return checksum;
+}
+
+template <typename F> double fastest(const int repeat, F &&function) {
+  double best = 0.0;
+  for (int i = 0; i < repeat; i++) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    function();
+    const std::chrono::duration<double> elapsed =
+        std::chrono::high_resolution_clock::now() - start;
+    best = (i == 0) ? elapsed.count() : std::min(best, elapsed.count());
+  }
+  return best;
+}
+
+std::size_t file_size(const std::string &filename) {
+  std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+  return static_cast<std::size_t>(stream.tellg());
+}
+
+boost::program_options::options_description define_args() {
+  namespace po = boost::program_options;
+
+  po::options_description desc{ "======================================\n"
+                                "------SPECFEM database reader---------\n"
+                                "======================================" };
+
+  desc.add_options()("help,h", "Print this help message")(
+      "nx", po::value<int>()->default_value(1024),
+      "Number of elements along x")(
+      "nz", po::value<int>()->default_value(1024),
+      "Number of elements along z")(
+      "repeat", po::value<int>()->default_value(3),
+      "Number of times every read is repeated. The fastest is reported")(
+      "prefix", po::value<std::string>()->default_value("synthetic_database"),
+      "Prefix of the files written by the benchmark")(
+      "keep", "Keep the files written by the benchmark");
+
+  return desc;
+}
+
+int execute(const boost::program_options::variables_map &vm,
+            const specfem::MPI::MPI *mpi) {
+  if (mpi->get_size() != 1) {
+    throw std::runtime_error("The database reader benchmark runs on a single "
+                             "MPI rank");
+  }
+
+  const int nx = vm["nx"].as<int>();
+  const int nz = vm["nz"].as<int>();
+  const int repeat = vm["repeat"].as<int>();
+  if (nx < 1 || nz < 1 || repeat < 1) {
+    throw std::runtime_error("Mesh size and number of repetitions need to be "
+                             "positive");
+  }
+
+  const std::string prefix = vm["prefix"].as<std::string>();
+  const std::string database = prefix + ".bin";
+  const std::string control_nodes = prefix + "_control_nodes.bin";
+  constexpr double element_size = 100.0;
+
+  write_database(database, nx, nz, element_size);
+  write_control_nodes(control_nodes, nx, nz, element_size);
+
+  // Messages printed while reading the mesh are not part of the benchmark
+  std::ostringstream discarded;
+  auto *const cout_buffer = std::cout.rdbuf(discarded.rdbuf());
+  int nspec = 0;
+  const double mesh_time = fastest(repeat, [&]() {
+    const specfem::mesh::mesh mesh(database, mpi);
+    nspec = mesh.nspec;
+  });
+  std::cout.rdbuf(cout_buffer);
+
+  if (nspec != nx * nz) {
+    std::ostringstream message;
+    message << "Read " << nspec << " elements from the synthetic database, "
+            << "expected " << nx * nz;
+    throw std::runtime_error(message.str());
+  }
+
+  double stream_checksum = 0.0;
+  const double stream_time = fastest(repeat, [&]() {
+    std::ifstream stream(control_nodes, std::ios::binary);
+    stream_checksum = read_control_nodes(stream, nx, nz);
+  });
+
+  double mapped_checksum = 0.0;
+  const double mapped_time = fastest(repeat, [&]() {
+    specfem::IO::fortran_reader reader(control_nodes);
+    mapped_checksum = read_control_nodes(reader, nx, nz);
+    if (!reader.eof()) {
+      throw std::runtime_error("Control node file was not fully read");
+    }
+  });
+
+  if (stream_checksum != mapped_checksum) {
+    throw std::runtime_error("Control nodes decoded from a stream and from a "
+                             "mapped file differ");
+  }
+
+  const double mb = 1.0 / (1024.0 * 1024.0);
+  const double database_size = file_size(database) * mb;
+  const double control_nodes_size = file_size(control_nodes) * mb;
+  const long nrecords = static_cast<long>(nx) * nz +
+                        static_cast<long>(2 * nx + 1) * (2 * nz + 1);
+
+  std::ostringstream message;
+  message << "Synthetic mesh : " << nx << " x " << nz << " elements\n"
+          << std::fixed << std::setprecision(1)
+          << "Database : " << database_size << " MB\n"
+          << std::setprecision(4) << "Mesh read : " << mesh_time << " s, "
+          << std::setprecision(1) << database_size / mesh_time << " MB/s\n"
+          << "Control nodes : " << control_nodes_size << " MB, " << nrecords
+          << " records\n"
+          << std::setprecision(4) << "  std::ifstream : " << stream_time
+          << " s, " << std::setprecision(1) << control_nodes_size / stream_time
+          << " MB/s\n"
+          << std::setprecision(4) << "  mapped : " << mapped_time << " s, "
+          << std::setprecision(1) << control_nodes_size / mapped_time
+          << " MB/s\n"
+          << std::setprecision(2)
+          << "  speedup : " << stream_time / mapped_time << "x";
+  mpi->cout(message.str());
+
+  if (!vm.count("keep")) {
+    std::remove(database.c_str());
+    std::remove(control_nodes.c_str());
+  }
+
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+
+  // Initialize MPI
+  specfem::MPI::MPI *mpi = new specfem::MPI::MPI(&argc, &argv);
+  // Initialize Kokkos
+  Kokkos::initialize(argc, argv);
+  int status = 0;
+  {
+    const auto desc = define_args();
+    boost::program_options::variables_map vm;
+    boost::program_options::store(
+        boost::program_options::parse_command_line(argc, argv, desc), vm);
+
+    if (vm.count("help")) {
+      if (mpi->main_proc())
+        std::cout << desc << std::endl;
+    } else {
+      status = execute(vm, mpi);
+    }
+  }
+  // Finalize Kokkos
+  Kokkos::finalize();
+  // Finalize MPI
+  delete mpi;
+  return status;
+}
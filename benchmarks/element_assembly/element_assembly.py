@@ -0,0 +1,93 @@
+import os
+import re
+
+import numpy as np
+
+
+def solver_time(log_file):
+    """Read the time spent in the time loop from a specfem2d log file."""
+    pattern = re.compile(r"Total solver time \(time loop\) : ([0-9.eE+-]+) secs")
+    with open(log_file, "r") as f:
+        for line in f:
+            match = pattern.search(line)
+            if match:
+                return float(match.group(1))
+
+    raise RuntimeError(f"Could not find solver time in {log_file}")
+
+
+def number_of_colors(log_file):
+    """Read the largest number of colors used by any element kernel."""
+    pattern = re.compile(r"Number of colors\s*: ([0-9]+)")
+    ncolors = 0
+    with open(log_file, "r") as f:
+        for line in f:
+            match = pattern.search(line)
+            if match:
+                ncolors = max(ncolors, int(match.group(1)))
+
+    return ncolors
+
+
+def load_traces(run, stations, components):
+    traces = []
+    for station in stations:
+        for component in components:
+            filename = os.path.join(
+                "runs", run, "OUTPUT_FILES", "results", f"{station}AA{component}.semv"
+            )
+            traces.append(np.loadtxt(filename)[:, 1])
+
+    return np.stack(traces)
+
+
+def summarize(assemblies, threads, k, stations, components, output):
+    ## Atomic additions are the baseline. Coloring changes the order in which
+    ## contributions are summed, so seismograms agree to round-off
+    baseline = assemblies[0]
+
+    lines = []
+    lines.append("Element assembly benchmark")
+    lines.append("--------------------------")
+    lines.append(f"Mesh : {4 * k} x {3 * k} elements ({12 * k * k} elements)")
+    lines.append(
+        "speedup is relative to atomic assembly with the same number of threads. "
+        "efficiency is the parallel efficiency relative to 1 thread\n"
+    )
+    lines.append(
+        f"{'assembly':>10} {'threads':>8} {'colors':>7} {'time (s)':>10} "
+        f"{'speedup':>8} {'efficiency':>11} {'misfit':>10}"
+    )
+
+    serial_time = {
+        assembly: solver_time(
+            os.path.join("runs", f"{assembly}_t{threads[0]}", "output.log")
+        )
+        * threads[0]
+        for assembly in assemblies
+    }
+
+    for nthreads in threads:
+        reference_run = f"{baseline}_t{nthreads}"
+        reference_time = solver_time(os.path.join("runs", reference_run, "output.log"))
+        reference_traces = load_traces(reference_run, stations, components)
+
+        for assembly in assemblies:
+            run = f"{assembly}_t{nthreads}"
+            log_file = os.path.join("runs", run, "output.log")
+            time = solver_time(log_file)
+            traces = load_traces(run, stations, components)
+            misfit = np.linalg.norm(traces - reference_traces) / np.linalg.norm(
+                reference_traces
+            )
+            efficiency = serial_time[assembly] / (nthreads * time)
+
+            lines.append(
+                f"{assembly:>10} {nthreads:>8} {number_of_colors(log_file):>7} "
+                f"{time:>10.3f} {reference_time / time:>8.2f} "
+                f"{efficiency:>11.2f} {misfit:>10.2e}"
+            )
+
+    os.makedirs(os.path.dirname(output.summary), exist_ok=True)
+    with open(output.summary, "w") as f:
+        f.write("\n".join(lines) + "\n")
@@ -0,0 +1,105 @@
+import os
+import re
+
+import numpy as np
+
+
+def solver_time(log_file):
+    """Read the time spent in the time loop from a specfem2d log file."""
+    pattern = re.compile(r"Total solver time \(time loop\) : ([0-9.eE+-]+) secs")
+    with open(log_file, "r") as f:
+        for line in f:
+            match = pattern.search(line)
+            if match:
+                return float(match.group(1))
+
+    raise RuntimeError(f"Could not find solver time in {log_file}")
+
+
+def perf_counters(perf_file):
+    """Read hardware counters written by `perf stat -x,`.
+
+    Returns an empty dictionary if perf was not available or a counter is not
+    supported on this machine.
+    """
+    counters = {}
+    with open(perf_file, "r") as f:
+        for line in f:
+            fields = line.strip().split(",")
+            if len(fields) < 3 or line.startswith("#"):
+                continue
+            try:
+                counters[fields[2]] = float(fields[0])
+            except ValueError:
+                ## <not supported> or <not counted>
+                continue
+
+    return counters
+
+
+def load_traces(run, stations, components):
+    traces = []
+    for station in stations:
+        for component in components:
+            filename = os.path.join(
+                "runs", run, "OUTPUT_FILES", "results", f"{station}AA{component}.semv"
+            )
+            traces.append(np.loadtxt(filename)[:, 1])
+
+    return np.stack(traces)
+
+
+def summarize(orderings, refinements, stations, components, output):
+    ## Reordering only changes the memory layout, so every ordering must give
+    ## the same seismograms as the database ordering
+    baseline = orderings[0]
+
+    lines = []
+    lines.append("Element ordering benchmark")
+    lines.append("--------------------------")
+    lines.append(
+        "LLC bandwidth is estimated as LLC-load-misses x 64 bytes / solver time\n"
+    )
+    lines.append(
+        f"{'ordering':>10} {'k':>6} {'nspec':>8} {'time (s)':>10} {'speedup':>8} "
+        f"{'cache miss %':>13} {'LLC misses':>12} {'LLC GB/s':>9} {'misfit':>10}"
+    )
+
+    for k in refinements:
+        reference_run = f"{baseline}_k{k}"
+        reference_time = solver_time(os.path.join("runs", reference_run, "output.log"))
+        reference_traces = load_traces(reference_run, stations, components)
+
+        for ordering in orderings:
+            run = f"{ordering}_k{k}"
+            time = solver_time(os.path.join("runs", run, "output.log"))
+            counters = perf_counters(os.path.join("runs", run, "perf.csv"))
+            traces = load_traces(run, stations, components)
+            misfit = np.linalg.norm(traces - reference_traces) / np.linalg.norm(
+                reference_traces
+            )
+
+            if "cache-misses" in counters and counters.get("cache-references", 0) > 0:
+                miss_rate = (
+                    f"{100 * counters['cache-misses'] / counters['cache-references']:>13.2f}"
+                )
+            else:
+                miss_rate = f"{'-':>13}"
+
+            if "LLC-load-misses" in counters:
+                llc_misses = f"{counters['LLC-load-misses']:>12.3e}"
+                bandwidth = f"{counters['LLC-load-misses'] * 64 / time / 1e9:>9.2f}"
+            else:
+                llc_misses = f"{'-':>12}"
+                bandwidth = f"{'-':>9}"
+
+            nspec = 12 * k * k
+            lines.append(
+                f"{ordering:>10} {k:>6} {nspec:>8} {time:>10.3f} "
+                f"{reference_time / time:>8.2f} {miss_rate} {llc_misses} "
+                f"{bandwidth} {misfit:>10.2e}"
+            )
+
+    os.makedirs(os.path.dirname(output.summary), exist_ok=True)
+    with open(output.summary, "w") as f:
+        f.write("\n".join(lines) + "\n")
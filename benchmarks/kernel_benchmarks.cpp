@@ -0,0 +1,291 @@
+#include "compute/assembly/assembly.hpp"
+#include "coupled_interface/coupled_interface.hpp"
+#include "domain/domain.hpp"
+#include "enumerations/interface.hpp"
+#include "frechet_derivatives/frechet_derivatives.hpp"
+#include "instrumentation/instrumentation.hpp"
+#include "quadrature/interface.hpp"
+#include "specfem_mpi/interface.hpp"
+#include "specfem_setup.hpp"
+#include "synthetic_mesh.hpp"
+#include "timescheme/newmark.hpp"
+#include <Kokkos_Core.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Micro-benchmarks of the kernels of the time loop on synthetic meshes
+
+namespace {
+
+struct result {
+  std::string kernel;   ///< Name of the kernel
+  std::string medium;   ///< Medium the kernel operates on
+  std::size_t dofs = 0; ///< Degrees of freedom updated by one call
+  double time = 0.0;    ///< Average time of one call in seconds
+};
+
+// Time a kernel in isolation. The first call is not timed so that
+// allocations and first-touch costs are excluded
+template <typename KernelType>
+result run(const std::string &kernel, const std::string &medium,
+           const std::size_t dofs, const int repeat, const KernelType &f) {
+  f();
+  Kokkos::fence();
+
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (int i = 0; i < repeat; ++i) {
+    f();
+  }
+  Kokkos::fence();
+  const std::chrono::duration<double> elapsed =
+      std::chrono::high_resolution_clock::now() - start;
+
+  return { kernel, medium, dofs, elapsed.count() / repeat };
+}
+
+template <specfem::element::medium_tag MediumTag, int NGLL>
+void benchmark_medium(const specfem::compute::assembly &assembly,
+                      const int nedges, const type_real dt, const int repeat,
+                      std::vector<result> &results) {
+  constexpr auto dim2 = specfem::dimension::type::dim2;
+  constexpr auto forward = specfem::wavefield::type::forward;
+  constexpr int components =
+      specfem::medium::medium<dim2, MediumTag>::components;
+  constexpr auto coupled_medium =
+      (MediumTag == specfem::element::medium_tag::elastic)
+          ? specfem::element::medium_tag::acoustic
+          : specfem::element::medium_tag::elastic;
+  using qp_type =
+      specfem::enums::element::quadrature::static_quadrature_points<NGLL>;
+
+  int nspec = 0;
+  for (int ispec = 0; ispec < assembly.mesh.nspec; ++ispec) {
+    if (assembly.properties.h_element_types(ispec) == MediumTag) {
+      nspec++;
+    }
+  }
+
+  if (nspec == 0)
+    return;
+
+  const std::string medium = specfem::instrumentation::to_string(MediumTag);
+  const std::size_t element_dofs =
+      static_cast<std::size_t>(nspec) * NGLL * NGLL * components;
+  const std::size_t global_dofs =
+      static_cast<std::size_t>(
+          assembly.fields.forward.template get_nglob<MediumTag>()) *
+      components;
+
+  specfem::domain::domain<forward, dim2, MediumTag, qp_type> domain(
+      dt, assembly, qp_type());
+
+  results.push_back(run("stiffness", medium, element_dofs, repeat, [&]() {
+    domain.compute_stiffness_interaction(0);
+  }));
+
+  results.push_back(run("mass_matrix", medium, element_dofs, repeat,
+                        [&]() { domain.compute_mass_matrix(dt); }));
+
+  results.push_back(run("divide_mass_matrix", medium, global_dofs, repeat,
+                        [&]() { domain.divide_mass_matrix(); }));
+
+  specfem::time_scheme::newmark<specfem::simulation::type::forward> newmark(
+      repeat + 1, 1, dt, 0.0);
+  newmark.link_assembly(assembly);
+
+  results.push_back(run("predictor", medium, global_dofs, repeat, [&]() {
+    newmark.apply_predictor_phase_forward(MediumTag);
+  }));
+
+  results.push_back(run("corrector", medium, global_dofs, repeat, [&]() {
+    newmark.apply_corrector_phase_forward(MediumTag);
+  }));
+
+  if (nedges > 0) {
+    specfem::coupled_interface::coupled_interface<forward, dim2, MediumTag,
+                                                  coupled_medium>
+        coupling(assembly);
+    const std::size_t coupling_dofs =
+        static_cast<std::size_t>(nedges) * NGLL * components;
+    results.push_back(run("coupling", medium, coupling_dofs, repeat,
+                          [&]() { coupling.compute_coupling(); }));
+  }
+
+  specfem::frechet_derivatives::frechet_derivatives<dim2, MediumTag, NGLL>
+      frechet(assembly);
+  results.push_back(run("frechet", medium, element_dofs, repeat,
+                        [&]() { frechet.compute(dt); }));
+
+  return;
+}
+
+template <int NGLL>
+std::vector<result>
+benchmark(const specfem::mesh::mesh &mesh,
+          const specfem::compute::element_assembly element_assembly,
+          const type_real dt, const int repeat) {
+  const specfem::quadrature::gll::gll gll(0.0, 0.0, NGLL);
+  const specfem::quadrature::quadratures quadratures(gll);
+
+  // Combined simulation with checkpointing allocates the forward, adjoint
+  // and backward wavefields, which are all needed by the Frechet kernels
+  const specfem::compute::assembly assembly(
+      mesh, quadratures, {}, {}, {}, 0.0, dt, repeat + 1, 0,
+      specfem::simulation::type::combined, true, false,
+      specfem::compute::element_ordering::none, element_assembly);
+
+  const int nedges = mesh.coupled_interfaces.elastic_acoustic.num_interfaces;
+
+  std::vector<result> results;
+  benchmark_medium<specfem::element::medium_tag::elastic, NGLL>(
+      assembly, nedges, dt, repeat, results);
+  benchmark_medium<specfem::element::medium_tag::acoustic, NGLL>(
+      assembly, nedges, dt, repeat, results);
+  return results;
+}
+
+void print(std::ostream &out, const std::vector<result> &results) {
+  out << std::left << std::setw(22) << "Kernel" << std::setw(12) << "Medium"
+      << std::right << std::setw(14) << "DOFs" << std::setw(14)
+      << "Time (ms)" << std::setw(17) << "DOF-updates/s"
+      << "\n";
+
+  for (const auto &result : results) {
+    out << std::left << std::setw(22) << result.kernel << std::setw(12)
+        << result.medium << std::right << std::setw(14) << result.dofs
+        << std::setw(14) << std::fixed << std::setprecision(4)
+        << 1e3 * result.time << std::setw(17) << std::scientific
+        << std::setprecision(3)
+        << ((result.time > 0.0) ? result.dofs / result.time : 0.0) << "\n";
+    out << std::defaultfloat;
+  }
+}
+
+boost::program_options::options_description define_args() {
+  namespace po = boost::program_options;
+
+  po::options_description desc{ "======================================\n"
+                                "--------SPECFEM kernel benchmarks-----\n"
+                                "======================================" };
+
+  desc.add_options()("help,h", "Print this help message")(
+      "nx", po::value<int>()->default_value(100),
+      "Number of elements along x")(
+      "nz", po::value<int>()->default_value(100),
+      "Number of elements along z")(
+      "acoustic-fraction", po::value<type_real>()->default_value(0.5),
+      "Fraction of element rows that are acoustic")(
+      "distortion", po::value<type_real>()->default_value(0.0),
+      "Maximum displacement of interior control nodes as a fraction of the "
+      "element size. Distorted elements are not affine")(
+      "ngll", po::value<int>()->default_value(5),
+      "Number of GLL points per dimension (4 to 8)")(
+      "repeat", po::value<int>()->default_value(100),
+      "Number of timed calls of every kernel")(
+      "element-assembly", po::value<std::string>()->default_value("atomic"),
+      "Element assembly strategy (atomic or coloring)");
+
+  return desc;
+}
+
+void execute(const boost::program_options::variables_map &vm) {
+  specfem::benchmarks::synthetic_mesh_parameters parameters;
+  parameters.nx = vm["nx"].as<int>();
+  parameters.nz = vm["nz"].as<int>();
+  parameters.acoustic_fraction = vm["acoustic-fraction"].as<type_real>();
+  parameters.distortion = vm["distortion"].as<type_real>();
+
+  const int ngll = vm["ngll"].as<int>();
+  const int repeat = vm["repeat"].as<int>();
+
+  const std::string assembly_name = vm["element-assembly"].as<std::string>();
+  specfem::compute::element_assembly element_assembly;
+  if (assembly_name == "atomic") {
+    element_assembly = specfem::compute::element_assembly::atomic;
+  } else if (assembly_name == "coloring") {
+    element_assembly = specfem::compute::element_assembly::coloring;
+  } else {
+    std::ostringstream message;
+    message << "Unknown element assembly : " << assembly_name
+            << ". Supported values are atomic and coloring.";
+    throw std::runtime_error(message.str());
+  }
+
+  if (repeat < 1) {
+    throw std::runtime_error("Number of repetitions needs to be positive");
+  }
+
+  // Kernels are timed by the harness. Avoid fencing every phase twice
+  specfem::instrumentation::registry::get().enable(false);
+
+  const auto mesh = specfem::benchmarks::synthetic_mesh(parameters);
+  const type_real dt = 1e-3;
+
+  std::vector<result> results;
+  switch (ngll) {
+  case 4:
+    results = benchmark<4>(mesh, element_assembly, dt, repeat);
+    break;
+  case 5:
+    results = benchmark<5>(mesh, element_assembly, dt, repeat);
+    break;
+  case 6:
+    results = benchmark<6>(mesh, element_assembly, dt, repeat);
+    break;
+  case 7:
+    results = benchmark<7>(mesh, element_assembly, dt, repeat);
+    break;
+  case 8:
+    results = benchmark<8>(mesh, element_assembly, dt, repeat);
+    break;
+  default:
+    std::ostringstream message;
+    message << "Unsupported number of GLL points : " << ngll
+            << ". Supported values are 4 to 8.";
+    throw std::runtime_error(message.str());
+  }
+
+  std::cout << "Synthetic mesh : " << parameters.nx << " x " << parameters.nz
+            << " elements, " << parameters.acoustic_fraction
+            << " acoustic, distortion " << parameters.distortion << "\n"
+            << "NGLL : " << ngll << ", element assembly : " << assembly_name
+            << ", " << repeat << " calls per kernel\n"
+            << "Execution space : "
+            << Kokkos::DefaultExecutionSpace::name() << "\n\n";
+
+  print(std::cout, results);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+
+  // Initialize MPI
+  specfem::MPI::MPI *mpi = new specfem::MPI::MPI(&argc, &argv);
+  // Initialize Kokkos
+  Kokkos::initialize(argc, argv);
+  {
+    const auto desc = define_args();
+    boost::program_options::variables_map vm;
+    boost::program_options::store(
+        boost::program_options::parse_command_line(argc, argv, desc), vm);
+
+    if (vm.count("help")) {
+      std::cout << desc << std::endl;
+    } else {
+      execute(vm);
+    }
+  }
+  // Finalize Kokkos
+  Kokkos::finalize();
+  // Finalize MPI
+  delete mpi;
+  return 0;
+}
@@ -0,0 +1,256 @@
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/interface.hpp"
+#include "instrumentation/instrumentation.hpp"
+#include "kernels/kernels.hpp"
+#include "quadrature/interface.hpp"
+#include "receiver/interface.hpp"
+#include "solver/time_marching.hpp"
+#include "source/interface.hpp"
+#include "specfem_mpi/interface.hpp"
+#include "specfem_setup.hpp"
+#include "synthetic_mesh.hpp"
+#include "timescheme/newmark.hpp"
+#include "yaml-cpp/yaml.h"
+#include <Kokkos_Core.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+// Strong scaling of the time loop on a synthetic mesh split into vertical
+// strips, one per MPI rank
+
+namespace {
+
+constexpr int ngll = 5;
+using qp_type = specfem::enums::element::quadrature::static_quadrature_points<
+    ngll>;
+
+struct result {
+  double time = 0.0; ///< Time spent in the time loop on the slowest rank
+  std::vector<type_real> seismogram; ///< Displacement at the receiver. Only
+                                     ///< filled on the rank owning it
+};
+
+// Run a forward simulation with a force source and a receiver in the elastic
+// part of the mesh. With the default mesh size and 4 ranks they are located
+// in different strips
+result simulate(const specfem::mesh::mesh &mesh,
+                const specfem::benchmarks::synthetic_mesh_parameters &geometry,
+                const int nsteps, const type_real dt,
+                const specfem::MPI::MPI *mpi) {
+  const specfem::quadrature::gll::gll gll(0.0, 0.0, ngll);
+  const specfem::quadrature::quadratures quadratures(gll);
+
+  const type_real width = geometry.nx * geometry.element_size;
+  const type_real height = geometry.nz * geometry.element_size;
+
+  YAML::Node node;
+  node["x"] = 0.45 * width;
+  node["z"] = 0.25 * height;
+  node["Ricker"]["f0"] = 5.0;
+  node["Ricker"]["factor"] = 1e10;
+  const auto source = std::make_shared<specfem::sources::force>(
+      node, nsteps, dt, specfem::wavefield::type::forward);
+  const type_real t0 = source->get_t0();
+
+  const std::vector<std::shared_ptr<specfem::sources::source> > sources = {
+    source
+  };
+  const std::vector<std::shared_ptr<specfem::receivers::receiver> >
+      receivers = { std::make_shared<specfem::receivers::receiver>(
+          "SY", "S0001", 0.55 * width, 0.25 * height, 0.0) };
+
+  const auto time_scheme = std::make_shared<
+      specfem::time_scheme::newmark<specfem::simulation::type::forward> >(
+      nsteps, 1, dt, t0);
+
+  specfem::compute::assembly assembly(
+      mesh, quadratures, sources, receivers,
+      { specfem::enums::seismogram::type::displacement }, t0, dt, nsteps,
+      time_scheme->get_max_seismogram_step(),
+      specfem::simulation::type::forward);
+  time_scheme->link_assembly(assembly);
+
+  const specfem::kernels::kernels<specfem::wavefield::type::forward,
+                                  specfem::dimension::type::dim2, qp_type>
+      kernels(dt, assembly, qp_type());
+  specfem::solver::time_marching<specfem::simulation::type::forward,
+                                 specfem::dimension::type::dim2, qp_type>
+      solver(kernels, time_scheme);
+
+  Kokkos::fence();
+  mpi->sync_all();
+  const auto start = std::chrono::high_resolution_clock::now();
+  solver.run();
+  Kokkos::fence();
+  const std::chrono::duration<double> elapsed =
+      std::chrono::high_resolution_clock::now() - start;
+
+  result output;
+  output.time = mpi->all_reduce(elapsed.count(), specfem::MPI::max);
+
+  if (assembly.receivers.nreceivers > 0) {
+    assembly.receivers.sync_seismograms();
+    const auto h_seismogram = assembly.receivers.h_seismogram;
+    for (int istep = 0; istep < h_seismogram.extent(0); ++istep) {
+      for (int icomp = 0; icomp < h_seismogram.extent(3); ++icomp) {
+        output.seismogram.push_back(h_seismogram(istep, 0, 0, icomp));
+      }
+    }
+  }
+
+  return output;
+}
+
+// Gather a seismogram recorded on a single rank on every rank
+std::vector<type_real> share(const std::vector<type_real> &seismogram,
+                             const int size, const specfem::MPI::MPI *mpi) {
+  std::vector<type_real> shared(size);
+  const bool owner = !seismogram.empty();
+  for (int i = 0; i < size; ++i) {
+    shared[i] = mpi->all_reduce(owner ? seismogram[i] : type_real(0.0),
+                                specfem::MPI::sum);
+  }
+  return shared;
+}
+
+boost::program_options::options_description define_args() {
+  namespace po = boost::program_options;
+
+  po::options_description desc{ "======================================\n"
+                                "------SPECFEM MPI strong scaling------\n"
+                                "======================================" };
+
+  desc.add_options()("help,h", "Print this help message")(
+      "nx", po::value<int>()->default_value(64),
+      "Number of elements along x")(
+      "nz", po::value<int>()->default_value(64),
+      "Number of elements along z")(
+      "acoustic-fraction", po::value<type_real>()->default_value(0.25),
+      "Fraction of element rows that are acoustic")(
+      "nsteps", po::value<int>()->default_value(800),
+      "Number of time steps")(
+      "check", "Compare the seismogram with a run of the unpartitioned mesh "
+               "on every rank");
+
+  return desc;
+}
+
+int execute(const boost::program_options::variables_map &vm,
+            const specfem::MPI::MPI *mpi) {
+  specfem::benchmarks::synthetic_mesh_parameters parameters;
+  parameters.nx = vm["nx"].as<int>();
+  parameters.nz = vm["nz"].as<int>();
+  parameters.acoustic_fraction = vm["acoustic-fraction"].as<type_real>();
+  parameters.nproc = mpi->get_size();
+  parameters.rank = mpi->get_rank();
+  parameters.mpi = mpi;
+
+  const int nsteps = vm["nsteps"].as<int>();
+  if (nsteps < 1) {
+    throw std::runtime_error("Number of time steps needs to be positive");
+  }
+
+  // Stable time step for 5 GLL points and the wave speeds of the synthetic
+  // mesh
+  const type_real dt = 1e-5 * parameters.element_size;
+
+  specfem::instrumentation::registry::get().enable(false);
+
+  const auto mesh = specfem::benchmarks::synthetic_mesh(parameters);
+  const auto partitioned = simulate(mesh, parameters, nsteps, dt, mpi);
+
+  const int nspec = parameters.nx * parameters.nz;
+  const double dofs = static_cast<double>(nspec) * ngll * ngll * nsteps;
+  const int max_nspec = mpi->all_reduce(mesh.nspec, specfem::MPI::max);
+
+  std::ostringstream message;
+  message << "Synthetic mesh : " << parameters.nx << " x " << parameters.nz
+          << " elements, " << parameters.acoustic_fraction << " acoustic\n"
+          << "MPI ranks : " << mpi->get_size()
+          << ", largest partition : " << max_nspec << " elements\n"
+          << "Execution space : " << Kokkos::DefaultExecutionSpace::name()
+          << "\n"
+          << "Time steps : " << nsteps << "\n"
+          << "Time loop : " << std::fixed << std::setprecision(4)
+          << partitioned.time << " s, " << std::scientific
+          << std::setprecision(3) << 1e3 * partitioned.time / nsteps
+          << " ms per step, " << dofs / partitioned.time
+          << " GLL point-updates/s\n";
+  mpi->cout(message.str());
+
+  if (!vm.count("check"))
+    return 0;
+
+  // Every rank runs the unpartitioned mesh. Sources and receivers of the
+  // reference are owned by the main rank
+  specfem::benchmarks::synthetic_mesh_parameters unpartitioned = parameters;
+  unpartitioned.nproc = 1;
+  unpartitioned.rank = 0;
+  const auto reference = simulate(
+      specfem::benchmarks::synthetic_mesh(unpartitioned), unpartitioned,
+      nsteps, dt, mpi);
+
+  const int size = mpi->all_reduce(
+      static_cast<int>(reference.seismogram.size()), specfem::MPI::max);
+  const auto expected = share(reference.seismogram, size, mpi);
+  const auto computed = share(partitioned.seismogram, size, mpi);
+
+  double error = 0.0;
+  double norm = 0.0;
+  for (int i = 0; i < size; ++i) {
+    error += (computed[i] - expected[i]) * (computed[i] - expected[i]);
+    norm += expected[i] * expected[i];
+  }
+  const double relative_error =
+      (norm > 0.0) ? std::sqrt(error / norm) : std::sqrt(error);
+
+  std::ostringstream check;
+  check << "Relative L2 error of the seismogram : " << std::scientific
+        << relative_error;
+  mpi->cout(check.str());
+
+  // Partitions only change the order in which contributions are summed
+  constexpr double tolerance = 1e-4;
+  if (norm == 0.0 || relative_error > tolerance) {
+    mpi->cout("Partitioned and unpartitioned seismograms differ");
+    return 1;
+  }
+
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+
+  // Initialize MPI
+  specfem::MPI::MPI *mpi = new specfem::MPI::MPI(&argc, &argv);
+  // Initialize Kokkos
+  Kokkos::initialize(argc, argv);
+  int status = 0;
+  {
+    const auto desc = define_args();
+    boost::program_options::variables_map vm;
+    boost::program_options::store(
+        boost::program_options::parse_command_line(argc, argv, desc), vm);
+
+    if (vm.count("help")) {
+      if (mpi->main_proc())
+        std::cout << desc << std::endl;
+    } else {
+      status = execute(vm, mpi);
+    }
+  }
+  // Finalize Kokkos
+  Kokkos::finalize();
+  // Finalize MPI
+  delete mpi;
+  return status;
+}
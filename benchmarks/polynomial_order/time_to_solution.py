@@ -0,0 +1,110 @@
+import os
+import re
+
+import numpy as np
+
+
+def solver_time(log_file):
+    """Read the time spent in the time loop from a specfem2d log file."""
+    pattern = re.compile(r"Total solver time \(time loop\) : ([0-9.eE+-]+) secs")
+    with open(log_file, "r") as f:
+        for line in f:
+            match = pattern.search(line)
+            if match:
+                return float(match.group(1))
+
+    raise RuntimeError(f"Could not find solver time in {log_file}")
+
+
+def load_traces(run, stations, components):
+    traces = []
+    for station in stations:
+        for component in components:
+            filename = os.path.join(
+                "runs", run, "OUTPUT_FILES", "results", f"{station}AA{component}.semv"
+            )
+            traces.append(np.loadtxt(filename)[:, 1])
+
+    return np.stack(traces)
+
+
+def relative_misfit(traces, reference):
+    return np.linalg.norm(traces - reference) / np.linalg.norm(reference)
+
+
+def time_at_misfit(misfits, times, target):
+    """Interpolate the time-to-solution at a target misfit in log-log space.
+
+    Returns None if the target misfit is not bracketed by the runs.
+    """
+    order = np.argsort(misfits)
+    log_misfits = np.log(np.asarray(misfits)[order])
+    log_times = np.log(np.asarray(times)[order])
+    log_target = np.log(target)
+
+    if log_target < log_misfits[0] or log_target > log_misfits[-1]:
+        return None
+
+    return float(np.exp(np.interp(log_target, log_misfits, log_times)))
+
+
+def summarize(ngll_values, refinements, reference, stations, components, output):
+    import matplotlib
+
+    matplotlib.use("Agg")
+    import matplotlib.pyplot as plt
+
+    reference_traces = load_traces(reference, stations, components)
+
+    results = {}
+    for ngll in ngll_values:
+        results[ngll] = []
+        for k in refinements:
+            run = f"ngll{ngll}_k{k}"
+            time = solver_time(os.path.join("runs", run, "output.log"))
+            misfit = relative_misfit(
+                load_traces(run, stations, components), reference_traces
+            )
+            results[ngll].append((k, time, misfit))
+
+    ## Compare the orders at a few accuracy levels
+    targets = [1e-1, 1e-2, 1e-3]
+
+    lines = []
+    lines.append("Time-to-solution vs polynomial order")
+    lines.append("------------------------------------")
+    lines.append(f"Reference solution : {reference}\n")
+    lines.append(f"{'NGLL':>6} {'k':>6} {'nspec':>8} {'time (s)':>12} {'misfit':>12}")
+    for ngll, runs in results.items():
+        for k, time, misfit in runs:
+            nspec = 12 * k * k
+            lines.append(f"{ngll:>6} {k:>6} {nspec:>8} {time:>12.4f} {misfit:>12.4e}")
+
+    lines.append("")
+    lines.append("Interpolated time-to-solution (s) at equal accuracy")
+    lines.append(f"{'NGLL':>6} " + " ".join(f"{t:>12.0e}" for t in targets))
+    for ngll, runs in results.items():
+        times = [time for _, time, _ in runs]
+        misfits = [misfit for _, _, misfit in runs]
+        row = []
+        for target in targets:
+            time = time_at_misfit(misfits, times, target)
+            row.append(f"{time:>12.4f}" if time is not None else f"{'-':>12}")
+        lines.append(f"{ngll:>6} " + " ".join(row))
+
+    os.makedirs(os.path.dirname(output.summary), exist_ok=True)
+    with open(output.summary, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+    fig, ax = plt.subplots(figsize=(6, 5))
+    for ngll, runs in results.items():
+        times = [time for _, time, _ in runs]
+        misfits = [misfit for _, _, misfit in runs]
+        ax.loglog(times, misfits, "o-", label=f"NGLL = {ngll}")
+
+    ax.set_xlabel("Solver time (s)")
+    ax.set_ylabel("Relative L2 misfit")
+    ax.grid(True, which="both", alpha=0.3)
+    ax.legend()
+    fig.tight_layout()
+    fig.savefig(output.plot)
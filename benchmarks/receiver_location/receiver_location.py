@@ -0,0 +1,79 @@
+import os
+import re
+
+import numpy as np
+
+## Extent of the model of the polynomial order benchmark, with a margin so
+## that every receiver lies inside the mesh
+XMIN, XMAX = 100.0, 3900.0
+ZMIN, ZMAX = 100.0, 2900.0
+
+
+def write_stations(filename, nreceivers):
+    """Write a STATIONS file with receivers on a regular grid."""
+    nx = int(np.ceil(np.sqrt(nreceivers * (XMAX - XMIN) / (ZMAX - ZMIN))))
+    nz = int(np.ceil(nreceivers / nx))
+    x, z = np.meshgrid(np.linspace(XMIN, XMAX, nx), np.linspace(ZMIN, ZMAX, nz))
+
+    os.makedirs(os.path.dirname(filename), exist_ok=True)
+    with open(filename, "w") as f:
+        for irec, (xr, zr) in enumerate(zip(x.ravel(), z.ravel())):
+            if irec == nreceivers:
+                break
+            f.write(f"S{irec + 1:05d}    AA    {xr:.7f}    {zr:.7f}    0.0    0.0\n")
+
+
+def read_time(log_file, name):
+    """Read a time reported at the end of a specfem2d log file."""
+    pattern = re.compile(re.escape(name) + r" : ([0-9.eE+-]+) secs")
+    with open(log_file, "r") as f:
+        for line in f:
+            match = pattern.search(line)
+            if match:
+                return float(match.group(1))
+
+    raise RuntimeError(f"Could not find {name} in {log_file}")
+
+
+def summarize(nreceivers, refinements, output):
+    ## The setup of the run with the fewest receivers is used as the baseline
+    ## to isolate the time spent locating receivers
+    baseline = min(nreceivers)
+
+    lines = []
+    lines.append("Receiver location benchmark")
+    lines.append("---------------------------")
+    lines.append(
+        "Receiver time is the setup time in excess of the run with "
+        f"{baseline} receivers\n"
+    )
+    lines.append(
+        f"{'k':>6} {'nspec':>8} {'nrec':>8} {'setup (s)':>10} "
+        f"{'receivers (s)':>14} {'us/receiver':>12}"
+    )
+
+    for k in refinements:
+        reference = read_time(
+            os.path.join("runs", f"nrec{baseline}_k{k}", "output.log"),
+            "Total setup time (before time loop)",
+        )
+        for nrec in nreceivers:
+            setup = read_time(
+                os.path.join("runs", f"nrec{nrec}_k{k}", "output.log"),
+                "Total setup time (before time loop)",
+            )
+            receivers = max(setup - reference, 0.0)
+            per_receiver = (
+                f"{1e6 * receivers / (nrec - baseline):>12.2f}"
+                if nrec > baseline
+                else f"{'-':>12}"
+            )
+            nspec = 12 * k * k
+            lines.append(
+                f"{k:>6} {nspec:>8} {nrec:>8} {setup:>10.3f} "
+                f"{receivers:>14.3f} {per_receiver}"
+            )
+
+    os.makedirs(os.path.dirname(output.summary), exist_ok=True)
+    with open(output.summary, "w") as f:
+        f.write("\n".join(lines) + "\n")
@@ -0,0 +1,192 @@
+#include "synthetic_mesh.hpp"
+#include "enumerations/medium.hpp"
+#include "material/material.hpp"
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+specfem::mesh::mesh specfem::benchmarks::synthetic_mesh(
+    const specfem::benchmarks::synthetic_mesh_parameters &parameters) {
+
+  const int nx = parameters.nx;
+  const int nz = parameters.nz;
+
+  if (nx < 1 || nz < 1) {
+    std::ostringstream message;
+    message << "Invalid synthetic mesh size : " << nx << " x " << nz;
+    throw std::runtime_error(message.str());
+  }
+
+  if (parameters.nproc < 1 || parameters.nproc > nx ||
+      parameters.rank < 0 || parameters.rank >= parameters.nproc) {
+    std::ostringstream message;
+    message << "Invalid synthetic mesh partition : rank " << parameters.rank
+            << " of " << parameters.nproc << " for " << nx << " columns";
+    throw std::runtime_error(message.str());
+  }
+
+  if (parameters.acoustic_fraction < 0.0 ||
+      parameters.acoustic_fraction > 1.0) {
+    std::ostringstream message;
+    message << "Invalid acoustic fraction : " << parameters.acoustic_fraction
+            << ". Needs to be within [0, 1]";
+    throw std::runtime_error(message.str());
+  }
+
+  // Bottom rows are elastic, top rows are acoustic
+  const int nz_acoustic = static_cast<int>(
+      std::round(parameters.acoustic_fraction * static_cast<type_real>(nz)));
+  const int nz_elastic = nz - nz_acoustic;
+
+  // Columns of elements within the strip of this rank
+  const int ix_begin = (parameters.rank * nx) / parameters.nproc;
+  const int ix_end = ((parameters.rank + 1) * nx) / parameters.nproc;
+  const int nx_local = ix_end - ix_begin;
+
+  constexpr int ndim = 2;
+  constexpr int ngnod = 4;
+  const int nspec = nx_local * nz;
+  const int npgeo = (nx_local + 1) * (nz + 1);
+
+  specfem::mesh::mesh mesh;
+  mesh.nspec = nspec;
+  mesh.npgeo = npgeo;
+  mesh.nproc = parameters.nproc;
+  mesh.mpi = parameters.mpi;
+  mesh.control_nodes =
+      specfem::mesh::control_nodes(ndim, nspec, ngnod, npgeo);
+
+  // Control nodes on a regular grid. Interior nodes are optionally displaced
+  // to generate non-affine elements. Displacements are drawn for the whole
+  // mesh so that nodes shared between strips are displaced identically
+  std::mt19937 generator(parameters.seed);
+  std::uniform_real_distribution<type_real> displacement(
+      -parameters.distortion * parameters.element_size,
+      parameters.distortion * parameters.element_size);
+
+  const auto node_index = [nx_local](const int ix, const int iz) {
+    return iz * (nx_local + 1) + ix;
+  };
+
+  for (int iz = 0; iz <= nz; ++iz) {
+    for (int ix = 0; ix <= nx; ++ix) {
+      type_real x = ix * parameters.element_size;
+      type_real z = iz * parameters.element_size;
+      const bool interior = (ix > 0 && ix < nx && iz > 0 && iz < nz);
+      if (interior && parameters.distortion > 0.0) {
+        x += displacement(generator);
+        z += displacement(generator);
+      }
+      if (ix >= ix_begin && ix <= ix_end) {
+        const int inode = node_index(ix - ix_begin, iz);
+        mesh.control_nodes.coord(0, inode) = x;
+        mesh.control_nodes.coord(1, inode) = z;
+      }
+    }
+  }
+
+  // Counter-clockwise control nodes starting from the bottom left corner
+  for (int iz = 0; iz < nz; ++iz) {
+    for (int ix = 0; ix < nx_local; ++ix) {
+      const int ispec = iz * nx_local + ix;
+      mesh.control_nodes.knods(0, ispec) = node_index(ix, iz);
+      mesh.control_nodes.knods(1, ispec) = node_index(ix + 1, iz);
+      mesh.control_nodes.knods(2, ispec) = node_index(ix + 1, iz + 1);
+      mesh.control_nodes.knods(3, ispec) = node_index(ix, iz + 1);
+    }
+  }
+
+  mesh.parameters.ngnod = ngnod;
+  mesh.parameters.nspec = nspec;
+
+  // One elastic and one acoustic material
+  using elastic_material =
+      specfem::material::material<specfem::element::medium_tag::elastic,
+                                  specfem::element::property_tag::isotropic>;
+  using acoustic_material =
+      specfem::material::material<specfem::element::medium_tag::acoustic,
+                                  specfem::element::property_tag::isotropic>;
+
+  const std::vector<elastic_material> l_elastic = { elastic_material(
+      2700.0, 1732.051, 3000.0, 9999.0, 9999.0, 0.0) };
+  const std::vector<acoustic_material> l_acoustic = { acoustic_material(
+      1020.0, 1500.0, 9999.0, 9999.0, 0.0) };
+
+  mesh.materials.n_materials = 2;
+  mesh.materials.elastic_isotropic = { 1, l_elastic };
+  mesh.materials.acoustic_isotropic = { 1, l_acoustic };
+  mesh.materials.material_index_mapping = specfem::kokkos::HostView1d<
+      specfem::mesh::materials::material_specification>(
+      "specfem::benchmarks::synthetic_mesh::material_index_mapping", nspec);
+
+  for (int iz = 0; iz < nz; ++iz) {
+    const auto medium = (iz < nz_elastic)
+                            ? specfem::element::medium_tag::elastic
+                            : specfem::element::medium_tag::acoustic;
+    for (int ix = 0; ix < nx_local; ++ix) {
+      mesh.materials.material_index_mapping(iz * nx_local + ix) = {
+        medium, specfem::element::property_tag::isotropic, 0
+      };
+    }
+  }
+
+  mesh.boundaries =
+      specfem::mesh::boundaries(specfem::mesh::absorbing_boundary(0),
+                                specfem::mesh::acoustic_free_surface(0));
+
+  // Fluid-solid edges between the top elastic and bottom acoustic rows
+  auto &elastic_acoustic = mesh.coupled_interfaces.elastic_acoustic;
+  if (nz_elastic > 0 && nz_acoustic > 0) {
+    using IndexViewType = Kokkos::View<int *, Kokkos::HostSpace>;
+    elastic_acoustic.num_interfaces = nx_local;
+    elastic_acoustic.medium1_index_mapping = IndexViewType(
+        "specfem::benchmarks::synthetic_mesh::elastic_index_mapping",
+        nx_local);
+    elastic_acoustic.medium2_index_mapping = IndexViewType(
+        "specfem::benchmarks::synthetic_mesh::acoustic_index_mapping",
+        nx_local);
+    for (int ix = 0; ix < nx_local; ++ix) {
+      elastic_acoustic.medium1_index_mapping(ix) =
+          (nz_elastic - 1) * nx_local + ix;
+      elastic_acoustic.medium2_index_mapping(ix) = nz_elastic * nx_local + ix;
+    }
+  }
+
+  // Every element of the first and last column shares an edge with the
+  // strips on the left and right
+  const bool has_left = (parameters.rank > 0);
+  const bool has_right = (parameters.rank < parameters.nproc - 1);
+  mesh.mpi_interfaces = specfem::mesh::interfaces::interface(
+      static_cast<int>(has_left) + static_cast<int>(has_right), nz);
+
+  int iinterface = 0;
+  for (const bool left : { true, false }) {
+    if ((left && !has_left) || (!left && !has_right))
+      continue;
+
+    const int ix = left ? 0 : nx_local - 1;
+    // Control nodes of the left or right edge
+    const int node1 = left ? 0 : 1;
+    const int node2 = left ? 3 : 2;
+
+    mesh.mpi_interfaces.my_neighbors(iinterface) =
+        parameters.rank + (left ? -1 : 1);
+    mesh.mpi_interfaces.my_nelmnts_neighbors(iinterface) = nz;
+    for (int iz = 0; iz < nz; ++iz) {
+      const int ispec = iz * nx_local + ix;
+      mesh.mpi_interfaces.my_interfaces(iinterface, iz, 0) = ispec;
+      mesh.mpi_interfaces.my_interfaces(iinterface, iz, 1) = 2;
+      mesh.mpi_interfaces.my_interfaces(iinterface, iz, 2) =
+          mesh.control_nodes.knods(node1, ispec);
+      mesh.mpi_interfaces.my_interfaces(iinterface, iz, 3) =
+          mesh.control_nodes.knods(node2, ispec);
+    }
+    iinterface++;
+  }
+
+  mesh.tags = specfem::mesh::tags(mesh.materials, mesh.boundaries);
+
+  return mesh;
+}
@@ -0,0 +1,53 @@
+#ifndef _SPECFEM_BENCHMARKS_SYNTHETIC_MESH_HPP
+#define _SPECFEM_BENCHMARKS_SYNTHETIC_MESH_HPP
+
+#include "mesh/mesh.hpp"
+#include "specfem_mpi/interface.hpp"
+#include "specfem_setup.hpp"
+
+namespace specfem {
+namespace benchmarks {
+
+/**
+ * @brief Parameters of a synthetic structured mesh
+ *
+ * The mesh is a rectangle of nx by nz square elements. The bottom rows of
+ * elements are elastic and the top rows are acoustic, with a fluid-solid
+ * interface between them.
+ *
+ * The mesh can be split into vertical strips of columns, one per MPI rank.
+ * Every rank then only builds its own strip, along with the MPI interfaces
+ * to the strips on its left and right.
+ */
+struct synthetic_mesh_parameters {
+  int nx = 100;                      ///< Number of elements along x
+  int nz = 100;                      ///< Number of elements along z
+  type_real acoustic_fraction = 0.5; ///< Fraction of rows that are acoustic
+  type_real element_size = 100.0;    ///< Edge length of an element in meters
+  type_real distortion = 0.0; ///< Maximum displacement of interior control
+                              ///< nodes as a fraction of the element size.
+                              ///< Distorted elements are not affine
+  unsigned int seed = 0;      ///< Seed used to distort the control nodes
+  int nproc = 1;              ///< Number of strips the mesh is split into
+  int rank = 0;               ///< Strip built by this rank
+  const specfem::MPI::MPI *mpi = nullptr; ///< MPI object of the ranks
+                                          ///< sharing the mesh. Required if
+                                          ///< nproc > 1
+};
+
+/**
+ * @brief Build a synthetic structured mesh
+ *
+ * The mesh has no absorbing boundaries or acoustic free surface, so that only
+ * the stiffness, coupling and update kernels are exercised.
+ *
+ * @param parameters Size, medium mix and partitioning of the mesh
+ * @return specfem::mesh::mesh Mesh of the strip of this rank
+ */
+specfem::mesh::mesh
+synthetic_mesh(const synthetic_mesh_parameters &parameters);
+
+} // namespace benchmarks
+} // namespace specfem
+
+#endif /* _SPECFEM_BENCHMARKS_SYNTHETIC_MESH_HPP */
@@ -0,0 +1,31 @@
+#ifndef SPECFEM_IO_HDF5_IMPL_MUTEX_HPP
+#define SPECFEM_IO_HDF5_IMPL_MUTEX_HPP
+
+#include <mutex>
+
+namespace specfem {
+namespace IO {
+namespace impl {
+namespace HDF5 {
+
+/**
+ * @brief Process-wide mutex serializing calls to the HDF5 library
+ *
+ * HDF5 builds without thread-safety do not allow concurrent calls into the
+ * library, even on different files. Every HDF5 call made from a background
+ * thread, and every HDF5 call made while such a thread may be running
+ * (including destructors of HDF5 objects), has to hold this mutex.
+ *
+ * @return std::mutex& Mutex shared by every translation unit
+ */
+inline std::mutex &mutex() {
+  static std::mutex instance;
+  return instance;
+}
+
+} // namespace HDF5
+} // namespace impl
+} // namespace IO
+} // namespace specfem
+
+#endif
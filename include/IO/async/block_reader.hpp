@@ -0,0 +1,105 @@
+#ifndef _SPECFEM_IO_ASYNC_BLOCK_READER_HPP
+#define _SPECFEM_IO_ASYNC_BLOCK_READER_HPP
+
+#include "block_writer.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace specfem {
+namespace IO {
+
+/**
+ * @brief Prefetch fixed size blocks from a binary file in a background thread
+ *
+ * Blocks are read in a fixed order given at construction (e.g. reverse order
+ * during time reversal). While the caller consumes one block, the I/O thread
+ * fills the remaining buffers with the following blocks. With the default of
+ * two buffers, reading the next block overlaps with processing the current
+ * one (double buffering).
+ *
+ * Files are expected to be written by @ref async_block_writer.
+ */
+class async_block_reader {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Open the file and start prefetching blocks
+   *
+   * @param filename Path to the input file
+   * @param block_size Expected size of a block in bytes
+   * @param order Indices of the blocks in the order they will be consumed
+   * @param nbuffers Number of host buffers (at least 2)
+   */
+  async_block_reader(const std::string &filename, const std::size_t block_size,
+                     const std::vector<int> &order, const int nbuffers = 2);
+  ///@}
+
+  /**
+   * @brief Stop the I/O thread and close the file
+   *
+   */
+  ~async_block_reader();
+
+  async_block_reader(const async_block_reader &) = delete;
+  async_block_reader &operator=(const async_block_reader &) = delete;
+
+  /**
+   * @brief Get the next block in the prefetch order
+   *
+   * Waits until the block has been read. The buffer returned by the previous
+   * call is handed back to the I/O thread and must no longer be accessed.
+   *
+   * @return const char* Host buffer containing the block
+   */
+  const char *next();
+
+  /**
+   * @brief Get the size of a block in bytes
+   *
+   */
+  std::size_t get_block_size() const { return block_size; }
+
+  /**
+   * @brief Get the number of blocks stored in the file
+   *
+   */
+  int get_nblocks() const { return nblocks; }
+
+private:
+  void run();
+  void stop();
+
+  std::string filename;      ///< Path to the input file
+  std::size_t block_size;    ///< Size of a block in bytes
+  int nblocks = 0;           ///< Number of blocks in the file
+  std::vector<int> order;    ///< Order in which blocks are consumed
+  std::FILE *file = nullptr; ///< Input file
+
+  std::vector<std::vector<char> > buffers; ///< Host buffers
+  std::deque<int> free_buffers;            ///< Buffers available for reading
+  std::deque<int> ready;                   ///< Buffers holding the next blocks
+  int current = -1;                        ///< Buffer held by the caller
+  std::size_t consumed = 0;                ///< Number of blocks consumed
+
+  std::mutex mutex;                  ///< Protects the buffer queues
+  std::condition_variable condition; ///< Signals changes to the queues
+  bool stopping = false;             ///< Stop prefetching
+  std::exception_ptr error;          ///< First error raised by the I/O thread
+  std::thread thread;                ///< I/O thread
+};
+
+} // namespace IO
+} // namespace specfem
+
+#endif
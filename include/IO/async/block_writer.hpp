@@ -0,0 +1,128 @@
+#ifndef _SPECFEM_IO_ASYNC_BLOCK_WRITER_HPP
+#define _SPECFEM_IO_ASYNC_BLOCK_WRITER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace specfem {
+namespace IO {
+
+/**
+ * @brief Header of files written by @ref async_block_writer
+ *
+ */
+struct async_block_header {
+  char magic[8];            ///< File signature
+  std::uint64_t block_size; ///< Size of a block in bytes
+  std::uint64_t nblocks;    ///< Number of blocks
+
+  constexpr static char signature[8] = { 'S', 'P', 'F', 'M', 'B', 'L', 'K',
+                                         '1' }; ///< Expected file signature
+};
+
+/**
+ * @brief Write fixed size blocks to a binary file from a background thread
+ *
+ * The caller fills a host buffer obtained from @ref acquire and hands it over
+ * with @ref submit. Buffers are written to disk by a background thread while
+ * the caller continues. At most @p nbuffers blocks are resident in memory;
+ * @ref acquire blocks until a buffer has been written when all of them are in
+ * flight.
+ *
+ * File layout: an @ref async_block_header followed by @p nblocks blocks of
+ * @p block_size bytes. Block @c i is stored at offset
+ * <tt>sizeof(header) + i * block_size</tt>.
+ */
+class async_block_writer {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Create the file and start the I/O thread
+   *
+   * @param filename Path to the output file
+   * @param block_size Size of a block in bytes
+   * @param nblocks Number of blocks in the file
+   * @param nbuffers Number of host buffers (at least 2)
+   */
+  async_block_writer(const std::string &filename, const std::size_t block_size,
+                     const int nblocks, const int nbuffers = 2);
+  ///@}
+
+  /**
+   * @brief Flush pending blocks and stop the I/O thread
+   *
+   * Errors are not reported from the destructor. Call @ref close to check for
+   * I/O errors.
+   */
+  ~async_block_writer();
+
+  async_block_writer(const async_block_writer &) = delete;
+  async_block_writer &operator=(const async_block_writer &) = delete;
+
+  /**
+   * @brief Get a free host buffer of block_size bytes
+   *
+   * Waits until a buffer is free if all buffers are being written.
+   *
+   * @return char* Host buffer to be filled by the caller
+   */
+  char *acquire();
+
+  /**
+   * @brief Queue the last acquired buffer for writing
+   *
+   * @param iblock Index of the block within the file
+   */
+  void submit(const int iblock);
+
+  /**
+   * @brief Write all pending blocks, stop the I/O thread and close the file
+   *
+   * Throws if any block could not be written.
+   */
+  void close();
+
+  /**
+   * @brief Get the size of a block in bytes
+   *
+   */
+  std::size_t get_block_size() const { return block_size; }
+
+private:
+  void run();
+
+  std::string filename;      ///< Path to the output file
+  std::size_t block_size;    ///< Size of a block in bytes
+  int nblocks;               ///< Number of blocks in the file
+  std::FILE *file = nullptr; ///< Output file
+
+  std::vector<std::vector<char> > buffers;  ///< Host buffers
+  std::deque<int> free_buffers;             ///< Buffers available to acquire
+  std::deque<std::pair<int, int> > pending; ///< (buffer, block) to be written
+  int acquired = -1;                        ///< Buffer handed out by acquire
+
+  std::mutex mutex;                  ///< Protects the buffer queues
+  std::condition_variable condition; ///< Signals changes to the queues
+  bool closing = false;              ///< No more blocks will be submitted
+  bool closed = false;               ///< File has been closed
+  std::exception_ptr error;          ///< First error raised by the I/O thread
+  std::thread thread;                ///< I/O thread
+};
+
+} // namespace IO
+} // namespace specfem
+
+#endif
@@ -2,9 +2,14 @@
 #define _FORTRAN_IO_TPP
 
 #include "IO/fortranio/fortran_io.hpp"
+#include "IO/fortranio/fortran_reader.hpp"
+#include "IO/fortranio/fortran_record.hpp"
 #include "specfem_setup.hpp"
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
+#include <vector>
 
 namespace specfem {
 namespace IO {
@@ -41,9 +46,30 @@ void fortran_read_line(std::ifstream &stream, Args... values) {
   }
 
   stream.read(reinterpret_cast<char *>(&buffer_length), fint);
-  specfem::IO::fortran_IO(stream, buffer_length, values...);
+  if (!stream || buffer_length < 0) {
+    throw std::runtime_error("Error reading fortran file");
+  }
 
-  stream.read(reinterpret_cast<char *>(&buffer_length), fint);
+  // The record and its trailing marker are read at once into a buffer that is
+  // reused between records
+  thread_local std::vector<char> buffer;
+  buffer.resize(buffer_length + fint);
+  stream.read(buffer.data(), buffer_length + fint);
+
+  int trailing_length;
+  std::memcpy(&trailing_length, buffer.data() + buffer_length, fint);
+  if (!stream || trailing_length != buffer_length) {
+    throw std::runtime_error("Error reading fortran file");
+  }
+
+  specfem::IO::impl::fortran_record(buffer.data(), buffer_length)
+      .decode(values...);
+  return;
+}
+
+template <typename... Args>
+void fortran_read_line(specfem::IO::fortran_reader &reader, Args... values) {
+  reader.read_line(values...);
   return;
 }
 
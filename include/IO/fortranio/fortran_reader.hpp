@@ -0,0 +1,103 @@
+#ifndef _FORTRAN_READER_HPP
+#define _FORTRAN_READER_HPP
+
+#include "fortran_record.hpp"
+#include <cstddef>
+#include <string>
+
+namespace specfem {
+namespace IO {
+
+/**
+ * @brief Read a Fortran unformatted binary file mapped in memory
+ *
+ * The whole file is mapped read-only when the reader is constructed. Records
+ * are then decoded straight from the mapping: there is no read call or
+ * allocation per value, and arrays stored contiguously in a record (e.g. the
+ * control nodes of an element) are copied in bulk.
+ *
+ * Unlike reading from a @c std::ifstream, the leading and trailing markers of
+ * every record are checked against each other and against the size of the
+ * file, so truncated or corrupted files are reported with the offset of the
+ * offending record.
+ */
+class fortran_reader {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Map a file in memory
+   *
+   * @param filename Path to the Fortran unformatted binary file
+   */
+  fortran_reader(const std::string &filename);
+  ///@}
+
+  /**
+   * @brief Unmap the file
+   *
+   */
+  ~fortran_reader();
+
+  fortran_reader(const fortran_reader &) = delete;
+  fortran_reader &operator=(const fortran_reader &) = delete;
+
+  /**
+   * @brief Read the next record of the file
+   *
+   * @tparam Args Argument can be of the type bool, int, type_real, string,
+   * vector<T = bool, int, type_real, string>
+   * @param values Comma separated list of variable addresses to be read.
+   */
+  template <typename... Args> void read_line(Args... values) {
+    const std::size_t record = position;
+    auto payload = this->next_record();
+    try {
+      payload.decode(values...);
+    } catch (const std::runtime_error &) {
+      this->fail(record, "Record does not match the values to be read.");
+    }
+  }
+
+  /**
+   * @brief Check if every record of the file has been read
+   *
+   */
+  bool eof() const { return position == size; }
+
+  /**
+   * @brief Get the offset of the next record in bytes
+   *
+   */
+  std::size_t tell() const { return position; }
+
+  /**
+   * @brief Get the size of the file in bytes
+   *
+   */
+  std::size_t get_size() const { return size; }
+
+  /**
+   * @brief Get the path to the file
+   *
+   */
+  const std::string &get_filename() const { return filename; }
+
+private:
+  specfem::IO::impl::fortran_record next_record();
+  [[noreturn]] void fail(const std::size_t record,
+                         const std::string &reason) const;
+
+  std::string filename;       ///< Path to the file
+  const char *data = nullptr; ///< Mapped file
+  std::size_t size = 0;       ///< Size of the file in bytes
+  std::size_t position = 0;   ///< Offset of the next record
+};
+
+} // namespace IO
+} // namespace specfem
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef _FORTRAN_RECORD_HPP
+#define _FORTRAN_RECORD_HPP
+
+#include "specfem_setup.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace specfem {
+namespace IO {
+namespace impl {
+/**
+ * @brief Decode the payload of a single Fortran unformatted record
+ *
+ * The record does not own its payload. Values are copied out of the payload
+ * with @c std::memcpy, so decoding does not allocate (except for strings) and
+ * does not depend on the alignment of the payload. Arrays of values stored in
+ * the same format as in memory are copied in bulk.
+ */
+class fortran_record {
+public:
+  /**
+   * @brief Construct a record from its payload
+   *
+   * @param data Start of the payload (after the leading record marker)
+   * @param length Length of the payload in bytes
+   */
+  fortran_record(const char *data, const int length)
+      : data(data), length(length) {}
+
+  /**
+   * @brief Decode values in the order they are stored in the record
+   *
+   * Throws if the record is shorter than the values or if bytes are left in
+   * the record once every value has been decoded.
+   *
+   * @tparam Args Argument can be of the type bool, int, type_real, string,
+   * vector<T = bool, int, type_real, string>
+   * @param values Comma separated list of variable addresses to be read.
+   */
+  template <typename... Args> void decode(Args... values) {
+    (this->read(values), ...);
+    if (offset != length) {
+      throw std::runtime_error("Error reading fortran file");
+    }
+  }
+
+private:
+  const char *take(const int nbytes) {
+    if (nbytes < 0 || offset + nbytes > length) {
+      throw std::runtime_error("Error reading fortran file");
+    }
+    const char *value = data + offset;
+    offset += nbytes;
+    return value;
+  }
+
+  void read(bool *value) {
+    int ivalue;
+    std::memcpy(&ivalue, take(fbool), fbool);
+    *value = (ivalue != 0);
+  }
+
+  void read(int *value) { std::memcpy(value, take(fint), fint); }
+
+  void read(type_real *value) {
+    double dvalue;
+    std::memcpy(&dvalue, take(fdouble), fdouble);
+    *value = static_cast<type_real>(dvalue);
+  }
+
+  void read(std::string *value) {
+    // Fortran strings are padded with blanks and are not null terminated
+    const char *svalue = take(fchar);
+    value->assign(svalue, std::find(svalue, svalue + fchar, '\0'));
+    value->erase(value->find_last_not_of(" \t\n\r") + 1);
+    value->erase(0, value->find_first_not_of(" \t\n\r"));
+  }
+
+  template <typename T> void read(std::vector<T> *value) {
+    const int nsize = value->size();
+    if constexpr (std::is_same_v<T, int> ||
+                  (std::is_same_v<T, type_real> &&
+                   sizeof(type_real) == fdouble)) {
+      // Same layout in the file and in memory
+      const int nbytes = nsize * sizeof(T);
+      if (nsize > 0) {
+        std::memcpy(value->data(), take(nbytes), nbytes);
+      }
+    } else {
+      std::vector<T> &rvalue = *value;
+      for (int i = 0; i < nsize; i++) {
+        T ivalue;
+        this->read(&ivalue);
+        rvalue[i] = ivalue;
+      }
+    }
+  }
+
+  const char *data; ///< Payload of the record
+  int length;       ///< Length of the payload in bytes
+  int offset = 0;   ///< Bytes already decoded
+};
+
+} // namespace impl
+} // namespace IO
+} // namespace specfem
+
+#endif
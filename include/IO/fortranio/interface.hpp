@@ -3,6 +3,7 @@
 
 #include "fortran_io.hpp"
 #include "fortran_io.tpp"
+#include "fortran_reader.hpp"
 #include <fstream>
 
 namespace specfem {
@@ -17,6 +18,17 @@ namespace IO {
  */
 template <typename... Args>
 void fortran_read_line(std::ifstream &stream, Args... values);
+
+/**
+ * @brief Read a line from fortran unformatted binary file mapped in memory
+ *
+ * @tparam Args Argument can be of the type bool, int, type_real, string,
+ * vector<T = bool, int, type_real, string>
+ * @param reader Reader of the mapped file.
+ * @param values Comma separated list of variable addresses to be read.
+ */
+template <typename... Args>
+void fortran_read_line(specfem::IO::fortran_reader &reader, Args... values);
 } // namespace IO
 } // namespace specfem
 
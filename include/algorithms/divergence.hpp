@@ -24,6 +24,10 @@ namespace algorithms {
  * @tparam IteratorType Iterator type (Chunk iterator)
  * @tparam MemberType Kokkos team member type
  * @tparam IteratorType Iterator type (Chunk iterator)
+ * @tparam PartialDerivativesType Partial derivatives container. Either @ref
+ * specfem::compute::partial_derivatives or @ref
+ * specfem::compute::affine_partial_derivatives if every element of the chunk
+ * is affine
  * @tparam VectorFieldType Vector field view type (Chunk view)
  * @tparam QuadratureType Quadrature view type
  * @tparam CallableType Callback functor type
@@ -38,12 +42,13 @@ namespace algorithms {
  * specfem::datatype::ScalarPointViewType<type_real, ViewType::components>)
  * @endcode
  */
-template <typename MemberType, typename IteratorType, typename VectorFieldType,
+template <typename MemberType, typename IteratorType,
+          typename PartialDerivativesType, typename VectorFieldType,
           typename QuadratureType, typename CallableType,
           std::enable_if_t<(VectorFieldType::isChunkViewType), int> = 0>
 KOKKOS_FORCEINLINE_FUNCTION void divergence(
     const MemberType &team, const IteratorType &iterator,
-    const specfem::compute::partial_derivatives &partial_derivatives,
+    const PartialDerivativesType &partial_derivatives,
     const Kokkos::View<type_real *,
                        typename MemberType::execution_space::memory_space>
         &weights,
@@ -82,13 +87,37 @@ KOKKOS_FORCEINLINE_FUNCTION void divergence(
         const int iz = iterator_index.index.iz;
         const int ix = iterator_index.index.ix;
 
-        const datatype jacobian =
-            (is_host_space) ? partial_derivatives.h_jacobian(ispec, iz, ix)
-                            : partial_derivatives.jacobian(ispec, iz, ix);
+        const datatype jacobian = [&]() -> datatype {
+          if constexpr (std::is_same_v<
+                            PartialDerivativesType,
+                            specfem::compute::affine_partial_derivatives>) {
+            // The Jacobian of an affine element is constant
+            specfem::point::partial_derivatives<
+                specfem::dimension::type::dim2, true, using_simd>
+                point_partial_derivatives;
+            if constexpr (is_host_space) {
+              specfem::compute::load_on_host(iterator_index.index,
+                                             partial_derivatives,
+                                             point_partial_derivatives);
+            } else {
+              specfem::compute::load_on_device(iterator_index.index,
+                                               partial_derivatives,
+                                               point_partial_derivatives);
+            }
+            return point_partial_derivatives.jacobian;
+          } else {
+            return (is_host_space)
+                       ? partial_derivatives.h_jacobian(ispec, iz, ix)
+                       : partial_derivatives.jacobian(ispec, iz, ix);
+          }
+        }();
 
         datatype temp1l[components] = { 0.0 };
         datatype temp2l[components] = { 0.0 };
 
+#ifdef KOKKOS_ENABLE_CUDA
+#pragma unroll
+#endif
         for (int l = 0; l < NGLL; ++l) {
           for (int icomp = 0; icomp < components; ++icomp) {
             temp1l[icomp] +=
@@ -22,6 +22,10 @@ namespace algorithms {
  *
  * @tparam MemberType Kokkos team member type
  * @tparam IteratorType Iterator type (Chunk iterator)
+ * @tparam PartialDerivativesType Partial derivatives container. Either @ref
+ * specfem::compute::partial_derivatives or @ref
+ * specfem::compute::affine_partial_derivatives if every element of the chunk
+ * is affine
  * @tparam ViewType Field view type (Chunk view)
  * @tparam QuadratureType Quadrature view type
  * @tparam CallbackFunctor Callback functor type
@@ -35,12 +39,13 @@ namespace algorithms {
  * specfem::datatype::VectorPointViewType<type_real, 2, ViewType::components>)
  * @endcode
  */
-template <typename MemberType, typename IteratorType, typename ViewType,
+template <typename MemberType, typename IteratorType,
+          typename PartialDerivativesType, typename ViewType,
           typename QuadratureType, typename CallbackFunctor,
           std::enable_if_t<ViewType::isChunkViewType, int> = 0>
 KOKKOS_FORCEINLINE_FUNCTION void
 gradient(const MemberType &team, const IteratorType &iterator,
-         const specfem::compute::partial_derivatives &partial_derivatives,
+         const PartialDerivativesType &partial_derivatives,
          const QuadratureType &quadrature, const ViewType &f,
          CallbackFunctor callback) {
   constexpr int components = ViewType::components;
@@ -86,6 +91,9 @@ gradient(const MemberType &team, const IteratorType &iterator,
         datatype df_dxi[components] = { 0.0 };
         datatype df_dgamma[components] = { 0.0 };
 
+#ifdef KOKKOS_ENABLE_CUDA
+#pragma unroll
+#endif
         for (int l = 0; l < NGLL; ++l) {
           for (int icomponent = 0; icomponent < components; ++icomponent) {
             df_dxi[icomponent] +=
@@ -128,6 +136,10 @@ gradient(const MemberType &team, const IteratorType &iterator,
  *
  * @tparam MemberType Kokkos team member type
  * @tparam IteratorType Iterator type (Chunk iterator)
+ * @tparam PartialDerivativesType Partial derivatives container. Either @ref
+ * specfem::compute::partial_derivatives or @ref
+ * specfem::compute::affine_partial_derivatives if every element of the chunk
+ * is affine
  * @tparam ViewType Field view type (Chunk view)
  * @tparam QuadratureType Quadrature view type
  * @tparam CallbackFunctor Callback functor type
@@ -144,12 +156,13 @@ gradient(const MemberType &team, const IteratorType &iterator,
  * ViewType::components>)
  * @endcode
  */
-template <typename MemberType, typename IteratorType, typename ViewType,
+template <typename MemberType, typename IteratorType,
+          typename PartialDerivativesType, typename ViewType,
           typename QuadratureType, typename CallbackFunctor,
           std::enable_if_t<ViewType::isChunkViewType, int> = 0>
 KOKKOS_FORCEINLINE_FUNCTION void
 gradient(const MemberType &team, const IteratorType &iterator,
-         const specfem::compute::partial_derivatives &partial_derivatives,
+         const PartialDerivativesType &partial_derivatives,
          const QuadratureType &quadrature, const ViewType &f, const ViewType &g,
          CallbackFunctor callback) {
   constexpr int components = ViewType::components;
@@ -201,6 +214,9 @@ gradient(const MemberType &team, const IteratorType &iterator,
           df_dgamma[icomponent] = 0.0;
         }
 
+#ifdef KOKKOS_ENABLE_CUDA
+#pragma unroll
+#endif
         for (int l = 0; l < NGLL; ++l) {
           for (int icomponent = 0; icomponent < components; ++icomponent) {
             df_dxi[icomponent] +=
@@ -234,6 +250,9 @@ gradient(const MemberType &team, const IteratorType &iterator,
           df_dgamma[icomponent] = 0.0;
         }
 
+#ifdef KOKKOS_ENABLE_CUDA
+#pragma unroll
+#endif
         for (int l = 0; l < NGLL; ++l) {
           for (int icomponent = 0; icomponent < components; ++icomponent) {
             df_dxi[icomponent] +=
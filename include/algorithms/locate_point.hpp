@@ -2,6 +2,7 @@
 #define _ALGORITHMS_LOCATE_POINT_HPP
 
 #include "compute/compute_mesh.hpp"
+#include "kokkos_abstractions.h"
 #include "point/coordinates.hpp"
 
 namespace specfem {
@@ -12,6 +13,25 @@ specfem::point::local_coordinates<specfem::dimension::type::dim2> locate_point(
         &coordinates,
     const specfem::compute::mesh &mesh);
 
+/**
+ * @brief Locate a batch of points within the mesh
+ *
+ * Points are located in parallel on the host using the spatial index of the
+ * mesh.
+ *
+ * @param coordinates Global coordinates of the points
+ * @param mesh Assembled mesh
+ * @return specfem::kokkos::HostView1d<specfem::point::local_coordinates> Local
+ * coordinates of every point
+ */
+specfem::kokkos::HostView1d<
+    specfem::point::local_coordinates<specfem::dimension::type::dim2> >
+locate_point(
+    const specfem::kokkos::HostView1d<
+        specfem::point::global_coordinates<specfem::dimension::type::dim2> >
+        &coordinates,
+    const specfem::compute::mesh &mesh);
+
 specfem::point::global_coordinates<specfem::dimension::type::dim2> locate_point(
     const specfem::point::local_coordinates<specfem::dimension::type::dim2>
         &coordinates,
@@ -0,0 +1,87 @@
+#ifndef _COMPUTE_AFFINE_ELEMENT_PARTITION_HPP
+#define _COMPUTE_AFFINE_ELEMENT_PARTITION_HPP
+
+#include "compute/compute_partial_derivatives.hpp"
+#include "kokkos_abstractions.h"
+
+namespace specfem {
+namespace compute {
+
+/**
+ * @brief Partition of the elements within a kernel into blocks of affine and
+ * non-affine elements
+ *
+ * Elements are launched in ranges (all elements of a kernel, or one color when
+ * elements are colored). Within every range, elements are partitioned in
+ * blocks of @p block_size consecutive elements since SIMD lanes operate on
+ * consecutive elements. A block is affine if all of its elements are affine.
+ * Affine blocks of range @c i are stored in [range_offsets(i),
+ * affine_offsets(i)) of @ref element_index_mapping and the remaining blocks in
+ * [affine_offsets(i), range_offsets(i + 1)). Blocks keep their relative order,
+ * so only the last block of either part can be partial.
+ *
+ */
+struct affine_element_partition {
+  int nranges = 0; ///< Number of ranges
+
+  specfem::kokkos::DeviceView1d<int> element_index_mapping; ///< Spectral
+                                                            ///< element index
+                                                            ///< ordered by
+                                                            ///< partition
+  specfem::kokkos::HostMirror1d<int>
+      h_element_index_mapping; ///< Host mirror of element_index_mapping
+  specfem::kokkos::HostView1d<int> h_range_offsets;  ///< Offset of every range
+  specfem::kokkos::HostView1d<int> h_affine_offsets; ///< End of the affine
+                                                     ///< blocks of every range
+
+  affine_element_partition() = default;
+
+  /**
+   * @brief Partition the elements within a kernel
+   *
+   * @param partial_derivatives Partial derivatives with affine elements
+   * flagged
+   * @param elements Spectral element indices of the kernel ordered by range
+   * @param range_offsets Offset of every range within @p elements. Extent is
+   * number of ranges + 1
+   * @param block_size Number of consecutive elements that are launched
+   * together
+   */
+  affine_element_partition(
+      const specfem::compute::partial_derivatives &partial_derivatives,
+      const specfem::kokkos::HostView1d<int> elements,
+      const specfem::kokkos::HostView1d<int> range_offsets,
+      const int block_size);
+
+  /**
+   * @brief Get the spectral element indices of the affine blocks of a range
+   *
+   * @param irange Index of the range
+   * @return specfem::kokkos::DeviceView1d<int> Subview of
+   * element_index_mapping
+   */
+  specfem::kokkos::DeviceView1d<int> get_affine(const int irange) const {
+    return Kokkos::subview(element_index_mapping,
+                           Kokkos::make_pair(h_range_offsets(irange),
+                                             h_affine_offsets(irange)));
+  }
+
+  /**
+   * @brief Get the spectral element indices of the non-affine blocks of a
+   * range
+   *
+   * @param irange Index of the range
+   * @return specfem::kokkos::DeviceView1d<int> Subview of
+   * element_index_mapping
+   */
+  specfem::kokkos::DeviceView1d<int> get_general(const int irange) const {
+    return Kokkos::subview(element_index_mapping,
+                           Kokkos::make_pair(h_affine_offsets(irange),
+                                             h_range_offsets(irange + 1)));
+  }
+};
+
+} // namespace compute
+} // namespace specfem
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef _COMPUTE_ASSEMBLY_HPP
 #define _COMPUTE_ASSEMBLY_HPP
 
+#include "compute/assembly_cache.hpp"
 #include "compute/boundaries/boundaries.hpp"
 #include "compute/compute_mesh.hpp"
 #include "compute/compute_partial_derivatives.hpp"
@@ -8,14 +9,20 @@
 // #include "compute/compute_sources.hpp"
 #include "compute/boundary_values/boundary_values.hpp"
 #include "compute/coupled_interfaces/coupled_interfaces.hpp"
+#include "compute/element_coloring.hpp"
 #include "compute/fields/fields.hpp"
 #include "compute/kernels/kernels.hpp"
+#include "compute/memory_footprint.hpp"
+#include "compute/mpi_interfaces/mpi_interfaces.hpp"
 #include "compute/properties/interface.hpp"
 #include "compute/sources/sources.hpp"
 #include "enumerations/specfem_enums.hpp"
 #include "mesh/mesh.hpp"
 #include "receiver/interface.hpp"
 #include "source/interface.hpp"
+#include <string>
+#include <tuple>
+#include <vector>
 
 namespace specfem {
 /**
@@ -46,14 +53,23 @@ struct assembly {
                                                            ///< interfaces
                                                            ///< between 2
                                                            ///< mediums
+  specfem::compute::mpi_interfaces mpi_interfaces; ///< Points shared with
+                                                   ///< other MPI ranks
   specfem::compute::fields fields; ///< Displacement, velocity, and acceleration
                                    ///< fields
   specfem::compute::boundary_values boundary_values; ///< Field values at the
                                                      ///< boundaries
+  specfem::compute::element_assembly element_assembly =
+      specfem::compute::element_assembly::atomic; ///< Strategy used to add
+                                                  ///< element contributions
+                                                  ///< to global points
 
   /**
    * @brief Generate a finite element assembly
    *
+   * When running on several MPI ranks, only the sources and receivers located
+   * within the partition of this rank are assembled.
+   *
    * @param mesh Finite element mesh as read from mesher
    * @param quadratures Quadrature points and weights
    * @param sources Source information
@@ -64,6 +80,18 @@ struct assembly {
    * @param max_timesteps Maximum number of time steps
    * @param max_sig_step Maximum number of siesmogram time steps
    * @param simulation Type of simulation (forward, adjoint, etc.)
+   * @param checkpointing Reconstruct the forward wavefield from snapshots
+   * during combined simulations instead of storing boundary values
+   * @param stream_boundary_values Boundary values are streamed to or from
+   * disk. Only a single time step is kept in device memory
+   * @param ordering Ordering of spectral elements and global points
+   * @param element_assembly Strategy used to add element contributions to
+   * global points
+   * @param cache Cache of the assembled mesh. The assembled mesh and partial
+   * derivatives are loaded from the cache if available, and stored in it
+   * otherwise
+   * @param seismogram_buffer_size Number of seismogram steps kept in device
+   * memory. 0 keeps every seismogram step of the simulation
    */
   assembly(
       const specfem::mesh::mesh &mesh,
@@ -73,7 +101,33 @@ struct assembly {
           &receivers,
       const std::vector<specfem::enums::seismogram::type> &stypes,
       const type_real t0, const type_real dt, const int max_timesteps,
-      const int max_sig_step, const specfem::simulation::type simulation);
+      const int max_sig_step, const specfem::simulation::type simulation,
+      const bool checkpointing = false,
+      const bool stream_boundary_values = false,
+      const specfem::compute::element_ordering ordering =
+          specfem::compute::element_ordering::none,
+      const specfem::compute::element_assembly element_assembly =
+          specfem::compute::element_assembly::atomic,
+      const specfem::compute::assembly_cache &cache =
+          specfem::compute::assembly_cache(),
+      const int seismogram_buffer_size = 0);
+
+  /**
+   * @brief Memory allocated by every container of the assembly
+   *
+   * @return std::vector<std::tuple<std::string,
+   * specfem::compute::memory_footprint> > Name and memory footprint of every
+   * container
+   */
+  std::vector<std::tuple<std::string, specfem::compute::memory_footprint> >
+  get_memory_footprint() const;
+
+  /**
+   * @brief Print the memory allocated by every container of the assembly
+   *
+   * @return std::string Memory report
+   */
+  std::string print_memory_footprint() const;
 };
 
 } // namespace compute
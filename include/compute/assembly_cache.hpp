@@ -0,0 +1,111 @@
+#ifndef _COMPUTE_ASSEMBLY_CACHE_HPP
+#define _COMPUTE_ASSEMBLY_CACHE_HPP
+
+#include "compute/compute_mesh.hpp"
+#include "compute/compute_partial_derivatives.hpp"
+#include "mesh/mesh.hpp"
+#include "quadrature/interface.hpp"
+#include <cstdint>
+#include <string>
+
+namespace specfem {
+namespace compute {
+
+/**
+ * @brief Binary cache of the assembled mesh
+ *
+ * Stores the element ordering, the global numbering and coordinates of the
+ * quadrature points, and the partial derivatives of the basis functions, i.e.
+ * the parts of @ref specfem::compute::assembly that are expensive to compute.
+ * Cache files are keyed by a hash of the mesh database contents, the
+ * quadrature and the element ordering. Loading a cache file maps it into
+ * memory and copies the stored arrays directly into the assembly views.
+ *
+ * A default constructed cache is disabled: @ref load always fails and @ref
+ * store does nothing.
+ */
+class assembly_cache {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Construct a disabled cache
+   *
+   */
+  assembly_cache() = default;
+
+  /**
+   * @brief Construct a cache for a mesh database
+   *
+   * @param directory Directory where cache files are stored
+   * @param database_file Path to the mesh database. The contents of the
+   * database are hashed to key the cache files
+   */
+  assembly_cache(const std::string &directory,
+                 const std::string &database_file);
+  ///@}
+
+  /**
+   * @brief Check if the cache is enabled
+   *
+   */
+  bool enabled() const { return !directory.empty(); }
+
+  /**
+   * @brief Get the path of the cache file
+   *
+   * @param quadratures Quadrature used to assemble the mesh
+   * @param ordering Ordering of spectral elements and global points
+   * @return std::string Path to the cache file
+   */
+  std::string
+  get_filename(const specfem::quadrature::quadratures &quadratures,
+               const specfem::compute::element_ordering ordering) const;
+
+  /**
+   * @brief Load the assembled mesh and partial derivatives from the cache
+   *
+   * @param mesh Finite element mesh as read from mesher
+   * @param quadratures Quadrature used to assemble the mesh
+   * @param ordering Ordering of spectral elements and global points
+   * @param compute_mesh Assembled mesh (output)
+   * @param partial_derivatives Partial derivatives (output)
+   * @return bool True if a valid cache file was found and loaded
+   */
+  bool load(const specfem::mesh::mesh &mesh,
+            const specfem::quadrature::quadratures &quadratures,
+            const specfem::compute::element_ordering ordering,
+            specfem::compute::mesh &compute_mesh,
+            specfem::compute::partial_derivatives &partial_derivatives) const;
+
+  /**
+   * @brief Store the assembled mesh and partial derivatives in the cache
+   *
+   * The cache file is written to a temporary file which is then renamed, such
+   * that concurrent runs never read a partially written cache file.
+   *
+   * @param quadratures Quadrature used to assemble the mesh
+   * @param compute_mesh Assembled mesh
+   * @param partial_derivatives Partial derivatives
+   */
+  void store(
+      const specfem::quadrature::quadratures &quadratures,
+      const specfem::compute::mesh &compute_mesh,
+      const specfem::compute::partial_derivatives &partial_derivatives) const;
+
+private:
+  std::uint64_t
+  get_key(const specfem::quadrature::quadratures &quadratures,
+          const specfem::compute::element_ordering ordering) const;
+
+  std::string directory;           ///< Directory of the cache files
+  std::uint64_t database_hash = 0; ///< Hash of the mesh database contents
+};
+
+} // namespace compute
+} // namespace specfem
+
+#endif
@@ -75,6 +75,13 @@ public:
              const specfem::compute::properties &properties,
              const specfem::compute::partial_derivatives &partial_derivatives);
   ///@}
+
+  /**
+   * @brief Memory allocated to store boundary conditions
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const;
 };
 
 /**
@@ -8,6 +8,9 @@
 #include "enumerations/dimension.hpp"
 #include "enumerations/medium.hpp"
 #include "impl/boundary_medium_container.hpp"
+#include <cstddef>
+#include <sstream>
+#include <string>
 
 namespace specfem {
 namespace compute {
@@ -24,7 +27,18 @@ public:
       specfem::element::boundary_tag::composite_stacey_dirichlet>
       composite_stacey_dirichlet;
 
-  boundary_values(const int nstep, const specfem::compute::mesh mesh,
+  /**
+   * @brief Allocate boundary values
+   *
+   * @param nstep Number of time steps for which values are stored
+   * @param nslots Number of time steps resident in device memory. Values of
+   * time step istep are stored in slot istep % nslots
+   * @param mesh Finite element mesh
+   * @param properties Material properties
+   * @param boundaries Boundary information
+   */
+  boundary_values(const int nstep, const int nslots,
+                  const specfem::compute::mesh mesh,
                   const specfem::compute::properties properties,
                   const specfem::compute::boundaries boundaries);
 
@@ -42,6 +56,96 @@ public:
     }
   }
 
+  /**
+   * @brief Size of the values stored for a single time step in bytes
+   *
+   * @return std::size_t Size in bytes
+   */
+  std::size_t step_size() const {
+    return stacey.step_size() + composite_stacey_dirichlet.step_size();
+  }
+
+  /**
+   * @brief Check if values are streamed to or from disk instead of being
+   * stored in memory for every time step
+   *
+   */
+  bool is_streamed() const { return stacey.nslots < stacey.nstep; }
+
+  /**
+   * @brief Memory allocated to store the boundary values
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint += stacey.get_memory_footprint();
+    footprint += composite_stacey_dirichlet.get_memory_footprint();
+    return footprint;
+  }
+
+  /**
+   * @brief Copy the values of a time step to a contiguous host buffer
+   *
+   * @param istep Time step
+   * @param buffer Host buffer of step_size() bytes
+   */
+  void copy_step_to_host(const int istep, type_real *buffer) const {
+    stacey.copy_step_to_host(istep, buffer);
+    composite_stacey_dirichlet.copy_step_to_host(
+        istep, buffer + stacey.step_size() / sizeof(type_real));
+  }
+
+  /**
+   * @brief Copy the values of a time step from a contiguous host buffer
+   *
+   * @param istep Time step
+   * @param buffer Host buffer of step_size() bytes
+   */
+  void copy_step_to_device(const int istep, const type_real *buffer) const {
+    stacey.copy_step_to_device(istep, buffer);
+    composite_stacey_dirichlet.copy_step_to_device(
+        istep, buffer + stacey.step_size() / sizeof(type_real));
+  }
+
+  /**
+   * @brief Print the memory used to store boundary values
+   *
+   * @return std::string Memory report
+   */
+  std::string print() const {
+    const std::size_t nstep = stacey.nstep;
+    const std::size_t compact_size = nstep * this->step_size();
+    const std::size_t dense_size =
+        nstep * (stacey.dense_step_size() +
+                 composite_stacey_dirichlet.dense_step_size());
+    const std::size_t resident_size = stacey.nslots * this->step_size();
+
+    std::ostringstream message;
+    message << "Boundary values:\n"
+            << "  Stored time steps             : " << nstep << "\n"
+            << "  Absorbing edge points         : "
+            << stacey.acoustic.npoints + stacey.elastic.npoints +
+                   composite_stacey_dirichlet.acoustic.npoints +
+                   composite_stacey_dirichlet.elastic.npoints
+            << "\n"
+            << "  Memory (edge points only)     : " << compact_size / 1048576.0
+            << " MB\n"
+            << "  Memory (full element grids)   : " << dense_size / 1048576.0
+            << " MB\n";
+
+    if (compact_size > 0) {
+      message << "  Reduction                     : "
+              << static_cast<double>(dense_size) / compact_size << "x\n";
+    }
+
+    message << "  Resident in device memory     : "
+            << resident_size / 1048576.0 << " MB (" << stacey.nslots
+            << " time steps)\n";
+
+    return message.str();
+  }
+
   void copy_to_host() {
     stacey.sync_to_host();
     composite_stacey_dirichlet.sync_to_host();
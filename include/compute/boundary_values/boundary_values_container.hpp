@@ -8,6 +8,7 @@
 #include "enumerations/medium.hpp"
 #include "impl/boundary_medium_container.hpp"
 #include "kokkos_abstractions.h"
+#include <cstddef>
 
 namespace specfem {
 namespace compute {
@@ -20,6 +21,10 @@ public:
   constexpr static auto dimension = DimensionType;
   constexpr static auto boundary_tag = BoundaryTag;
 
+  int nstep = 0;  ///< Number of time steps for which values are stored
+  int nslots = 0; ///< Number of time steps resident in device memory. Equal
+                  ///< to nstep unless values are streamed to or from disk
+
   specfem::kokkos::DeviceView1d<int> property_index_mapping;
   specfem::kokkos::HostMirror1d<int> h_property_index_mapping;
 
@@ -32,10 +37,71 @@ public:
 
   boundary_value_container() = default;
 
-  boundary_value_container(const int nstep, const specfem::compute::mesh mesh,
+  boundary_value_container(const int nstep, const int nslots,
+                           const specfem::compute::mesh mesh,
                            const specfem::compute::properties properties,
                            const specfem::compute::boundaries boundaries);
 
+  /**
+   * @brief Size of the values stored for a single time step in bytes
+   *
+   * @return std::size_t Size in bytes
+   */
+  std::size_t step_size() const {
+    return acoustic.step_size() + elastic.step_size();
+  }
+
+  /**
+   * @brief Size of the values of a single time step in bytes if every
+   * quadrature point of the absorbing elements were stored
+   *
+   * @return std::size_t Size in bytes
+   */
+  std::size_t dense_step_size() const {
+    return acoustic.dense_step_size() + elastic.dense_step_size();
+  }
+
+  /**
+   * @brief Memory allocated to store the boundary values
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(property_index_mapping, h_property_index_mapping);
+    footprint += acoustic.get_memory_footprint();
+    footprint += elastic.get_memory_footprint();
+    return footprint;
+  }
+
+  /**
+   * @brief Copy the values of a time step to a contiguous host buffer
+   *
+   * Acoustic values are followed by elastic values.
+   *
+   * @param istep Time step
+   * @param buffer Host buffer of step_size() bytes
+   */
+  void copy_step_to_host(const int istep, type_real *buffer) const {
+    const int islot = istep % nslots;
+    acoustic.copy_slot_to_host(islot, buffer);
+    elastic.copy_slot_to_host(islot, buffer + acoustic.step_size() /
+                                                  sizeof(type_real));
+  }
+
+  /**
+   * @brief Copy the values of a time step from a contiguous host buffer
+   *
+   * @param istep Time step
+   * @param buffer Host buffer of step_size() bytes
+   */
+  void copy_step_to_device(const int istep, const type_real *buffer) const {
+    const int islot = istep % nslots;
+    acoustic.copy_slot_to_device(islot, buffer);
+    elastic.copy_slot_to_device(islot, buffer + acoustic.step_size() /
+                                                    sizeof(type_real));
+  }
+
   void sync_to_host() {
     Kokkos::deep_copy(h_property_index_mapping, property_index_mapping);
     acoustic.sync_to_host();
@@ -83,14 +149,21 @@ store_on_device(const int istep, const IndexType index,
       (BoundaryValueContainerType::dimension == AccelerationType::dimension),
       "DimensionType must match AccelerationType::dimension_type");
 
+  // Values are not stored when the forward wavefield is reconstructed from
+  // snapshots
+  if (istep >= boundary_value_container.nstep)
+    return;
+
+  const int islot = istep % boundary_value_container.nslots;
+
   IndexType l_index = index;
   l_index.ispec = boundary_value_container.property_index_mapping(index.ispec);
 
   if constexpr (MediumTag == specfem::element::medium_tag::acoustic) {
-    boundary_value_container.acoustic.store_on_device(istep, l_index,
+    boundary_value_container.acoustic.store_on_device(islot, l_index,
                                                       acceleration);
   } else if constexpr (MediumTag == specfem::element::medium_tag::elastic) {
-    boundary_value_container.elastic.store_on_device(istep, l_index,
+    boundary_value_container.elastic.store_on_device(islot, l_index,
                                                      acceleration);
   }
 
@@ -120,11 +193,13 @@ load_on_device(const int istep, const IndexType index,
 
   l_index.ispec = boundary_value_container.property_index_mapping(index.ispec);
 
+  const int islot = istep % boundary_value_container.nslots;
+
   if constexpr (MediumType == specfem::element::medium_tag::acoustic) {
-    boundary_value_container.acoustic.load_on_device(istep, l_index,
+    boundary_value_container.acoustic.load_on_device(islot, l_index,
                                                      acceleration);
   } else if constexpr (MediumType == specfem::element::medium_tag::elastic) {
-    boundary_value_container.elastic.load_on_device(istep, l_index,
+    boundary_value_container.elastic.load_on_device(islot, l_index,
                                                     acceleration);
   }
 
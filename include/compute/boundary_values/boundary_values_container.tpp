@@ -7,10 +7,12 @@
 template <specfem::dimension::type DimensionType,
           specfem::element::boundary_tag BoundaryTag>
 specfem::compute::boundary_value_container<DimensionType, BoundaryTag>::
-    boundary_value_container(const int nstep, const specfem::compute::mesh mesh,
+    boundary_value_container(const int nstep, const int nslots,
+                             const specfem::compute::mesh mesh,
                              const specfem::compute::properties properties,
                              const specfem::compute::boundaries boundaries)
-    : property_index_mapping(
+    : nstep(nstep), nslots(nslots),
+      property_index_mapping(
           "specfem::compute::boundary_value_container::property_index_mapping",
           mesh.nspec),
       h_property_index_mapping(
@@ -24,11 +26,11 @@ specfem::compute::boundary_value_container<DimensionType, BoundaryTag>::
 
   acoustic = specfem::compute::impl::boundary_medium_container<
       DimensionType, specfem::element::medium_tag::acoustic, BoundaryTag>(
-      nstep, mesh, properties, boundaries, h_property_index_mapping);
+      nslots, mesh, properties, boundaries, h_property_index_mapping);
 
   elastic = specfem::compute::impl::boundary_medium_container<
       DimensionType, specfem::element::medium_tag::elastic, BoundaryTag>(
-      nstep, mesh, properties, boundaries, h_property_index_mapping);
+      nslots, mesh, properties, boundaries, h_property_index_mapping);
 
   Kokkos::deep_copy(property_index_mapping, h_property_index_mapping);
 }
@@ -8,11 +8,26 @@
 #include "enumerations/medium.hpp"
 #include "point/field.hpp"
 #include <Kokkos_Core.hpp>
+#include <cstddef>
 
 namespace specfem {
 namespace compute {
 namespace impl {
 
+/**
+ * @brief Boundary values stored at the quadrature points on the absorbing
+ * edges of elements within a medium
+ *
+ * Only quadrature points that lie on an absorbing edge are stored. Values are
+ * stored step-major as (nslots, npoints, components) views, so that values of a
+ * single time step are contiguous in memory. nslots is either the number of
+ * time steps or, when values are streamed to or from disk, the number of time
+ * steps resident in device memory.
+ *
+ * @tparam DimensionType Dimension of the elements
+ * @tparam MediumTag Medium tag of the elements
+ * @tparam BoundaryTag Boundary tag of the elements
+ */
 template <specfem::dimension::type DimensionType,
           specfem::element::medium_tag MediumTag,
           specfem::element::boundary_tag BoundaryTag>
@@ -22,43 +37,110 @@ private:
       specfem::medium::medium<DimensionType, MediumTag>::components;
   constexpr static auto dimension = DimensionType;
 
+  using HostSliceType =
+      Kokkos::View<type_real *[components], Kokkos::LayoutRight,
+                   Kokkos::HostSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >; ///< Values of a
+                                                              ///< single time
+                                                              ///< step on host
+
 public:
   using value_type =
-      Kokkos::View<type_real ****[components], Kokkos::LayoutLeft,
-                   Kokkos::DefaultExecutionSpace>;
+      Kokkos::View<type_real **[components], Kokkos::LayoutRight,
+                   Kokkos::DefaultExecutionSpace>; ///< (nslots, npoints,
+                                                   ///< components)
+  using index_type =
+      Kokkos::View<int ***, Kokkos::LayoutLeft,
+                   Kokkos::DefaultExecutionSpace>; ///< (nelements, nz, nx)
 
-  value_type values;
-  typename value_type::HostMirror h_values;
+  int npoints = 0; ///< Number of quadrature points on absorbing edges
 
-  boundary_medium_container() = default;
+  index_type point_index_mapping; ///< Index of the quadrature point within
+                                  ///< values. -1 for points not on an
+                                  ///< absorbing edge
+  typename index_type::HostMirror h_point_index_mapping; ///< Host mirror of
+                                                         ///< point index
+                                                         ///< mapping
+
+  value_type values;                       ///< Boundary values
+  typename value_type::HostMirror h_values; ///< Host mirror of values
 
-  boundary_medium_container(const int nspec, const int nz, const int nx,
-                            const int nstep)
-      : values("specfem::compute::impl::stacey_values", nspec, nz, nx, nstep),
-        h_values(Kokkos::create_mirror_view(values)) {}
+  boundary_medium_container() = default;
 
   boundary_medium_container(
-      const int nstep, const specfem::compute::mesh mesh,
+      const int nslots, const specfem::compute::mesh mesh,
       const specfem::compute::properties properties,
       const specfem::compute::boundaries boundaries,
       specfem::kokkos::HostView1d<int> property_index_mapping);
 
+  /**
+   * @brief Size of the values stored for a single time step in bytes
+   *
+   * @return std::size_t Size in bytes
+   */
+  std::size_t step_size() const {
+    return sizeof(type_real) * npoints * components;
+  }
+
+  /**
+   * @brief Size of the values of a single time step in bytes if every
+   * quadrature point of the absorbing elements were stored
+   *
+   * @return std::size_t Size in bytes
+   */
+  std::size_t dense_step_size() const {
+    return sizeof(type_real) * point_index_mapping.extent(0) *
+           point_index_mapping.extent(1) * point_index_mapping.extent(2) *
+           components;
+  }
+
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(point_index_mapping, h_point_index_mapping)
+        .add(values, h_values);
+    return footprint;
+  }
+
+  /**
+   * @brief Copy the values stored in a slot to a contiguous host buffer
+   *
+   * @param islot Slot (time step) within values
+   * @param buffer Host buffer of step_size() bytes
+   */
+  void copy_slot_to_host(const int islot, type_real *buffer) const {
+    const HostSliceType h_slice(buffer, npoints);
+    Kokkos::deep_copy(h_slice,
+                      Kokkos::subview(values, islot, Kokkos::ALL, Kokkos::ALL));
+  }
+
+  /**
+   * @brief Copy values from a contiguous host buffer to a slot
+   *
+   * @param islot Slot (time step) within values
+   * @param buffer Host buffer of step_size() bytes
+   */
+  void copy_slot_to_device(const int islot, const type_real *buffer) const {
+    const HostSliceType h_slice(const_cast<type_real *>(buffer), npoints);
+    Kokkos::deep_copy(
+        Kokkos::subview(values, islot, Kokkos::ALL, Kokkos::ALL), h_slice);
+  }
+
   template <
       typename AccelerationType,
       typename std::enable_if_t<!AccelerationType::simd::using_simd, int> = 0>
   KOKKOS_FUNCTION void
-  load_on_device(const int istep, const specfem::point::index<dimension> &index,
+  load_on_device(const int islot, const specfem::point::index<dimension> &index,
                  AccelerationType &acceleration) const {
 
-    const int ispec = index.ispec;
-    const int iz = index.iz;
-    const int ix = index.ix;
+    const int ipoint = point_index_mapping(index.ispec, index.iz, index.ix);
 
 #ifdef KOKKOS_ENABLE_CUDA
 #pragma unroll
 #endif
     for (int icomp = 0; icomp < components; ++icomp) {
-      acceleration.acceleration(icomp) = values(ispec, iz, ix, istep, icomp);
+      acceleration.acceleration(icomp) =
+          (ipoint < 0) ? static_cast<type_real>(0.0)
+                       : values(islot, ipoint, icomp);
     }
 
     return;
@@ -68,19 +150,20 @@ public:
       typename AccelerationType,
       typename std::enable_if_t<!AccelerationType::simd::using_simd, int> = 0>
   KOKKOS_FUNCTION void
-  store_on_device(const int istep,
+  store_on_device(const int islot,
                   const specfem::point::index<dimension> &index,
                   const AccelerationType &acceleration) const {
 
-    const int ispec = index.ispec;
-    const int iz = index.iz;
-    const int ix = index.ix;
+    const int ipoint = point_index_mapping(index.ispec, index.iz, index.ix);
+
+    if (ipoint < 0)
+      return;
 
 #ifdef KOKKOS_ENABLE_CUDA
 #pragma unroll
 #endif
     for (int icomp = 0; icomp < components; ++icomp) {
-      values(ispec, iz, ix, istep, icomp) = acceleration.acceleration(icomp);
+      values(islot, ipoint, icomp) = acceleration.acceleration(icomp);
     }
 
     return;
@@ -90,23 +173,26 @@ public:
       typename AccelerationType,
       typename std::enable_if_t<AccelerationType::simd::using_simd, int> = 0>
   KOKKOS_FUNCTION void
-  load_on_device(const int istep,
+  load_on_device(const int islot,
                  const specfem::point::simd_index<dimension> &index,
                  AccelerationType &acceleration) const {
 
-    const int ispec = index.ispec;
-    const int iz = index.iz;
-    const int ix = index.ix;
-
     using simd = typename AccelerationType::simd;
-    using mask_type = typename simd::mask_type;
-    using tag_type = typename simd::tag_type;
-
-    mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
-    for (int icomp = 0; icomp < components; ++icomp)
-      Kokkos::Experimental::where(mask, acceleration.acceleration(icomp))
-          .copy_from(&values(ispec, iz, ix, istep, icomp), tag_type());
+    // Lanes map to consecutive elements, whose edge points are not contiguous
+    // within values
+    for (int lane = 0; lane < simd::size(); ++lane) {
+      const int ipoint =
+          index.mask(std::size_t(lane))
+              ? point_index_mapping(index.ispec + lane, index.iz, index.ix)
+              : -1;
+
+      for (int icomp = 0; icomp < components; ++icomp) {
+        acceleration.acceleration(icomp)[lane] =
+            (ipoint < 0) ? static_cast<type_real>(0.0)
+                         : values(islot, ipoint, icomp);
+      }
+    }
 
     return;
   }
@@ -115,23 +201,26 @@ public:
       typename AccelerationType,
       typename std::enable_if_t<AccelerationType::simd::using_simd, int> = 0>
   KOKKOS_FUNCTION void
-  store_on_device(const int istep,
+  store_on_device(const int islot,
                   const specfem::point::simd_index<dimension> &index,
                   const AccelerationType &acceleration) const {
 
-    const int ispec = index.ispec;
-    const int iz = index.iz;
-    const int ix = index.ix;
-
     using simd = typename AccelerationType::simd;
-    using mask_type = typename simd::mask_type;
-    using tag_type = typename simd::tag_type;
 
-    mask_type mask([&](std::size_t lane) { return index.mask(lane); });
+    for (int lane = 0; lane < simd::size(); ++lane) {
+      if (!index.mask(std::size_t(lane)))
+        continue;
+
+      const int ipoint =
+          point_index_mapping(index.ispec + lane, index.iz, index.ix);
 
-    for (int icomp = 0; icomp < components; ++icomp)
-      Kokkos::Experimental::where(mask, acceleration.acceleration(icomp))
-          .copy_to(&values(ispec, iz, ix, istep, icomp), tag_type());
+      if (ipoint < 0)
+        continue;
+
+      for (int icomp = 0; icomp < components; ++icomp) {
+        values(islot, ipoint, icomp) = acceleration.acceleration(icomp)[lane];
+      }
+    }
 
     return;
   }
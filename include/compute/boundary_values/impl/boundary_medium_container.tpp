@@ -9,7 +9,7 @@ template <specfem::dimension::type DimensionType,
 specfem::compute::impl::boundary_medium_container<DimensionType, MediumType,
                                             BoundaryTag>::
     boundary_medium_container(
-        const int nstep, const specfem::compute::mesh mesh,
+        const int nslots, const specfem::compute::mesh mesh,
         const specfem::compute::properties properties,
         const specfem::compute::boundaries boundaries,
         specfem::kokkos::HostView1d<int> property_index_mapping) {
@@ -27,8 +27,39 @@ specfem::compute::impl::boundary_medium_container<DimensionType, MediumType,
     }
   }
 
+  point_index_mapping = index_type(
+      "specfem::compute::boundary_medium_container::point_index_mapping",
+      nelements, nz, nx);
+  h_point_index_mapping = Kokkos::create_mirror_view(point_index_mapping);
+
+  // Number the quadrature points on absorbing edges. Points shared between
+  // elements are numbered once per element since every element contributes
+  // separately to the global acceleration.
+  npoints = 0;
+  for (int ispec = 0; ispec < nspec; ispec++) {
+    const int ielement = property_index_mapping(ispec);
+    if (ielement < 0 || properties.h_element_types(ispec) != MediumType ||
+        boundaries.boundary_tags(ispec) != BoundaryTag)
+      continue;
+
+    const int ispec_stacey = boundaries.h_stacey_index_mapping(ispec);
+
+    for (int iz = 0; iz < nz; iz++) {
+      for (int ix = 0; ix < nx; ix++) {
+        const bool on_edge =
+            (ispec_stacey >= 0) &&
+            (boundaries.stacey.h_quadrature_point_boundary_tag(
+                 ispec_stacey, iz, ix) ==
+             specfem::element::boundary_tag::stacey);
+        h_point_index_mapping(ielement, iz, ix) = on_edge ? npoints++ : -1;
+      }
+    }
+  }
+
+  Kokkos::deep_copy(point_index_mapping, h_point_index_mapping);
+
   values = value_type("specfem::compute::boundary_medium_container::values",
-                      nelements, nz, nx, nstep);
+                      nslots, npoints);
 
   h_values = Kokkos::create_mirror_view(values);
 
@@ -1,6 +1,8 @@
 #pragma once
 
 // #include "compute/compute_quadrature.hpp"
+#include "compute/memory_footprint.hpp"
+#include "compute/spatial_index.hpp"
 #include "element/quadrature.hpp"
 #include "kokkos_abstractions.h"
 #include "mesh/mesh.hpp"
@@ -13,6 +15,32 @@
 namespace specfem {
 namespace compute {
 
+/**
+ * @brief Ordering of spectral elements within groups of elements sharing the
+ * same medium, property and boundary tags
+ *
+ */
+enum class element_ordering {
+  none,   ///< Keep the ordering of the mesh database. Global points are
+          ///< numbered by coordinate
+  hilbert ///< Order elements along a Hilbert curve through their centers.
+          ///< Global points are numbered in the order they are first touched
+          ///< by the elements
+};
+
+/**
+ * @brief Algorithm used to find the quadrature points shared between spectral
+ * elements
+ *
+ */
+enum class global_numbering {
+  topology,   ///< Derive shared points from the control nodes shared between
+              ///< elements. Falls back to @c coordinates if the resulting
+              ///< numbering does not match the coordinates of the points
+  coordinates ///< Sort every quadrature point by coordinates and merge points
+              ///< within a tolerance
+};
+
 /**
  * @brief Mapping between spectral element indexing within @ref
  * specfem::mesh::mesh and @ref specfem::compute::mesh
@@ -23,16 +51,42 @@ namespace compute {
  */
 struct mesh_to_compute_mapping {
   int nspec; ///< Number of spectral elements
+  specfem::compute::element_ordering ordering =
+      specfem::compute::element_ordering::none; ///< Ordering of elements
+                                                ///< within tag groups
   specfem::kokkos::HostView1d<int> compute_to_mesh; ///< Mapping from compute
                                                     ///< ordering to mesh
                                                     ///< ordering
   specfem::kokkos::HostView1d<int> mesh_to_compute; ///< Mapping from mesh
                                                     ///< ordering to compute
                                                     ///< ordering
+  specfem::kokkos::HostView1d<int> outer; ///< 1 if the element (in compute
+                                          ///< ordering) shares a point with
+                                          ///< the partition of another MPI
+                                          ///< rank
 
   mesh_to_compute_mapping() = default;
 
   mesh_to_compute_mapping(const specfem::mesh::tags &tags);
+
+  /**
+   * @brief Group elements by tag and reorder elements within every group
+   *
+   * Within every group, elements touching an MPI interface (outer elements)
+   * come before the remaining (inner) elements. Both ranges are ordered
+   * according to @p ordering.
+   *
+   * @param tags Element tags
+   * @param control_nodes Control nodes used to compute element centers
+   * @param ordering Ordering of elements within every group
+   * @param mpi_interfaces Interfaces with the partitions of other MPI ranks
+   */
+  mesh_to_compute_mapping(const specfem::mesh::tags &tags,
+                          const specfem::mesh::control_nodes &control_nodes,
+                          const specfem::compute::element_ordering ordering,
+                          const specfem::mesh::interfaces::interface
+                              &mpi_interfaces =
+                                  specfem::mesh::interfaces::interface());
 };
 
 /**
@@ -184,14 +238,58 @@ struct mesh {
                                                      ///< element index between
                                                      ///< mesh database ordering
                                                      ///< and compute ordering
+  specfem::compute::spatial_index spatial_index; ///< Spatial index used to
+                                                 ///< locate points within the
+                                                 ///< mesh
 
   mesh() = default;
 
+  /**
+   * @brief Assemble the mesh
+   *
+   * @param tags Element tags
+   * @param control_nodes Control nodes
+   * @param quadratures Quadrature object
+   * @param ordering Ordering of elements within groups of elements sharing the
+   * same tags, and of the global points
+   * @param mpi_interfaces Interfaces with the partitions of other MPI ranks.
+   * Elements touching them are placed first within every group
+   */
   mesh(const specfem::mesh::tags &tags,
+       const specfem::mesh::control_nodes &control_nodes,
+       const specfem::quadrature::quadratures &quadratures,
+       const specfem::compute::element_ordering ordering =
+           specfem::compute::element_ordering::none,
+       const specfem::mesh::interfaces::interface &mpi_interfaces =
+           specfem::mesh::interfaces::interface());
+
+  /**
+   * @brief Construct the mesh from a previously computed element mapping and
+   * global numbering (e.g. loaded from @ref specfem::compute::assembly_cache)
+   *
+   * @param mapping Mapping between mesh and compute element ordering
+   * @param points Global numbering and coordinates of the quadrature points
+   * @param control_nodes Control nodes
+   * @param quadratures Quadrature object
+   */
+  mesh(const specfem::compute::mesh_to_compute_mapping &mapping,
+       const specfem::compute::points &points,
        const specfem::mesh::control_nodes &control_nodes,
        const specfem::quadrature::quadratures &quadratures);
 
-  specfem::compute::points assemble();
+  /**
+   * @brief Compute the global numbering and coordinates of the quadrature
+   * points
+   *
+   * Both algorithms number points in the same order, so they return the same
+   * numbering on conforming meshes.
+   *
+   * @param numbering Algorithm used to find shared quadrature points
+   * @return specfem::compute::points Global numbering and coordinates
+   */
+  specfem::compute::points
+  assemble(const specfem::compute::global_numbering numbering =
+               specfem::compute::global_numbering::topology);
 
   /**
    * @brief Compute the global coordinates for a point given its local
@@ -216,6 +314,13 @@ struct mesh {
   specfem::point::local_coordinates<specfem::dimension::type::dim2> locate(
       const specfem::point::global_coordinates<specfem::dimension::type::dim2>
           &point);
+
+  /**
+   * @brief Memory allocated to store the assembled mesh
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const;
 };
 
 /**
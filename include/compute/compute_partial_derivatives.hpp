@@ -1,6 +1,7 @@
 #ifndef _COMPUTE_PARTIAL_DERIVATIVES_HPP
 #define _COMPUTE_PARTIAL_DERIVATIVES_HPP
 
+#include "compute/memory_footprint.hpp"
 #include "enumerations/specfem_enums.hpp"
 #include "kokkos_abstractions.h"
 #include "macros.hpp"
@@ -11,9 +12,80 @@
 
 namespace specfem {
 namespace compute {
+/**
+ * @brief Partial derivatives of the basis functions of affine elements
+ *
+ * The mapping of an affine element (rectangle or parallelogram) from the
+ * reference element is linear, so the partial derivatives and the Jacobian
+ * are constant within the element and are stored once per element. Values
+ * are only meaningful for elements flagged in @ref
+ * partial_derivatives::h_is_affine.
+ *
+ */
+struct affine_partial_derivatives {
+
+private:
+  using ViewType =
+      typename Kokkos::View<type_real *, Kokkos::LayoutLeft,
+                            Kokkos::DefaultExecutionSpace>; ///< Underlying view
+                                                            ///< type used to
+                                                            ///< store data
+
+public:
+  int nspec; ///< Number of spectral elements
+
+  ViewType xix;                    ///< @xix
+  ViewType::HostMirror h_xix;      ///< Host mirror of @xix
+  ViewType xiz;                    ///< @xiz
+  ViewType::HostMirror h_xiz;      ///< Host mirror of @xiz
+  ViewType gammax;                 ///< @gammax
+  ViewType::HostMirror h_gammax;   ///< Host mirror of @gammax
+  ViewType gammaz;                 ///< @gammaz
+  ViewType::HostMirror h_gammaz;   ///< Host mirror of @gammaz
+  ViewType jacobian;               ///< Jacobian
+  ViewType::HostMirror h_jacobian; ///< Host mirror of Jacobian
+
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Default constructor
+   *
+   */
+  affine_partial_derivatives() = default;
+
+  /**
+   * @brief Allocate the partial derivatives of every element
+   *
+   * @param nspec Number of spectral elements
+   */
+  affine_partial_derivatives(const int nspec);
+  ///@}
+
+  /**
+   * @brief Copy the partial derivatives to the device
+   *
+   */
+  void sync_views();
+
+  /**
+   * @brief Memory allocated to store the partial derivatives
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const;
+};
+
 /**
  * @brief Partial derivatives of the basis functions at every quadrature point
  *
+ * Elements whose partial derivatives are constant (affine elements) are
+ * detected when the partial derivatives are computed. Their partial
+ * derivatives are additionally stored once per element in @ref affine, which
+ * lets kernels load them without per quadrature point memory traffic.
+ *
  */
 struct partial_derivatives {
 
@@ -40,6 +112,11 @@ public:
   ViewType jacobian;               ///< Jacobian
   ViewType::HostMirror h_jacobian; ///< Host mirror of Jacobian
 
+  int naffine = 0; ///< Number of affine elements
+  specfem::kokkos::HostView1d<bool> h_is_affine; ///< Element is affine
+  specfem::compute::affine_partial_derivatives affine; ///< Partial derivatives
+                                                       ///< of affine elements
+
   /**
    * @name Constructors
    *
@@ -60,7 +137,27 @@ public:
   partial_derivatives(const specfem::compute::mesh &mesh);
   ///@}
 
+  /**
+   * @brief Copy the partial derivatives to the device and detect affine
+   * elements
+   *
+   */
   void sync_views();
+
+  /**
+   * @brief Memory allocated to store the partial derivatives
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const;
+
+private:
+  /**
+   * @brief Flag elements with constant partial derivatives and store their
+   * partial derivatives in @ref affine
+   *
+   */
+  void compute_affine_elements();
 };
 
 /**
@@ -254,6 +351,118 @@ inline void impl_store_on_host(
   }
 }
 
+template <typename PointPartialDerivativesType,
+          typename std::enable_if_t<
+              PointPartialDerivativesType::simd::using_simd, int> = 0>
+KOKKOS_FORCEINLINE_FUNCTION void impl_load_on_device(
+    const specfem::point::simd_index<PointPartialDerivativesType::dimension>
+        &index,
+    const specfem::compute::affine_partial_derivatives &derivatives,
+    PointPartialDerivativesType &partial_derivatives) {
+
+  const int ispec = index.ispec;
+
+  using simd = typename PointPartialDerivativesType::simd;
+  using mask_type = typename simd::mask_type;
+  using tag_type = typename simd::tag_type;
+
+  constexpr static bool StoreJacobian =
+      PointPartialDerivativesType::store_jacobian;
+
+  mask_type mask([&](std::size_t lane) { return index.mask(lane); });
+
+  Kokkos::Experimental::where(mask, partial_derivatives.xix)
+      .copy_from(&derivatives.xix(ispec), tag_type());
+  Kokkos::Experimental::where(mask, partial_derivatives.gammax)
+      .copy_from(&derivatives.gammax(ispec), tag_type());
+  Kokkos::Experimental::where(mask, partial_derivatives.xiz)
+      .copy_from(&derivatives.xiz(ispec), tag_type());
+  Kokkos::Experimental::where(mask, partial_derivatives.gammaz)
+      .copy_from(&derivatives.gammaz(ispec), tag_type());
+  if constexpr (StoreJacobian) {
+    Kokkos::Experimental::where(mask, partial_derivatives.jacobian)
+        .copy_from(&derivatives.jacobian(ispec), tag_type());
+  }
+}
+
+template <typename PointPartialDerivativesType,
+          typename std::enable_if_t<
+              !PointPartialDerivativesType::simd::using_simd, int> = 0>
+KOKKOS_FORCEINLINE_FUNCTION void impl_load_on_device(
+    const specfem::point::index<PointPartialDerivativesType::dimension> &index,
+    const specfem::compute::affine_partial_derivatives &derivatives,
+    PointPartialDerivativesType &partial_derivatives) {
+
+  const int ispec = index.ispec;
+
+  constexpr static bool StoreJacobian =
+      PointPartialDerivativesType::store_jacobian;
+
+  partial_derivatives.xix = derivatives.xix(ispec);
+  partial_derivatives.gammax = derivatives.gammax(ispec);
+  partial_derivatives.xiz = derivatives.xiz(ispec);
+  partial_derivatives.gammaz = derivatives.gammaz(ispec);
+  if constexpr (StoreJacobian) {
+    partial_derivatives.jacobian = derivatives.jacobian(ispec);
+  }
+}
+
+template <typename PointPartialDerivativesType,
+          typename std::enable_if_t<
+              PointPartialDerivativesType::simd::using_simd, int> = 0>
+inline void impl_load_on_host(
+    const specfem::point::simd_index<PointPartialDerivativesType::dimension>
+        &index,
+    const specfem::compute::affine_partial_derivatives &derivatives,
+    PointPartialDerivativesType &partial_derivatives) {
+
+  const int ispec = index.ispec;
+
+  using simd = typename PointPartialDerivativesType::simd;
+  using mask_type = typename simd::mask_type;
+  using tag_type = typename simd::tag_type;
+
+  constexpr static bool StoreJacobian =
+      PointPartialDerivativesType::store_jacobian;
+
+  mask_type mask([&](std::size_t lane) { return index.mask(lane); });
+
+  Kokkos::Experimental::where(mask, partial_derivatives.xix)
+      .copy_from(&derivatives.h_xix(ispec), tag_type());
+  Kokkos::Experimental::where(mask, partial_derivatives.gammax)
+      .copy_from(&derivatives.h_gammax(ispec), tag_type());
+  Kokkos::Experimental::where(mask, partial_derivatives.xiz)
+      .copy_from(&derivatives.h_xiz(ispec), tag_type());
+  Kokkos::Experimental::where(mask, partial_derivatives.gammaz)
+      .copy_from(&derivatives.h_gammaz(ispec), tag_type());
+  if constexpr (StoreJacobian) {
+    Kokkos::Experimental::where(mask, partial_derivatives.jacobian)
+        .copy_from(&derivatives.h_jacobian(ispec), tag_type());
+  }
+}
+
+template <typename PointPartialDerivativesType,
+          typename std::enable_if_t<
+              !PointPartialDerivativesType::simd::using_simd, int> = 0>
+inline void impl_load_on_host(
+    const specfem::point::index<PointPartialDerivativesType::dimension> &index,
+    const specfem::compute::affine_partial_derivatives &derivatives,
+    PointPartialDerivativesType &partial_derivatives) {
+
+  const int ispec = index.ispec;
+
+  constexpr static bool StoreJacobian =
+      PointPartialDerivativesType::store_jacobian;
+
+  partial_derivatives.xix = derivatives.h_xix(ispec);
+  partial_derivatives.gammax = derivatives.h_gammax(ispec);
+  partial_derivatives.xiz = derivatives.h_xiz(ispec);
+  partial_derivatives.gammaz = derivatives.h_gammaz(ispec);
+  if constexpr (StoreJacobian) {
+    partial_derivatives.jacobian = derivatives.h_jacobian(ispec);
+  }
+}
+
 /**
  * @brief Load the partial derivatives at a given quadrature point on the device
  *
@@ -330,6 +539,60 @@ store_on_host(const IndexType &index,
               const PointPartialDerivativesType &partial_derivatives) {
   impl_store_on_host(index, derivatives, partial_derivatives);
 }
+
+/**
+ * @brief Load the partial derivatives of an affine element at a given
+ * quadrature point on the device
+ *
+ * @ingroup ComputePartialDerivativesDataAccess
+ *
+ * @tparam PointPartialDerivativesType Point partial derivatives type. Needs to
+ * be of @ref specfem::point::partial_derivatives
+ * @tparam IndexType Index type. Needs to be of @ref specfem::point::index or
+ * @ref specfem::point::simd_index
+ * @param index Index of the quadrature point. Every element of the index must
+ * be affine
+ * @param derivatives Partial derivatives of affine elements
+ * @param partial_derivatives Partial derivatives at the given quadrature point
+ */
+template <
+    typename PointPartialDerivativesType, typename IndexType,
+    typename std::enable_if_t<IndexType::using_simd ==
+                                  PointPartialDerivativesType::simd::using_simd,
+                              int> = 0>
+KOKKOS_FORCEINLINE_FUNCTION void
+load_on_device(const IndexType &index,
+               const specfem::compute::affine_partial_derivatives &derivatives,
+               PointPartialDerivativesType &partial_derivatives) {
+  impl_load_on_device(index, derivatives, partial_derivatives);
+}
+
+/**
+ * @brief Load the partial derivatives of an affine element at a given
+ * quadrature point on the host
+ *
+ * @ingroup ComputePartialDerivativesDataAccess
+ *
+ * @tparam PointPartialDerivativesType Point partial derivatives type. Needs to
+ * be of @ref specfem::point::partial_derivatives
+ * @tparam IndexType Index type. Needs to be of @ref specfem::point::index or
+ * @ref specfem::point::simd_index
+ * @param index Index of the quadrature point. Every element of the index must
+ * be affine
+ * @param derivatives Partial derivatives of affine elements
+ * @param partial_derivatives Partial derivatives at the given quadrature point
+ */
+template <
+    typename PointPartialDerivativesType, typename IndexType,
+    typename std::enable_if_t<IndexType::using_simd ==
+                                  PointPartialDerivativesType::simd::using_simd,
+                              int> = 0>
+inline void
+load_on_host(const IndexType &index,
+             const specfem::compute::affine_partial_derivatives &derivatives,
+             PointPartialDerivativesType &partial_derivatives) {
+  impl_load_on_host(index, derivatives, partial_derivatives);
+}
 } // namespace compute
 } // namespace specfem
 
@@ -1,6 +1,7 @@
 #ifndef _COMPUTE_RECEIVERS_HPP
 #define _COMPUTE_RECEIVERS_HPP
 
+#include "compute/memory_footprint.hpp"
 #include "kokkos_abstractions.h"
 #include "receiver/interface.hpp"
 #include "specfem_setup.hpp"
@@ -56,15 +57,15 @@ struct receivers {
                                                        ///< to rotate receiver
                                                        ///< components stored
                                                        ///< on host
-  specfem::kokkos::DeviceView5d<type_real> field;      ///< Container to store
-                                                  ///< spectral element field
-                                                  ///< used in computing
-                                                  ///< seismograms stored on
-                                                  ///< the device
   specfem::kokkos::DeviceView4d<type_real> seismogram;   ///< Container to store
                                                          ///< computed
                                                          ///< seismograms stored
-                                                         ///< on the device
+                                                         ///< on the device.
+                                                         ///< Ring buffer where
+                                                         ///< seismogram step
+                                                         ///< @c i is stored at
+                                                         ///< <tt>i %
+                                                         ///< extent(0)</tt>
   specfem::kokkos::HostMirror4d<type_real> h_seismogram; ///< Container to
                                                          ///< store computed
                                                          ///< seismograms
@@ -76,22 +77,17 @@ struct receivers {
   specfem::kokkos::HostMirror1d<specfem::enums::seismogram::type>
       h_seismogram_types; ///< Types of seismograms to be calculated stored on
                           ///< the host
-  Kokkos::View<type_real *****[2], Kokkos::LayoutLeft,
+  Kokkos::View<type_real ****[2], Kokkos::LayoutLeft,
                specfem::kokkos::DevMemSpace>
-      receiver_field; ///< Receiver field
-                      ///< inside the
-                      ///< element where
-                      ///< receiver is
-                      ///< located stored
-                      ///< on the device
-  Kokkos::View<type_real *****[2], Kokkos::LayoutLeft,
+      receiver_field; ///< Work array storing the field inside the element
+                      ///< where every receiver is located, for every
+                      ///< seismogram type, while it is interpolated to the
+                      ///< receiver. Only holds the latest seismogram step
+  Kokkos::View<type_real ****[2], Kokkos::LayoutLeft,
                specfem::kokkos::DevMemSpace>::HostMirror
-      h_receiver_field; ///< Receiver field
-                        ///< inside the
-                        ///< element where
-                        ///< receiver is
-                        ///< located stored
-                        ///< on the host
+      h_receiver_field; ///< Host copy of @ref receiver_field used for
+                        ///< debugging. Only allocated by @ref
+                        ///< sync_receiver_field
 
   /**
    * @brief Default constructor
@@ -99,22 +95,40 @@ struct receivers {
    */
   receivers(){};
 
+  /**
+   * @brief Allocate receiver views
+   *
+   * @param nreceivers Number of receivers
+   * @param max_sig_step Number of seismogram steps in the simulation
+   * @param N Number of quadrature points
+   * @param n_seis_types Number of seismogram types
+   * @param buffer_size Number of seismogram steps kept in memory. 0 keeps
+   * every seismogram step of the simulation
+   */
   receivers(const int nreceivers, const int max_sig_step, const int N,
-            const int n_seis_types);
+            const int n_seis_types, const int buffer_size = 0);
   /**
    * @brief Constructor to allocate and assign views
    *
+   * @param max_sig_step Number of seismogram steps in the simulation
    * @param receivers Pointer to receivers objects read from sources file
    * @param stypes Types of seismograms to be written
-   * @param quadx Quarature object in x dimension
-   * @param quadz Quadrature object in z dimension
-   * @param mpi Pointer to the MPI object
+   * @param mesh Assembled mesh used to locate the receivers
+   * @param buffer_size Number of seismogram steps kept in memory. 0 keeps
+   * every seismogram step of the simulation
    */
   receivers(const int max_sig_step,
             const std::vector<std::shared_ptr<specfem::receivers::receiver> >
                 &receivers,
             const std::vector<specfem::enums::seismogram::type> &stypes,
-            const specfem::compute::mesh &mesh);
+            const specfem::compute::mesh &mesh, const int buffer_size = 0);
+
+  /**
+   * @brief Get the number of seismogram steps kept in memory
+   *
+   * @return int Length of the seismogram ring buffer
+   */
+  int get_buffer_size() const { return seismogram.extent(0); }
   /**
    * @brief Sync views within this struct from host to device
    *
@@ -128,6 +142,22 @@ struct receivers {
    *
    */
   void sync_seismograms();
+
+  /**
+   * @brief Copy the field inside the elements where receivers are located to
+   * the host, as computed for the latest seismogram step
+   *
+   * Intended for debugging. @ref h_receiver_field is allocated on the first
+   * call.
+   */
+  void sync_receiver_field();
+
+  /**
+   * @brief Memory allocated to store receiver information and seismograms
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const;
 };
 } // namespace compute
 } // namespace specfem
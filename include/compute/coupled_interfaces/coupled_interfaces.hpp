@@ -60,6 +60,19 @@ struct coupled_interfaces {
   specfem::compute::interface_container<medium1, medium2>
   get_interface_container() const;
 
+  /**
+   * @brief Memory allocated to store the coupled interfaces
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint += elastic_acoustic.get_memory_footprint();
+    footprint += acoustic_poroelastic.get_memory_footprint();
+    footprint += elastic_poroelastic.get_memory_footprint();
+    return footprint;
+  }
+
   specfem::compute::interface_container<specfem::element::medium_tag::elastic,
                                         specfem::element::medium_tag::acoustic>
       elastic_acoustic; ///< Elastic-acoustic interface
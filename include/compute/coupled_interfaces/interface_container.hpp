@@ -152,6 +152,24 @@ public:
   EdgeNormalView::HostMirror h_medium2_edge_normal; ///< Host mirror for @ref
                                                     ///< medium2_edge_normal
 
+  /**
+   * @brief Memory allocated to store the interface
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(medium1_index_mapping, h_medium1_index_mapping)
+        .add(medium2_index_mapping, h_medium2_index_mapping)
+        .add(medium1_edge_type, h_medium1_edge_type)
+        .add(medium2_edge_type, h_medium2_edge_type)
+        .add(medium1_edge_factor, h_medium1_edge_factor)
+        .add(medium2_edge_factor, h_medium2_edge_factor)
+        .add(medium1_edge_normal, h_medium1_edge_normal)
+        .add(medium2_edge_normal, h_medium2_edge_normal);
+    return footprint;
+  }
+
   /**
    * @brief Get the spectral element index for elements on edges of the
    * interface
@@ -0,0 +1,76 @@
+#ifndef _COMPUTE_ELEMENT_COLORING_HPP
+#define _COMPUTE_ELEMENT_COLORING_HPP
+
+#include "compute/compute_mesh.hpp"
+#include "kokkos_abstractions.h"
+
+namespace specfem {
+namespace compute {
+
+/**
+ * @brief Strategy used to scatter element contributions to global points
+ *
+ */
+enum class element_assembly {
+  atomic,  ///< Launch all elements at once and use atomic additions on
+           ///< shared global points
+  coloring ///< Launch elements one color at a time. Elements of the same
+           ///< color share no global points, so contributions are added
+           ///< without atomics
+};
+
+/**
+ * @brief Coloring of the elements within a kernel such that elements of the
+ * same color share no global points
+ *
+ * Elements are colored in blocks of @p block_size consecutive elements, since
+ * SIMD lanes operate on consecutive elements. Blocks of the same color are
+ * stored contiguously within @ref element_index_mapping; the blocks of color
+ * @c i are in the range [color_offsets(i), color_offsets(i + 1)). Within a
+ * color, every block except the last one is full.
+ *
+ */
+struct element_coloring {
+  int ncolors = 0; ///< Number of colors
+
+  specfem::kokkos::DeviceView1d<int> element_index_mapping; ///< Spectral
+                                                            ///< element index
+                                                            ///< ordered by
+                                                            ///< color
+  specfem::kokkos::HostMirror1d<int>
+      h_element_index_mapping; ///< Host mirror of element_index_mapping
+  specfem::kokkos::HostView1d<int> h_color_offsets; ///< Offset of every color
+                                                    ///< within
+                                                    ///< element_index_mapping
+
+  element_coloring() = default;
+
+  /**
+   * @brief Color the elements within a kernel
+   *
+   * @param points Assembly information
+   * @param elements Spectral element indices of the kernel. Must be contiguous
+   * @param block_size Number of consecutive elements that are colored together
+   */
+  element_coloring(const specfem::compute::points &points,
+                   const specfem::kokkos::HostView1d<int> elements,
+                   const int block_size);
+
+  /**
+   * @brief Get the spectral element indices of a color
+   *
+   * @param icolor Index of the color
+   * @return specfem::kokkos::DeviceView1d<int> Subview of
+   * element_index_mapping
+   */
+  specfem::kokkos::DeviceView1d<int> get_color(const int icolor) const {
+    return Kokkos::subview(element_index_mapping,
+                           Kokkos::make_pair(h_color_offsets(icolor),
+                                             h_color_offsets(icolor + 1)));
+  }
+};
+
+} // namespace compute
+} // namespace specfem
+
+#endif
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "datatypes/simd.hpp"
 #include "point/assembly_index.hpp"
 #include "point/coordinates.hpp"
 
@@ -148,7 +149,6 @@ impl_load_on_device(const specfem::point::simd_assembly_index &index,
   const int iglob = index.iglob;
 
   using mask_type = typename ViewType::simd::mask_type;
-  using tag_type = typename ViewType::simd::tag_type;
 
   mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -166,29 +166,31 @@ impl_load_on_device(const specfem::point::simd_assembly_index &index,
 
   if constexpr (StoreDisplacement) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.displacement(icomp))
-          .copy_from(&curr_field.field(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_from(mask, point_field.displacement(icomp),
+                                          &curr_field.field(iglob, icomp));
     }
   }
 
   if constexpr (StoreVelocity) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.velocity(icomp))
-          .copy_from(&curr_field.field_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_from(mask, point_field.velocity(icomp),
+                                          &curr_field.field_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreAcceleration) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.acceleration(icomp))
-          .copy_from(&curr_field.field_dot_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_from(
+          mask, point_field.acceleration(icomp),
+          &curr_field.field_dot_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreMassMatrix) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.mass_matrix(icomp))
-          .copy_from(&curr_field.mass_inverse(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_from(
+          mask, point_field.mass_matrix(icomp),
+          &curr_field.mass_inverse(iglob, icomp));
     }
   }
 
@@ -332,7 +334,6 @@ inline void impl_load_on_host(const specfem::point::simd_assembly_index &index,
   constexpr static int components = ViewType::components;
 
   using mask_type = typename ViewType::simd::mask_type;
-  using tag_type = typename ViewType::simd::tag_type;
 
   const int iglob = index.iglob;
 
@@ -352,29 +353,32 @@ inline void impl_load_on_host(const specfem::point::simd_assembly_index &index,
 
   if constexpr (StoreDisplacement) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.displacement(icomp))
-          .copy_from(&curr_field.h_field(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_from(mask, point_field.displacement(icomp),
+                                          &curr_field.h_field(iglob, icomp));
     }
   }
 
   if constexpr (StoreVelocity) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.velocity(icomp))
-          .copy_from(&curr_field.h_field_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_from(
+          mask, point_field.velocity(icomp),
+          &curr_field.h_field_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreAcceleration) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.acceleration(icomp))
-          .copy_from(&curr_field.h_field_dot_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_from(
+          mask, point_field.acceleration(icomp),
+          &curr_field.h_field_dot_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreMassMatrix) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.mass_matrix(icomp))
-          .copy_from(&curr_field.h_mass_inverse(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_from(
+          mask, point_field.mass_matrix(icomp),
+          &curr_field.h_mass_inverse(iglob, icomp));
     }
   }
 
@@ -614,7 +618,6 @@ impl_store_on_device(const specfem::point::simd_assembly_index &index,
   constexpr static int components = ViewType::components;
 
   using mask_type = typename ViewType::simd::mask_type;
-  using tag_type = typename ViewType::simd::tag_type;
 
   const int iglob = index.iglob;
 
@@ -634,29 +637,30 @@ impl_store_on_device(const specfem::point::simd_assembly_index &index,
 
   if constexpr (StoreDisplacement) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.displacement(icomp))
-          .copy_to(&curr_field.h_field(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_to(mask, point_field.displacement(icomp),
+                                        &curr_field.h_field(iglob, icomp));
     }
   }
 
   if constexpr (StoreVelocity) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.velocity(icomp))
-          .copy_to(&curr_field.field_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_to(mask, point_field.velocity(icomp),
+                                        &curr_field.field_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreAcceleration) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.acceleration(icomp))
-          .copy_to(&curr_field.field_dot_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_to(
+          mask, point_field.acceleration(icomp),
+          &curr_field.field_dot_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreMassMatrix) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.mass_matrix(icomp))
-          .copy_to(&curr_field.mass_inverse(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_to(mask, point_field.mass_matrix(icomp),
+                                        &curr_field.mass_inverse(iglob, icomp));
     }
   }
 
@@ -789,7 +793,6 @@ inline void impl_store_on_host(const specfem::point::simd_assembly_index &index,
   constexpr static int components = ViewType::components;
 
   using mask_type = typename ViewType::simd::mask_type;
-  using tag_type = typename ViewType::simd::tag_type;
 
   const int iglob = index.iglob;
 
@@ -809,29 +812,31 @@ inline void impl_store_on_host(const specfem::point::simd_assembly_index &index,
 
   if constexpr (StoreDisplacement) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.displacement(icomp))
-          .copy_to(&curr_field.h_field(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_to(mask, point_field.displacement(icomp),
+                                        &curr_field.h_field(iglob, icomp));
     }
   }
 
   if constexpr (StoreVelocity) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.velocity(icomp))
-          .copy_to(&curr_field.h_field_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_to(mask, point_field.velocity(icomp),
+                                        &curr_field.h_field_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreAcceleration) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.acceleration(icomp))
-          .copy_to(&curr_field.h_field_dot_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_to(
+          mask, point_field.acceleration(icomp),
+          &curr_field.h_field_dot_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreMassMatrix) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      Kokkos::Experimental::where(mask, point_field.acceleration(icomp))
-          .copy_to(&curr_field.h_mass_matrix(iglob, icomp), tag_type());
+      specfem::datatype::masked_copy_to(
+          mask, point_field.acceleration(icomp),
+          &curr_field.h_mass_matrix(iglob, icomp));
     }
   }
 
@@ -1081,7 +1086,6 @@ impl_add_on_device(const specfem::point::simd_assembly_index &index,
   constexpr static int components = ViewType::components;
 
   using mask_type = typename ViewType::simd::mask_type;
-  using tag_type = typename ViewType::simd::tag_type;
 
   const int iglob = index.iglob;
 
@@ -1101,49 +1105,29 @@ impl_add_on_device(const specfem::point::simd_assembly_index &index,
 
   if constexpr (StoreDisplacement) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      typename ViewType::simd::datatype lhs;
-      Kokkos::Experimental::where(mask, lhs).copy_from(
-          &curr_field.field(iglob, icomp), tag_type());
-
-      lhs += point_field.displacement(icomp);
-      Kokkos::Experimental::where(mask, lhs).copy_to(
-          &curr_field.field(iglob, icomp), tag_type());
+      specfem::datatype::masked_add_to(mask, point_field.displacement(icomp),
+                                       &curr_field.field(iglob, icomp));
     }
   }
 
   if constexpr (StoreVelocity) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      typename ViewType::simd::datatype lhs;
-      Kokkos::Experimental::where(mask, lhs).copy_from(
-          &curr_field.field_dot(iglob, icomp), tag_type());
-
-      lhs += point_field.velocity(icomp);
-      Kokkos::Experimental::where(mask, lhs).copy_to(
-          &curr_field.field_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_add_to(mask, point_field.velocity(icomp),
+                                       &curr_field.field_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreAcceleration) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      typename ViewType::simd::datatype lhs;
-      Kokkos::Experimental::where(mask, lhs).copy_from(
-          &curr_field.field_dot_dot(iglob, icomp), tag_type());
-
-      lhs += point_field.acceleration(icomp);
-      Kokkos::Experimental::where(mask, lhs).copy_to(
-          &curr_field.field_dot_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_add_to(mask, point_field.acceleration(icomp),
+                                       &curr_field.field_dot_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreMassMatrix) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      typename ViewType::simd::datatype lhs;
-      Kokkos::Experimental::where(mask, lhs).copy_from(
-          &curr_field.mass_inverse(iglob, icomp), tag_type());
-
-      lhs += point_field.mass_matrix(icomp);
-      Kokkos::Experimental::where(mask, lhs).copy_to(
-          &curr_field.mass_inverse(iglob, icomp), tag_type());
+      specfem::datatype::masked_add_to(mask, point_field.mass_matrix(icomp),
+                                       &curr_field.mass_inverse(iglob, icomp));
     }
   }
 
@@ -1275,7 +1259,6 @@ inline void impl_add_on_host(const specfem::point::simd_assembly_index &index,
   constexpr static int components = ViewType::components;
 
   using mask_type = typename ViewType::simd::mask_type;
-  using tag_type = typename ViewType::simd::tag_type;
 
   const int iglob = index.iglob;
 
@@ -1295,49 +1278,31 @@ inline void impl_add_on_host(const specfem::point::simd_assembly_index &index,
 
   if constexpr (StoreDisplacement) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      typename ViewType::simd::datatype lhs;
-      Kokkos::Experimental::where(mask, lhs).copy_from(
-          &curr_field.h_field(iglob, icomp), tag_type());
-
-      lhs += point_field.displacement(icomp);
-      Kokkos::Experimental::where(mask, lhs).copy_to(
-          &curr_field.h_field(iglob, icomp), tag_type());
+      specfem::datatype::masked_add_to(mask, point_field.displacement(icomp),
+                                       &curr_field.h_field(iglob, icomp));
     }
   }
 
   if constexpr (StoreVelocity) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      typename ViewType::simd::datatype lhs;
-      Kokkos::Experimental::where(mask, lhs).copy_from(
-          &curr_field.h_field_dot(iglob, icomp), tag_type());
-
-      lhs += point_field.velocity(icomp);
-      Kokkos::Experimental::where(mask, lhs).copy_to(
-          &curr_field.h_field_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_add_to(mask, point_field.velocity(icomp),
+                                       &curr_field.h_field_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreAcceleration) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      typename ViewType::simd::datatype lhs;
-      Kokkos::Experimental::where(mask, lhs).copy_from(
-          &curr_field.h_field_dot_dot(iglob, icomp), tag_type());
-
-      lhs += point_field.acceleration(icomp);
-      Kokkos::Experimental::where(mask, lhs).copy_to(
-          &curr_field.h_field_dot_dot(iglob, icomp), tag_type());
+      specfem::datatype::masked_add_to(
+          mask, point_field.acceleration(icomp),
+          &curr_field.h_field_dot_dot(iglob, icomp));
     }
   }
 
   if constexpr (StoreMassMatrix) {
     for (int icomp = 0; icomp < components; ++icomp) {
-      typename ViewType::simd::datatype lhs;
-      Kokkos::Experimental::where(mask, lhs).copy_from(
-          &curr_field.h_mass_inverse(iglob, icomp), tag_type());
-
-      lhs += point_field.mass_matrix(icomp);
-      Kokkos::Experimental::where(mask, lhs).copy_to(
-          &curr_field.h_mass_inverse(iglob, icomp), tag_type());
+      specfem::datatype::masked_add_to(
+          mask, point_field.mass_matrix(icomp),
+          &curr_field.h_mass_inverse(iglob, icomp));
     }
   }
 
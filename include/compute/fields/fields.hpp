@@ -32,10 +32,13 @@ struct fields {
    * @param mesh Assembled mesh
    * @param properties Material properties
    * @param simulation Current simulation type
+   * @param checkpointing Allocate the forward field in combined simulations.
+   * Required when the forward wavefield is recomputed from snapshots.
    */
   fields(const specfem::compute::mesh &mesh,
          const specfem::compute::properties &properties,
-         const specfem::simulation::type simulation);
+         const specfem::simulation::type simulation,
+         const bool checkpointing = false);
   ///@}
 
   /**
@@ -82,6 +85,20 @@ struct fields {
     backward.copy_to_host();
   }
 
+  /**
+   * @brief Memory allocated to store the fields
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint += buffer.get_memory_footprint();
+    footprint += forward.get_memory_footprint();
+    footprint += adjoint.get_memory_footprint();
+    footprint += backward.get_memory_footprint();
+    return footprint;
+  }
+
   specfem::compute::simulation_field<specfem::wavefield::type::buffer>
       buffer; ///< Buffer field. Generally used for temporary storage for
               ///< adjoint fields read from disk
@@ -29,15 +29,24 @@ public:
 
   template <specfem::sync::kind sync> void sync_fields() const;
 
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(field, h_field)
+        .add(field_dot, h_field_dot)
+        .add(field_dot_dot, h_field_dot_dot)
+        .add(mass_inverse, h_mass_inverse);
+    return footprint;
+  }
+
   int nglob;
-  specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft> field;
-  specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft> h_field;
-  specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft> field_dot;
-  specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft> h_field_dot;
-  specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft> field_dot_dot;
-  specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft> h_field_dot_dot;
-  specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft> mass_inverse;
-  specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft> h_mass_inverse;
+  specfem::kokkos::DeviceView2d<type_field, Kokkos::LayoutLeft> field;
+  specfem::kokkos::HostMirror2d<type_field, Kokkos::LayoutLeft> h_field;
+  specfem::kokkos::DeviceView2d<type_field, Kokkos::LayoutLeft> field_dot;
+  specfem::kokkos::HostMirror2d<type_field, Kokkos::LayoutLeft> h_field_dot;
+  specfem::kokkos::DeviceView2d<type_field, Kokkos::LayoutLeft> field_dot_dot;
+  specfem::kokkos::HostMirror2d<type_field, Kokkos::LayoutLeft> h_field_dot_dot;
+  specfem::kokkos::DeviceView2d<type_field, Kokkos::LayoutLeft> mass_inverse;
+  specfem::kokkos::HostMirror2d<type_field, Kokkos::LayoutLeft> h_mass_inverse;
 };
 } // namespace impl
 
@@ -58,24 +58,25 @@ specfem::compute::impl::field_impl<DimensionType, MediumTag>::field_impl(
 
   nglob = count;
 
-  field = specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>(
+  field = specfem::kokkos::DeviceView2d<type_field, Kokkos::LayoutLeft>(
       "specfem::compute::fields::field", nglob, medium_type::components);
-  h_field = specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft>(
+  h_field = specfem::kokkos::HostMirror2d<type_field, Kokkos::LayoutLeft>(
       Kokkos::create_mirror_view(field));
-  field_dot = specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>(
+  field_dot = specfem::kokkos::DeviceView2d<type_field, Kokkos::LayoutLeft>(
       "specfem::compute::fields::field_dot", nglob, medium_type::components);
-  h_field_dot = specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft>(
+  h_field_dot = specfem::kokkos::HostMirror2d<type_field, Kokkos::LayoutLeft>(
       Kokkos::create_mirror_view(field_dot));
-  field_dot_dot = specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>(
+  field_dot_dot = specfem::kokkos::DeviceView2d<type_field, Kokkos::LayoutLeft>(
       "specfem::compute::fields::field_dot_dot", nglob,
       medium_type::components);
   h_field_dot_dot =
-      specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft>(
+      specfem::kokkos::HostMirror2d<type_field, Kokkos::LayoutLeft>(
           Kokkos::create_mirror_view(field_dot_dot));
-  mass_inverse = specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>(
+  mass_inverse = specfem::kokkos::DeviceView2d<type_field, Kokkos::LayoutLeft>(
       "specfem::compute::fields::mass_inverse", nglob, medium_type::components);
-  h_mass_inverse = specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft>(
-      Kokkos::create_mirror_view(mass_inverse));
+  h_mass_inverse =
+      specfem::kokkos::HostMirror2d<type_field, Kokkos::LayoutLeft>(
+          Kokkos::create_mirror_view(mass_inverse));
 
   Kokkos::parallel_for(
       "specfem::compute::fields::field_impl::initialize_field",
@@ -68,6 +68,20 @@ public:
    */
   void copy_to_device() { sync_fields<specfem::sync::kind::HostToDevice>(); }
 
+  /**
+   * @brief Memory allocated to store the field
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(index_mapping, h_index_mapping)
+        .add(assembly_index_mapping, h_assembly_index_mapping);
+    footprint += elastic.get_memory_footprint();
+    footprint += acoustic.get_memory_footprint();
+    return footprint;
+  }
+
   /**
    * @brief Copy fields from another simulation field
    *
@@ -137,6 +151,30 @@ void deep_copy(simulation_field<WavefieldType1> &dst,
   specfem::compute::deep_copy(dst.acoustic, src.acoustic);
 }
 
+/**
+ * @brief Copy displacement, velocity and acceleration between simulation fields
+ * on the device
+ *
+ * Unlike @ref deep_copy the index mappings and host mirrors are not copied.
+ * Both fields need to be defined on the same assembly.
+ *
+ * @tparam WavefieldType1 Destination wavefield type
+ * @tparam WavefieldType2 Source wavefield type
+ * @param dst Destination field
+ * @param src Source field
+ */
+template <specfem::wavefield::type WavefieldType1,
+          specfem::wavefield::type WavefieldType2>
+void deep_copy_on_device(const simulation_field<WavefieldType1> &dst,
+                         const simulation_field<WavefieldType2> &src) {
+  Kokkos::deep_copy(dst.elastic.field, src.elastic.field);
+  Kokkos::deep_copy(dst.elastic.field_dot, src.elastic.field_dot);
+  Kokkos::deep_copy(dst.elastic.field_dot_dot, src.elastic.field_dot_dot);
+  Kokkos::deep_copy(dst.acoustic.field, src.acoustic.field);
+  Kokkos::deep_copy(dst.acoustic.field_dot, src.acoustic.field_dot);
+  Kokkos::deep_copy(dst.acoustic.field_dot_dot, src.acoustic.field_dot_dot);
+}
+
 /**
  * @defgroup FieldDataAccess
  */
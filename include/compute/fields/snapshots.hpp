@@ -0,0 +1,184 @@
+#pragma once
+
+#include "compute/fields/simulation_field.hpp"
+#include "enumerations/medium.hpp"
+#include "enumerations/wavefield.hpp"
+#include "kokkos_abstractions.h"
+#include "specfem_setup.hpp"
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+
+namespace specfem {
+namespace compute {
+namespace impl {
+/**
+ * @brief Snapshots of the fields within a medium
+ *
+ * Snapshots are stored as (nglob, components, nsnapshots) views such that
+ * every snapshot is a contiguous block of memory.
+ */
+template <specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag>
+struct medium_snapshots {
+  using ViewType =
+      specfem::kokkos::DeviceView3d<type_field, Kokkos::LayoutLeft>; ///< View
+                                                                     ///< type
+
+  medium_snapshots() = default;
+
+  medium_snapshots(const int nglob, const int nsnapshots)
+      : field("specfem::compute::medium_snapshots::field", nglob,
+              specfem::medium::medium<DimensionType, MediumTag>::components,
+              nsnapshots),
+        field_dot("specfem::compute::medium_snapshots::field_dot", nglob,
+                  specfem::medium::medium<DimensionType, MediumTag>::components,
+                  nsnapshots),
+        field_dot_dot(
+            "specfem::compute::medium_snapshots::field_dot_dot", nglob,
+            specfem::medium::medium<DimensionType, MediumTag>::components,
+            nsnapshots) {}
+
+  ViewType field;         ///< Displacement (or potential)
+  ViewType field_dot;     ///< Velocity
+  ViewType field_dot_dot; ///< Acceleration
+};
+} // namespace impl
+
+/**
+ * @brief Device resident snapshots of a simulation field
+ *
+ * Used to reconstruct the forward wavefield during combined simulations when
+ * the boundary values of the forward simulation are not stored. Only the
+ * displacement, velocity and acceleration are stored. The mass matrix does not
+ * change between time steps.
+ */
+class wavefield_snapshots {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Default constructor
+   *
+   */
+  wavefield_snapshots() = default;
+
+  /**
+   * @brief Allocate snapshots for a simulation field
+   *
+   * @tparam WavefieldType Wavefield type
+   * @param nsnapshots Number of snapshots
+   * @param field Simulation field to be stored
+   */
+  template <specfem::wavefield::type WavefieldType>
+  wavefield_snapshots(const int nsnapshots,
+                      const simulation_field<WavefieldType> &field)
+      : nsnapshots(nsnapshots),
+        elastic(field.elastic.nglob, nsnapshots),
+        acoustic(field.acoustic.nglob, nsnapshots) {}
+  ///@}
+
+  /**
+   * @brief Size of a single snapshot in bytes
+   *
+   * @tparam WavefieldType Wavefield type
+   * @param field Simulation field to be stored
+   * @return std::size_t Size of a snapshot in bytes
+   */
+  template <specfem::wavefield::type WavefieldType>
+  static std::size_t
+  snapshot_size(const simulation_field<WavefieldType> &field) {
+    constexpr int elastic_components =
+        specfem::medium::medium<specfem::dimension::type::dim2,
+                                specfem::element::medium_tag::elastic>::
+            components;
+    constexpr int acoustic_components =
+        specfem::medium::medium<specfem::dimension::type::dim2,
+                                specfem::element::medium_tag::acoustic>::
+            components;
+
+    // displacement, velocity and acceleration
+    return 3 * sizeof(type_field) *
+           (static_cast<std::size_t>(field.elastic.nglob) * elastic_components +
+            static_cast<std::size_t>(field.acoustic.nglob) *
+                acoustic_components);
+  }
+
+  /**
+   * @brief Store a simulation field in a snapshot
+   *
+   * @tparam WavefieldType Wavefield type
+   * @param isnapshot Index of the snapshot
+   * @param field Simulation field to store
+   */
+  template <specfem::wavefield::type WavefieldType>
+  void store(const int isnapshot,
+             const simulation_field<WavefieldType> &field) const {
+    copy_to_snapshot(isnapshot, field.elastic, elastic);
+    copy_to_snapshot(isnapshot, field.acoustic, acoustic);
+  }
+
+  /**
+   * @brief Restore a simulation field from a snapshot
+   *
+   * @tparam WavefieldType Wavefield type
+   * @param isnapshot Index of the snapshot
+   * @param field Simulation field to restore (output)
+   */
+  template <specfem::wavefield::type WavefieldType>
+  void restore(const int isnapshot,
+               const simulation_field<WavefieldType> &field) const {
+    copy_from_snapshot(isnapshot, elastic, field.elastic);
+    copy_from_snapshot(isnapshot, acoustic, field.acoustic);
+  }
+
+  int nsnapshots = 0; ///< Number of snapshots
+
+private:
+  template <specfem::dimension::type DimensionType,
+            specfem::element::medium_tag MediumTag>
+  static void
+  copy_to_snapshot(const int isnapshot,
+                   const impl::field_impl<DimensionType, MediumTag> &field,
+                   const impl::medium_snapshots<DimensionType, MediumTag>
+                       &snapshots) {
+    Kokkos::deep_copy(Kokkos::subview(snapshots.field, Kokkos::ALL,
+                                      Kokkos::ALL, isnapshot),
+                      field.field);
+    Kokkos::deep_copy(Kokkos::subview(snapshots.field_dot, Kokkos::ALL,
+                                      Kokkos::ALL, isnapshot),
+                      field.field_dot);
+    Kokkos::deep_copy(Kokkos::subview(snapshots.field_dot_dot, Kokkos::ALL,
+                                      Kokkos::ALL, isnapshot),
+                      field.field_dot_dot);
+  }
+
+  template <specfem::dimension::type DimensionType,
+            specfem::element::medium_tag MediumTag>
+  static void copy_from_snapshot(
+      const int isnapshot,
+      const impl::medium_snapshots<DimensionType, MediumTag> &snapshots,
+      const impl::field_impl<DimensionType, MediumTag> &field) {
+    Kokkos::deep_copy(field.field, Kokkos::subview(snapshots.field,
+                                                   Kokkos::ALL, Kokkos::ALL,
+                                                   isnapshot));
+    Kokkos::deep_copy(field.field_dot, Kokkos::subview(snapshots.field_dot,
+                                                       Kokkos::ALL,
+                                                       Kokkos::ALL, isnapshot));
+    Kokkos::deep_copy(field.field_dot_dot,
+                      Kokkos::subview(snapshots.field_dot_dot, Kokkos::ALL,
+                                      Kokkos::ALL, isnapshot));
+  }
+
+  impl::medium_snapshots<specfem::dimension::type::dim2,
+                         specfem::element::medium_tag::elastic>
+      elastic; ///< Elastic snapshots
+  impl::medium_snapshots<specfem::dimension::type::dim2,
+                         specfem::element::medium_tag::acoustic>
+      acoustic; ///< Acoustic snapshots
+};
+
+} // namespace compute
+} // namespace specfem
@@ -8,10 +8,13 @@
 #include "compute_receivers.hpp"
 // #include "compute_sources.hpp"
 // #include "coupled_interfaces.hpp"
+#include "affine_element_partition.hpp"
 #include "assembly/assembly.hpp"
+#include "assembly_cache.hpp"
 #include "boundary_values/boundary_values.hpp"
 #include "coupled_interfaces/coupled_interfaces.hpp"
 #include "coupled_interfaces/interface_container.hpp"
+#include "element_coloring.hpp"
 #include "fields/fields.hpp"
 #include "properties/interface.hpp"
 #include "sources/source_medium.hpp"
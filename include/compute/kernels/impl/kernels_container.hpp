@@ -1,5 +1,7 @@
 #pragma once
 
+#include "compute/memory_footprint.hpp"
+#include "datatypes/simd.hpp"
 #include "enumerations/medium.hpp"
 #include "kokkos_abstractions.h"
 #include "point/coordinates.hpp"
@@ -26,7 +28,7 @@ public:
   int ngllz;
   int ngllx;
 
-  using ViewType = Kokkos::View<type_real ***, Kokkos::LayoutLeft,
+  using ViewType = Kokkos::View<type_field ***, Kokkos::LayoutLeft,
                                 Kokkos::DefaultExecutionSpace>;
 
   ViewType rho;
@@ -99,9 +101,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -109,18 +109,16 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    Kokkos::Experimental::where(mask, kernels.rho)
-        .copy_from(&rho(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.mu)
-        .copy_from(&mu(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.kappa)
-        .copy_from(&kappa(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.rhop)
-        .copy_from(&rhop(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.alpha)
-        .copy_from(&alpha(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.beta)
-        .copy_from(&beta(ispec, iz, ix), tag_type());
+    specfem::datatype::masked_copy_from(mask, kernels.rho, &rho(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.mu, &mu(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.kappa,
+                                        &kappa(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.rhop,
+                                        &rhop(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.alpha,
+                                        &alpha(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.beta,
+                                        &beta(ispec, iz, ix));
   }
 
   template <
@@ -155,9 +153,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -165,18 +161,17 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    Kokkos::Experimental::where(mask, kernels.rho)
-        .copy_from(&h_rho(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.mu)
-        .copy_from(&h_mu(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.kappa)
-        .copy_from(&h_kappa(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.rhop)
-        .copy_from(&h_rhop(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.alpha)
-        .copy_from(&h_alpha(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.beta)
-        .copy_from(&h_beta(ispec, iz, ix), tag_type());
+    specfem::datatype::masked_copy_from(mask, kernels.rho,
+                                        &h_rho(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.mu, &h_mu(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.kappa,
+                                        &h_kappa(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.rhop,
+                                        &h_rhop(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.alpha,
+                                        &h_alpha(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.beta,
+                                        &h_beta(ispec, iz, ix));
   }
 
   template <
@@ -211,9 +206,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -221,18 +214,14 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    Kokkos::Experimental::where(mask, kernels.rho)
-        .copy_to(&rho(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.mu)
-        .copy_to(&mu(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.kappa)
-        .copy_to(&kappa(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.rhop)
-        .copy_to(&rhop(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.alpha)
-        .copy_to(&alpha(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.beta)
-        .copy_to(&beta(ispec, iz, ix), tag_type());
+    specfem::datatype::masked_copy_to(mask, kernels.rho, &rho(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.mu, &mu(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.kappa,
+                                      &kappa(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.rhop, &rhop(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.alpha,
+                                      &alpha(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.beta, &beta(ispec, iz, ix));
   }
 
   template <
@@ -267,9 +256,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -277,18 +264,16 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    Kokkos::Experimental::where(mask, kernels.rho)
-        .copy_to(&h_rho(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.mu)
-        .copy_to(&h_mu(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.kappa)
-        .copy_to(&h_kappa(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.rhop)
-        .copy_to(&h_rhop(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.alpha)
-        .copy_to(&h_alpha(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.beta)
-        .copy_to(&h_beta(ispec, iz, ix), tag_type());
+    specfem::datatype::masked_copy_to(mask, kernels.rho, &h_rho(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.mu, &h_mu(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.kappa,
+                                      &h_kappa(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.rhop,
+                                      &h_rhop(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.alpha,
+                                      &h_alpha(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.beta,
+                                      &h_beta(ispec, iz, ix));
   }
 
   template <
@@ -323,9 +308,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -333,43 +316,14 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    simd_type lhs;
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&rho(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.rho;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&rho(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&mu(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.mu;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&mu(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&kappa(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.kappa;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&kappa(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&rhop(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.rhop;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&rhop(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&alpha(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.alpha;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&alpha(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&beta(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.beta;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&beta(ispec, iz, ix),
-                                                   tag_type());
+    specfem::datatype::masked_add_to(mask, kernels.rho, &rho(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.mu, &mu(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.kappa,
+                                     &kappa(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.rhop, &rhop(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.alpha,
+                                     &alpha(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.beta, &beta(ispec, iz, ix));
   }
 
   template <
@@ -404,9 +358,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -414,43 +366,16 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    simd_type lhs;
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&h_rho(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.rho;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&h_rho(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&h_mu(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.mu;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&h_mu(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&h_kappa(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.kappa;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&h_kappa(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&h_rhop(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.rhop;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&h_rhop(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&h_alpha(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.alpha;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&h_alpha(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&h_beta(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.beta;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&h_beta(ispec, iz, ix),
-                                                   tag_type());
+    specfem::datatype::masked_add_to(mask, kernels.rho, &h_rho(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.mu, &h_mu(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.kappa,
+                                     &h_kappa(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.rhop,
+                                     &h_rhop(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.alpha,
+                                     &h_alpha(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.beta,
+                                     &h_beta(ispec, iz, ix));
   }
 
   void copy_to_host() {
@@ -471,6 +396,17 @@ public:
     Kokkos::deep_copy(beta, h_beta);
   }
 
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(rho, h_rho)
+        .add(mu, h_mu)
+        .add(kappa, h_kappa)
+        .add(rhop, h_rhop)
+        .add(alpha, h_alpha)
+        .add(beta, h_beta);
+    return footprint;
+  }
+
   void initialize() {
     Kokkos::parallel_for(
         "specfem::compute::impl::kernels::elastic::initialize",
@@ -498,7 +434,7 @@ public:
   int ngllz;
   int ngllx;
 
-  using ViewType = Kokkos::View<type_real ***, Kokkos::LayoutLeft,
+  using ViewType = Kokkos::View<type_field ***, Kokkos::LayoutLeft,
                                 Kokkos::DefaultExecutionSpace>;
   ViewType rho;
   ViewType::HostMirror h_rho;
@@ -559,9 +495,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -569,14 +503,13 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    Kokkos::Experimental::where(mask, kernels.rho)
-        .copy_from(&rho(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.kappa)
-        .copy_from(&kappa(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.rhop)
-        .copy_from(&rho_prime(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.alpha)
-        .copy_from(&alpha(ispec, iz, ix), tag_type());
+    specfem::datatype::masked_copy_from(mask, kernels.rho, &rho(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.kappa,
+                                        &kappa(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.rhop,
+                                        &rho_prime(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.alpha,
+                                        &alpha(ispec, iz, ix));
   }
 
   template <
@@ -609,9 +542,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -619,14 +550,14 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    Kokkos::Experimental::where(mask, kernels.rho)
-        .copy_from(&h_rho(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.kappa)
-        .copy_from(&h_kappa(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.rhop)
-        .copy_from(&h_rho_prime(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.alpha)
-        .copy_from(&h_alpha(ispec, iz, ix), tag_type());
+    specfem::datatype::masked_copy_from(mask, kernels.rho,
+                                        &h_rho(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.kappa,
+                                        &h_kappa(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.rhop,
+                                        &h_rho_prime(ispec, iz, ix));
+    specfem::datatype::masked_copy_from(mask, kernels.alpha,
+                                        &h_alpha(ispec, iz, ix));
   }
 
   template <
@@ -659,9 +590,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -669,14 +598,13 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    Kokkos::Experimental::where(mask, kernels.rho)
-        .copy_to(&rho(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.kappa)
-        .copy_to(&kappa(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.rhop)
-        .copy_to(&rho_prime(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.alpha)
-        .copy_to(&alpha(ispec, iz, ix), tag_type());
+    specfem::datatype::masked_copy_to(mask, kernels.rho, &rho(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.kappa,
+                                      &kappa(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.rhop,
+                                      &rho_prime(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.alpha,
+                                      &alpha(ispec, iz, ix));
   }
 
   template <
@@ -709,9 +637,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -719,14 +645,13 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    Kokkos::Experimental::where(mask, kernels.rho)
-        .copy_to(&h_rho(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.kappa)
-        .copy_to(&h_kappa(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.rhop)
-        .copy_to(&h_rho_prime(ispec, iz, ix), tag_type());
-    Kokkos::Experimental::where(mask, kernels.alpha)
-        .copy_to(&h_alpha(ispec, iz, ix), tag_type());
+    specfem::datatype::masked_copy_to(mask, kernels.rho, &h_rho(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.kappa,
+                                      &h_kappa(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.rhop,
+                                      &h_rho_prime(ispec, iz, ix));
+    specfem::datatype::masked_copy_to(mask, kernels.alpha,
+                                      &h_alpha(ispec, iz, ix));
   }
 
   template <
@@ -759,9 +684,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -769,31 +692,13 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    simd_type lhs;
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&rho(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.rho;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&rho(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&kappa(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.kappa;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&kappa(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&rho_prime(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.rhop;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&rho_prime(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&alpha(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.alpha;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&alpha(ispec, iz, ix),
-                                                   tag_type());
+    specfem::datatype::masked_add_to(mask, kernels.rho, &rho(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.kappa,
+                                     &kappa(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.rhop,
+                                     &rho_prime(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.alpha,
+                                     &alpha(ispec, iz, ix));
   }
 
   template <
@@ -826,9 +731,7 @@ public:
     static_assert(PointKernelType::medium_tag == value_type);
     static_assert(PointKernelType::property_tag == property_type);
 
-    using simd_type = typename PointKernelType::simd::datatype;
     using mask_type = typename PointKernelType::simd::mask_type;
-    using tag_type = typename PointKernelType::simd::tag_type;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -836,31 +739,13 @@ public:
     const int iz = index.iz;
     const int ix = index.ix;
 
-    simd_type lhs;
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&h_rho(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.rho;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&h_rho(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&h_kappa(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.kappa;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&h_kappa(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(
-        &h_rho_prime(ispec, iz, ix), tag_type());
-    lhs += kernels.rhop;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&h_rho_prime(ispec, iz, ix),
-                                                   tag_type());
-
-    Kokkos::Experimental::where(mask, lhs).copy_from(&h_alpha(ispec, iz, ix),
-                                                     tag_type());
-    lhs += kernels.alpha;
-    Kokkos::Experimental::where(mask, lhs).copy_to(&h_alpha(ispec, iz, ix),
-                                                   tag_type());
+    specfem::datatype::masked_add_to(mask, kernels.rho, &h_rho(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.kappa,
+                                     &h_kappa(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.rhop,
+                                     &h_rho_prime(ispec, iz, ix));
+    specfem::datatype::masked_add_to(mask, kernels.alpha,
+                                     &h_alpha(ispec, iz, ix));
   }
 
   void copy_to_host() {
@@ -877,6 +762,15 @@ public:
     Kokkos::deep_copy(alpha, h_alpha);
   }
 
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(rho, h_rho)
+        .add(kappa, h_kappa)
+        .add(rho_prime, h_rho_prime)
+        .add(alpha, h_alpha);
+    return footprint;
+  }
+
   void initialize() {
     Kokkos::parallel_for(
         "specfem::compute::impl::kernels::acoustic::initialize",
@@ -95,6 +95,21 @@ public:
     elastic_isotropic.copy_to_device();
     acoustic_isotropic.copy_to_device();
   }
+
+  /**
+   * @brief Memory allocated to store the misfit kernels
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(element_types, h_element_types)
+        .add(element_property, h_element_property)
+        .add(property_index_mapping, h_property_index_mapping);
+    footprint += elastic_isotropic.get_memory_footprint();
+    footprint += acoustic_isotropic.get_memory_footprint();
+    return footprint;
+  }
 };
 
 /**
@@ -0,0 +1,83 @@
+#ifndef _COMPUTE_MEMORY_FOOTPRINT_HPP
+#define _COMPUTE_MEMORY_FOOTPRINT_HPP
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+
+namespace specfem {
+namespace compute {
+
+/**
+ * @brief Memory allocated by the views of a container
+ *
+ * Views are attributed to host or device memory by their memory space. When
+ * the device memory space is accessible from the host (e.g. serial or OpenMP
+ * builds) host mirrors alias the device views and are not counted twice.
+ */
+struct memory_footprint {
+  std::size_t device = 0; ///< Bytes allocated in device memory
+  std::size_t host = 0;   ///< Bytes allocated in host memory
+
+  /**
+   * @brief Add the allocation of a view
+   *
+   * @tparam ViewType Kokkos view type
+   * @param view View to add
+   * @return memory_footprint& Reference to this footprint
+   */
+  template <typename ViewType>
+  memory_footprint &add(const ViewType &view) {
+    const std::size_t bytes =
+        view.span() * sizeof(typename ViewType::value_type);
+    if constexpr (Kokkos::SpaceAccessibility<
+                      Kokkos::HostSpace,
+                      typename ViewType::memory_space>::accessible) {
+      host += bytes;
+    } else {
+      device += bytes;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Add the allocation of a view and its host mirror
+   *
+   * The mirror is only added if it does not alias the view.
+   *
+   * @tparam ViewType Kokkos view type
+   * @tparam MirrorType Kokkos view type of the mirror
+   * @param view View to add
+   * @param mirror Host mirror of @p view
+   * @return memory_footprint& Reference to this footprint
+   */
+  template <typename ViewType, typename MirrorType>
+  memory_footprint &add(const ViewType &view, const MirrorType &mirror) {
+    this->add(view);
+    if (static_cast<const void *>(mirror.data()) !=
+        static_cast<const void *>(view.data())) {
+      this->add(mirror);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Add the footprint of another container
+   *
+   */
+  memory_footprint &operator+=(const memory_footprint &other) {
+    device += other.device;
+    host += other.host;
+    return *this;
+  }
+
+  /**
+   * @brief Total number of bytes allocated in host and device memory
+   *
+   */
+  std::size_t total() const { return device + host; }
+};
+
+} // namespace compute
+} // namespace specfem
+
+#endif /* _COMPUTE_MEMORY_FOOTPRINT_HPP */
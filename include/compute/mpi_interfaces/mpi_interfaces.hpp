@@ -0,0 +1,102 @@
+#pragma once
+
+#include "compute/compute_mesh.hpp"
+#include "compute/memory_footprint.hpp"
+#include "enumerations/dimension.hpp"
+#include "kokkos_abstractions.h"
+#include "mesh/mesh.hpp"
+#include "point/coordinates.hpp"
+#include "specfem_mpi/interface.hpp"
+#include <vector>
+
+namespace specfem {
+namespace compute {
+/**
+ * @brief Global points shared with the partitions of other MPI ranks
+ *
+ * Points shared with every neighbor are stored contiguously, starting at
+ * @c h_offsets(ineighbor). Within an interface, points are sorted by their
+ * coordinates so that both ranks sharing the interface list them in the same
+ * order. Values exchanged with a neighbor can then be packed and unpacked
+ * without sending indices.
+ */
+struct mpi_interfaces {
+  int nneighbors = 0; ///< Number of neighboring MPI ranks
+  int npoints = 0;    ///< Total number of points on all interfaces
+
+  const specfem::MPI::MPI *mpi = nullptr; ///< MPI object used to communicate
+                                          ///< with the neighbors
+
+  specfem::kokkos::HostView1d<int> h_neighbors; ///< Rank of every neighbor
+  specfem::kokkos::HostView1d<int> h_offsets;   ///< Index of the first point
+                                                ///< of every interface.
+                                                ///< (nneighbors + 1)
+  specfem::kokkos::DeviceView1d<int> index_mapping;  ///< Global index of
+                                                     ///< every interface point
+  specfem::kokkos::HostMirror1d<int> h_index_mapping; ///< Global index of
+                                                      ///< every interface
+                                                      ///< point
+
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Default constructor. No interfaces
+   *
+   */
+  mpi_interfaces() = default;
+
+  /**
+   * @brief Compute the points shared with the neighbors of this rank
+   *
+   * The number of points on every interface is checked against the number
+   * of points the neighbor found on the same interface. Communication goes
+   * through the MPI object of @p mesh.
+   *
+   * @param mesh Finite element mesh as read from mesher
+   * @param points Assembled global points
+   * @param mapping Mapping between mesh and compute spectral element indexing
+   */
+  mpi_interfaces(const specfem::mesh::mesh &mesh,
+                 const specfem::compute::points &points,
+                 const specfem::compute::mesh_to_compute_mapping &mapping);
+  ///@}
+
+  /**
+   * @brief Memory allocated to store the interfaces
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(index_mapping, h_index_mapping);
+    footprint.add(h_neighbors).add(h_offsets);
+    return footprint;
+  }
+};
+
+/**
+ * @brief Find the points owned by this MPI rank
+ *
+ * Sources and receivers are located on every rank. A point is owned by the
+ * rank whose partition contains it, i.e. the rank where the located point is
+ * closest to the requested coordinates. Ties between ranks sharing an
+ * interface are broken in favor of the lowest rank, so that every point is
+ * owned by exactly one rank.
+ *
+ * @param coordinates Global coordinates of the points
+ * @param mesh Assembled mesh of this rank
+ * @param mpi MPI object of the ranks sharing the mesh. Every point is owned
+ * by this rank if nullptr
+ * @return std::vector<bool> True for every point owned by this rank
+ */
+std::vector<bool> owned_points(
+    const std::vector<
+        specfem::point::global_coordinates<specfem::dimension::type::dim2> >
+        &coordinates,
+    const specfem::compute::mesh &mesh, const specfem::MPI::MPI *mpi);
+
+} // namespace compute
+} // namespace specfem
@@ -20,6 +20,12 @@ struct material_property
 
   material_property() = default;
 
+  /**
+   * @brief Compute the properties of every element of this medium
+   *
+   * Mesh materials are assigned per element, so every element is homogeneous
+   * by construction and storing the properties once per element is exact.
+   */
   material_property(
       const int nspec, const int n_element, const int ngllz, const int ngllx,
       const specfem::compute::mesh_to_compute_mapping &mapping,
@@ -28,7 +34,7 @@ struct material_property
       const specfem::kokkos::HostView1d<int> property_index_mapping)
       : specfem::compute::impl::properties::properties_container<type,
                                                                  property>(
-            n_element, ngllz, ngllx) {
+            n_element, ngllz, ngllx, true) {
 
     int count = 0;
     for (int ispec = 0; ispec < nspec; ++ispec) {
@@ -37,19 +43,11 @@ struct material_property
 
       if ((tag.medium_tag == type) && (tag.property_tag == property)) {
         property_index_mapping(ispec) = count;
-        for (int iz = 0; iz < ngllz; ++iz) {
-          for (int ix = 0; ix < ngllx; ++ix) {
-            // Get the material at index from mesh::materials
-            auto material =
-                std::get<specfem::material::material<type, property> >(
-                    materials[ispec_mesh]);
-
-            // Assign the material property to the property container
-            auto point_property = material.get_properties();
-            this->assign(specfem::point::index<dimension>(count, iz, ix),
-                         point_property);
-          }
-        }
+        // Assign the material property to the property container
+        auto material = std::get<specfem::material::material<type, property> >(
+            materials[ispec_mesh]);
+        this->assign(specfem::point::index<dimension>(count, 0, 0),
+                     material.get_properties());
         count++;
       }
     }
@@ -1,6 +1,7 @@
 #ifndef _COMPUTE_PROPERTIES_IMPL_HPP
 #define _COMPUTE_PROPERTIES_IMPL_HPP
 
+#include "compute/memory_footprint.hpp"
 #include "point/interface.hpp"
 #include <Kokkos_SIMD.hpp>
 
@@ -10,6 +11,16 @@ namespace impl {
 
 namespace properties {
 
+/**
+ * @brief Material properties of every element of a medium
+ *
+ * Properties are stored either at every quadrature point or, for homogeneous
+ * elements, once per element together with the quantities derived from them.
+ * Both storage modes share the same data access functions.
+ *
+ * @tparam type Medium tag
+ * @tparam property Property tag
+ */
 template <specfem::element::medium_tag type,
           specfem::element::property_tag property>
 struct properties_container {
@@ -28,10 +39,14 @@ struct properties_container<specfem::element::medium_tag::elastic,
 
   using ViewType = typename Kokkos::View<type_real ***, Kokkos::LayoutLeft,
                                          Kokkos::DefaultExecutionSpace>;
+  using ElementViewType =
+      typename Kokkos::View<type_real *, Kokkos::LayoutLeft,
+                            Kokkos::DefaultExecutionSpace>;
 
   int nspec; ///< total number of acoustic spectral elements
   int ngllz; ///< number of quadrature points in z dimension
   int ngllx; ///< number of quadrature points in x dimension
+  bool per_element = false; ///< Properties are stored once per element
   ViewType rho;
   ViewType::HostMirror h_rho;
   ViewType mu;
@@ -39,17 +54,70 @@ struct properties_container<specfem::element::medium_tag::elastic,
   ViewType lambdaplus2mu;
   ViewType::HostMirror h_lambdaplus2mu;
 
+  /**
+   * @name Per-element storage
+   *
+   * Only allocated if @ref per_element is true. The derived quantities are
+   * stored to avoid computing them on every load.
+   */
+  ///@{
+  ElementViewType element_rho;
+  ElementViewType::HostMirror h_element_rho;
+  ElementViewType element_mu;
+  ElementViewType::HostMirror h_element_mu;
+  ElementViewType element_lambdaplus2mu;
+  ElementViewType::HostMirror h_element_lambdaplus2mu;
+  ElementViewType element_lambda;
+  ElementViewType::HostMirror h_element_lambda;
+  ElementViewType element_rho_vp;
+  ElementViewType::HostMirror h_element_rho_vp;
+  ElementViewType element_rho_vs;
+  ElementViewType::HostMirror h_element_rho_vs;
+  ///@}
+
   properties_container() = default;
 
-  properties_container(const int nspec, const int ngllz, const int ngllx)
-      : nspec(nspec), ngllz(ngllz), ngllx(ngllx),
-        rho("specfem::compute::properties::rho", nspec, ngllz, ngllx),
+  /**
+   * @brief Allocate the properties of a medium
+   *
+   * @param nspec Number of elements of the medium
+   * @param ngllz Number of quadrature points in z dimension
+   * @param ngllx Number of quadrature points in x dimension
+   * @param per_element Store properties once per element. Requires every
+   * element to be homogeneous
+   */
+  properties_container(const int nspec, const int ngllz, const int ngllx,
+                       const bool per_element = false)
+      : nspec(nspec), ngllz(ngllz), ngllx(ngllx), per_element(per_element),
+        rho("specfem::compute::properties::rho", per_element ? 0 : nspec,
+            ngllz, ngllx),
         h_rho(Kokkos::create_mirror_view(rho)),
-        mu("specfem::compute::properties::mu", nspec, ngllz, ngllx),
+        mu("specfem::compute::properties::mu", per_element ? 0 : nspec, ngllz,
+           ngllx),
         h_mu(Kokkos::create_mirror_view(mu)),
-        lambdaplus2mu("specfem::compute::properties::lambdaplus2mu", nspec,
-                      ngllz, ngllx),
-        h_lambdaplus2mu(Kokkos::create_mirror_view(lambdaplus2mu)) {}
+        lambdaplus2mu("specfem::compute::properties::lambdaplus2mu",
+                      per_element ? 0 : nspec, ngllz, ngllx),
+        h_lambdaplus2mu(Kokkos::create_mirror_view(lambdaplus2mu)),
+        element_rho("specfem::compute::properties::element_rho",
+                    per_element ? nspec : 0),
+        h_element_rho(Kokkos::create_mirror_view(element_rho)),
+        element_mu("specfem::compute::properties::element_mu",
+                   per_element ? nspec : 0),
+        h_element_mu(Kokkos::create_mirror_view(element_mu)),
+        element_lambdaplus2mu(
+            "specfem::compute::properties::element_lambdaplus2mu",
+            per_element ? nspec : 0),
+        h_element_lambdaplus2mu(
+            Kokkos::create_mirror_view(element_lambdaplus2mu)),
+        element_lambda("specfem::compute::properties::element_lambda",
+                       per_element ? nspec : 0),
+        h_element_lambda(Kokkos::create_mirror_view(element_lambda)),
+        element_rho_vp("specfem::compute::properties::element_rho_vp",
+                       per_element ? nspec : 0),
+        h_element_rho_vp(Kokkos::create_mirror_view(element_rho_vp)),
+        element_rho_vs("specfem::compute::properties::element_rho_vs",
+                       per_element ? nspec : 0),
+        h_element_rho_vs(Kokkos::create_mirror_view(element_rho_vs)) {}
 
   template <
       typename PointProperties,
@@ -69,6 +137,16 @@ struct properties_container<specfem::element::medium_tag::elastic,
     const int iz = index.iz;
     const int ix = index.ix;
 
+    if (per_element) {
+      property.rho = element_rho(ispec);
+      property.mu = element_mu(ispec);
+      property.lambdaplus2mu = element_lambdaplus2mu(ispec);
+      property.lambda = element_lambda(ispec);
+      property.rho_vp = element_rho_vp(ispec);
+      property.rho_vs = element_rho_vs(ispec);
+      return;
+    }
+
     property.rho = rho(ispec, iz, ix);
     property.mu = mu(ispec, iz, ix);
     property.lambdaplus2mu = lambdaplus2mu(ispec, iz, ix);
@@ -101,6 +179,22 @@ struct properties_container<specfem::element::medium_tag::elastic,
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
+    if (per_element) {
+      Kokkos::Experimental::where(mask, property.rho)
+          .copy_from(&element_rho(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.mu)
+          .copy_from(&element_mu(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.lambdaplus2mu)
+          .copy_from(&element_lambdaplus2mu(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.lambda)
+          .copy_from(&element_lambda(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.rho_vp)
+          .copy_from(&element_rho_vp(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.rho_vs)
+          .copy_from(&element_rho_vs(ispec), tag_type());
+      return;
+    }
+
     Kokkos::Experimental::where(mask, property.rho)
         .copy_from(&rho(ispec, iz, ix), tag_type());
     Kokkos::Experimental::where(mask, property.mu)
@@ -131,6 +225,16 @@ struct properties_container<specfem::element::medium_tag::elastic,
     const int iz = index.iz;
     const int ix = index.ix;
 
+    if (per_element) {
+      property.rho = h_element_rho(ispec);
+      property.mu = h_element_mu(ispec);
+      property.lambdaplus2mu = h_element_lambdaplus2mu(ispec);
+      property.lambda = h_element_lambda(ispec);
+      property.rho_vp = h_element_rho_vp(ispec);
+      property.rho_vs = h_element_rho_vs(ispec);
+      return;
+    }
+
     property.rho = h_rho(ispec, iz, ix);
     property.mu = h_mu(ispec, iz, ix);
     property.lambdaplus2mu = h_lambdaplus2mu(ispec, iz, ix);
@@ -163,6 +267,22 @@ struct properties_container<specfem::element::medium_tag::elastic,
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
+    if (per_element) {
+      Kokkos::Experimental::where(mask, property.rho)
+          .copy_from(&h_element_rho(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.mu)
+          .copy_from(&h_element_mu(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.lambdaplus2mu)
+          .copy_from(&h_element_lambdaplus2mu(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.lambda)
+          .copy_from(&h_element_lambda(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.rho_vp)
+          .copy_from(&h_element_rho_vp(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.rho_vs)
+          .copy_from(&h_element_rho_vs(ispec), tag_type());
+      return;
+    }
+
     Kokkos::Experimental::where(mask, property.rho)
         .copy_from(&h_rho(ispec, iz, ix), tag_type());
     Kokkos::Experimental::where(mask, property.mu)
@@ -179,14 +299,45 @@ struct properties_container<specfem::element::medium_tag::elastic,
     Kokkos::deep_copy(rho, h_rho);
     Kokkos::deep_copy(mu, h_mu);
     Kokkos::deep_copy(lambdaplus2mu, h_lambdaplus2mu);
+    Kokkos::deep_copy(element_rho, h_element_rho);
+    Kokkos::deep_copy(element_mu, h_element_mu);
+    Kokkos::deep_copy(element_lambdaplus2mu, h_element_lambdaplus2mu);
+    Kokkos::deep_copy(element_lambda, h_element_lambda);
+    Kokkos::deep_copy(element_rho_vp, h_element_rho_vp);
+    Kokkos::deep_copy(element_rho_vs, h_element_rho_vs);
   }
 
   void copy_to_host() {
     Kokkos::deep_copy(h_rho, rho);
     Kokkos::deep_copy(h_mu, mu);
     Kokkos::deep_copy(h_lambdaplus2mu, lambdaplus2mu);
+    Kokkos::deep_copy(h_element_rho, element_rho);
+    Kokkos::deep_copy(h_element_mu, element_mu);
+    Kokkos::deep_copy(h_element_lambdaplus2mu, element_lambdaplus2mu);
+    Kokkos::deep_copy(h_element_lambda, element_lambda);
+    Kokkos::deep_copy(h_element_rho_vp, element_rho_vp);
+    Kokkos::deep_copy(h_element_rho_vs, element_rho_vs);
   }
 
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(rho, h_rho)
+        .add(mu, h_mu)
+        .add(lambdaplus2mu, h_lambdaplus2mu)
+        .add(element_rho, h_element_rho)
+        .add(element_mu, h_element_mu)
+        .add(element_lambdaplus2mu, h_element_lambdaplus2mu)
+        .add(element_lambda, h_element_lambda)
+        .add(element_rho_vp, h_element_rho_vp)
+        .add(element_rho_vs, h_element_rho_vs);
+    return footprint;
+  }
+
+  /**
+   * @brief Store the properties at a quadrature point on the host
+   *
+   * With per-element storage the properties are stored for the whole element.
+   */
   template <
       typename PointProperties,
       typename std::enable_if_t<!PointProperties::simd::using_simd, int> = 0>
@@ -204,11 +355,28 @@ struct properties_container<specfem::element::medium_tag::elastic,
     const int iz = index.iz;
     const int ix = index.ix;
 
+    if (per_element) {
+      h_element_rho(ispec) = property.rho;
+      h_element_mu(ispec) = property.mu;
+      h_element_lambdaplus2mu(ispec) = property.lambdaplus2mu;
+      h_element_lambda(ispec) = property.lambdaplus2mu - 2 * property.mu;
+      h_element_rho_vp(ispec) = sqrt(property.rho * property.lambdaplus2mu);
+      h_element_rho_vs(ispec) = sqrt(property.rho * property.mu);
+      return;
+    }
+
     h_rho(ispec, iz, ix) = property.rho;
     h_mu(ispec, iz, ix) = property.mu;
     h_lambdaplus2mu(ispec, iz, ix) = property.lambdaplus2mu;
   }
 
+  /**
+   * @brief Store the properties at a quadrature point of multiple elements on
+   * the host
+   *
+   * With per-element storage the properties are stored for the whole
+   * elements.
+   */
   template <
       typename PointProperties,
       typename std::enable_if_t<PointProperties::simd::using_simd, int> = 0>
@@ -232,6 +400,25 @@ struct properties_container<specfem::element::medium_tag::elastic,
 
     mask_type mask([&, this](std::size_t lane) { return index.mask(lane); });
 
+    if (per_element) {
+      const auto lambda = property.lambdaplus2mu - 2 * property.mu;
+      const auto rho_vp = Kokkos::sqrt(property.rho * property.lambdaplus2mu);
+      const auto rho_vs = Kokkos::sqrt(property.rho * property.mu);
+      Kokkos::Experimental::where(mask, property.rho)
+          .copy_to(&h_element_rho(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.mu)
+          .copy_to(&h_element_mu(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.lambdaplus2mu)
+          .copy_to(&h_element_lambdaplus2mu(ispec), tag_type());
+      Kokkos::Experimental::where(mask, lambda)
+          .copy_to(&h_element_lambda(ispec), tag_type());
+      Kokkos::Experimental::where(mask, rho_vp)
+          .copy_to(&h_element_rho_vp(ispec), tag_type());
+      Kokkos::Experimental::where(mask, rho_vs)
+          .copy_to(&h_element_rho_vs(ispec), tag_type());
+      return;
+    }
+
     Kokkos::Experimental::where(mask, property.rho)
         .copy_to(&h_rho(ispec, iz, ix), tag_type());
     Kokkos::Experimental::where(mask, property.mu)
@@ -252,10 +439,14 @@ struct properties_container<specfem::element::medium_tag::acoustic,
 
   using ViewType = typename Kokkos::View<type_real ***, Kokkos::LayoutLeft,
                                          Kokkos::DefaultExecutionSpace>;
+  using ElementViewType =
+      typename Kokkos::View<type_real *, Kokkos::LayoutLeft,
+                            Kokkos::DefaultExecutionSpace>;
 
   int nspec; ///< total number of acoustic spectral elements
   int ngllz; ///< number of quadrature points in z dimension
   int ngllx; ///< number of quadrature points in x dimension
+  bool per_element = false; ///< Properties are stored once per element
   ViewType rho_inverse;
   ViewType::HostMirror h_rho_inverse;
   ViewType lambdaplus2mu_inverse;
@@ -263,20 +454,64 @@ struct properties_container<specfem::element::medium_tag::acoustic,
   ViewType kappa;
   ViewType::HostMirror h_kappa;
 
+  /**
+   * @name Per-element storage
+   *
+   * Only allocated if @ref per_element is true. The derived quantities are
+   * stored to avoid computing them on every load.
+   */
+  ///@{
+  ElementViewType element_rho_inverse;
+  ElementViewType::HostMirror h_element_rho_inverse;
+  ElementViewType element_lambdaplus2mu_inverse;
+  ElementViewType::HostMirror h_element_lambdaplus2mu_inverse;
+  ElementViewType element_kappa;
+  ElementViewType::HostMirror h_element_kappa;
+  ElementViewType element_rho_vpinverse;
+  ElementViewType::HostMirror h_element_rho_vpinverse;
+  ///@}
+
   properties_container() = default;
 
-  properties_container(const int nspec, const int ngllz, const int ngllx)
-      : nspec(nspec), ngllz(ngllz), ngllx(ngllx),
-        rho_inverse("specfem::compute::properties::rho_inverse", nspec, ngllz,
-                    ngllx),
+  /**
+   * @brief Allocate the properties of a medium
+   *
+   * @param nspec Number of elements of the medium
+   * @param ngllz Number of quadrature points in z dimension
+   * @param ngllx Number of quadrature points in x dimension
+   * @param per_element Store properties once per element. Requires every
+   * element to be homogeneous
+   */
+  properties_container(const int nspec, const int ngllz, const int ngllx,
+                       const bool per_element = false)
+      : nspec(nspec), ngllz(ngllz), ngllx(ngllx), per_element(per_element),
+        rho_inverse("specfem::compute::properties::rho_inverse",
+                    per_element ? 0 : nspec, ngllz, ngllx),
         h_rho_inverse(Kokkos::create_mirror_view(rho_inverse)),
         lambdaplus2mu_inverse(
-            "specfem::compute::properties::lambdaplus2mu_inverse", nspec, ngllz,
-            ngllx),
+            "specfem::compute::properties::lambdaplus2mu_inverse",
+            per_element ? 0 : nspec, ngllz, ngllx),
         h_lambdaplus2mu_inverse(
             Kokkos::create_mirror_view(lambdaplus2mu_inverse)),
-        kappa("specfem::compute::properties::kappa", nspec, ngllz, ngllx),
-        h_kappa(Kokkos::create_mirror_view(kappa)) {}
+        kappa("specfem::compute::properties::kappa", per_element ? 0 : nspec,
+              ngllz, ngllx),
+        h_kappa(Kokkos::create_mirror_view(kappa)),
+        element_rho_inverse("specfem::compute::properties::element_rho_inverse",
+                            per_element ? nspec : 0),
+        h_element_rho_inverse(Kokkos::create_mirror_view(element_rho_inverse)),
+        element_lambdaplus2mu_inverse(
+            "specfem::compute::properties::element_lambdaplus2mu_inverse",
+            per_element ? nspec : 0),
+        h_element_lambdaplus2mu_inverse(
+            Kokkos::create_mirror_view(element_lambdaplus2mu_inverse)),
+        element_kappa("specfem::compute::properties::element_kappa",
+                      per_element ? nspec : 0),
+        h_element_kappa(Kokkos::create_mirror_view(element_kappa)),
+        element_rho_vpinverse(
+            "specfem::compute::properties::element_rho_vpinverse",
+            per_element ? nspec : 0),
+        h_element_rho_vpinverse(
+            Kokkos::create_mirror_view(element_rho_vpinverse)) {}
 
   template <
       typename PointProperties,
@@ -296,6 +531,14 @@ struct properties_container<specfem::element::medium_tag::acoustic,
     const int iz = index.iz;
     const int ix = index.ix;
 
+    if (per_element) {
+      property.rho_inverse = element_rho_inverse(ispec);
+      property.lambdaplus2mu_inverse = element_lambdaplus2mu_inverse(ispec);
+      property.kappa = element_kappa(ispec);
+      property.rho_vpinverse = element_rho_vpinverse(ispec);
+      return;
+    }
+
     property.rho_inverse = rho_inverse(ispec, iz, ix);
     property.lambdaplus2mu_inverse = lambdaplus2mu_inverse(ispec, iz, ix);
     property.kappa = kappa(ispec, iz, ix);
@@ -327,6 +570,18 @@ struct properties_container<specfem::element::medium_tag::acoustic,
 
     mask_type mask([&, this](std::size_t lane) { return index.mask(lane); });
 
+    if (per_element) {
+      Kokkos::Experimental::where(mask, property.rho_inverse)
+          .copy_from(&element_rho_inverse(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.lambdaplus2mu_inverse)
+          .copy_from(&element_lambdaplus2mu_inverse(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.kappa)
+          .copy_from(&element_kappa(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.rho_vpinverse)
+          .copy_from(&element_rho_vpinverse(ispec), tag_type());
+      return;
+    }
+
     Kokkos::Experimental::where(mask, property.rho_inverse)
         .copy_from(&rho_inverse(ispec, iz, ix), tag_type());
     Kokkos::Experimental::where(mask, property.lambdaplus2mu_inverse)
@@ -356,6 +611,14 @@ struct properties_container<specfem::element::medium_tag::acoustic,
     const int iz = index.iz;
     const int ix = index.ix;
 
+    if (per_element) {
+      property.rho_inverse = h_element_rho_inverse(ispec);
+      property.lambdaplus2mu_inverse = h_element_lambdaplus2mu_inverse(ispec);
+      property.kappa = h_element_kappa(ispec);
+      property.rho_vpinverse = h_element_rho_vpinverse(ispec);
+      return;
+    }
+
     property.rho_inverse = h_rho_inverse(ispec, iz, ix);
     property.lambdaplus2mu_inverse = h_lambdaplus2mu_inverse(ispec, iz, ix);
     property.kappa = h_kappa(ispec, iz, ix);
@@ -387,6 +650,18 @@ struct properties_container<specfem::element::medium_tag::acoustic,
 
     mask_type mask([&, this](std::size_t lane) { return index.mask(lane); });
 
+    if (per_element) {
+      Kokkos::Experimental::where(mask, property.rho_inverse)
+          .copy_from(&h_element_rho_inverse(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.lambdaplus2mu_inverse)
+          .copy_from(&h_element_lambdaplus2mu_inverse(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.kappa)
+          .copy_from(&h_element_kappa(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.rho_vpinverse)
+          .copy_from(&h_element_rho_vpinverse(ispec), tag_type());
+      return;
+    }
+
     Kokkos::Experimental::where(mask, property.rho_inverse)
         .copy_from(&h_rho_inverse(ispec, iz, ix), tag_type());
     Kokkos::Experimental::where(mask, property.lambdaplus2mu_inverse)
@@ -402,14 +677,41 @@ struct properties_container<specfem::element::medium_tag::acoustic,
     Kokkos::deep_copy(rho_inverse, h_rho_inverse);
     Kokkos::deep_copy(lambdaplus2mu_inverse, h_lambdaplus2mu_inverse);
     Kokkos::deep_copy(kappa, h_kappa);
+    Kokkos::deep_copy(element_rho_inverse, h_element_rho_inverse);
+    Kokkos::deep_copy(element_lambdaplus2mu_inverse,
+                      h_element_lambdaplus2mu_inverse);
+    Kokkos::deep_copy(element_kappa, h_element_kappa);
+    Kokkos::deep_copy(element_rho_vpinverse, h_element_rho_vpinverse);
   }
 
   void copy_to_host() {
     Kokkos::deep_copy(h_rho_inverse, rho_inverse);
     Kokkos::deep_copy(h_lambdaplus2mu_inverse, lambdaplus2mu_inverse);
     Kokkos::deep_copy(h_kappa, kappa);
+    Kokkos::deep_copy(h_element_rho_inverse, element_rho_inverse);
+    Kokkos::deep_copy(h_element_lambdaplus2mu_inverse,
+                      element_lambdaplus2mu_inverse);
+    Kokkos::deep_copy(h_element_kappa, element_kappa);
+    Kokkos::deep_copy(h_element_rho_vpinverse, element_rho_vpinverse);
   }
 
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(rho_inverse, h_rho_inverse)
+        .add(lambdaplus2mu_inverse, h_lambdaplus2mu_inverse)
+        .add(kappa, h_kappa)
+        .add(element_rho_inverse, h_element_rho_inverse)
+        .add(element_lambdaplus2mu_inverse, h_element_lambdaplus2mu_inverse)
+        .add(element_kappa, h_element_kappa)
+        .add(element_rho_vpinverse, h_element_rho_vpinverse);
+    return footprint;
+  }
+
+  /**
+   * @brief Store the properties at a quadrature point on the host
+   *
+   * With per-element storage the properties are stored for the whole element.
+   */
   template <
       typename PointProperties,
       typename std::enable_if_t<!PointProperties::simd::using_simd, int> = 0>
@@ -427,11 +729,27 @@ struct properties_container<specfem::element::medium_tag::acoustic,
     const int iz = index.iz;
     const int ix = index.ix;
 
+    if (per_element) {
+      h_element_rho_inverse(ispec) = property.rho_inverse;
+      h_element_lambdaplus2mu_inverse(ispec) = property.lambdaplus2mu_inverse;
+      h_element_kappa(ispec) = property.kappa;
+      h_element_rho_vpinverse(ispec) =
+          sqrt(property.rho_inverse * property.lambdaplus2mu_inverse);
+      return;
+    }
+
     h_rho_inverse(ispec, iz, ix) = property.rho_inverse;
     h_lambdaplus2mu_inverse(ispec, iz, ix) = property.lambdaplus2mu_inverse;
     h_kappa(ispec, iz, ix) = property.kappa;
   }
 
+  /**
+   * @brief Store the properties at a quadrature point of multiple elements on
+   * the host
+   *
+   * With per-element storage the properties are stored for the whole
+   * elements.
+   */
   template <
       typename PointProperties,
       typename std::enable_if_t<PointProperties::simd::using_simd, int> = 0>
@@ -455,6 +773,20 @@ struct properties_container<specfem::element::medium_tag::acoustic,
 
     mask_type mask([&, this](std::size_t lane) { return index.mask(lane); });
 
+    if (per_element) {
+      const auto rho_vpinverse =
+          Kokkos::sqrt(property.rho_inverse * property.lambdaplus2mu_inverse);
+      Kokkos::Experimental::where(mask, property.rho_inverse)
+          .copy_to(&h_element_rho_inverse(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.lambdaplus2mu_inverse)
+          .copy_to(&h_element_lambdaplus2mu_inverse(ispec), tag_type());
+      Kokkos::Experimental::where(mask, property.kappa)
+          .copy_to(&h_element_kappa(ispec), tag_type());
+      Kokkos::Experimental::where(mask, rho_vpinverse)
+          .copy_to(&h_element_rho_vpinverse(ispec), tag_type());
+      return;
+    }
+
     Kokkos::Experimental::where(mask, property.rho_inverse)
         .copy_to(&h_rho_inverse(ispec, iz, ix), tag_type());
     Kokkos::Experimental::where(mask, property.lambdaplus2mu_inverse)
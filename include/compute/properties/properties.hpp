@@ -84,6 +84,13 @@ public:
              const specfem::mesh::materials &materials);
 
   ///@}
+
+  /**
+   * @brief Memory allocated to store the material properties
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const;
 };
 
 /**
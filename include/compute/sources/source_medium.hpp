@@ -28,6 +28,12 @@ private:
                                                    ///< store source time
                                                    ///< functions
 
+  using AnalyticView =
+      Kokkos::View<specfem::forcing_function::analytic_parameters *,
+                   Kokkos::DefaultExecutionSpace>; ///< Underlying view type to
+                                                   ///< store analytic source
+                                                   ///< time functions
+
   using SourceArrayView =
       Kokkos::View<type_real ****, Kokkos::LayoutRight,
                    Kokkos::DefaultExecutionSpace>; ///< Underlying view type to
@@ -71,22 +77,103 @@ public:
    * @param t0 Initial time
    * @param dt Time step
    * @param nsteps Number of time steps
+   * @param window Number of time steps of the tabulated source time functions
+   * stored on the device at any time
    */
   source_medium(
       const std::vector<std::shared_ptr<specfem::sources::source> > &sources,
       const specfem::compute::mesh &mesh,
       const specfem::compute::partial_derivatives &partial_derivatives,
       const specfem::compute::properties &properties, const type_real t0,
-      const type_real dt, const int nsteps);
+      const type_real dt, const int nsteps, const int window = 256);
   ///@}
 
+  /**
+   * @brief Make sure the window of tabulated source time functions stored on
+   * the device contains a time step
+   *
+   * The window is shifted forward or backward depending on the direction the
+   * time steps are iterated in. Must be called on the host before launching
+   * kernels that read the source time function at @p timestep.
+   *
+   * @param timestep Time step
+   * @return int Index of @p timestep within the window
+   */
+  int load_source_time_function(const int timestep) const;
+
+  /**
+   * @brief Tabulate the source time functions for the window of time steps
+   * starting at a time step and copy them to the device
+   *
+   * @param start First time step within the window
+   */
+  void load_window(const int start) const;
+
+  /**
+   * @brief Value of the source time function of a source
+   *
+   * Analytic source time functions are evaluated at @p time, other source
+   * time functions are read from the window loaded using
+   * load_source_time_function.
+   *
+   * @param isource Index of the source
+   * @param icomponent Component of the source time function
+   * @param time Time at the current time step
+   * @param iwindow Index of the current time step within the window
+   * @return type_real Value of the source time function
+   */
+  KOKKOS_INLINE_FUNCTION type_real
+  get_source_time_function(const int isource, const int icomponent,
+                           const type_real time, const int iwindow) const {
+    const auto &parameters = analytic(isource);
+    if (parameters.type != specfem::forcing_function::analytic_type::none) {
+      return parameters.compute(time);
+    }
+
+    return source_time_function(iwindow, tabulated_index(isource), icomponent);
+  }
+
+  /**
+   * @brief Memory allocated to store the source information
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(source_index_mapping, h_source_index_mapping)
+        .add(analytic, h_analytic)
+        .add(tabulated_index, h_tabulated_index)
+        .add(source_time_function, h_source_time_function)
+        .add(source_array, h_source_array);
+    return footprint;
+  }
+
+  type_real t0; ///< Initial time
+  type_real dt; ///< Time step
+  int nsteps;   ///< Number of time steps
+  int window;   ///< Number of time steps stored in source_time_function
+
   IndexView source_index_mapping; ///< Spectral element index for every source
   IndexView::HostMirror h_source_index_mapping; ///< Host mirror of
                                                 ///< source_index_mapping
-  SourceTimeFunctionView source_time_function;  ///< Source time function for
-                                                ///< every source
+  AnalyticView analytic; ///< Parameters of analytic source time functions for
+                         ///< every source
+  AnalyticView::HostMirror h_analytic; ///< Host mirror of analytic
+  IndexView tabulated_index; ///< Index of every source among the sources with
+                             ///< tabulated source time functions (-1 for
+                             ///< analytic ones)
+  IndexView::HostMirror h_tabulated_index; ///< Host mirror of
+                                           ///< tabulated_index
+  SourceTimeFunctionView source_time_function; ///< Tabulated source time
+                                               ///< functions for the time
+                                               ///< steps within the window
   SourceTimeFunctionView::HostMirror
-      h_source_time_function;   ///< Host mirror of source_time_function
+      h_source_time_function; ///< Host mirror of source_time_function
+  std::vector<std::shared_ptr<specfem::sources::source> >
+      tabulated_sources; ///< Sources whose source time functions are
+                         ///< tabulated, in the order of tabulated_index
+  Kokkos::View<int, Kokkos::HostSpace> window_start; ///< First time step
+                                                     ///< within the window
   SourceArrayView source_array; ///< Lagrange interpolants for every source
   SourceArrayView::HostMirror h_source_array; ///< Host mirror of source_array
 };
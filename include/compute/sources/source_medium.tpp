@@ -4,6 +4,7 @@
 #include "point/coordinates.hpp"
 #include "source_medium.hpp"
 #include <Kokkos_Core.hpp>
+#include <algorithm>
 
 template <specfem::dimension::type Dimension,
           specfem::element::medium_tag Medium>
@@ -13,27 +14,50 @@ specfem::compute::source_medium<Dimension, Medium>::
         const specfem::compute::mesh &mesh,
         const specfem::compute::partial_derivatives &partial_derivatives,
         const specfem::compute::properties &properties, const type_real t0,
-        const type_real dt, const int nsteps)
-    : source_index_mapping("specfem::sources::source_index_mapping",
+        const type_real dt, const int nsteps, const int window)
+    : t0(t0), dt(dt), nsteps(nsteps),
+      window(std::max(1, std::min(window, nsteps))),
+      source_index_mapping("specfem::sources::source_index_mapping",
                            sources.size()),
       h_source_index_mapping(Kokkos::create_mirror_view(source_index_mapping)),
-      source_time_function("specfem::sources::source_time_function", nsteps,
-                           sources.size(), components),
-      h_source_time_function(Kokkos::create_mirror_view(source_time_function)),
+      analytic("specfem::sources::analytic", sources.size()),
+      h_analytic(Kokkos::create_mirror_view(analytic)),
+      tabulated_index("specfem::sources::tabulated_index", sources.size()),
+      h_tabulated_index(Kokkos::create_mirror_view(tabulated_index)),
+      window_start("specfem::sources::window_start"),
       source_array("specfem::sources::source_array", sources.size(),
                    components, mesh.quadratures.gll.N,
                    mesh.quadratures.gll.N),
       h_source_array(Kokkos::create_mirror_view(source_array)) {
 
+  int ntabulated = 0;
+  for (int isource = 0; isource < sources.size(); isource++) {
+    this->h_analytic(isource) = sources[isource]->get_analytic_parameters();
+    this->h_tabulated_index(isource) =
+        (this->h_analytic(isource).type ==
+         specfem::forcing_function::analytic_type::none)
+            ? ntabulated++
+            : -1;
+  }
+
+  // Analytic source time functions are evaluated within the kernels. The
+  // remaining ones are tabulated on the host one window of time steps at a
+  // time, when the window is loaded
+  this->source_time_function =
+      SourceTimeFunctionView("specfem::sources::source_time_function",
+                             this->window, ntabulated, components);
+  this->h_source_time_function =
+      Kokkos::create_mirror_view(this->source_time_function);
+
   for (int isource = 0; isource < sources.size(); isource++) {
     auto sv_source_array = Kokkos::subview(
         this->h_source_array, isource, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
     sources[isource]->compute_source_array(mesh, partial_derivatives,
                                            properties, sv_source_array);
-    auto sv_stf_array = Kokkos::subview(this->h_source_time_function,
-                                        Kokkos::ALL, isource, Kokkos::ALL);
-    sources[isource]->compute_source_time_function(t0, dt, nsteps,
-                                                   sv_stf_array);
+    const int itabulated = this->h_tabulated_index(isource);
+    if (itabulated >= 0) {
+      this->tabulated_sources.push_back(sources[isource]);
+    }
     specfem::point::global_coordinates<specfem::dimension::type::dim2> coord(
         sources[isource]->get_x(), sources[isource]->get_z());
 
@@ -42,8 +66,59 @@ specfem::compute::source_medium<Dimension, Medium>::
   }
 
   Kokkos::deep_copy(source_array, h_source_array);
-  Kokkos::deep_copy(source_time_function, h_source_time_function);
+  Kokkos::deep_copy(analytic, h_analytic);
+  Kokkos::deep_copy(tabulated_index, h_tabulated_index);
   Kokkos::deep_copy(source_index_mapping, h_source_index_mapping);
 
+  this->window_start() = 0;
+  if (ntabulated > 0) {
+    this->load_window(0);
+  }
+
   return;
 }
+
+template <specfem::dimension::type Dimension,
+          specfem::element::medium_tag Medium>
+int specfem::compute::source_medium<Dimension, Medium>::
+    load_source_time_function(const int timestep) const {
+
+  if (this->source_time_function.extent(1) == 0)
+    return 0;
+
+  int start = this->window_start();
+
+  if ((timestep < start) || (timestep >= start + this->window)) {
+    // Fill the window with the time steps following (or preceding when
+    // iterating backward in time) the current time step
+    start = (timestep < start) ? std::max(0, timestep - this->window + 1)
+                               : std::min(timestep, nsteps - this->window);
+    this->load_window(start);
+  }
+
+  return timestep - start;
+}
+
+template <specfem::dimension::type Dimension,
+          specfem::element::medium_tag Medium>
+void specfem::compute::source_medium<Dimension, Medium>::load_window(
+    const int start) const {
+
+  specfem::kokkos::HostView2d<type_real> tabulated(
+      "specfem::sources::tabulated", this->window, components);
+
+  for (int itabulated = 0; itabulated < this->tabulated_sources.size();
+       itabulated++) {
+    this->tabulated_sources[itabulated]->compute_source_time_function(
+        this->t0, this->dt, start, this->window, tabulated);
+    for (int iwindow = 0; iwindow < this->window; iwindow++) {
+      for (int icomponent = 0; icomponent < components; icomponent++) {
+        this->h_source_time_function(iwindow, itabulated, icomponent) =
+            tabulated(iwindow, icomponent);
+      }
+    }
+  }
+
+  Kokkos::deep_copy(this->source_time_function, this->h_source_time_function);
+  this->window_start() = start;
+}
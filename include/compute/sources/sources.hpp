@@ -63,6 +63,21 @@ struct sources {
     }
   }
 
+  /**
+   * @brief Memory allocated to store the source information
+   *
+   * @return specfem::compute::memory_footprint Memory footprint
+   */
+  specfem::compute::memory_footprint get_memory_footprint() const {
+    specfem::compute::memory_footprint footprint;
+    footprint.add(source_domain_index_mapping)
+        .add(source_medium_mapping)
+        .add(source_wavefield_mapping);
+    footprint += acoustic_sources.get_memory_footprint();
+    footprint += elastic_sources.get_memory_footprint();
+    return footprint;
+  }
+
   int nsources; ///< Number of sources
   specfem::kokkos::HostView1d<int>
       source_domain_index_mapping; ///< Spectral element index for every source
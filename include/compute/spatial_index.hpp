@@ -0,0 +1,78 @@
+#ifndef _COMPUTE_SPATIAL_INDEX_HPP
+#define _COMPUTE_SPATIAL_INDEX_HPP
+
+#include "kokkos_abstractions.h"
+#include "point/coordinates.hpp"
+#include "specfem_setup.hpp"
+#include <tuple>
+
+namespace specfem {
+namespace compute {
+
+struct points;
+
+/**
+ * @brief Spatial index of the spectral elements used to locate points within
+ * the mesh
+ *
+ * Elements are binned into a uniform grid of cells by the bounding box of
+ * their quadrature points. The cells of an element, and the elements of a
+ * cell, are stored in compressed sparse row format: the elements of cell @c i
+ * are h_cell_elements(h_cell_offsets(i) : h_cell_offsets(i + 1)).
+ *
+ * The index also stores the adjacency of elements, i.e. the elements that
+ * share at least one corner with an element, in the same format.
+ *
+ * The index lives on the host and is built once per assembled mesh.
+ */
+struct spatial_index {
+  int nspec = 0;                   ///< Number of spectral elements
+  int ncells_x = 0;                ///< Number of cells along x
+  int ncells_z = 0;                ///< Number of cells along z
+  type_real xmin = 0.0;            ///< Lower x bound of the grid
+  type_real zmin = 0.0;            ///< Lower z bound of the grid
+  type_real cell_size_x = 1.0;     ///< Width of a cell
+  type_real cell_size_z = 1.0;     ///< Height of a cell
+  specfem::kokkos::HostView1d<int> h_cell_offsets; ///< Offset of every cell
+                                                   ///< within h_cell_elements
+  specfem::kokkos::HostView1d<int> h_cell_elements; ///< Elements overlapping
+                                                    ///< every cell
+  specfem::kokkos::HostView1d<int> h_adjacency_offsets; ///< Offset of every
+                                                        ///< element within
+                                                        ///< h_adjacency
+  specfem::kokkos::HostView1d<int> h_adjacency; ///< Elements sharing a corner
+                                                ///< with every element, in
+                                                ///< ascending order
+
+  spatial_index() = default;
+
+  /**
+   * @brief Build the spatial index of an assembled mesh
+   *
+   * @param points Global numbering and coordinates of the quadrature points
+   */
+  spatial_index(const specfem::compute::points &points);
+
+  /**
+   * @brief Find the quadrature point closest to a point
+   *
+   * Equivalent to a scan over every quadrature point of every element.
+   * Among equidistant quadrature points the one with the lowest (ispec, iz,
+   * ix) is returned.
+   *
+   * @param points Global numbering and coordinates of the quadrature points
+   * used to build the index
+   * @param coordinates Global coordinates of the point
+   * @return std::tuple<int, int, int> (ix, iz, ispec) of the closest
+   * quadrature point
+   */
+  std::tuple<int, int, int> closest_quadrature_point(
+      const specfem::compute::points &points,
+      const specfem::point::global_coordinates<specfem::dimension::type::dim2>
+          &coordinates) const;
+};
+
+} // namespace compute
+} // namespace specfem
+
+#endif
@@ -2,6 +2,7 @@
 
 #include "specfem_setup.hpp"
 #include <Kokkos_SIMD.hpp>
+#include <type_traits>
 
 namespace specfem {
 namespace datatype {
@@ -141,5 +142,94 @@ template <typename T, typename simd_type, bool UseSIMD> struct simd_like {
    */
   constexpr static int size() { return datatype::size(); }
 };
+
+/**
+ * @brief Load the lanes of a SIMD vector selected by a mask from contiguous
+ * memory
+ *
+ * Memory may hold a different type than the SIMD vector (e.g. wavefields stored
+ * in double precision within mixed precision builds), in which case lanes are
+ * converted one at a time.
+ *
+ * @tparam MaskType Mask type of the SIMD vector
+ * @tparam SIMDType SIMD vector type
+ * @tparam T Type of the values stored in memory
+ * @param mask Lanes to load
+ * @param value SIMD vector to load into
+ * @param ptr Pointer to the value of the first lane
+ */
+template <typename MaskType, typename SIMDType, typename T>
+KOKKOS_FORCEINLINE_FUNCTION void
+masked_copy_from(const MaskType &mask, SIMDType &value, const T *ptr) {
+  using value_type = typename SIMDType::value_type;
+  if constexpr (std::is_same_v<value_type, T>) {
+    Kokkos::Experimental::where(mask, value).copy_from(
+        ptr, Kokkos::Experimental::element_aligned_tag());
+  } else {
+    for (std::size_t lane = 0; lane < SIMDType::size(); ++lane) {
+      if (mask[lane]) {
+        value[lane] = static_cast<value_type>(ptr[lane]);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Store the lanes of a SIMD vector selected by a mask to contiguous
+ * memory
+ *
+ * @tparam MaskType Mask type of the SIMD vector
+ * @tparam SIMDType SIMD vector type
+ * @tparam T Type of the values stored in memory
+ * @param mask Lanes to store
+ * @param value SIMD vector to store
+ * @param ptr Pointer to the value of the first lane
+ */
+template <typename MaskType, typename SIMDType, typename T>
+KOKKOS_FORCEINLINE_FUNCTION void
+masked_copy_to(const MaskType &mask, const SIMDType &value, T *ptr) {
+  if constexpr (std::is_same_v<typename SIMDType::value_type, T>) {
+    Kokkos::Experimental::where(mask, value).copy_to(
+        ptr, Kokkos::Experimental::element_aligned_tag());
+  } else {
+    for (std::size_t lane = 0; lane < SIMDType::size(); ++lane) {
+      if (mask[lane]) {
+        ptr[lane] = static_cast<T>(value[lane]);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Add the lanes of a SIMD vector selected by a mask to contiguous
+ * memory
+ *
+ * The sum is evaluated in the precision of the values stored in memory.
+ *
+ * @tparam MaskType Mask type of the SIMD vector
+ * @tparam SIMDType SIMD vector type
+ * @tparam T Type of the values stored in memory
+ * @param mask Lanes to add
+ * @param value SIMD vector to add
+ * @param ptr Pointer to the value of the first lane
+ */
+template <typename MaskType, typename SIMDType, typename T>
+KOKKOS_FORCEINLINE_FUNCTION void
+masked_add_to(const MaskType &mask, const SIMDType &value, T *ptr) {
+  if constexpr (std::is_same_v<typename SIMDType::value_type, T>) {
+    SIMDType lhs;
+    Kokkos::Experimental::where(mask, lhs).copy_from(
+        ptr, Kokkos::Experimental::element_aligned_tag());
+    lhs += value;
+    Kokkos::Experimental::where(mask, lhs).copy_to(
+        ptr, Kokkos::Experimental::element_aligned_tag());
+  } else {
+    for (std::size_t lane = 0; lane < SIMDType::size(); ++lane) {
+      if (mask[lane]) {
+        ptr[lane] += static_cast<T>(value[lane]);
+      }
+    }
+  }
+}
 } // namespace datatype
 } // namespace specfem
@@ -2,6 +2,7 @@
 
 #include "compute/assembly/assembly.hpp"
 #include "impl/kernels.hpp"
+#include "parallel_configuration/chunk_tuning.hpp"
 #include "quadrature/interface.hpp"
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
@@ -55,6 +56,30 @@ public:
    */
   void divide_mass_matrix();
 
+  /**
+   * @brief Estimate the bytes read and written from global memory by one
+   * call to divide_mass_matrix
+   *
+   * @return std::size_t Estimated traffic in bytes
+   */
+  std::size_t divide_mass_matrix_traffic() const {
+    // Acceleration is read and written, mass matrix is read
+    return static_cast<std::size_t>(field.template get_nglob<MediumTag>()) *
+           medium_type::components * 3 * sizeof(type_field);
+  }
+
+  /**
+   * @brief Select the fastest chunk configuration of the stiffness kernels
+   *
+   * Looks up the choice in the tuning cache. If no entry exists, every
+   * compiled candidate is timed for a few calls of the stiffness kernels and
+   * the fastest is cached. The acceleration is restored after timing, so the
+   * wavefield is unchanged.
+   *
+   * @param tuning Tuning parameters. Nothing is done if tuning is disabled
+   */
+  void tune_chunk_config(const specfem::parallel_config::chunk_tuning &tuning);
+
 private:
   specfem::compute::simulation_field<WavefieldType> field; ///< Wavefield
 };
@@ -1,9 +1,15 @@
 #pragma once
 
 #include "domain.hpp"
+#include "instrumentation/instrumentation.hpp"
 #include "parallel_configuration/range_config.hpp"
 #include "policies/range.hpp"
 #include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <vector>
 
 template <specfem::wavefield::type WavefieldType,
           specfem::dimension::type DimensionType,
@@ -78,3 +84,86 @@ void specfem::domain::domain<WavefieldType, DimensionType, MediumTag,
 
   Kokkos::fence();
 }
+
+template <specfem::wavefield::type WavefieldType,
+          specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag, typename qp_type>
+void specfem::domain::domain<WavefieldType, DimensionType, MediumTag,
+                             qp_type>::
+    tune_chunk_config(const specfem::parallel_config::chunk_tuning &tuning) {
+  const auto candidates = this->describe_chunk_configs();
+  const int nelements = this->total_elements();
+  const int ncandidates = candidates.size();
+
+  if (!tuning.enabled() || ncandidates < 2 || nelements == 0)
+    return;
+
+  using simd = specfem::datatype::simd<type_real, true>;
+
+  std::ostringstream key;
+  key << specfem::parallel_config::chunk_tuning::hardware_key() << ":"
+      << specfem::instrumentation::to_string(WavefieldType) << ":"
+      << specfem::instrumentation::to_string(MediumTag)
+      << ":nspec=" << nelements << ":ngll=" << qp_type::NGLL
+      << ":real=" << sizeof(type_real) << ":simd=" << simd::size()
+      << ":colors=" << this->num_colors();
+
+  std::ostringstream message;
+  message << "Chunk tuning (" << specfem::instrumentation::to_string(MediumTag)
+          << ", " << specfem::instrumentation::to_string(WavefieldType)
+          << ") : ";
+
+  int best = 0;
+  if (tuning.load(key.str(), candidates, best)) {
+    this->set_chunk_config(best);
+    std::cout << message.str() << candidates[best] << " [cached]\n";
+    return;
+  }
+
+  // Stiffness contributions are accumulated into the acceleration. Restore
+  // it once every candidate has been timed
+  const auto acceleration = [&]() {
+    if constexpr (MediumTag == specfem::element::medium_tag::elastic) {
+      return field.elastic.field_dot_dot;
+    } else {
+      return field.acoustic.field_dot_dot;
+    }
+  }();
+
+  decltype(acceleration) saved(
+      "specfem::domain::domain::tune_chunk_config::acceleration",
+      acceleration.extent(0), acceleration.extent(1));
+  Kokkos::deep_copy(saved, acceleration);
+
+  std::vector<double> times(ncandidates);
+  for (int icandidate = 0; icandidate < ncandidates; ++icandidate) {
+    this->set_chunk_config(icandidate);
+
+    // The first call is not timed so that first-launch costs are excluded
+    this->compute_stiffness_interaction(0);
+    Kokkos::fence();
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int istep = 0; istep < tuning.get_nsteps(); ++istep) {
+      this->compute_stiffness_interaction(0);
+    }
+    Kokkos::fence();
+    const std::chrono::duration<double> elapsed =
+        std::chrono::high_resolution_clock::now() - start;
+    times[icandidate] = elapsed.count() / tuning.get_nsteps();
+  }
+
+  Kokkos::deep_copy(acceleration, saved);
+
+  best = std::min_element(times.begin(), times.end()) - times.begin();
+  this->set_chunk_config(best);
+  tuning.store(key.str(), candidates[best]);
+
+  std::cout << message.str() << candidates[best] << "\n";
+  for (int icandidate = 0; icandidate < ncandidates; ++icandidate) {
+    std::cout << "    " << candidates[icandidate] << " : "
+              << 1e3 * times[icandidate] << " ms\n";
+  }
+
+  return;
+}
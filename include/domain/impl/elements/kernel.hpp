@@ -6,6 +6,7 @@
 #include "enumerations/interface.hpp"
 #include "kokkos_abstractions.h"
 #include "parallel_configuration/chunk_config.hpp"
+#include "parallel_configuration/chunk_tuning.hpp"
 #include "point/boundary.hpp"
 #include "point/field.hpp"
 #include "point/field_derivatives.hpp"
@@ -14,6 +15,11 @@
 #include "policies/chunk.hpp"
 #include "quadrature/interface.hpp"
 #include "specfem_setup.hpp"
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace specfem {
 namespace domain {
@@ -21,12 +27,19 @@ namespace impl {
 namespace kernels {
 /**
  * @brief Datatypes used in the kernels
+ *
+ * @tparam ParallelConfigType Chunk configuration of the element policy.
+ * Defaults to @ref specfem::parallel_config::default_chunk_config
  */
 template <specfem::wavefield::type WavefieldType,
           specfem::dimension::type DimensionType,
           specfem::element::medium_tag MediumTag,
           specfem::element::property_tag PropertyTag,
-          specfem::element::boundary_tag BoundaryTag, int NGLL>
+          specfem::element::boundary_tag BoundaryTag, int NGLL,
+          typename ParallelConfigType =
+              specfem::parallel_config::default_chunk_config<
+                  DimensionType, specfem::datatype::simd<type_real, true>,
+                  Kokkos::DefaultExecutionSpace> >
 class KernelDatatypes {
 public:
   constexpr static auto wavefield_type = WavefieldType;
@@ -38,8 +51,7 @@ public:
   constexpr static bool using_simd = true;
 
   using simd = specfem::datatype::simd<type_real, using_simd>;
-  using ParallelConfig = specfem::parallel_config::default_chunk_config<
-      DimensionType, simd, Kokkos::DefaultExecutionSpace>;
+  using ParallelConfig = ParallelConfigType;
 
   using ChunkPolicyType = specfem::policy::element_chunk<ParallelConfig>;
 
@@ -114,6 +126,11 @@ private:
   constexpr static int components = datatypes::components;
   constexpr static int num_dimensions = datatypes::num_dimensions;
 
+  /// Chunk configurations the stiffness kernel can be launched with
+  using ChunkConfigCandidates =
+      typename specfem::parallel_config::chunk_config_candidates<
+          DimensionType, simd, Kokkos::DefaultExecutionSpace>::type;
+
 public:
   /**
    * @name Compile-time constants
@@ -129,6 +146,10 @@ public:
   constexpr static auto boundary_tag =
       BoundaryTag; ///< Boundary tag of the elements
   constexpr static int ngll = NGLL;
+  constexpr static int num_chunk_configs =
+      std::tuple_size_v<ChunkConfigCandidates>; ///< Number of chunk
+                                                ///< configurations compiled
+                                                ///< for the stiffness kernel
   ///@}
 
 public:
@@ -148,9 +169,125 @@ public:
       const type_real dt,
       const specfem::compute::simulation_field<WavefieldType> &field) const;
 
+  /**
+   * @brief Launch the interaction of wavefield with stiffness matrix
+   *
+   * Kernels are launched on @p space and are not waited for. Colors are
+   * ordered by the execution space instance.
+   *
+   * @param istep Time step
+   * @param field Wavefield
+   * @param space Execution space instance on which the kernels are launched
+   */
   void compute_stiffness_interaction(
       const int istep,
-      const specfem::compute::simulation_field<WavefieldType> &field) const;
+      const specfem::compute::simulation_field<WavefieldType> &field,
+      const Kokkos::DefaultExecutionSpace &space) const;
+
+  /**
+   * @brief Get the number of colors used to assemble the elements in this
+   * kernel
+   *
+   * @return int Number of colors. 0 if contributions are added atomically
+   */
+  inline int num_colors() const { return coloring.ncolors; }
+
+  /**
+   * @brief Estimate the bytes read and written from global memory by one
+   * call to compute_stiffness_interaction
+   *
+   * Counts the index mapping, the gathered displacement, the read-modify-write
+   * of the acceleration, the material properties and the partial derivatives
+   * (once per element for affine elements). Boundary terms and quadrature
+   * data held in scratch memory are not counted.
+   *
+   * @return std::size_t Estimated traffic in bytes
+   */
+  std::size_t estimated_traffic() const;
+
+  /**
+   * @brief Select the chunk configuration used by the stiffness kernel
+   *
+   * @param index Index within @ref
+   * specfem::parallel_config::chunk_config_candidates
+   */
+  void set_chunk_config(const int index);
+
+  /**
+   * @brief Get the index of the chunk configuration used by the stiffness
+   * kernel
+   *
+   */
+  inline int get_chunk_config() const { return chunk_config_index; }
+
+  /**
+   * @brief Describe every chunk configuration the stiffness kernel can be
+   * launched with
+   *
+   */
+  static std::vector<std::string> describe_chunk_configs() {
+    return specfem::parallel_config::describe_candidates<
+        ChunkConfigCandidates>();
+  }
+
+private:
+  template <bool UseAtomics>
+  void impl_compute_mass_matrix(
+      const type_real dt,
+      const specfem::compute::simulation_field<WavefieldType> &field,
+      const specfem::kokkos::DeviceView1d<int> &elements) const;
+
+  /**
+   * @brief Compute the interaction of wavefield with stiffness matrix for a
+   * range of elements
+   *
+   * @tparam UseAtomics Add contributions to global points atomically
+   * @tparam Affine Every element within @p elements is affine. Partial
+   * derivatives are then loaded once per element
+   * @tparam ParallelConfig Chunk configuration of the element policy
+   */
+  template <bool UseAtomics, bool Affine, typename ParallelConfig>
+  void impl_compute_stiffness_interaction(
+      const int istep,
+      const specfem::compute::simulation_field<WavefieldType> &field,
+      const specfem::kokkos::DeviceView1d<int> &elements,
+      const Kokkos::DefaultExecutionSpace &space) const;
+
+  /**
+   * @brief Launch the stiffness kernel with the chunk configuration selected
+   * at runtime
+   */
+  template <bool UseAtomics, bool Affine, std::size_t... Candidates>
+  void launch_stiffness_interaction(
+      const int istep,
+      const specfem::compute::simulation_field<WavefieldType> &field,
+      const specfem::kokkos::DeviceView1d<int> &elements,
+      const Kokkos::DefaultExecutionSpace &space,
+      std::index_sequence<Candidates...>) const {
+    ((chunk_config_index == Candidates
+          ? impl_compute_stiffness_interaction<
+                UseAtomics, Affine,
+                std::tuple_element_t<Candidates, ChunkConfigCandidates> >(
+                istep, field, elements, space)
+          : void()),
+     ...);
+  }
+
+  /**
+   * @brief Get the partial derivatives container used by the stiffness
+   * kernel
+   *
+   * @tparam Affine Return the per-element partial derivatives of affine
+   * elements
+   */
+  template <bool Affine>
+  KOKKOS_FORCEINLINE_FUNCTION const auto &get_partial_derivatives() const {
+    if constexpr (Affine) {
+      return partial_derivatives.affine;
+    } else {
+      return partial_derivatives;
+    }
+  }
 
 protected:
   int nelements;                   ///< Number of elements in this kernel
@@ -173,6 +310,14 @@ protected:
       boundary_values; ///< Boundary values to store information on field values
                        ///< at boundaries for reconstruction during adjoint
                        ///< simulations
+  specfem::compute::element_coloring coloring; ///< Coloring of the elements
+                                               ///< when contributions are
+                                               ///< added without atomics
+  specfem::compute::affine_element_partition
+      affine_partition; ///< Partition of the elements launched together
+                        ///< into affine and non-affine elements
+  int chunk_config_index = 0; ///< Chunk configuration of the stiffness
+                              ///< kernel
 };
 
 /**
@@ -235,97 +380,26 @@ public:
   }
 
   /**
-   * @brief Compute the interaction of wavefield with stiffness matrix
+   * @brief Launch the interaction of wavefield with stiffness matrix
+   *
+   * Returns without waiting for the kernels to complete.
    *
    * @param istep Time step
+   * @param space Execution space instance on which the kernels are launched
    */
-  void compute_stiffness_interaction(const int istep) const {
+  void compute_stiffness_interaction(
+      const int istep, const Kokkos::DefaultExecutionSpace &space =
+                           Kokkos::DefaultExecutionSpace()) const {
     element_kernel_base<WavefieldType, DimensionType, MediumTag, PropertyTag,
                         BoundaryTag,
-                        NGLL>::compute_stiffness_interaction(istep, field);
+                        NGLL>::compute_stiffness_interaction(istep, field,
+                                                             space);
   }
 
 private:
   specfem::compute::simulation_field<WavefieldType> field; ///< Wavefield
 };
 
-template <specfem::dimension::type DimensionType,
-          specfem::element::medium_tag MediumTag,
-          specfem::element::property_tag PropertyTag, int NGLL>
-class element_kernel<specfem::wavefield::type::backward, DimensionType,
-                     MediumTag, PropertyTag,
-                     specfem::element::boundary_tag::stacey, NGLL>
-    : public element_kernel_base<specfem::wavefield::type::backward,
-                                 DimensionType, MediumTag, PropertyTag,
-                                 specfem::element::boundary_tag::stacey, NGLL> {
-
-private:
-  /// Datatypes used in the kernels
-  using datatypes =
-      KernelDatatypes<specfem::wavefield::type::backward, DimensionType,
-                      MediumTag, PropertyTag,
-                      specfem::element::boundary_tag::stacey, NGLL>;
-  using simd = typename datatypes::simd;
-  using ChunkPolicyType = typename datatypes::ChunkPolicyType;
-  using PointBoundaryType = typename datatypes::PointBoundaryType;
-  using ChunkElementFieldType = typename datatypes::ChunkElementFieldType;
-  using ChunkStressIntegrandType = typename datatypes::ChunkStressIntegrandType;
-  using ElementQuadratureType = typename datatypes::ElementQuadratureType;
-  using PointAccelerationType = typename datatypes::PointAccelerationType;
-  using PointVelocityType = typename datatypes::PointVelocityType;
-  using PointFieldDerivativesType =
-      typename datatypes::PointFieldDerivativesType;
-  using PointMassType = typename datatypes::PointMassType;
-  using PointPropertyType = typename datatypes::PointPropertyType;
-  using PointPartialDerivativesType =
-      typename datatypes::PointPartialDerivativesType;
-
-  constexpr static int components = datatypes::components;
-  constexpr static int num_dimensions = datatypes::num_dimensions;
-
-public:
-  /**
-   * @name Compile-time constants
-   *
-   */
-  ///@{
-  constexpr static auto wavefield_type =
-      specfem::wavefield::type::backward; ///< Type of wavefield
-  constexpr static auto dimension =
-      DimensionType;                            ///< Dimension of the elements
-  constexpr static auto medium_tag = MediumTag; ///< Medium tag of the elements
-  constexpr static auto property_tag =
-      PropertyTag; ///< Property tag of the elements
-  constexpr static auto boundary_tag =
-      specfem::element::boundary_tag::stacey; ///< Boundary tag of the elements
-  constexpr static int ngll = NGLL;
-  ///@}
-
-public:
-  element_kernel() = default;
-  element_kernel(
-      const specfem::compute::assembly &assembly,
-      const specfem::kokkos::HostView1d<int> h_element_kernel_index_mapping)
-      : field(assembly.fields
-                  .get_simulation_field<specfem::wavefield::type::backward>()),
-        element_kernel_base<specfem::wavefield::type::backward, DimensionType,
-                            MediumTag, PropertyTag,
-                            specfem::element::boundary_tag::stacey, NGLL>(
-            assembly, h_element_kernel_index_mapping) {}
-
-  void compute_mass_matrix(const type_real dt) const {
-    element_kernel_base<specfem::wavefield::type::backward, DimensionType,
-                        MediumTag, PropertyTag,
-                        specfem::element::boundary_tag::stacey,
-                        NGLL>::compute_mass_matrix(dt, field);
-  }
-
-  void compute_stiffness_interaction(const int istep) const;
-
-private:
-  specfem::compute::simulation_field<specfem::wavefield::type::backward> field;
-};
-
 } // namespace kernels
 } // namespace impl
 } // namespace domain
@@ -11,6 +11,9 @@
 #include "kernel.hpp"
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
 
 template <specfem::wavefield::type WavefieldType,
           specfem::dimension::type DimensionType,
@@ -54,6 +57,40 @@ specfem::domain::impl::kernels::element_kernel_base<
 
   Kokkos::deep_copy(element_kernel_index_mapping,
                     h_element_kernel_index_mapping);
+
+  // Elements of the same color share no global points. Color blocks of
+  // consecutive elements since SIMD lanes operate on consecutive elements
+  if (assembly.element_assembly ==
+          specfem::compute::element_assembly::coloring &&
+      nelements > 0) {
+    coloring = specfem::compute::element_coloring(
+        points, h_element_kernel_index_mapping, simd::size());
+  }
+
+  // Launch affine elements separately in the stiffness kernel. Elements are
+  // launched all at once or one color at a time
+  if (nelements > 0) {
+    if (coloring.ncolors == 0) {
+      specfem::kokkos::HostView1d<int> range_offsets(
+          "specfem::domain::impl::kernels::element_kernel_base::range_offsets",
+          2);
+      range_offsets(0) = 0;
+      range_offsets(1) = nelements;
+      affine_partition = specfem::compute::affine_element_partition(
+          partial_derivatives, h_element_kernel_index_mapping, range_offsets,
+          simd::size());
+    } else {
+      specfem::kokkos::HostView1d<int> colored_elements(
+          "specfem::domain::impl::kernels::element_kernel_base::colored_"
+          "elements",
+          nelements);
+      Kokkos::deep_copy(colored_elements, coloring.element_index_mapping);
+      affine_partition = specfem::compute::affine_element_partition(
+          partial_derivatives, colored_elements, coloring.h_color_offsets,
+          simd::size());
+    }
+  }
+
   return;
 }
 
@@ -70,11 +107,138 @@ void specfem::domain::impl::kernels::element_kernel_base<
   if (nelements == 0)
     return;
 
+  if (coloring.ncolors == 0) {
+    impl_compute_mass_matrix<true>(dt, field, element_kernel_index_mapping);
+    return;
+  }
+
+  for (int icolor = 0; icolor < coloring.ncolors; icolor++) {
+    impl_compute_mass_matrix<false>(dt, field, coloring.get_color(icolor));
+  }
+
+  return;
+}
+
+template <specfem::wavefield::type WavefieldType,
+          specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag,
+          specfem::element::boundary_tag BoundaryTag, int NGLL>
+std::size_t specfem::domain::impl::kernels::element_kernel_base<
+    WavefieldType, DimensionType, MediumTag, PropertyTag, BoundaryTag,
+    NGLL>::estimated_traffic() const {
+  if (nelements == 0)
+    return 0;
+
+  using PropertyType =
+      specfem::point::properties<DimensionType, MediumTag, PropertyTag, false>;
+
+  int naffine = 0;
+  for (int irange = 0; irange < affine_partition.nranges; irange++) {
+    naffine += affine_partition.h_affine_offsets(irange) -
+               affine_partition.h_range_offsets(irange);
+  }
+
+  // Homogeneous properties are stored once per element
+  bool per_element = false;
+  if constexpr (MediumTag == specfem::element::medium_tag::elastic) {
+    per_element = properties.elastic_isotropic.per_element;
+  } else if constexpr (MediumTag == specfem::element::medium_tag::acoustic) {
+    per_element = properties.acoustic_isotropic.per_element;
+  }
+
+  constexpr std::size_t ngll2 = NGLL * NGLL;
+  constexpr std::size_t nmetrics = 5; // xix, xiz, gammax, gammaz, jacobian
+
+  // Displacement is read once, acceleration is read and written
+  const std::size_t per_point =
+      sizeof(int) + 3 * components * sizeof(type_field);
+
+  const std::size_t ngeneral = nelements - naffine;
+  return nelements * ngll2 * per_point +
+         nelements * (per_element ? 1 : ngll2) * sizeof(PropertyType) +
+         (ngeneral * ngll2 + naffine) * nmetrics * sizeof(type_real);
+}
+
+template <specfem::wavefield::type WavefieldType,
+          specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag,
+          specfem::element::boundary_tag BoundaryTag, int NGLL>
+void specfem::domain::impl::kernels::element_kernel_base<
+    WavefieldType, DimensionType, MediumTag, PropertyTag, BoundaryTag, NGLL>::
+    compute_stiffness_interaction(
+        const int istep,
+        const specfem::compute::simulation_field<WavefieldType> &field,
+        const Kokkos::DefaultExecutionSpace &space) const {
+  if (nelements == 0)
+    return;
+
+  constexpr auto candidates = std::make_index_sequence<num_chunk_configs>();
+
+  // Ranges of the affine partition are the colors of the elements
+  for (int irange = 0; irange < affine_partition.nranges; irange++) {
+    const auto affine_elements = affine_partition.get_affine(irange);
+    const auto general_elements = affine_partition.get_general(irange);
+    if (coloring.ncolors == 0) {
+      launch_stiffness_interaction<true, true>(istep, field, affine_elements,
+                                               space, candidates);
+      launch_stiffness_interaction<true, false>(
+          istep, field, general_elements, space, candidates);
+    } else {
+      launch_stiffness_interaction<false, true>(
+          istep, field, affine_elements, space, candidates);
+      launch_stiffness_interaction<false, false>(
+          istep, field, general_elements, space, candidates);
+    }
+  }
+
+  return;
+}
+
+template <specfem::wavefield::type WavefieldType,
+          specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag,
+          specfem::element::boundary_tag BoundaryTag, int NGLL>
+void specfem::domain::impl::kernels::element_kernel_base<
+    WavefieldType, DimensionType, MediumTag, PropertyTag, BoundaryTag,
+    NGLL>::set_chunk_config(const int index) {
+  if (index < 0 || index >= num_chunk_configs) {
+    std::ostringstream message;
+    message << "Invalid chunk configuration : " << index << ". "
+            << num_chunk_configs
+            << " chunk configurations are compiled for this kernel";
+    throw std::runtime_error(message.str());
+  }
+
+  chunk_config_index = index;
+  return;
+}
+
+template <specfem::wavefield::type WavefieldType,
+          specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag,
+          specfem::element::boundary_tag BoundaryTag, int NGLL>
+template <bool UseAtomics>
+void specfem::domain::impl::kernels::element_kernel_base<
+    WavefieldType, DimensionType, MediumTag, PropertyTag, BoundaryTag, NGLL>::
+    impl_compute_mass_matrix(
+        const type_real dt,
+        const specfem::compute::simulation_field<WavefieldType> &field,
+        const specfem::kokkos::DeviceView1d<int> &elements) const {
+
+  const int num_elements = elements.extent(0);
+
+  if (num_elements == 0)
+    return;
+
   const auto wgll = quadrature.gll.weights;
 
   constexpr int simd_size = simd::size();
 
-  ChunkPolicyType chunk_policy(element_kernel_index_mapping, NGLL, NGLL);
+  ChunkPolicyType chunk_policy(elements, NGLL, NGLL);
 
   Kokkos::parallel_for(
       "specfem::domain::impl::kernels::elements::compute_mass_matrix",
@@ -86,7 +250,7 @@ void specfem::domain::impl::kernels::element_kernel_base<
               team.league_rank() * ChunkPolicyType::tile_size * simd_size +
               tile;
 
-          if (starting_element_index >= nelements) {
+          if (starting_element_index >= num_elements) {
             break;
           }
 
@@ -133,8 +297,14 @@ void specfem::domain::impl::kernels::element_kernel_base<
                     compute_mass_matrix_terms(dt, point_boundary,
                                               point_property, mass_matrix);
 
-                specfem::compute::atomic_add_on_device(index, mass_matrix,
-                                                       field);
+                // Elements launched together share no global points when
+                // the elements are colored
+                if constexpr (UseAtomics) {
+                  specfem::compute::atomic_add_on_device(index, mass_matrix,
+                                                         field);
+                } else {
+                  specfem::compute::add_on_device(index, mass_matrix, field);
+                }
               });
         }
       });
@@ -149,15 +319,29 @@ template <specfem::wavefield::type WavefieldType,
           specfem::element::medium_tag MediumTag,
           specfem::element::property_tag PropertyTag,
           specfem::element::boundary_tag BoundaryTag, int NGLL>
+template <bool UseAtomics, bool Affine, typename ParallelConfig>
 void specfem::domain::impl::kernels::element_kernel_base<
     WavefieldType, DimensionType, MediumTag, PropertyTag, BoundaryTag, NGLL>::
-    compute_stiffness_interaction(
+    impl_compute_stiffness_interaction(
         const int istep,
-        const specfem::compute::simulation_field<WavefieldType> &field) const {
+        const specfem::compute::simulation_field<WavefieldType> &field,
+        const specfem::kokkos::DeviceView1d<int> &elements,
+        const Kokkos::DefaultExecutionSpace &space) const {
 
-  if (nelements == 0)
+  const int num_elements = elements.extent(0);
+
+  if (num_elements == 0)
     return;
 
+  // Chunk dependent datatypes of the selected chunk configuration
+  using chunk_datatypes =
+      KernelDatatypes<WavefieldType, DimensionType, MediumTag, PropertyTag,
+                      BoundaryTag, NGLL, ParallelConfig>;
+  using ChunkPolicyType = typename chunk_datatypes::ChunkPolicyType;
+  using ChunkElementFieldType = typename chunk_datatypes::ChunkElementFieldType;
+  using ChunkStressIntegrandType =
+      typename chunk_datatypes::ChunkStressIntegrandType;
+
   const auto hprime = quadrature.gll.hprime;
   const auto wgll = quadrature.gll.weights;
   const auto index_mapping = points.index_mapping;
@@ -166,7 +350,7 @@ void specfem::domain::impl::kernels::element_kernel_base<
                      ChunkStressIntegrandType::shmem_size() +
                      ElementQuadratureType::shmem_size();
 
-  ChunkPolicyType chunk_policy(element_kernel_index_mapping, NGLL, NGLL);
+  ChunkPolicyType chunk_policy(space, elements, NGLL, NGLL);
 
   constexpr int simd_size = simd::size();
 
@@ -185,7 +369,7 @@ void specfem::domain::impl::kernels::element_kernel_base<
               team.league_rank() * ChunkPolicyType::tile_size * simd_size +
               tile;
 
-          if (starting_element_index >= nelements) {
+          if (starting_element_index >= num_elements) {
             break;
           }
 
@@ -197,7 +381,7 @@ void specfem::domain::impl::kernels::element_kernel_base<
           team.team_barrier();
 
           specfem::algorithms::gradient(
-              team, iterator, partial_derivatives,
+              team, iterator, get_partial_derivatives<Affine>(),
               element_quadrature.hprime_gll, element_field.displacement,
               // Compute stresses using the gradients
               [&](const typename ChunkPolicyType::iterator_type::index_type
@@ -206,8 +390,9 @@ void specfem::domain::impl::kernels::element_kernel_base<
                 const auto &index = iterator_index.index;
 
                 PointPartialDerivativesType point_partial_derivatives;
-                specfem::compute::load_on_device(index, partial_derivatives,
-                                                 point_partial_derivatives);
+                specfem::compute::load_on_device(
+                    index, get_partial_derivatives<Affine>(),
+                    point_partial_derivatives);
 
                 PointPropertyType point_property;
                 specfem::compute::load_on_device(index, properties,
@@ -235,7 +420,7 @@ void specfem::domain::impl::kernels::element_kernel_base<
           team.team_barrier();
 
           specfem::algorithms::divergence(
-              team, iterator, partial_derivatives, wgll,
+              team, iterator, get_partial_derivatives<Affine>(), wgll,
               element_quadrature.hprime_wgll, stress_integrand.F,
               [&, istep = istep](const typename ChunkPolicyType::iterator_type::index_type
                       &iterator_index,
@@ -260,76 +445,55 @@ void specfem::domain::impl::kernels::element_kernel_base<
                 specfem::compute::load_on_device(index, boundaries,
                                                  point_boundary);
 
-                specfem::domain::impl::boundary_conditions::
-                    apply_boundary_conditions(point_boundary, point_property,
-                                              velocity, acceleration);
-
-                // Store forward boundary values for reconstruction during
-                // adjoint simulations. The function does nothing if the
-                // boundary tag is not stacey
                 if constexpr (WavefieldType ==
-                              specfem::wavefield::type::forward) {
-                  specfem::compute::store_on_device(istep, index, acceleration,
-                                                    boundary_values);
+                                  specfem::wavefield::type::backward &&
+                              BoundaryTag ==
+                                  specfem::element::boundary_tag::stacey) {
+                  // Replay the absorbing traction of the forward simulation
+                  // on the absorbing edges
+                  PointAccelerationType boundary_term;
+                  specfem::compute::load_on_device(istep, index,
+                                                   boundary_values,
+                                                   boundary_term);
+
+                  for (int icomponent = 0; icomponent < components;
+                       ++icomponent) {
+                    acceleration.acceleration(icomponent) +=
+                        boundary_term.acceleration(icomponent);
+                  }
+                } else {
+                  const PointAccelerationType stiffness = acceleration;
+
+                  specfem::domain::impl::boundary_conditions::
+                      apply_boundary_conditions(point_boundary, point_property,
+                                                velocity, acceleration);
+
+                  // Store the boundary contribution for reconstruction during
+                  // adjoint simulations. The function does nothing if the
+                  // boundary tag is not stacey
+                  if constexpr (WavefieldType ==
+                                specfem::wavefield::type::forward) {
+                    PointAccelerationType boundary_term;
+                    for (int icomponent = 0; icomponent < components;
+                         ++icomponent) {
+                      boundary_term.acceleration(icomponent) =
+                          acceleration.acceleration(icomponent) -
+                          stiffness.acceleration(icomponent);
+                    }
+                    specfem::compute::store_on_device(
+                        istep, index, boundary_term, boundary_values);
+                  }
                 }
 
-                specfem::compute::atomic_add_on_device(index, acceleration,
-                                                       field);
+                if constexpr (UseAtomics) {
+                  specfem::compute::atomic_add_on_device(index, acceleration,
+                                                         field);
+                } else {
+                  specfem::compute::add_on_device(index, acceleration, field);
+                }
               });
         }
       });
 
-  Kokkos::fence();
-
   return;
 }
-
-template <specfem::dimension::type DimensionType,
-          specfem::element::medium_tag MediumType,
-          specfem::element::property_tag PropertyTag, int NGLL>
-void specfem::domain::impl::kernels::element_kernel<
-    specfem::wavefield::type::backward, DimensionType, MediumType, PropertyTag,
-    specfem::element::boundary_tag::stacey,
-    NGLL>::compute_stiffness_interaction(const int istep) const {
-
-  if (this->nelements == 0)
-    return;
-
-  ChunkPolicyType chunk_policy(this->element_kernel_index_mapping, NGLL, NGLL);
-
-  constexpr int simd_size = simd::size();
-
-  Kokkos::parallel_for(
-      "specfem::domain::impl::kernels::elements::compute_stiffness_"
-      "interaction",
-      static_cast<const typename ChunkPolicyType::policy_type &>(chunk_policy),
-      KOKKOS_CLASS_LAMBDA(const typename ChunkPolicyType::member_type &team) {
-        for (int tile = 0; tile < ChunkPolicyType::tile_size * simd_size;
-             tile += ChunkPolicyType::chunk_size * simd_size) {
-          const int starting_element_index =
-              team.league_rank() * ChunkPolicyType::tile_size * simd_size +
-              tile;
-
-          if (starting_element_index >= this->nelements) {
-            break;
-          }
-
-          const auto iterator =
-              chunk_policy.league_iterator(starting_element_index);
-
-          Kokkos::parallel_for(
-              Kokkos::TeamThreadRange(team, iterator.chunk_size()),
-              [&](const int i) {
-                const auto iterator_index = iterator(i);
-                const auto index = iterator_index.index;
-
-                PointAccelerationType acceleration;
-                specfem::compute::load_on_device(
-                    istep, index, this->boundary_values, acceleration);
-
-                specfem::compute::atomic_add_on_device(index, acceleration,
-                                                       this->field);
-              });
-        }
-      });
-}
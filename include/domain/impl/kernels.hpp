@@ -5,6 +5,9 @@
 #include "domain/impl/receivers/interface.hpp"
 #include "domain/impl/sources/interface.hpp"
 #include "enumerations/interface.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
 
 namespace specfem {
 namespace domain {
@@ -31,13 +34,146 @@ public:
    * @param istep Time step
    */
   inline void compute_stiffness_interaction(const int istep) const {
-    isotropic_elements.compute_stiffness_interaction(istep);
-    isotropic_elements_dirichlet.compute_stiffness_interaction(istep);
-    isotropic_elements_stacey.compute_stiffness_interaction(istep);
-    isotropic_elements_stacey_dirichlet.compute_stiffness_interaction(istep);
+    compute_outer_stiffness_interaction(istep);
+    start_inner_stiffness_interaction(istep);
+    finish_inner_stiffness_interaction();
     return;
   }
 
+  /**
+   * @brief Compute the interaction of stiffness matrix with wavefield for the
+   * elements sharing points with other MPI ranks
+   *
+   * Returns once the contributions of the outer elements have been added to
+   * the acceleration, so that it can be sent to the neighbors.
+   *
+   * @param istep Time step
+   */
+  inline void compute_outer_stiffness_interaction(const int istep) const {
+    // The wavefield is updated on the default instance. Wait for the update
+    // before the outer and inner instances read it
+    Kokkos::DefaultExecutionSpace().fence();
+    isotropic_elements.outer.compute_stiffness_interaction(istep, outer_space);
+    isotropic_elements_dirichlet.outer.compute_stiffness_interaction(
+        istep, outer_space);
+    isotropic_elements_stacey.outer.compute_stiffness_interaction(istep,
+                                                                  outer_space);
+    isotropic_elements_stacey_dirichlet.outer.compute_stiffness_interaction(
+        istep, outer_space);
+    outer_space.fence();
+    return;
+  }
+
+  /**
+   * @brief Launch the interaction of stiffness matrix with wavefield for the
+   * elements sharing no points with other MPI ranks
+   *
+   * Kernels run on their own execution space instance and are not waited
+   * for. They do not touch the points exchanged with other ranks.
+   *
+   * @param istep Time step
+   */
+  inline void start_inner_stiffness_interaction(const int istep) const {
+    isotropic_elements.inner.compute_stiffness_interaction(istep, inner_space);
+    isotropic_elements_dirichlet.inner.compute_stiffness_interaction(
+        istep, inner_space);
+    isotropic_elements_stacey.inner.compute_stiffness_interaction(istep,
+                                                                  inner_space);
+    isotropic_elements_stacey_dirichlet.inner.compute_stiffness_interaction(
+        istep, inner_space);
+    return;
+  }
+
+  /**
+   * @brief Wait for the kernels launched by @ref
+   * start_inner_stiffness_interaction
+   *
+   */
+  inline void finish_inner_stiffness_interaction() const {
+    inner_space.fence();
+    return;
+  }
+
+  /**
+   * @brief Estimate the bytes read and written from global memory by one
+   * call to compute_stiffness_interaction
+   *
+   * @return std::size_t Estimated traffic in bytes
+   */
+  inline std::size_t stiffness_traffic() const {
+    return isotropic_elements.estimated_traffic() +
+           isotropic_elements_dirichlet.estimated_traffic() +
+           isotropic_elements_stacey.estimated_traffic() +
+           isotropic_elements_stacey_dirichlet.estimated_traffic();
+  }
+
+  /**
+   * @brief Select the chunk configuration used by the stiffness kernels
+   *
+   * @param index Index within @ref
+   * specfem::parallel_config::chunk_config_candidates
+   */
+  inline void set_chunk_config(const int index) {
+    isotropic_elements.set_chunk_config(index);
+    isotropic_elements_dirichlet.set_chunk_config(index);
+    isotropic_elements_stacey.set_chunk_config(index);
+    isotropic_elements_stacey_dirichlet.set_chunk_config(index);
+  }
+
+  /**
+   * @brief Get the index of the chunk configuration used by the stiffness
+   * kernels
+   *
+   */
+  inline int get_chunk_config() const {
+    return isotropic_elements.get_chunk_config();
+  }
+
+  /**
+   * @brief Describe every chunk configuration the stiffness kernels can be
+   * launched with
+   *
+   */
+  static std::vector<std::string> describe_chunk_configs() {
+    return element_kernel<DimensionType, isotropic,
+                          none>::describe_chunk_configs();
+  }
+
+  /**
+   * @brief Get the number of elements updated by the stiffness kernels
+   *
+   */
+  inline int total_elements() const {
+    return isotropic_elements.total_elements() +
+           isotropic_elements_dirichlet.total_elements() +
+           isotropic_elements_stacey.total_elements() +
+           isotropic_elements_stacey_dirichlet.total_elements();
+  }
+
+  /**
+   * @brief Get the largest number of colors used to assemble the elements of
+   * the stiffness kernels
+   *
+   * @return int Number of colors. 0 if contributions are added atomically
+   */
+  inline int num_colors() const {
+    return std::max({ isotropic_elements.num_colors(),
+                      isotropic_elements_dirichlet.num_colors(),
+                      isotropic_elements_stacey.num_colors(),
+                      isotropic_elements_stacey_dirichlet.num_colors() });
+  }
+
+  /**
+   * @brief Get the number of elements sharing points with other MPI ranks
+   *
+   */
+  inline int outer_elements() const {
+    return isotropic_elements.outer.total_elements() +
+           isotropic_elements_dirichlet.outer.total_elements() +
+           isotropic_elements_stacey.outer.total_elements() +
+           isotropic_elements_stacey_dirichlet.outer.total_elements();
+  }
+
   /**
    * @brief Compute the mass matrix
    *
@@ -105,19 +241,57 @@ private:
       WavefieldType, DimensionType, medium, property,
       quadrature_point_type>; ///< Underlying receiver kernel data structure
 
-  element_kernel<DimensionType, isotropic, none>
+  /**
+   * @brief Element kernels of a group of elements sharing the same tags,
+   * split into the elements touching MPI interfaces and the remaining ones
+   *
+   */
+  template <specfem::element::property_tag property,
+            specfem::element::boundary_tag boundary>
+  struct element_kernel_group {
+    element_kernel<DimensionType, property, boundary>
+        outer; ///< Elements sharing points with other MPI ranks
+    element_kernel<DimensionType, property, boundary>
+        inner; ///< Elements sharing no points with other MPI ranks
+
+    inline std::size_t estimated_traffic() const {
+      return outer.estimated_traffic() + inner.estimated_traffic();
+    }
+
+    inline void set_chunk_config(const int index) {
+      outer.set_chunk_config(index);
+      inner.set_chunk_config(index);
+    }
+
+    inline int get_chunk_config() const { return outer.get_chunk_config(); }
+
+    inline int total_elements() const {
+      return outer.total_elements() + inner.total_elements();
+    }
+
+    inline int num_colors() const {
+      return std::max(outer.num_colors(), inner.num_colors());
+    }
+
+    inline void compute_mass_matrix(const type_real dt) const {
+      outer.compute_mass_matrix(dt);
+      inner.compute_mass_matrix(dt);
+    }
+  };
+
+  element_kernel_group<isotropic, none>
       isotropic_elements; ///< Stiffness kernels for isotropic elements
 
-  element_kernel<DimensionType, isotropic, dirichlet>
+  element_kernel_group<isotropic, dirichlet>
       isotropic_elements_dirichlet; ///< Stiffness kernels for isotropic
                                     ///< elements with Dirichlet boundary
                                     ///< conditions
 
-  element_kernel<DimensionType, isotropic, stacey>
+  element_kernel_group<isotropic, stacey>
       isotropic_elements_stacey; ///< Stiffness kernels for isotropic elements
                                  ///< with Stacey boundary conditions
 
-  element_kernel<DimensionType, isotropic, composite_stacey_dirichlet>
+  element_kernel_group<isotropic, composite_stacey_dirichlet>
       isotropic_elements_stacey_dirichlet; ///< Stiffness kernels for isotropic
                                            ///< elements with Stacey and
                                            ///< Dirichlet boundary conditions on
@@ -130,6 +304,11 @@ private:
   receiver_kernel<DimensionType, isotropic>
       isotropic_receivers; ///< Kernels for computing seismograms within
                            ///< isotropic elements
+
+  Kokkos::DefaultExecutionSpace outer_space; ///< Execution space instance
+                                             ///< of the outer elements
+  Kokkos::DefaultExecutionSpace inner_space; ///< Execution space instance
+                                             ///< of the inner elements
 };
 } // namespace kernels
 } // namespace impl
@@ -20,11 +20,23 @@ struct element_tag {
   specfem::element::medium_tag medium_tag;
 };
 
-template <typename ElementType>
+specfem::kokkos::HostView1d<int>
+get_ispec_domain(const std::vector<int> &ispecs) {
+  specfem::kokkos::HostView1d<int> h_ispec_domain(
+      "specfem::domain::domain::h_ispec_domain", ispecs.size());
+  for (int index = 0; index < ispecs.size(); index++) {
+    h_ispec_domain(index) = ispecs[index];
+  }
+  return h_ispec_domain;
+}
+
+template <typename ElementGroupType>
 void allocate_elements(
     const specfem::compute::assembly &assembly,
     const specfem::kokkos::HostView1d<element_tag> element_tags,
-    ElementType &elements) {
+    ElementGroupType &elements) {
+
+  using ElementType = decltype(elements.outer);
 
   constexpr auto wavefield_type = ElementType::wavefield_type;
   constexpr auto medium_tag = ElementType::medium_tag;
@@ -36,9 +48,12 @@ void allocate_elements(
       specfem::medium::medium<ElementType::dimension, medium_tag, property_tag>;
 
   const int nspec = assembly.mesh.nspec;
+  const auto outer = assembly.mesh.mapping.outer;
 
-  // count number of elements in this domain
-  int nelements = 0;
+  // Get ispec for each element in this domain. Elements touching MPI
+  // interfaces come first within every group of elements
+  std::vector<int> outer_ispecs;
+  std::vector<int> inner_ispecs;
   for (int ispec = 0; ispec < nspec; ispec++) {
     if (element_tags(ispec).medium_tag == medium_tag &&
         element_tags(ispec).property_tag == property_tag &&
@@ -53,26 +68,19 @@ void allocate_elements(
                                    "condition found non acoustic element");
         }
       }
-      nelements++;
-    }
-  }
 
-  specfem::kokkos::DeviceView1d<int> ispec_domain(
-      "specfem::domain::domain::h_ispec_domain", nelements);
-  specfem::kokkos::HostMirror1d<int> h_ispec_domain =
-      Kokkos::create_mirror_view(ispec_domain);
-
-  // Get ispec for each element in this domain
-  int index = 0;
-  for (int ispec = 0; ispec < nspec; ispec++) {
-    if (element_tags(ispec).medium_tag == medium_tag &&
-        element_tags(ispec).property_tag == property_tag &&
-        element_tags(ispec).boundary_tag == boundary_tag) {
-      h_ispec_domain(index) = ispec;
-      index++;
+      if (outer(ispec)) {
+        outer_ispecs.push_back(ispec);
+      } else {
+        inner_ispecs.push_back(ispec);
+      }
     }
   }
 
+  // Create isotropic acoustic surface elements
+  elements.outer = { assembly, get_ispec_domain(outer_ispecs) };
+  elements.inner = { assembly, get_ispec_domain(inner_ispecs) };
+
   if constexpr (wavefield_type == specfem::wavefield::type::forward ||
                 wavefield_type == specfem::wavefield::type::adjoint) {
 
@@ -85,11 +93,16 @@ void allocate_elements(
               << specfem::domain::impl::boundary_conditions::print_boundary_tag<
                      boundary_tag>()
               << "\n"
-              << "    - Number of elements  : " << nelements << "\n\n";
+              << "    - Number of elements  : " << elements.total_elements()
+              << "\n";
+    if (!outer_ispecs.empty())
+      std::cout << "    - Outer elements      : " << outer_ispecs.size()
+                << "\n";
+    if (elements.num_colors() > 0)
+      std::cout << "    - Number of colors    : " << elements.num_colors()
+                << "\n";
+    std::cout << "\n";
   }
-
-  // Create isotropic acoustic surface elements
-  elements = { assembly, h_ispec_domain };
 }
 
 template <specfem::wavefield::type WavefieldType,
@@ -105,10 +118,22 @@ void allocate_isotropic_sources(
   const auto &sources = assembly.sources;
   const int nsources = sources.nsources;
 
+  // Sources of the backward wavefield also drive the forward wavefield when
+  // the forward simulation is recomputed during combined simulations
+  const auto acts_on_wavefield = [&](const int isource) {
+    const auto wavefield = sources.source_wavefield_mapping(isource);
+    if constexpr (WavefieldType == specfem::wavefield::type::forward) {
+      return (wavefield == specfem::wavefield::type::forward) ||
+             (wavefield == specfem::wavefield::type::backward);
+    } else {
+      return wavefield == WavefieldType;
+    }
+  };
+
   int nsources_in_this_domain = 0;
   for (int isource = 0; isource < sources.nsources; isource++) {
     if ((sources.source_medium_mapping(isource) == medium_tag) &&
-        (sources.source_wavefield_mapping(isource) == WavefieldType)) {
+        acts_on_wavefield(isource)) {
       nsources_in_this_domain++;
     }
   }
@@ -122,7 +147,7 @@ void allocate_isotropic_sources(
   for (int isource = 0; isource < nsources; isource++) {
     const int isources_domain = sources.source_domain_index_mapping(isource);
     if (sources.source_medium_mapping(isource) == medium_tag &&
-        sources.source_wavefield_mapping(isource) == WavefieldType) {
+        acts_on_wavefield(isource)) {
       h_source_domain_index_mapping(index) =
           sources.source_domain_index_mapping(isource);
       index++;
@@ -242,6 +267,19 @@ specfem::domain::impl::kernels::
   allocate_isotropic_receivers(assembly, quadrature_points,
                                isotropic_receivers);
 
+  // Outer and inner elements are launched on separate execution space
+  // instances so that the inner elements can run while the halo exchange is
+  // in flight. Host backends launch synchronously and partitioning them would
+  // split their thread pool, so they keep the default instance
+  if constexpr (!Kokkos::SpaceAccessibility<
+                    Kokkos::HostSpace,
+                    Kokkos::DefaultExecutionSpace::memory_space>::accessible) {
+    const auto instances = Kokkos::Experimental::partition_space(
+        Kokkos::DefaultExecutionSpace(), 1, 1);
+    outer_space = instances[0];
+    inner_space = instances[1];
+  }
+
   // Compute mass matrices
 
   this->compute_mass_matrix(dt);
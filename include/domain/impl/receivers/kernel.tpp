@@ -94,6 +94,13 @@ void specfem::domain::impl::kernels::receiver_kernel<
   if (nseismograms == 0)
     return;
 
+  // Seismograms are stored in a ring buffer of the latest seismogram steps
+  const int nbuffer = receivers.get_buffer_size();
+  if (nbuffer == 0)
+    return;
+
+  const int isig_slot = isig_step % nbuffer;
+
   int scratch_size =
       ElementFieldType::shmem_size() + ElementQuadratureType::shmem_size();
 
@@ -180,7 +187,7 @@ void specfem::domain::impl::kernels::receiver_kernel<
 
               auto sv_receiver_field =
                   Kokkos::subview(receivers.receiver_field, iz, ix, iseis_l,
-                                  ireceiver_l, isig_step, Kokkos::ALL);
+                                  ireceiver_l, Kokkos::ALL);
 
               receiver.get_field(iz, ix, point_partial_derivatives,
                                  point_properties,
@@ -194,7 +201,7 @@ void specfem::domain::impl::kernels::receiver_kernel<
         //-------------------------------------------------------------------
         const auto sv_receiver_field =
             Kokkos::subview(receivers.receiver_field, Kokkos::ALL, Kokkos::ALL,
-                            iseis_l, ireceiver_l, isig_step, Kokkos::ALL);
+                            iseis_l, ireceiver_l, Kokkos::ALL);
 
         const auto polynomial = Kokkos::subview(
             receivers.receiver_array, ireceiver_l, 0, Kokkos::ALL, Kokkos::ALL);
@@ -205,17 +212,17 @@ void specfem::domain::impl::kernels::receiver_kernel<
 
         Kokkos::single(Kokkos::PerTeam(team_member), [=] {
           if (specfem::globals::simulation_wave == specfem::wave::p_sv) {
-            receivers.seismogram(isig_step, iseis_l, ireceiver_l, 0) =
+            receivers.seismogram(isig_slot, iseis_l, ireceiver_l, 0) =
                 receivers.cos_recs(ireceiver_l) * seismogram_components(0) +
                 receivers.sin_recs(ireceiver_l) * seismogram_components(1);
-            receivers.seismogram(isig_step, iseis_l, ireceiver_l, 1) =
+            receivers.seismogram(isig_slot, iseis_l, ireceiver_l, 1) =
                 receivers.sin_recs(ireceiver_l) * seismogram_components(0) +
                 receivers.cos_recs(ireceiver_l) * seismogram_components(1);
           } else if (specfem::globals::simulation_wave == specfem::wave::sh) {
-            receivers.seismogram(isig_step, iseis_l, ireceiver_l, 0) =
+            receivers.seismogram(isig_slot, iseis_l, ireceiver_l, 0) =
                 receivers.cos_recs(ireceiver_l) * seismogram_components(0) +
                 receivers.sin_recs(ireceiver_l) * seismogram_components(1);
-            receivers.seismogram(isig_step, iseis_l, ireceiver_l, 0) = 0;
+            receivers.seismogram(isig_slot, iseis_l, ireceiver_l, 0) = 0;
           }
         });
 
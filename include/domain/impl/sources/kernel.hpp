@@ -27,20 +27,62 @@ public:
   constexpr static bool using_simd = false;
 
   source_kernel() = default;
+  /**
+   * @brief Construct the kernel and compact the sources to sparse form
+   *
+   * Every source is reduced to the quadrature points where its Lagrange
+   * interpolant is nonzero. For forward simulations in acoustic media the
+   * division by @f$ \kappa @f$ is folded into the stored weights. The
+   * resulting (point, source, weight) entries are sorted by global point so
+   * that every point is updated by a single thread.
+   *
+   * @param assembly Assembly object
+   * @param h_source_domain_index_mapping Indices of the sources handled by
+   * this kernel within the source medium
+   * @param quadrature_points Quadrature points object
+   */
   source_kernel(
       const specfem::compute::assembly &assembly,
       const specfem::kokkos::HostView1d<int> h_source_domain_index_mapping,
       const quadrature_point_type quadrature_points);
 
+  /**
+   * @brief Add the source contributions to the acceleration at a timestep
+   *
+   * The source time functions are first evaluated once for every source.
+   * A single range over the global points touched by the sources then reads
+   * them. Each thread sums the contributions of all the sources at its point,
+   * so the field is updated without atomics.
+   *
+   * @param timestep Current timestep
+   */
   void compute_source_interaction(const int timestep) const;
 
 private:
   int nsources;
-  specfem::compute::points points;
+  int npoints; ///< Number of global points touched by the sources
   specfem::compute::quadrature quadrature;
   specfem::kokkos::DeviceView1d<int> source_domain_index_mapping;
   specfem::kokkos::HostMirror1d<int> h_source_domain_index_mapping;
-  specfem::compute::properties properties;
+  specfem::kokkos::DeviceView1d<int> point_offsets; ///< Offsets of the entries
+                                                    ///< of every point
+  specfem::kokkos::HostMirror1d<int> h_point_offsets; ///< Host mirror of
+                                                      ///< point_offsets
+  specfem::kokkos::DeviceView1d<int> point_iglob; ///< Global index of every
+                                                  ///< point within the medium
+  specfem::kokkos::HostMirror1d<int> h_point_iglob; ///< Host mirror of
+                                                    ///< point_iglob
+  specfem::kokkos::DeviceView1d<int> entry_source; ///< Source of every entry
+                                                   ///< within this kernel
+  specfem::kokkos::HostMirror1d<int> h_entry_source; ///< Host mirror of
+                                                     ///< entry_source
+  specfem::kokkos::DeviceView2d<type_real> entry_weight; ///< Weight of every
+                                                         ///< entry
+  specfem::kokkos::HostMirror2d<type_real> h_entry_weight; ///< Host mirror of
+                                                           ///< entry_weight
+  specfem::kokkos::DeviceView2d<type_real>
+      source_time_function_values; ///< Source time function of every source
+                                   ///< at the current timestep
   specfem::compute::simulation_field<WavefieldType> field;
   specfem::compute::source_medium<DimensionType, MediumTag> sources;
   quadrature_point_type quadrature_points;
@@ -9,6 +9,8 @@
 #include "kokkos_abstractions.h"
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <vector>
 
 template <specfem::wavefield::type WavefieldType,
           specfem::dimension::type DimensionType,
@@ -22,12 +24,13 @@ specfem::domain::impl::kernels::source_kernel<
                             const quadrature_point_type quadrature_points)
     : nsources(h_source_domain_index_mapping.extent(0)),
       h_source_domain_index_mapping(h_source_domain_index_mapping),
-      points(assembly.mesh.points), quadrature(assembly.mesh.quadratures),
-      properties(assembly.properties),
+      quadrature(assembly.mesh.quadratures),
       sources(assembly.sources.get_source_medium<MediumTag>()),
       quadrature_points(quadrature_points),
       field(assembly.fields.get_simulation_field<WavefieldType>()) {
 
+  constexpr int components = medium_type::components;
+
   // Check if the source element is the type being allocated
   for (int isource = 0; isource < nsources; isource++) {
     const int ispec = sources.h_source_index_mapping(isource);
@@ -48,6 +51,115 @@ specfem::domain::impl::kernels::source_kernel<
 
   Kokkos::deep_copy(source_domain_index_mapping, h_source_domain_index_mapping);
 
+  // Compact every source to the quadrature points where its Lagrange
+  // interpolant is nonzero. Point sources located on an element edge or
+  // corner only touch a few points of the element.
+  struct entry {
+    int iglob;
+    int isource;
+    type_real weight[components];
+  };
+
+  std::vector<entry> entries;
+
+  const int ngllz = sources.h_source_array.extent(2);
+  const int ngllx = sources.h_source_array.extent(3);
+
+  for (int isource = 0; isource < nsources; isource++) {
+    const int isource_l = h_source_domain_index_mapping(isource);
+    const int ispec_l = sources.h_source_index_mapping(isource_l);
+    for (int iz = 0; iz < ngllz; iz++) {
+      for (int ix = 0; ix < ngllx; ix++) {
+        entry e;
+        bool nonzero = false;
+        for (int icomp = 0; icomp < components; icomp++) {
+          e.weight[icomp] = sources.h_source_array(isource_l, icomp, iz, ix);
+          nonzero = nonzero || (e.weight[icomp] != 0.0);
+        }
+
+        if (!nonzero)
+          continue;
+
+        // For acoustic medium, forward simulation, divide by kappa
+        if constexpr ((WavefieldType == specfem::wavefield::type::forward) &&
+                      (MediumTag == specfem::element::medium_tag::acoustic)) {
+          const specfem::point::index<DimensionType> index(ispec_l, iz, ix);
+          specfem::point::properties<DimensionType, MediumTag, PropertyTag,
+                                     using_simd>
+              point_properties;
+          specfem::compute::load_on_host(index, assembly.properties,
+                                         point_properties);
+          for (int icomp = 0; icomp < components; icomp++) {
+            e.weight[icomp] /= point_properties.kappa;
+          }
+        }
+
+        const int index = field.h_index_mapping(ispec_l, iz, ix);
+        e.iglob = field.h_assembly_index_mapping(index,
+                                                 static_cast<int>(MediumTag));
+        e.isource = isource;
+        entries.push_back(e);
+      }
+    }
+  }
+
+  // Sort the entries by global point so that the contributions to a point
+  // are summed by a single thread. Sorting by source within a point keeps the
+  // order of the sum independent of the order of the kernels.
+  std::sort(entries.begin(), entries.end(),
+            [](const entry &lhs, const entry &rhs) {
+              return (lhs.iglob < rhs.iglob) ||
+                     ((lhs.iglob == rhs.iglob) && (lhs.isource < rhs.isource));
+            });
+
+  const int nentries = entries.size();
+
+  npoints = 0;
+  for (int ientry = 0; ientry < nentries; ientry++) {
+    if (ientry == 0 || entries[ientry].iglob != entries[ientry - 1].iglob)
+      npoints++;
+  }
+
+  point_offsets = specfem::kokkos::DeviceView1d<int>(
+      "specfem::domain::impl::kernels::source_kernel::point_offsets",
+      npoints + 1);
+  point_iglob = specfem::kokkos::DeviceView1d<int>(
+      "specfem::domain::impl::kernels::source_kernel::point_iglob", npoints);
+  entry_source = specfem::kokkos::DeviceView1d<int>(
+      "specfem::domain::impl::kernels::source_kernel::entry_source", nentries);
+  entry_weight = specfem::kokkos::DeviceView2d<type_real>(
+      "specfem::domain::impl::kernels::source_kernel::entry_weight", nentries,
+      components);
+
+  h_point_offsets = Kokkos::create_mirror_view(point_offsets);
+  h_point_iglob = Kokkos::create_mirror_view(point_iglob);
+  h_entry_source = Kokkos::create_mirror_view(entry_source);
+  h_entry_weight = Kokkos::create_mirror_view(entry_weight);
+
+  int ipoint = 0;
+  for (int ientry = 0; ientry < nentries; ientry++) {
+    if (ientry == 0 || entries[ientry].iglob != entries[ientry - 1].iglob) {
+      h_point_offsets(ipoint) = ientry;
+      h_point_iglob(ipoint) = entries[ientry].iglob;
+      ipoint++;
+    }
+    h_entry_source(ientry) = entries[ientry].isource;
+    for (int icomp = 0; icomp < components; icomp++) {
+      h_entry_weight(ientry, icomp) = entries[ientry].weight[icomp];
+    }
+  }
+  h_point_offsets(npoints) = nentries;
+
+  Kokkos::deep_copy(point_offsets, h_point_offsets);
+  Kokkos::deep_copy(point_iglob, h_point_iglob);
+  Kokkos::deep_copy(entry_source, h_entry_source);
+  Kokkos::deep_copy(entry_weight, h_entry_weight);
+
+  source_time_function_values = specfem::kokkos::DeviceView2d<type_real>(
+      "specfem::domain::impl::kernels::source_kernel::source_time_function_"
+      "values",
+      nsources, components);
+
   source = specfem::domain::impl::sources::source<
       DimensionType, MediumTag, PropertyTag, quadrature_point_type, using_simd>();
   return;
@@ -64,78 +176,66 @@ void specfem::domain::impl::kernels::source_kernel<
   constexpr int components = medium_type::components;
   using PointFieldType = specfem::point::field<DimensionType, MediumTag, false,
                                                false, true, false, using_simd>;
+  using PointValueType =
+      specfem::datatype::ScalarPointViewType<type_real, components,
+                                             using_simd>;
 
-  if (nsources == 0)
+  if (npoints == 0)
     return;
 
-  const auto index_mapping = points.index_mapping;
+  // Analytic source time functions are evaluated at the current time, the
+  // others are read from the window of tabulated time steps
+  const int iwindow = sources.load_source_time_function(timestep);
+  const type_real time = sources.t0 + timestep * sources.dt;
+
+  // Evaluate the source time functions once per source rather than once for
+  // every point touched by the source
+  Kokkos::parallel_for(
+      "specfem::domain::domain::compute_source_time_function",
+      specfem::kokkos::DeviceRange(0, nsources),
+      KOKKOS_CLASS_LAMBDA(const int isource) {
+        const int isource_l = source_domain_index_mapping(isource);
+        for (int icomp = 0; icomp < components; icomp++) {
+          source_time_function_values(isource, icomp) =
+              sources.get_source_time_function(isource_l, icomp, time,
+                                               iwindow);
+        }
+      });
 
+  // Every global point touched by the sources is owned by a single thread,
+  // which sums the contributions of all the sources at that point
   Kokkos::parallel_for(
       "specfem::domain::domain::compute_source_interaction",
-      specfem::kokkos::DeviceTeam(nsources, Kokkos::AUTO, 1),
-      KOKKOS_CLASS_LAMBDA(
-          const specfem::kokkos::DeviceTeam::member_type &team_member) {
-        int ngllx, ngllz;
-        quadrature_points.get_ngll(&ngllx, &ngllz);
-        const int isource_l =
-            source_domain_index_mapping(team_member.league_rank());
-        const int ispec_l = sources.source_index_mapping(isource_l);
-
-        Kokkos::parallel_for(
-            quadrature_points.template TeamThreadRange<specfem::enums::axes::z,
-                                                       specfem::enums::axes::x>(
-                team_member),
-            [=](const int xz) {
-              int iz, ix;
-              sub2ind(xz, ngllx, iz, ix);
-              specfem::point::index<DimensionType> index(ispec_l, iz, ix);
-
-              const specfem::datatype::ScalarPointViewType<
-                  type_real, medium_type::components, using_simd>
-                  lagrange_interpolant(Kokkos::subview(
-                      sources.source_array, isource_l, Kokkos::ALL, iz, ix));
-
-              // Source time function
-              // For acoustic medium, forward simulation, divide by kappa
-              const auto stf = [&, timestep, components]() {
-                if constexpr ((WavefieldType ==
-                               specfem::wavefield::type::forward) &&
-                              (MediumTag ==
-                               specfem::element::medium_tag::acoustic)) {
-                  const auto point_properties = [&]()
-                      -> specfem::point::properties<DimensionType, MediumTag,
-                                                    PropertyTag, using_simd> {
-                    specfem::point::properties<DimensionType, MediumTag,
-                                               PropertyTag, using_simd>
-                        point_properties;
-                    specfem::compute::load_on_device(index, properties,
-                                                     point_properties);
-                    return point_properties;
-                  }();
-                  specfem::datatype::ScalarPointViewType<
-                      type_real, medium_type::components, using_simd>
-                      stf(Kokkos::subview(sources.source_time_function,
-                                          timestep, isource_l, Kokkos::ALL));
-                  for (int i = 0; i < components; i++) {
-                    stf(i) = stf(i) / point_properties.kappa;
-                  }
-                  return stf;
-                } else {
-                  return specfem::datatype::ScalarPointViewType<
-                      type_real, medium_type::components, using_simd>(
-                      Kokkos::subview(sources.source_time_function, timestep,
-                                      isource_l, Kokkos::ALL));
-                }
-              }();
-
-              PointFieldType acceleration;
-
-              source.compute_interaction(stf, lagrange_interpolant,
-                                         acceleration.acceleration);
-
-              specfem::compute::atomic_add_on_device(index, acceleration,
-                                                     field);
-            });
+      specfem::kokkos::DeviceRange(0, npoints),
+      KOKKOS_CLASS_LAMBDA(const int ipoint) {
+        PointFieldType acceleration;
+
+        for (int ientry = point_offsets(ipoint);
+             ientry < point_offsets(ipoint + 1); ientry++) {
+          const int isource = entry_source(ientry);
+
+          PointValueType source_time_function;
+          PointValueType weight;
+          for (int icomp = 0; icomp < components; icomp++) {
+            source_time_function(icomp) =
+                source_time_function_values(isource, icomp);
+            weight(icomp) = entry_weight(ientry, icomp);
+          }
+
+          PointFieldType contribution;
+
+          source.compute_interaction(source_time_function, weight,
+                                     contribution.acceleration);
+
+          for (int icomp = 0; icomp < components; icomp++) {
+            acceleration.acceleration(icomp) +=
+                contribution.acceleration(icomp);
+          }
+        }
+
+        specfem::compute::add_on_device(
+            specfem::point::assembly_index<false>(point_iglob(ipoint)),
+            acceleration, field);
       });
 
   Kokkos::fence();
@@ -27,7 +27,7 @@ enum class type { displacement, velocity, acceleration };
  * @brief Output format of seismogram enumeration
  *
  */
-enum format { seismic_unix, ascii };
+enum format { seismic_unix, ascii, binary, hdf5 };
 
 } // namespace seismogram
 
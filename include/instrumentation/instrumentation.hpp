@@ -0,0 +1,196 @@
+#ifndef _SPECFEM_INSTRUMENTATION_HPP
+#define _SPECFEM_INSTRUMENTATION_HPP
+
+#include "enumerations/medium.hpp"
+#include "enumerations/wavefield.hpp"
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace specfem {
+namespace instrumentation {
+
+/**
+ * @brief Time and estimated memory traffic of a phase of the time loop
+ * accumulated over all time steps
+ *
+ */
+struct phase_timer {
+  std::string phase;     ///< Name of the phase (e.g. stiffness)
+  std::string wavefield; ///< Wavefield the phase operates on
+  std::string medium;    ///< Medium the phase operates on
+  int calls = 0;         ///< Number of times the phase was executed
+  double time = 0.0;     ///< Time spent in the phase in seconds
+  std::size_t bytes = 0; ///< Estimated bytes read and written by the phase.
+                         ///< 0 if no estimate is available
+
+  /**
+   * @brief Achieved bandwidth in GB/s. 0 if no traffic estimate is available
+   *
+   */
+  double bandwidth() const {
+    return (time > 0.0) ? static_cast<double>(bytes) / 1e9 / time : 0.0;
+  }
+};
+
+/**
+ * @brief Registry of the timers of every phase of the time loop
+ *
+ * Timers are only recorded when the registry is enabled, since timing a phase
+ * requires fencing the execution space before and after the phase. The
+ * registry is enabled by default if SPECFEM is built with @c
+ * ENABLE_PROFILING.
+ */
+class registry {
+public:
+  /**
+   * @brief Get the registry of this process
+   *
+   * @return registry& Registry
+   */
+  static registry &get();
+
+  registry(const registry &) = delete;
+  registry &operator=(const registry &) = delete;
+
+  /**
+   * @brief Enable or disable recording of timers
+   *
+   * @param enabled True to record timers
+   */
+  void enable(const bool enabled) { this->enabled = enabled; }
+
+  /**
+   * @brief Check if timers are recorded
+   *
+   */
+  bool is_enabled() const { return this->enabled; }
+
+  /**
+   * @brief Add an execution of a phase
+   *
+   * @param phase Name of the phase
+   * @param wavefield Wavefield the phase operates on
+   * @param medium Medium the phase operates on
+   * @param time Time spent in the phase in seconds
+   * @param bytes Estimated bytes read and written by the phase
+   */
+  void record(const std::string &phase, const std::string &wavefield,
+              const std::string &medium, const double time,
+              const std::size_t bytes);
+
+  /**
+   * @brief Get the timers of every phase in the order they were first
+   * recorded
+   *
+   */
+  const std::vector<phase_timer> &get_timers() const { return this->timers; }
+
+  /**
+   * @brief Remove all timers
+   *
+   */
+  void reset();
+
+  /**
+   * @brief Print a table of the time, traffic and bandwidth of every phase
+   *
+   * @param out Output stream
+   */
+  void print(std::ostream &out) const;
+
+  /**
+   * @brief Write the timers as JSON
+   *
+   * @param out Output stream
+   */
+  void write_json(std::ostream &out) const;
+
+  /**
+   * @brief Write the timers as JSON to a file
+   *
+   * @param filename Path to the file
+   */
+  void write_json(const std::string &filename) const;
+
+private:
+  registry();
+
+  bool enabled; ///< Timers are recorded
+  std::vector<phase_timer> timers; ///< Timers in the order of first record
+  std::map<std::tuple<std::string, std::string, std::string>, int>
+      index; ///< Position of every (phase, wavefield, medium) in timers
+};
+
+/**
+ * @brief Scoped region of the time loop
+ *
+ * Opens a Kokkos profiling region named after the phase, wavefield and medium
+ * for the lifetime of the object, which makes the phase visible to Kokkos
+ * tools. If the @ref registry is enabled, the time spent within the region is
+ * also recorded.
+ */
+class region {
+public:
+  /**
+   * @brief Open a region
+   *
+   * @param phase Name of the phase
+   * @param wavefield Wavefield the phase operates on
+   * @param medium Medium the phase operates on
+   * @param bytes Estimated bytes read and written by the phase
+   */
+  region(const std::string &phase, const std::string &wavefield,
+         const std::string &medium, const std::size_t bytes = 0);
+
+  /**
+   * @brief Open a region
+   *
+   * @param phase Name of the phase
+   * @param wavefield Wavefield the phase operates on
+   * @param medium Medium the phase operates on
+   * @param bytes Estimated bytes read and written by the phase
+   */
+  region(const std::string &phase, const specfem::wavefield::type wavefield,
+         const specfem::element::medium_tag medium,
+         const std::size_t bytes = 0);
+
+  /**
+   * @brief Close the region and record its time
+   *
+   */
+  ~region();
+
+  region(const region &) = delete;
+  region &operator=(const region &) = delete;
+
+private:
+  std::string phase;     ///< Name of the phase
+  std::string wavefield; ///< Wavefield the phase operates on
+  std::string medium;    ///< Medium the phase operates on
+  std::size_t bytes;     ///< Estimated bytes read and written by the phase
+  bool timed;            ///< Registry was enabled when the region opened
+  std::chrono::time_point<std::chrono::high_resolution_clock>
+      start; ///< Time at which the region opened
+};
+
+/**
+ * @brief Name of a wavefield used to label timers
+ *
+ */
+std::string to_string(const specfem::wavefield::type wavefield);
+
+/**
+ * @brief Name of a medium used to label timers
+ *
+ */
+std::string to_string(const specfem::element::medium_tag medium);
+
+} // namespace instrumentation
+} // namespace specfem
+
+#endif /* _SPECFEM_INSTRUMENTATION_HPP */
@@ -5,6 +5,7 @@
 #include "enumerations/dimension.hpp"
 #include "enumerations/medium.hpp"
 #include "frechet_derivatives/frechet_derivatives.hpp"
+#include "instrumentation/instrumentation.hpp"
 
 namespace specfem {
 namespace kernels {
@@ -16,8 +17,18 @@ public:
       : elastic_elements(assembly), acoustic_elements(assembly) {}
 
   inline void compute_derivatives(const type_real &dt) {
-    elastic_elements.compute(dt);
-    acoustic_elements.compute(dt);
+    {
+      specfem::instrumentation::region region(
+          "frechet", specfem::wavefield::type::adjoint,
+          specfem::element::medium_tag::elastic);
+      elastic_elements.compute(dt);
+    }
+    {
+      specfem::instrumentation::region region(
+          "frechet", specfem::wavefield::type::adjoint,
+          specfem::element::medium_tag::acoustic);
+      acoustic_elements.compute(dt);
+    }
   }
 
 private:
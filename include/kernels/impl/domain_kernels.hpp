@@ -6,6 +6,7 @@
 #include "enumerations/simulation.hpp"
 #include "enumerations/specfem_enums.hpp"
 #include "kernels.hpp"
+#include "parallel_configuration/chunk_tuning.hpp"
 
 namespace specfem {
 namespace kernels {
@@ -30,6 +31,15 @@ public:
     }
   }
 
+  template <specfem::element::medium_tag medium>
+  inline void compute_forces(const int istep) {
+    if constexpr (medium == specfem::element::medium_tag::elastic) {
+      elastic_kernels.compute_forces(istep);
+    } else if constexpr (medium == specfem::element::medium_tag::acoustic) {
+      acoustic_kernels.compute_forces(istep);
+    }
+  }
+
   void initialize(const type_real &dt) {
 
     elastic_kernels.invert_mass_matrix();
@@ -42,6 +52,17 @@ public:
     acoustic_kernels.compute_seismograms(isig_step);
   }
 
+  /**
+   * @brief Select the fastest chunk configuration of the stiffness kernels of
+   * every medium
+   *
+   * @param tuning Tuning parameters. Nothing is done if tuning is disabled
+   */
+  void tune_chunk_config(const specfem::parallel_config::chunk_tuning &tuning) {
+    elastic_kernels.tune_chunk_config(tuning);
+    acoustic_kernels.tune_chunk_config(tuning);
+  }
+
 private:
   specfem::kernels::impl::kernels<WavefieldType, DimensionType,
                                   specfem::element::medium_tag::elastic,
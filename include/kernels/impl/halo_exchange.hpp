@@ -0,0 +1,154 @@
+#ifndef _SPECFEM_KERNELS_IMPL_HALO_EXCHANGE_HPP
+#define _SPECFEM_KERNELS_IMPL_HALO_EXCHANGE_HPP
+
+#include "compute/interface.hpp"
+#include "enumerations/dimension.hpp"
+#include "enumerations/medium.hpp"
+#include "enumerations/simulation.hpp"
+#include "kokkos_abstractions.h"
+#include "specfem_mpi/interface.hpp"
+#include "specfem_setup.hpp"
+#include <Kokkos_Core.hpp>
+#include <vector>
+
+#ifdef MPI_PARALLEL
+#include <mpi.h>
+#endif
+
+namespace specfem {
+namespace kernels {
+namespace impl {
+/**
+ * @brief Assemble a field at the points shared with other MPI ranks
+ *
+ * Every rank only adds the contributions of its own elements to the points on
+ * its partition boundary. The exchange sends those partial sums to the
+ * neighbors sharing the points and adds the partial sums received from them,
+ * so that every rank holds the fully assembled value.
+ *
+ * The exchange is split into @ref start and @ref finish. Sends and receives
+ * are non-blocking, so work that does not touch the exchanged field can be
+ * done in between. Nothing is done when the partition has no neighbors, in
+ * particular when SPECFEM is compiled without MPI. Messages are sent on the
+ * communicator of the MPI object the mesh was read with.
+ *
+ * @tparam WavefieldType Wavefield type
+ * @tparam DimensionType Dimension type
+ * @tparam MediumTag Medium of the exchanged field
+ */
+template <specfem::wavefield::type WavefieldType,
+          specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag>
+class halo_exchange {
+public:
+  using field_type =
+      specfem::compute::impl::field_impl<DimensionType, MediumTag>;
+  using view_type = decltype(field_type::field_dot_dot);
+  constexpr static int components = field_type::components;
+
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Default constructor. Nothing is exchanged
+   *
+   */
+  halo_exchange() = default;
+
+  /**
+   * @brief Construct the exchange for the wavefield of an assembly
+   *
+   * @param assembly Assembly holding the MPI interfaces and the field
+   */
+  halo_exchange(const specfem::compute::assembly &assembly);
+  ///@}
+
+  /**
+   * @brief Post the receives and send the values of @p view on the
+   * interfaces
+   *
+   * @param view Field to assemble. Contributions of every element of this
+   * rank need to be summed in before the call
+   */
+  void start(const view_type &view);
+
+  /**
+   * @brief Wait for the neighbor values and add them to @p view
+   *
+   * @param view Field passed to @ref start
+   */
+  void finish(const view_type &view);
+
+  /**
+   * @brief Assemble the acceleration of the wavefield
+   *
+   */
+  void exchange_acceleration() {
+    start(field.field_dot_dot);
+    finish(field.field_dot_dot);
+  }
+
+  /**
+   * @brief Start assembling the acceleration of the wavefield
+   *
+   */
+  void start_acceleration() { start(field.field_dot_dot); }
+
+  /**
+   * @brief Finish assembling the acceleration of the wavefield
+   *
+   */
+  void finish_acceleration() { finish(field.field_dot_dot); }
+
+  /**
+   * @brief Assemble the mass matrix of the wavefield before it is inverted
+   *
+   */
+  void exchange_mass_matrix() {
+    start(field.mass_inverse);
+    finish(field.mass_inverse);
+  }
+
+  /**
+   * @brief Check if this rank shares points with other ranks
+   *
+   */
+  bool enabled() const { return nneighbors > 0; }
+
+private:
+  using buffer_type =
+      Kokkos::View<type_field *[components], Kokkos::LayoutRight,
+                   specfem::kokkos::DevMemSpace>;
+
+  int nneighbors = 0; ///< Number of neighboring ranks
+  int npoints = 0;    ///< Number of interface points
+  const specfem::MPI::MPI *mpi = nullptr; ///< MPI object used to communicate
+                                          ///< with the neighbors
+  specfem::kokkos::HostView1d<int> h_neighbors; ///< Rank of every neighbor
+  specfem::kokkos::HostView1d<int> h_offsets;   ///< First point of every
+                                                ///< interface
+  specfem::kokkos::DeviceView1d<int> index_mapping; ///< Index of every
+                                                    ///< interface point
+                                                    ///< within the field of
+                                                    ///< this medium. -1 if
+                                                    ///< the point is not in
+                                                    ///< this medium
+  field_type field;                                ///< Field of this medium
+  buffer_type send_buffer;                         ///< Packed values sent
+  buffer_type recv_buffer;                         ///< Packed values received
+  typename buffer_type::HostMirror h_send_buffer;  ///< Host staging of
+                                                   ///< @c send_buffer
+  typename buffer_type::HostMirror h_recv_buffer;  ///< Host staging of
+                                                   ///< @c recv_buffer
+#ifdef MPI_PARALLEL
+  std::vector<MPI_Request> requests; ///< Pending receives and sends
+#endif
+};
+
+} // namespace impl
+} // namespace kernels
+} // namespace specfem
+
+#endif /* _SPECFEM_KERNELS_IMPL_HALO_EXCHANGE_HPP */
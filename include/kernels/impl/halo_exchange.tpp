@@ -0,0 +1,151 @@
+#ifndef _SPECFEM_KERNELS_IMPL_HALO_EXCHANGE_TPP
+#define _SPECFEM_KERNELS_IMPL_HALO_EXCHANGE_TPP
+
+#include "halo_exchange.hpp"
+#include "kokkos_abstractions.h"
+#include <Kokkos_Core.hpp>
+
+template <specfem::wavefield::type WavefieldType,
+          specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag>
+specfem::kernels::impl::halo_exchange<WavefieldType, DimensionType, MediumTag>::
+    halo_exchange(const specfem::compute::assembly &assembly)
+    : nneighbors(assembly.mpi_interfaces.nneighbors),
+      npoints(assembly.mpi_interfaces.npoints),
+      mpi(assembly.mpi_interfaces.mpi),
+      h_neighbors(assembly.mpi_interfaces.h_neighbors),
+      h_offsets(assembly.mpi_interfaces.h_offsets) {
+
+  if (nneighbors == 0)
+    return;
+
+  const auto simulation_field =
+      assembly.fields.template get_simulation_field<WavefieldType>();
+
+  if constexpr (MediumTag == specfem::element::medium_tag::elastic) {
+    this->field = simulation_field.elastic;
+  } else if constexpr (MediumTag == specfem::element::medium_tag::acoustic) {
+    this->field = simulation_field.acoustic;
+  }
+
+  // Interface points hold global indices. Map them to the field of this
+  // medium
+  this->index_mapping = specfem::kokkos::DeviceView1d<int>(
+      "specfem::kernels::impl::halo_exchange::index_mapping", npoints);
+  auto h_index_mapping = Kokkos::create_mirror_view(this->index_mapping);
+  for (int ipoint = 0; ipoint < npoints; ipoint++) {
+    const int iglob = assembly.mpi_interfaces.h_index_mapping(ipoint);
+    h_index_mapping(ipoint) = simulation_field.h_assembly_index_mapping(
+        iglob, static_cast<int>(MediumTag));
+  }
+  Kokkos::deep_copy(this->index_mapping, h_index_mapping);
+
+  this->send_buffer = buffer_type(
+      "specfem::kernels::impl::halo_exchange::send_buffer", npoints);
+  this->recv_buffer = buffer_type(
+      "specfem::kernels::impl::halo_exchange::recv_buffer", npoints);
+  this->h_send_buffer = Kokkos::create_mirror_view(this->send_buffer);
+  this->h_recv_buffer = Kokkos::create_mirror_view(this->recv_buffer);
+
+#ifdef MPI_PARALLEL
+  this->requests.resize(2 * nneighbors, MPI_REQUEST_NULL);
+#endif
+
+  return;
+}
+
+template <specfem::wavefield::type WavefieldType,
+          specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag>
+void specfem::kernels::impl::halo_exchange<
+    WavefieldType, DimensionType, MediumTag>::start(const view_type &view) {
+
+  if (nneighbors == 0)
+    return;
+
+#ifdef MPI_PARALLEL
+  const auto datatype =
+      (sizeof(type_field) == sizeof(float)) ? MPI_FLOAT : MPI_DOUBLE;
+  const int tag = static_cast<int>(MediumTag);
+
+  // Receives are posted before packing so that they are ready when the
+  // neighbors send
+  for (int i = 0; i < nneighbors; i++) {
+    const int offset = h_offsets(i);
+    const int count = (h_offsets(i + 1) - offset) * components;
+    MPI_Irecv(h_recv_buffer.data() + offset * components, count, datatype,
+              h_neighbors(i), tag, mpi->get_comm(), &requests[i]);
+  }
+#endif
+
+  const auto index_mapping = this->index_mapping;
+  const auto send_buffer = this->send_buffer;
+
+  Kokkos::parallel_for(
+      "specfem::kernels::impl::halo_exchange::pack",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, npoints),
+      KOKKOS_LAMBDA(const int ipoint) {
+        const int iglob = index_mapping(ipoint);
+        for (int icomp = 0; icomp < components; icomp++) {
+          send_buffer(ipoint, icomp) =
+              (iglob < 0) ? static_cast<type_field>(0.0) : view(iglob, icomp);
+        }
+      });
+
+  // Fences the pack kernel
+  Kokkos::deep_copy(h_send_buffer, send_buffer);
+
+#ifdef MPI_PARALLEL
+  for (int i = 0; i < nneighbors; i++) {
+    const int offset = h_offsets(i);
+    const int count = (h_offsets(i + 1) - offset) * components;
+    MPI_Isend(h_send_buffer.data() + offset * components, count, datatype,
+              h_neighbors(i), tag, mpi->get_comm(),
+              &requests[nneighbors + i]);
+  }
+#endif
+
+  return;
+}
+
+template <specfem::wavefield::type WavefieldType,
+          specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag>
+void specfem::kernels::impl::halo_exchange<
+    WavefieldType, DimensionType, MediumTag>::finish(const view_type &view) {
+
+  if (nneighbors == 0)
+    return;
+
+#ifdef MPI_PARALLEL
+  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+#endif
+
+  // Inner elements may still be running on another execution space instance.
+  // They do not touch the interface points, so only the instance used for the
+  // exchange is waited for
+  const Kokkos::DefaultExecutionSpace space;
+  Kokkos::deep_copy(space, recv_buffer, h_recv_buffer);
+
+  const auto index_mapping = this->index_mapping;
+  const auto recv_buffer = this->recv_buffer;
+
+  // A point shared with several neighbors appears on several interfaces
+  Kokkos::parallel_for(
+      "specfem::kernels::impl::halo_exchange::unpack",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(space, 0, npoints),
+      KOKKOS_LAMBDA(const int ipoint) {
+        const int iglob = index_mapping(ipoint);
+        if (iglob < 0)
+          return;
+        for (int icomp = 0; icomp < components; icomp++) {
+          Kokkos::atomic_add(&view(iglob, icomp), recv_buffer(ipoint, icomp));
+        }
+      });
+
+  space.fence();
+
+  return;
+}
+
+#endif /* _SPECFEM_KERNELS_IMPL_HALO_EXCHANGE_TPP */
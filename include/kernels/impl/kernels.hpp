@@ -7,6 +7,9 @@
 #include "enumerations/medium.hpp"
 #include "enumerations/simulation.hpp"
 #include "enumerations/specfem_enums.hpp"
+#include "halo_exchange.hpp"
+#include "halo_exchange.tpp"
+#include "instrumentation/instrumentation.hpp"
 #include "interface_kernels.hpp"
 
 namespace specfem {
@@ -22,25 +25,79 @@ public:
   kernels(const type_real dt, const specfem::compute::assembly &assembly,
           const qp_type &quadrature_points)
       : domain(dt, assembly, quadrature_points),
-        interface_kernels<WavefieldType, DimensionType, MediumTag>(assembly) {}
+        interface_kernels<WavefieldType, DimensionType, MediumTag>(assembly),
+        halo(assembly) {}
 
   inline void update_wavefields(const int istep) {
-    interface_kernels<WavefieldType, DimensionType,
-                      MediumTag>::compute_coupling();
-    domain.compute_source_interaction(istep);
-    domain.compute_stiffness_interaction(istep);
+    compute_forces(istep);
+    specfem::instrumentation::region region(
+        "divide_mass_matrix", WavefieldType, MediumTag,
+        domain.divide_mass_matrix_traffic());
     domain.divide_mass_matrix();
   }
 
-  inline void invert_mass_matrix() { domain.invert_mass_matrix(); }
+  /**
+   * @brief Accumulate coupling, source and stiffness terms into the
+   * acceleration without dividing by the mass matrix
+   *
+   * Used when the division is fused into the time scheme update. The
+   * acceleration is assembled across MPI ranks before returning. Elements
+   * sharing points with other ranks are computed first, and the elements
+   * within the partition are computed while the exchange is in flight.
+   *
+   * @param istep Time step
+   */
+  inline void compute_forces(const int istep) {
+    {
+      specfem::instrumentation::region region("coupling", WavefieldType,
+                                              MediumTag);
+      interface_kernels<WavefieldType, DimensionType,
+                        MediumTag>::compute_coupling();
+    }
+    {
+      specfem::instrumentation::region region("source", WavefieldType,
+                                              MediumTag);
+      domain.compute_source_interaction(istep);
+    }
+    {
+      // Timed regions fence the device, so the exchange is timed as part of
+      // the stiffness phase it overlaps with
+      specfem::instrumentation::region region(
+          "stiffness", WavefieldType, MediumTag, domain.stiffness_traffic());
+      domain.compute_outer_stiffness_interaction(istep);
+      halo.start_acceleration();
+      domain.start_inner_stiffness_interaction(istep);
+      halo.finish_acceleration();
+      domain.finish_inner_stiffness_interaction();
+    }
+  }
+
+  /**
+   * @brief Assemble the mass matrix across MPI ranks and invert it
+   *
+   */
+  inline void invert_mass_matrix() {
+    halo.exchange_mass_matrix();
+    domain.invert_mass_matrix();
+  }
+
+  inline void
+  tune_chunk_config(const specfem::parallel_config::chunk_tuning &tuning) {
+    domain.tune_chunk_config(tuning);
+  }
 
   inline void compute_seismograms(const int &isig_step) {
+    specfem::instrumentation::region region("seismogram", WavefieldType,
+                                            MediumTag);
     domain.compute_seismograms(isig_step);
   }
 
 private:
   specfem::domain::domain<WavefieldType, DimensionType, MediumTag, qp_type>
       domain;
+  specfem::kernels::impl::halo_exchange<WavefieldType, DimensionType,
+                                        MediumTag>
+      halo; ///< Assembly of the acceleration across MPI ranks
 };
 } // namespace impl
 } // namespace kernels
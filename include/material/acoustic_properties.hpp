@@ -4,6 +4,7 @@
 #include "point/properties.hpp"
 #include "properties.hpp"
 #include "specfem_setup.hpp"
+#include <array>
 #include <exception>
 #include <ostream>
 
@@ -74,6 +75,17 @@ public:
              this->kappa };
   }
 
+  /**
+   * @brief Get the parameters the material was constructed from
+   *
+   * @return std::array<type_real, 5> density, cp, Qkappa, Qmu and compaction
+   * gradient, in the order of the constructor arguments
+   */
+  inline std::array<type_real, 5> get_parameters() const {
+    return { this->density, this->cp, this->Qkappa, this->Qmu,
+             this->compaction_grad };
+  }
+
   inline std::string print() const {
     std::ostringstream message;
 
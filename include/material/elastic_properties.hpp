@@ -4,6 +4,7 @@
 #include "point/properties.hpp"
 #include "properties.hpp"
 #include "specfem_setup.hpp"
+#include <array>
 #include <exception>
 #include <ostream>
 
@@ -75,6 +76,17 @@ public:
     return { this->lambdaplus2mu, this->mu, this->density };
   }
 
+  /**
+   * @brief Get the parameters the material was constructed from
+   *
+   * @return std::array<type_real, 6> density, cs, cp, Qkappa, Qmu and
+   * compaction gradient, in the order of the constructor arguments
+   */
+  inline std::array<type_real, 6> get_parameters() const {
+    return { this->density, this->cs,  this->cp,
+             this->Qkappa,  this->Qmu, this->compaction_grad };
+  }
+
   inline std::string print() const {
     std::ostringstream message;
 
@@ -1,6 +1,7 @@
 #ifndef _READ_MATERIAL_PROPERTIES_HPP
 #define _READ_MATERIAL_PROPERTIES_HPP
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "material/interface.hpp"
 #include "specfem_mpi/interface.hpp"
 #include <fstream>
@@ -24,8 +25,8 @@ namespace fortran {
  * from the database file
  */
 std::vector<std::shared_ptr<specfem::material::material> >
-read_material_properties(std::ifstream &stream, const int numat,
-                         const specfem::MPI::MPI *mpi);
+read_material_properties(specfem::IO::fortran_reader &stream,
+                         const int numat, const specfem::MPI::MPI *mpi);
 } // namespace fortran
 } // namespace IO
 } // namespace mesh
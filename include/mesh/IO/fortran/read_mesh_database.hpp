@@ -1,6 +1,7 @@
 #ifndef _READ_MESH_DATABASE_HPP
 #define _READ_MESH_DATABASE_HPP
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "kokkos_abstractions.h"
 #include "specfem_mpi/interface.hpp"
 #include "specfem_setup.hpp"
@@ -29,7 +30,8 @@ namespace fortran {
  * database file
  */
 std::tuple<int, int, int>
-read_mesh_database_header(std::ifstream &stream, const specfem::MPI::MPI *mpi);
+read_mesh_database_header(specfem::IO::fortran_reader &stream,
+                          const specfem::MPI::MPI *mpi);
 /**
  * @brief Read coorg elements from fortran binary database file
  *
@@ -41,7 +43,7 @@ read_mesh_database_header(std::ifstream &stream, const specfem::MPI::MPI *mpi);
  * fortran binary database file
  */
 specfem::kokkos::HostView2d<type_real>
-read_coorg_elements(std::ifstream &stream, const int npgeo,
+read_coorg_elements(specfem::IO::fortran_reader &stream, const int npgeo,
                     const specfem::MPI::MPI *mpi);
 
 /**
@@ -49,7 +51,7 @@ read_coorg_elements(std::ifstream &stream, const int npgeo,
  */
 
 std::tuple<int, type_real, bool>
-read_mesh_database_attenuation(std::ifstream &stream,
+read_mesh_database_attenuation(specfem::IO::fortran_reader &stream,
                                const specfem::MPI::MPI *mpi);
 } // namespace fortran
 } // namespace IO
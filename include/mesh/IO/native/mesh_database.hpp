@@ -0,0 +1,63 @@
+#pragma once
+
+#include "mesh/mesh.hpp"
+#include "specfem_mpi/interface.hpp"
+#include <string>
+
+namespace specfem {
+namespace mesh {
+namespace IO {
+/**
+ * Native mesh format written and read with the SPECFEM++ IO libraries
+ *
+ */
+namespace native {
+
+/**
+ * @brief Version of the native mesh format
+ *
+ * Stored in every mesh file and checked when reading
+ */
+constexpr int format_version = 1;
+
+/**
+ * @brief Write a mesh in the native mesh format
+ *
+ * Every array of the mesh (control nodes, knods, materials, boundaries,
+ * coupled interfaces and MPI interfaces) is stored as a contiguous dataset,
+ * preceded by a small dataset holding the sizes of all the other datasets.
+ * Reading the mesh back is then a single read per array, without any
+ * per-element parsing.
+ *
+ * Partitioned meshes are written one partition per file, like the Fortran
+ * databases. Acoustic forcing boundaries are not supported.
+ *
+ * @tparam IOLibrary Library used to write the mesh (@c
+ * specfem::IO::HDF5<specfem::IO::write> or @c
+ * specfem::IO::ASCII<specfem::IO::write>)
+ * @param filename Path to the mesh file (an .h5 file if using HDF5, a folder
+ * if using ASCII)
+ * @param mesh Mesh to write
+ */
+template <typename IOLibrary>
+void write_mesh(const std::string &filename, const specfem::mesh::mesh &mesh);
+
+/**
+ * @brief Read a mesh written in the native mesh format
+ *
+ * @tparam IOLibrary Library used to read the mesh (@c
+ * specfem::IO::HDF5<specfem::IO::read> or @c
+ * specfem::IO::ASCII<specfem::IO::read>)
+ * @param filename Path to the mesh file of the partition assigned to this MPI
+ * rank (without the .h5 extension if using HDF5)
+ * @param mpi Pointer to MPI object
+ * @return specfem::mesh::mesh Mesh read from the file
+ */
+template <typename IOLibrary>
+specfem::mesh::mesh read_mesh(const std::string &filename,
+                              const specfem::MPI::MPI *mpi);
+
+} // namespace native
+} // namespace IO
+} // namespace mesh
+} // namespace specfem
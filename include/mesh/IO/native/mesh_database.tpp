@@ -0,0 +1,489 @@
+#pragma once
+
+#include "enumerations/specfem_enums.hpp"
+#include "kokkos_abstractions.h"
+#include "material/material.hpp"
+#include "mesh/IO/native/mesh_database.hpp"
+#include "mesh/materials/materials.tpp"
+#include "mesh/mesh.hpp"
+#include "specfem_mpi/interface.hpp"
+#include "specfem_setup.hpp"
+#include <Kokkos_Core.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace specfem {
+namespace mesh {
+namespace IO {
+namespace native {
+namespace impl {
+
+/**
+ * @brief Entries of the Sizes dataset
+ *
+ * The Sizes dataset is read first and holds the extents of every other
+ * dataset, so that the views can be allocated before they are read.
+ */
+enum size_entry : int {
+  version = 0,             ///< Version of the format
+  nspec,                   ///< Number of spectral elements
+  npgeo,                   ///< Number of control nodes
+  nproc,                   ///< Number of partitions of the mesh
+  ndim,                    ///< Dimension of the control node coordinates
+  ngnod,                   ///< Number of control nodes per element
+  n_elastic_isotropic,     ///< Number of elastic isotropic materials
+  n_acoustic_isotropic,    ///< Number of acoustic isotropic materials
+  n_absorbing,             ///< Number of absorbing boundary edges
+  n_acoustic_free_surface, ///< Number of acoustic free surface edges
+  n_elastic_acoustic,      ///< Number of elastic-acoustic edges
+  n_acoustic_poroelastic,  ///< Number of acoustic-poroelastic edges
+  n_elastic_poroelastic,   ///< Number of elastic-poroelastic edges
+  ninterfaces,             ///< Number of neighboring partitions
+  max_interface_size,      ///< Maximum number of elements on an interface
+  nelem_on_the_axis,       ///< Number of axial elements
+  nsizes                   ///< Number of entries
+};
+
+constexpr int elastic_isotropic_parameters = 6;
+constexpr int acoustic_isotropic_parameters = 5;
+
+template <typename Group, typename InterfaceContainer>
+void write_interfaces(Group &coupled, const std::string &name,
+                      const InterfaceContainer &interfaces) {
+  if (interfaces.medium1_index_mapping.extent(0) == 0)
+    return;
+
+  auto group = coupled.createGroup(name);
+  group.createDataset("Medium1", interfaces.medium1_index_mapping).write();
+  group.createDataset("Medium2", interfaces.medium2_index_mapping).write();
+}
+
+template <typename Group, typename InterfaceContainer>
+void read_interfaces(Group &coupled, const std::string &name,
+                     const int num_interfaces,
+                     InterfaceContainer &interfaces) {
+  interfaces.num_interfaces = num_interfaces;
+  interfaces.medium1_index_mapping = Kokkos::View<int *, Kokkos::HostSpace>(
+      "medium1_index_mapping", num_interfaces);
+  interfaces.medium2_index_mapping = Kokkos::View<int *, Kokkos::HostSpace>(
+      "medium2_index_mapping", num_interfaces);
+
+  if (num_interfaces == 0)
+    return;
+
+  auto group = coupled.openGroup(name);
+  group.openDataset("Medium1", interfaces.medium1_index_mapping).read();
+  group.openDataset("Medium2", interfaces.medium2_index_mapping).read();
+}
+
+} // namespace impl
+} // namespace native
+} // namespace IO
+} // namespace mesh
+} // namespace specfem
+
+template <typename IOLibrary>
+void specfem::mesh::IO::native::write_mesh(const std::string &filename,
+                                           const specfem::mesh::mesh &mesh) {
+
+  namespace impl = specfem::mesh::IO::native::impl;
+
+  // Meshes read from Fortran databases hold placeholder views when there is
+  // no forcing boundary
+  if (mesh.boundaries.forcing_boundary.numacforcing.extent(0) > 0 &&
+      mesh.parameters.nelem_acforcing > 0) {
+    throw std::runtime_error(
+        "Acoustic forcing boundaries cannot be written to the native mesh "
+        "format");
+  }
+
+  const int nspec = mesh.nspec;
+  const auto &materials = mesh.materials;
+  const auto &absorbing = mesh.boundaries.absorbing_boundary;
+  const auto &free_surface = mesh.boundaries.acoustic_free_surface;
+  const auto &coupled_interfaces = mesh.coupled_interfaces;
+  const auto &mpi_interfaces = mesh.mpi_interfaces;
+
+  const int n_elastic_isotropic =
+      materials.elastic_isotropic.material_properties.size();
+  const int n_acoustic_isotropic =
+      materials.acoustic_isotropic.material_properties.size();
+
+  // Axial elements are stored as a list of elements
+  const int naxial = mesh.axial_nodes.is_on_the_axis.extent(0);
+  std::vector<int> axial_elements;
+  for (int ispec = 0; ispec < naxial; ispec++) {
+    if (mesh.axial_nodes.is_on_the_axis(ispec))
+      axial_elements.push_back(ispec);
+  }
+
+  // Sizes are taken from the views rather than from mesh.parameters, which
+  // is not filled for meshes generated in memory
+  specfem::kokkos::HostView1d<int> sizes("specfem::mesh::IO::native::sizes",
+                                         impl::nsizes);
+  sizes(impl::version) = specfem::mesh::IO::native::format_version;
+  sizes(impl::nspec) = nspec;
+  sizes(impl::npgeo) = mesh.control_nodes.coord.extent(1);
+  sizes(impl::nproc) = mesh.nproc;
+  sizes(impl::ndim) = mesh.control_nodes.coord.extent(0);
+  sizes(impl::ngnod) = mesh.control_nodes.knods.extent(0);
+  sizes(impl::n_elastic_isotropic) = n_elastic_isotropic;
+  sizes(impl::n_acoustic_isotropic) = n_acoustic_isotropic;
+  sizes(impl::n_absorbing) = absorbing.index_mapping.extent(0);
+  sizes(impl::n_acoustic_free_surface) = free_surface.index_mapping.extent(0);
+  sizes(impl::n_elastic_acoustic) =
+      coupled_interfaces.elastic_acoustic.medium1_index_mapping.extent(0);
+  sizes(impl::n_acoustic_poroelastic) =
+      coupled_interfaces.acoustic_poroelastic.medium1_index_mapping.extent(0);
+  sizes(impl::n_elastic_poroelastic) =
+      coupled_interfaces.elastic_poroelastic.medium1_index_mapping.extent(0);
+  sizes(impl::ninterfaces) = mpi_interfaces.my_interfaces.extent(0);
+  sizes(impl::max_interface_size) = mpi_interfaces.my_interfaces.extent(1);
+  sizes(impl::nelem_on_the_axis) = axial_elements.size();
+
+  typename IOLibrary::File file(filename);
+
+  file.createDataset("Sizes", sizes).write();
+
+  // Control nodes
+  typename IOLibrary::Group control_nodes = file.createGroup("/ControlNodes");
+  control_nodes.createDataset("Coordinates", mesh.control_nodes.coord).write();
+  control_nodes.createDataset("Knods", mesh.control_nodes.knods).write();
+
+  // Materials
+  specfem::kokkos::HostView1d<int> medium("specfem::mesh::IO::native::medium",
+                                          nspec);
+  specfem::kokkos::HostView1d<int> property(
+      "specfem::mesh::IO::native::property", nspec);
+  specfem::kokkos::HostView1d<int> index("specfem::mesh::IO::native::index",
+                                         nspec);
+
+  for (int ispec = 0; ispec < nspec; ispec++) {
+    const auto &specification = materials.material_index_mapping(ispec);
+    medium(ispec) = static_cast<int>(specification.type);
+    property(ispec) = static_cast<int>(specification.property);
+    index(ispec) = specification.index;
+  }
+
+  typename IOLibrary::Group material_group = file.createGroup("/Materials");
+  material_group.createDataset("Medium", medium).write();
+  material_group.createDataset("Property", property).write();
+  material_group.createDataset("Index", index).write();
+
+  if (n_elastic_isotropic > 0) {
+    specfem::kokkos::HostView2d<type_real> elastic_isotropic(
+        "specfem::mesh::IO::native::elastic_isotropic", n_elastic_isotropic,
+        impl::elastic_isotropic_parameters);
+    for (int i = 0; i < n_elastic_isotropic; i++) {
+      const auto parameters =
+          materials.elastic_isotropic.material_properties[i].get_parameters();
+      for (int j = 0; j < impl::elastic_isotropic_parameters; j++)
+        elastic_isotropic(i, j) = parameters[j];
+    }
+    material_group.createDataset("ElasticIsotropic", elastic_isotropic)
+        .write();
+  }
+
+  if (n_acoustic_isotropic > 0) {
+    specfem::kokkos::HostView2d<type_real> acoustic_isotropic(
+        "specfem::mesh::IO::native::acoustic_isotropic", n_acoustic_isotropic,
+        impl::acoustic_isotropic_parameters);
+    for (int i = 0; i < n_acoustic_isotropic; i++) {
+      const auto parameters =
+          materials.acoustic_isotropic.material_properties[i].get_parameters();
+      for (int j = 0; j < impl::acoustic_isotropic_parameters; j++)
+        acoustic_isotropic(i, j) = parameters[j];
+    }
+    material_group.createDataset("AcousticIsotropic", acoustic_isotropic)
+        .write();
+  }
+
+  // Boundaries. Edge types are stored as integers
+  typename IOLibrary::Group boundaries = file.createGroup("/Boundaries");
+
+  if (sizes(impl::n_absorbing) > 0) {
+    specfem::kokkos::HostView1d<int> type(
+        "specfem::mesh::IO::native::absorbing_type", sizes(impl::n_absorbing));
+    for (int i = 0; i < sizes(impl::n_absorbing); i++)
+      type(i) = static_cast<int>(absorbing.type(i));
+
+    boundaries.createDataset("AbsorbingIndexMapping", absorbing.index_mapping)
+        .write();
+    boundaries.createDataset("AbsorbingType", type).write();
+  }
+
+  if (sizes(impl::n_acoustic_free_surface) > 0) {
+    specfem::kokkos::HostView1d<int> type(
+        "specfem::mesh::IO::native::free_surface_type",
+        sizes(impl::n_acoustic_free_surface));
+    for (int i = 0; i < sizes(impl::n_acoustic_free_surface); i++)
+      type(i) = static_cast<int>(free_surface.type(i));
+
+    boundaries
+        .createDataset("FreeSurfaceIndexMapping", free_surface.index_mapping)
+        .write();
+    boundaries.createDataset("FreeSurfaceType", type).write();
+  }
+
+  // Coupled interfaces
+  typename IOLibrary::Group coupled = file.createGroup("/CoupledInterfaces");
+  impl::write_interfaces(coupled, "ElasticAcoustic",
+                         coupled_interfaces.elastic_acoustic);
+  impl::write_interfaces(coupled, "AcousticPoroelastic",
+                         coupled_interfaces.acoustic_poroelastic);
+  impl::write_interfaces(coupled, "ElasticPoroelastic",
+                         coupled_interfaces.elastic_poroelastic);
+
+  // MPI interfaces
+  if (sizes(impl::ninterfaces) > 0) {
+    typename IOLibrary::Group interfaces = file.createGroup("/MPIInterfaces");
+    interfaces.createDataset("Neighbors", mpi_interfaces.my_neighbors).write();
+    interfaces
+        .createDataset("NumberOfElements", mpi_interfaces.my_nelmnts_neighbors)
+        .write();
+    interfaces.createDataset("Elements", mpi_interfaces.my_interfaces).write();
+  }
+
+  // Axial elements
+  if (sizes(impl::nelem_on_the_axis) > 0) {
+    specfem::kokkos::HostView1d<int> axial(
+        "specfem::mesh::IO::native::axial_elements",
+        sizes(impl::nelem_on_the_axis));
+    for (int i = 0; i < sizes(impl::nelem_on_the_axis); i++)
+      axial(i) = axial_elements[i];
+
+    typename IOLibrary::Group elements = file.createGroup("/Elements");
+    elements.createDataset("Axial", axial).write();
+  }
+
+  return;
+}
+
+template <typename IOLibrary>
+specfem::mesh::mesh
+specfem::mesh::IO::native::read_mesh(const std::string &filename,
+                                     const specfem::MPI::MPI *mpi) {
+
+  namespace impl = specfem::mesh::IO::native::impl;
+
+  typename IOLibrary::File file(filename);
+
+  specfem::kokkos::HostView1d<int> sizes("specfem::mesh::IO::native::sizes",
+                                         impl::nsizes);
+  file.openDataset("Sizes", sizes).read();
+
+  if (sizes(impl::version) != specfem::mesh::IO::native::format_version) {
+    std::ostringstream message;
+    message << "Mesh " << filename << " was written with version "
+            << sizes(impl::version) << " of the native mesh format, expected "
+            << "version " << specfem::mesh::IO::native::format_version;
+    throw std::runtime_error(message.str());
+  }
+
+  specfem::mesh::mesh mesh;
+
+  mesh.mpi = mpi;
+
+  const int nspec = sizes(impl::nspec);
+  const int ngnod = sizes(impl::ngnod);
+
+  mesh.nspec = nspec;
+  mesh.npgeo = sizes(impl::npgeo);
+  mesh.nproc = sizes(impl::nproc);
+
+  if (mesh.nproc != mpi->get_size()) {
+    std::ostringstream message;
+    message << "Mesh " << filename << " is a partition of a mesh with "
+            << mesh.nproc << " partitions, but SPECFEM is running on "
+            << mpi->get_size() << " MPI ranks";
+    throw std::runtime_error(message.str());
+  }
+
+  // Control nodes
+  mesh.control_nodes = specfem::mesh::control_nodes(
+      sizes(impl::ndim), nspec, ngnod, sizes(impl::npgeo));
+
+  typename IOLibrary::Group control_nodes = file.openGroup("/ControlNodes");
+  control_nodes.openDataset("Coordinates", mesh.control_nodes.coord).read();
+  control_nodes.openDataset("Knods", mesh.control_nodes.knods).read();
+
+  // Materials
+  const int n_elastic_isotropic = sizes(impl::n_elastic_isotropic);
+  const int n_acoustic_isotropic = sizes(impl::n_acoustic_isotropic);
+
+  specfem::kokkos::HostView1d<int> medium("specfem::mesh::IO::native::medium",
+                                          nspec);
+  specfem::kokkos::HostView1d<int> property(
+      "specfem::mesh::IO::native::property", nspec);
+  specfem::kokkos::HostView1d<int> index("specfem::mesh::IO::native::index",
+                                         nspec);
+
+  typename IOLibrary::Group material_group = file.openGroup("/Materials");
+  material_group.openDataset("Medium", medium).read();
+  material_group.openDataset("Property", property).read();
+  material_group.openDataset("Index", index).read();
+
+  mesh.materials.n_materials = n_elastic_isotropic + n_acoustic_isotropic;
+  mesh.materials.material_index_mapping = specfem::kokkos::HostView1d<
+      specfem::mesh::materials::material_specification>(
+      "specfem::mesh::material_index_mapping", nspec);
+
+  for (int ispec = 0; ispec < nspec; ispec++) {
+    mesh.materials.material_index_mapping(ispec) = {
+      static_cast<specfem::element::medium_tag>(medium(ispec)),
+      static_cast<specfem::element::property_tag>(property(ispec)),
+      index(ispec)
+    };
+  }
+
+  using elastic_isotropic_type =
+      specfem::material::material<specfem::element::medium_tag::elastic,
+                                  specfem::element::property_tag::isotropic>;
+  using acoustic_isotropic_type =
+      specfem::material::material<specfem::element::medium_tag::acoustic,
+                                  specfem::element::property_tag::isotropic>;
+
+  std::vector<elastic_isotropic_type> l_elastic_isotropic;
+  l_elastic_isotropic.reserve(n_elastic_isotropic);
+
+  if (n_elastic_isotropic > 0) {
+    specfem::kokkos::HostView2d<type_real> elastic_isotropic(
+        "specfem::mesh::IO::native::elastic_isotropic", n_elastic_isotropic,
+        impl::elastic_isotropic_parameters);
+    material_group.openDataset("ElasticIsotropic", elastic_isotropic).read();
+    for (int i = 0; i < n_elastic_isotropic; i++) {
+      // density, cs, cp, Qkappa, Qmu, compaction_grad
+      l_elastic_isotropic.push_back(elastic_isotropic_type(
+          elastic_isotropic(i, 0), elastic_isotropic(i, 1),
+          elastic_isotropic(i, 2), elastic_isotropic(i, 3),
+          elastic_isotropic(i, 4), elastic_isotropic(i, 5)));
+    }
+  }
+
+  std::vector<acoustic_isotropic_type> l_acoustic_isotropic;
+  l_acoustic_isotropic.reserve(n_acoustic_isotropic);
+
+  if (n_acoustic_isotropic > 0) {
+    specfem::kokkos::HostView2d<type_real> acoustic_isotropic(
+        "specfem::mesh::IO::native::acoustic_isotropic", n_acoustic_isotropic,
+        impl::acoustic_isotropic_parameters);
+    material_group.openDataset("AcousticIsotropic", acoustic_isotropic).read();
+    for (int i = 0; i < n_acoustic_isotropic; i++) {
+      // density, cp, Qkappa, Qmu, compaction_grad
+      l_acoustic_isotropic.push_back(acoustic_isotropic_type(
+          acoustic_isotropic(i, 0), acoustic_isotropic(i, 1),
+          acoustic_isotropic(i, 2), acoustic_isotropic(i, 3),
+          acoustic_isotropic(i, 4)));
+    }
+  }
+
+  mesh.materials.elastic_isotropic = { n_elastic_isotropic,
+                                       l_elastic_isotropic };
+  mesh.materials.acoustic_isotropic = { n_acoustic_isotropic,
+                                        l_acoustic_isotropic };
+
+  // Boundaries
+  const int n_absorbing = sizes(impl::n_absorbing);
+  const int n_acoustic_free_surface = sizes(impl::n_acoustic_free_surface);
+
+  specfem::mesh::absorbing_boundary absorbing(n_absorbing);
+  specfem::mesh::acoustic_free_surface free_surface(n_acoustic_free_surface);
+
+  if (n_absorbing > 0 || n_acoustic_free_surface > 0) {
+    typename IOLibrary::Group boundaries = file.openGroup("/Boundaries");
+
+    if (n_absorbing > 0) {
+      specfem::kokkos::HostView1d<int> type(
+          "specfem::mesh::IO::native::absorbing_type", n_absorbing);
+      boundaries.openDataset("AbsorbingIndexMapping", absorbing.index_mapping)
+          .read();
+      boundaries.openDataset("AbsorbingType", type).read();
+      for (int i = 0; i < n_absorbing; i++)
+        absorbing.type(i) =
+            static_cast<specfem::enums::boundaries::type>(type(i));
+    }
+
+    if (n_acoustic_free_surface > 0) {
+      specfem::kokkos::HostView1d<int> type(
+          "specfem::mesh::IO::native::free_surface_type",
+          n_acoustic_free_surface);
+      boundaries
+          .openDataset("FreeSurfaceIndexMapping", free_surface.index_mapping)
+          .read();
+      boundaries.openDataset("FreeSurfaceType", type).read();
+      for (int i = 0; i < n_acoustic_free_surface; i++)
+        free_surface.type(i) =
+            static_cast<specfem::enums::boundaries::type>(type(i));
+    }
+  }
+
+  mesh.boundaries = specfem::mesh::boundaries(absorbing, free_surface);
+
+  // Coupled interfaces
+  const int n_elastic_acoustic = sizes(impl::n_elastic_acoustic);
+  const int n_acoustic_poroelastic = sizes(impl::n_acoustic_poroelastic);
+  const int n_elastic_poroelastic = sizes(impl::n_elastic_poroelastic);
+
+  if (n_elastic_acoustic > 0 || n_acoustic_poroelastic > 0 ||
+      n_elastic_poroelastic > 0) {
+    typename IOLibrary::Group coupled = file.openGroup("/CoupledInterfaces");
+    impl::read_interfaces(coupled, "ElasticAcoustic", n_elastic_acoustic,
+                          mesh.coupled_interfaces.elastic_acoustic);
+    impl::read_interfaces(coupled, "AcousticPoroelastic",
+                          n_acoustic_poroelastic,
+                          mesh.coupled_interfaces.acoustic_poroelastic);
+    impl::read_interfaces(coupled, "ElasticPoroelastic",
+                          n_elastic_poroelastic,
+                          mesh.coupled_interfaces.elastic_poroelastic);
+  }
+
+  // MPI interfaces
+  mesh.mpi_interfaces = specfem::mesh::interfaces::interface(
+      sizes(impl::ninterfaces), sizes(impl::max_interface_size));
+
+  if (sizes(impl::ninterfaces) > 0) {
+    typename IOLibrary::Group interfaces = file.openGroup("/MPIInterfaces");
+    interfaces.openDataset("Neighbors", mesh.mpi_interfaces.my_neighbors)
+        .read();
+    interfaces
+        .openDataset("NumberOfElements",
+                     mesh.mpi_interfaces.my_nelmnts_neighbors)
+        .read();
+    interfaces.openDataset("Elements", mesh.mpi_interfaces.my_interfaces)
+        .read();
+  }
+
+  // Axial elements
+  const int nelem_on_the_axis = sizes(impl::nelem_on_the_axis);
+  mesh.axial_nodes = specfem::mesh::elements::axial_elements(nspec);
+
+  if (nelem_on_the_axis > 0) {
+    specfem::kokkos::HostView1d<int> axial(
+        "specfem::mesh::IO::native::axial_elements", nelem_on_the_axis);
+    typename IOLibrary::Group elements = file.openGroup("/Elements");
+    elements.openDataset("Axial", axial).read();
+    for (int i = 0; i < nelem_on_the_axis; i++)
+      mesh.axial_nodes.is_on_the_axis(axial(i)) = true;
+  }
+
+  // Launch parameters are not stored. Rebuild the sizes they describe
+  mesh.parameters.numat = mesh.materials.n_materials;
+  mesh.parameters.ngnod = ngnod;
+  mesh.parameters.nspec = nspec;
+  mesh.parameters.pointsdisp = 0;
+  mesh.parameters.nelemabs = n_absorbing;
+  mesh.parameters.nelem_acforcing = 0;
+  mesh.parameters.nelem_acoustic_surface = n_acoustic_free_surface;
+  mesh.parameters.num_fluid_solid_edges = n_elastic_acoustic;
+  mesh.parameters.num_fluid_poro_edges = n_acoustic_poroelastic;
+  mesh.parameters.num_solid_poro_edges = n_elastic_poroelastic;
+  mesh.parameters.nnodes_tangential_curve = 0;
+  mesh.parameters.nelem_on_the_axis = nelem_on_the_axis;
+  mesh.parameters.plot_lowerleft_corner_only = false;
+
+  mesh.tags = specfem::mesh::tags(mesh.materials, mesh.boundaries);
+
+  return mesh;
+}
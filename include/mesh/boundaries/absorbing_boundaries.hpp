@@ -1,5 +1,6 @@
 #pragma once
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "enumerations/specfem_enums.hpp"
 #include "specfem_mpi/specfem_mpi.hpp"
 
@@ -44,8 +45,9 @@ struct absorbing_boundary {
    * @param nspec Number of spectral elements
    * @param mpi Pointer to MPI object
    */
-  absorbing_boundary(std::ifstream &stream, int num_abs_boundary_faces,
-                     const int nspec, const specfem::MPI::MPI *mpi);
+  absorbing_boundary(specfem::IO::fortran_reader &stream,
+                     int num_abs_boundary_faces, const int nspec,
+                     const specfem::MPI::MPI *mpi);
   ///@}
 };
 } // namespace mesh
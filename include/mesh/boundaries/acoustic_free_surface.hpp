@@ -1,5 +1,6 @@
 #pragma once
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "enumerations/specfem_enums.hpp"
 #include "specfem_mpi/specfem_mpi.hpp"
 
@@ -32,7 +33,7 @@ struct acoustic_free_surface {
    * @param knods Spectral element node connectivity
    * @param mpi Pointer to MPI object
    */
-  acoustic_free_surface(std::ifstream &stream,
+  acoustic_free_surface(specfem::IO::fortran_reader &stream,
                         const int &nelem_acoustic_surface,
                         const Kokkos::View<int **, Kokkos::HostSpace> knods,
                         const specfem::MPI::MPI *mpi);
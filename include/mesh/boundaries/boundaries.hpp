@@ -53,8 +53,9 @@ struct boundaries {
    * @param knods Spectral element control nodes
    * @param mpi Pointer to MPI object
    */
-  boundaries(std::ifstream &stream, const int nspec, const int n_absorbing,
-             const int n_acoustic_surface, const int n_acforcing,
+  boundaries(specfem::IO::fortran_reader &stream, const int nspec,
+             const int n_absorbing, const int n_acoustic_surface,
+             const int n_acforcing,
              const Kokkos::View<int **, Kokkos::HostSpace> knods,
              const specfem::MPI::MPI *mpi)
       : absorbing_boundary(stream, n_absorbing, nspec, mpi),
@@ -1,6 +1,7 @@
 #ifndef _FORCING_BOUNDARIES_HPP
 #define _FORCING_BOUNDARIES_HPP
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "kokkos_abstractions.h"
 #include "specfem_mpi/interface.hpp"
 
@@ -117,8 +118,9 @@ struct forcing_boundary {
    * @param nspec Number of spectral elements
    * @param mpi Pointer to MPI object
    */
-  forcing_boundary(std::ifstream &stream, const int nelement_acforcing,
-                   const int nspec, const specfem::MPI::MPI *mpi);
+  forcing_boundary(specfem::IO::fortran_reader &stream,
+                   const int nelement_acforcing, const int nspec,
+                   const specfem::MPI::MPI *mpi);
 };
 
 } // namespace mesh
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "enumerations/medium.hpp"
 #include "interface_container.hpp"
 #include "specfem_mpi/specfem_mpi.hpp"
@@ -39,7 +40,7 @@ public:
    * interfaces
    * @param mpi Pointer to MPI object
    */
-  coupled_interfaces(std::ifstream &stream,
+  coupled_interfaces(specfem::IO::fortran_reader &stream,
                      const int num_interfaces_elastic_acoustic,
                      const int num_interfaces_acoustic_poroelastic,
                      const int num_interfaces_elastic_poroelastic,
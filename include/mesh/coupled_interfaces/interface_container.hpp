@@ -1,5 +1,6 @@
 #pragma once
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "enumerations/medium.hpp"
 #include "kokkos_abstractions.h"
 #include "specfem_mpi/interface.hpp"
@@ -38,7 +39,8 @@ struct interface_container {
    * interfaces section
    * @param mpi Pointer to MPI object
    */
-  interface_container(const int num_interfaces, std::ifstream &stream,
+  interface_container(const int num_interfaces,
+                      specfem::IO::fortran_reader &stream,
                       const specfem::MPI::MPI *mpi);
   ///@}
 
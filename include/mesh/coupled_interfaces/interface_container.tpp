@@ -8,10 +8,9 @@
 
 template <specfem::element::medium_tag medium1,
           specfem::element::medium_tag medium2>
-specfem::mesh::interface_container<
-    medium1, medium2>::interface_container(const int num_interfaces,
-                                           std::ifstream &stream,
-                                           const specfem::MPI::MPI *mpi)
+specfem::mesh::interface_container<medium1, medium2>::interface_container(
+    const int num_interfaces, specfem::IO::fortran_reader &stream,
+    const specfem::MPI::MPI *mpi)
     : num_interfaces(num_interfaces),
       medium1_index_mapping("medium1_index_mapping", num_interfaces),
       medium2_index_mapping("medium2_index_mapping", num_interfaces) {
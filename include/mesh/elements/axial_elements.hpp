@@ -1,6 +1,7 @@
 #ifndef _AXIAL_ELEMENTS_HPP
 #define _AXIAL_ELEMENTS_HPP
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "kokkos_abstractions.h"
 #include "specfem_mpi/interface.hpp"
 
@@ -17,8 +18,9 @@ struct axial_elements {
   specfem::kokkos::HostView1d<bool> is_on_the_axis;
   axial_elements(){};
   axial_elements(const int nspec);
-  axial_elements(std::ifstream &stream, const int nelem_on_the_axis,
-                 const int nspec, const specfem::MPI::MPI *mpi);
+  axial_elements(specfem::IO::fortran_reader &stream,
+                 const int nelem_on_the_axis, const int nspec,
+                 const specfem::MPI::MPI *mpi);
 };
 } // namespace elements
 } // namespace mesh
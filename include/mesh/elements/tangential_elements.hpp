@@ -1,6 +1,7 @@
 #ifndef _TANGENTIAL_ELEMENTS_HPP
 #define _TANGENTIAL_ELEMENTS_HPP
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "kokkos_abstractions.h"
 #include "specfem_mpi/interface.hpp"
 
@@ -18,7 +19,8 @@ struct tangential_elements {
   specfem::kokkos::HostView1d<type_real> x, y;
   tangential_elements(){};
   tangential_elements(const int nnodes_tangential_curve);
-  tangential_elements(std::ifstream &stream, const int nnodes_tangential_curve);
+  tangential_elements(specfem::IO::fortran_reader &stream,
+                      const int nnodes_tangential_curve);
 };
 } // namespace elements
 } // namespace mesh
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "kokkos_abstractions.h"
 #include "material/material.hpp"
 #include "specfem_mpi/interface.hpp"
@@ -90,8 +91,8 @@ struct materials {
    * @param numat Total number of different materials
    * @param mpi Pointer to a MPI object
    */
-  materials(std::ifstream &stream, const int numat, const int nspec,
-            const specfem::kokkos::HostView2d<int> knods,
+  materials(specfem::IO::fortran_reader &stream, const int numat,
+            const int nspec, const specfem::kokkos::HostView2d<int> knods,
             const specfem::MPI::MPI *mpi);
   ///@}
 
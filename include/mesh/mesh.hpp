@@ -7,6 +7,7 @@
 #include "elements/tangential_elements.hpp"
 #include "materials/materials.hpp"
 #include "mesh/tags/tags.hpp"
+#include "mpi_interfaces/mpi_interfaces.hpp"
 #include "properties/properties.hpp"
 #include "specfem_mpi/interface.hpp"
 #include "specfem_setup.hpp"
@@ -35,6 +36,10 @@ struct mesh {
   specfem::mesh::boundaries boundaries; ///< Struct to store information at the
                                         ///< boundaries
 
+  specfem::mesh::interfaces::interface mpi_interfaces; ///< Interfaces with
+                                                       ///< the partitions of
+                                                       ///< other MPI ranks
+
   specfem::mesh::tags tags; ///< Struct to store tags for every spectral element
 
   specfem::mesh::elements::tangential_elements tangential_nodes; ///< Defines
@@ -47,6 +52,10 @@ struct mesh {
                                                        ///< (never used)
   specfem::mesh::materials materials; ///< Defines material properties
 
+  const specfem::MPI::MPI *mpi = nullptr; ///< MPI object used to
+                                          ///< communicate with the
+                                          ///< partitions of other ranks
+
   /**
    * @name Constructors
    *
@@ -69,5 +78,21 @@ struct mesh {
 
   std::string print() const;
 };
+
+/**
+ * @brief Get the database file of the partition assigned to this MPI rank
+ *
+ * Partitioned meshes are written by the mesher to one database per
+ * partition, with the 5-digit partition index appended to the database
+ * filename (e.g. database.bin.00003). Output files written by every rank
+ * follow the same convention.
+ *
+ * @param filename Database filename as given in the parameter file
+ * @param mpi Pointer to MPI object. nullptr if running without MPI
+ * @return std::string @p filename if running on a single rank, database of
+ * the partition of this rank otherwise
+ */
+std::string partition_filename(const std::string &filename,
+                               const specfem::MPI::MPI *mpi);
 } // namespace mesh
 } // namespace specfem
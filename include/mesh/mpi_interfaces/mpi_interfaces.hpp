@@ -1,22 +1,65 @@
 #ifndef _MPI_INTERFACES_HPP
 #define _MPI_INTERFACES_HPP
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "kokkos_abstractions.h"
 #include "specfem_mpi/interface.hpp"
+#include <fstream>
 
 namespace specfem {
 namespace mesh {
 namespace interfaces {
 
+/**
+ * @brief Interfaces between the partition of this MPI rank and the partitions
+ * of its neighbors
+ *
+ * Every interface element is described by 4 values : the spectral element
+ * index, the interface type (1 if the element only shares a corner with the
+ * neighbor, 2 if it shares an edge), and the indices of the shared control
+ * nodes. The second node is -1 for corner interfaces. Indices are 0-based.
+ */
 struct interface {
   // Utilities use to compute MPI buffers
-  int ninterfaces, max_interface_size;
-  specfem::kokkos::HostView1d<int> my_neighbors;
-  specfem::kokkos::HostView1d<int> my_nelmnts_neighbors;
-  specfem::kokkos::HostView3d<int> my_interfaces;
+  int ninterfaces = 0;        ///< Number of neighboring partitions
+  int max_interface_size = 0; ///< Maximum number of elements on an interface
+  specfem::kokkos::HostView1d<int> my_neighbors; ///< Rank of every neighbor
+  specfem::kokkos::HostView1d<int> my_nelmnts_neighbors; ///< Number of
+                                                         ///< elements on
+                                                         ///< every interface
+  specfem::kokkos::HostView3d<int> my_interfaces; ///< Interface elements
+                                                  ///< (interface, element,
+                                                  ///< value)
+
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Default constructor. Mesh without interfaces
+   *
+   */
   interface(){};
+
+  /**
+   * @brief Allocate interfaces
+   *
+   * @param ninterfaces Number of neighboring partitions
+   * @param max_interface_size Maximum number of elements on an interface
+   */
   interface(const int ninterfaces, const int max_interface_size);
-  interface(std::ifstream &stream, const specfem::MPI::MPI *mpi);
+
+  /**
+   * @brief Read interfaces from fortran binary database file
+   *
+   * @param stream Stream object for fortran binary file buffered to the MPI
+   * interfaces section
+   * @param mpi Pointer to MPI object
+   */
+  interface(specfem::IO::fortran_reader &stream,
+            const specfem::MPI::MPI *mpi);
+  ///@}
   ~interface() = default;
 };
 } // namespace interfaces
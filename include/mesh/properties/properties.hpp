@@ -1,6 +1,7 @@
 #ifndef _MESH_PROPERTIES_HPP
 #define _MESH_PROPERTIES_HPP
 
+#include "IO/fortranio/fortran_reader.hpp"
 #include "specfem_mpi/interface.hpp"
 
 namespace specfem {
@@ -40,7 +41,8 @@ struct properties {
    * section
    * @param mpi Pointer to MPI object
    */
-  properties(std::ifstream &stream, const specfem::MPI::MPI *mpi);
+  properties(specfem::IO::fortran_reader &stream,
+             const specfem::MPI::MPI *mpi);
 };
 } // namespace mesh
 } // namespace specfem
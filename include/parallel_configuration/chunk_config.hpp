@@ -3,6 +3,7 @@
 #include "constants.hpp"
 #include "enumerations/dimension.hpp"
 #include <Kokkos_Core.hpp>
+#include <tuple>
 
 namespace specfem {
 namespace parallel_config {
@@ -67,5 +68,67 @@ struct default_chunk_config<specfem::dimension::type::dim2, SIMD,
     : chunk_config<specfem::dimension::type::dim2, 1, 1, 1, 1, SIMD,
                    Kokkos::Serial> {};
 #endif
+
+/**
+ * @brief Chunk configurations timed when auto-tuning the stiffness kernel
+ *
+ * Defines a @c std::tuple of @ref specfem::parallel_config::chunk_config
+ * types. The first candidate is always the default configuration. Every
+ * candidate instantiates its own stiffness kernels, so additional candidates
+ * are only compiled if SPECFEM is built with @c ENABLE_CHUNK_TUNING.
+ *
+ * @tparam DimensionType Dimension type of the elements within a chunk.
+ * @tparam SIMD SIMD type to use simd operations. @ref specfem::datatypes::simd
+ * @tparam ExecutionSpace Execution space for the policy.
+ */
+template <specfem::dimension::type DimensionType, typename SIMD,
+          typename ExecutionSpace>
+struct chunk_config_candidates {
+  using type = std::tuple<
+      default_chunk_config<DimensionType, SIMD, ExecutionSpace> >;
+};
+
+#ifdef ENABLE_CHUNK_TUNING
+#ifdef KOKKOS_ENABLE_CUDA
+template <typename SIMD>
+struct chunk_config_candidates<specfem::dimension::type::dim2, SIMD,
+                               Kokkos::Cuda> {
+  using type = std::tuple<
+      default_chunk_config<specfem::dimension::type::dim2, SIMD, Kokkos::Cuda>,
+      chunk_config<specfem::dimension::type::dim2, 16, 16, 128, 1, SIMD,
+                   Kokkos::Cuda>,
+      chunk_config<specfem::dimension::type::dim2, 8, 8, 64, 1, SIMD,
+                   Kokkos::Cuda> >;
+};
+#endif
+
+#ifdef KOKKOS_ENABLE_OPENMP
+template <typename SIMD>
+struct chunk_config_candidates<specfem::dimension::type::dim2, SIMD,
+                               Kokkos::OpenMP> {
+  using type = std::tuple<
+      default_chunk_config<specfem::dimension::type::dim2, SIMD,
+                           Kokkos::OpenMP>,
+      chunk_config<specfem::dimension::type::dim2, 4, 4, 1, 1, SIMD,
+                   Kokkos::OpenMP>,
+      chunk_config<specfem::dimension::type::dim2, 8, 8, 1, 1, SIMD,
+                   Kokkos::OpenMP> >;
+};
+#endif
+
+#ifdef KOKKOS_ENABLE_SERIAL
+template <typename SIMD>
+struct chunk_config_candidates<specfem::dimension::type::dim2, SIMD,
+                               Kokkos::Serial> {
+  using type = std::tuple<
+      default_chunk_config<specfem::dimension::type::dim2, SIMD,
+                           Kokkos::Serial>,
+      chunk_config<specfem::dimension::type::dim2, 4, 4, 1, 1, SIMD,
+                   Kokkos::Serial>,
+      chunk_config<specfem::dimension::type::dim2, 8, 8, 1, 1, SIMD,
+                   Kokkos::Serial> >;
+};
+#endif
+#endif
 } // namespace parallel_config
 } // namespace specfem
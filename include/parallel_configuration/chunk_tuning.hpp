@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace specfem {
+namespace parallel_config {
+
+/**
+ * @brief Auto-tuning of the chunk configuration of the stiffness kernel
+ *
+ * When enabled, every stiffness kernel times each of the compiled @ref
+ * specfem::parallel_config::chunk_config_candidates for a few steps before
+ * the time loop and keeps the fastest. The description of the choice is cached
+ * in a text file keyed by the execution space, the concurrency and the size of
+ * the mesh, so that later runs on the same hardware and mesh skip the timing.
+ * Cached choices that are no longer compiled are ignored.
+ *
+ * A default constructed object is disabled.
+ */
+class chunk_tuning {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Construct a disabled tuner
+   *
+   */
+  chunk_tuning() = default;
+
+  /**
+   * @brief Construct an enabled tuner
+   *
+   * @param cache_file File where tuning results are cached. Empty if results
+   * are not cached
+   * @param nsteps Number of timed calls of the stiffness kernel for every
+   * candidate
+   */
+  chunk_tuning(const std::string &cache_file, const int nsteps);
+  ///@}
+
+  /**
+   * @brief Check if auto-tuning is enabled
+   *
+   */
+  bool enabled() const { return this->enable; }
+
+  /**
+   * @brief Get the number of timed calls of the stiffness kernel for every
+   * candidate
+   *
+   */
+  int get_nsteps() const { return this->nsteps; }
+
+  /**
+   * @brief Look up a cached choice
+   *
+   * @param key Key of the kernel being tuned
+   * @param candidates Description of every candidate of the kernel
+   * @param index Index of the cached candidate within @p candidates (output)
+   * @return bool True if the cache file holds an entry for @p key that
+   * matches one of @p candidates
+   */
+  bool load(const std::string &key, const std::vector<std::string> &candidates,
+            int &index) const;
+
+  /**
+   * @brief Add or replace a choice in the cache file
+   *
+   * The cache file is rewritten to a temporary file that is then renamed, so
+   * concurrent readers never see a partially written file.
+   *
+   * @param key Key of the kernel being tuned
+   * @param description Description of the fastest candidate
+   */
+  void store(const std::string &key, const std::string &description) const;
+
+  /**
+   * @brief Describe the hardware the kernels execute on
+   *
+   * @return std::string Name and concurrency of the default execution space
+   */
+  static std::string hardware_key();
+
+private:
+  bool enable = false;    ///< Auto-tuning is enabled
+  std::string cache_file; ///< File where tuning results are cached
+  int nsteps = 10;        ///< Timed calls of every candidate
+};
+
+/**
+ * @brief Describe a chunk configuration for output
+ *
+ * @tparam ParallelConfig Chunk configuration
+ * @return std::string Chunk size, tile size, number of threads and vector
+ * lanes
+ */
+template <typename ParallelConfig> std::string describe() {
+  std::ostringstream description;
+  description << "chunk " << ParallelConfig::chunk_size << ", tile "
+              << ParallelConfig::tile_size << ", threads "
+              << ParallelConfig::num_threads << ", lanes "
+              << ParallelConfig::vector_lanes;
+  return description.str();
+}
+
+namespace impl {
+template <typename Candidates, std::size_t... Is>
+std::vector<std::string> describe_candidates(std::index_sequence<Is...>) {
+  return { describe<std::tuple_element_t<Is, Candidates> >()... };
+}
+} // namespace impl
+
+/**
+ * @brief Describe every chunk configuration within a tuple of candidates
+ *
+ * @tparam Candidates @c std::tuple of chunk configurations
+ * @return std::vector<std::string> Description of every candidate
+ */
+template <typename Candidates> std::vector<std::string> describe_candidates() {
+  return impl::describe_candidates<Candidates>(
+      std::make_index_sequence<std::tuple_size_v<Candidates> >());
+}
+
+} // namespace parallel_config
+} // namespace specfem
@@ -0,0 +1,51 @@
+#ifndef _PARAMETER_CHECKPOINTING_HPP
+#define _PARAMETER_CHECKPOINTING_HPP
+
+#include "yaml-cpp/yaml.h"
+#include <cstddef>
+
+namespace specfem {
+namespace runtime_configuration {
+
+/**
+ * @brief Checkpointing configuration for combined simulations
+ *
+ * When checkpointing is enabled the forward wavefield is recomputed from
+ * periodic snapshots during the combined simulation instead of being
+ * reconstructed from the boundary values stored by the forward simulation.
+ *
+ */
+class checkpointing {
+
+public:
+  /**
+   * @brief Construct a new checkpointing object
+   *
+   * @param memory_budget Memory available for wavefield snapshots in MB
+   */
+  checkpointing(const double memory_budget) : memory_budget(memory_budget) {}
+
+  /**
+   * @brief Construct a new checkpointing object
+   *
+   * @param Node YAML node describing the checkpointing configuration
+   */
+  checkpointing(const YAML::Node &Node);
+
+  /**
+   * @brief Get the memory budget for wavefield snapshots
+   *
+   * @return std::size_t Memory budget in bytes
+   */
+  std::size_t get_memory_budget() const {
+    return static_cast<std::size_t>(memory_budget * 1024.0 * 1024.0);
+  }
+
+private:
+  double memory_budget; ///< Memory available for snapshots in MB
+};
+
+} // namespace runtime_configuration
+} // namespace specfem
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "specfem_setup.hpp"
 #include "yaml-cpp/yaml.h"
+#include <string>
 #include <tuple>
 
 namespace specfem {
@@ -35,9 +36,25 @@ public:
     return std::make_tuple(this->fortran_database, this->source_database);
   }
 
+  /**
+   * @brief Get the directory where assembled meshes are cached
+   *
+   * @return std::string Cache directory. Empty if caching is disabled
+   */
+  std::string get_assembly_cache() const { return this->assembly_cache; }
+
+  /**
+   * @brief Get the format of the mesh database
+   *
+   * @return std::string Fortran, HDF5 or ASCII
+   */
+  std::string get_mesh_format() const { return this->mesh_format; }
+
 private:
   std::string fortran_database; ///< location of fortran binary database
   std::string source_database;  ///< location of sources file
+  std::string assembly_cache;   ///< directory of assembled mesh cache files
+  std::string mesh_format = "Fortran"; ///< format of the mesh database
 };
 
 } // namespace runtime_configuration
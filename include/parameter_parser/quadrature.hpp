@@ -47,6 +47,13 @@ public:
    */
   specfem::quadrature::quadratures instantiate();
 
+  /**
+   * @brief Get the number of quadrature points
+   *
+   * @return int Number of quadrature points in each dimension
+   */
+  int get_ngll() const { return this->ngll; }
+
 private:
   type_real alpha; ///< alpha value used to instantiate a
                    ///< specfem::quadrature::quadrature class
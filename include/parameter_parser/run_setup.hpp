@@ -10,7 +10,6 @@ namespace runtime_configuration {
 
 /**
  * @brief Run setup defines run configuration for the simulation
- * @note This object is not used in the current version
  *
  */
 class run_setup {
@@ -19,8 +18,6 @@ public:
   /**
    * @brief Construct a new run setup object
    *
-   * @note This object is not used in the current version
-   *
    * @param nproc Number of processors used in the simulation
    * @param nruns Number of simulation runs
    */
@@ -32,6 +29,13 @@ public:
    */
   run_setup(const YAML::Node &Node);
 
+  /**
+   * @brief Get the number of simulation runs
+   *
+   * @return int Number of simulation runs
+   */
+  int get_nruns() const { return this->nruns; }
+
 private:
   int nproc; ///< number of processors used in the simulation
   int nruns; ///< Number of simulation runs
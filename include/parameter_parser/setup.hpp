@@ -1,6 +1,7 @@
 #ifndef _PARAMETER_SETUP_HPP
 #define _PARAMETER_SETUP_HPP
 
+#include "checkpointing.hpp"
 #include "database_configuration.hpp"
 #include "header.hpp"
 #include "parameter_parser/solver/interface.hpp"
@@ -15,7 +16,9 @@
 #include "writer/wavefield.hpp"
 #include "yaml-cpp/yaml.h"
 #include <memory>
+#include <string>
 #include <tuple>
+#include <vector>
 
 namespace specfem {
 namespace runtime_configuration {
@@ -94,6 +97,24 @@ public:
     return databases->get_databases();
   }
 
+  /**
+   * @brief Get the directory where assembled meshes are cached
+   *
+   * @return std::string Cache directory. Empty if caching is disabled
+   */
+  std::string get_assembly_cache() const {
+    return databases->get_assembly_cache();
+  }
+
+  /**
+   * @brief Get the format of the mesh database
+   *
+   * @return std::string Fortran, HDF5 or ASCII
+   */
+  std::string get_mesh_format() const {
+    return databases->get_mesh_format();
+  }
+
   /**
    * @brief Get the path to stations file
    *
@@ -141,6 +162,39 @@ public:
     }
   }
 
+  /**
+   * @brief Instantiate a stream writing seismograms during the time loop
+   *
+   * @param assembly Assembly object
+   * @return std::shared_ptr<specfem::writer::seismogram_stream> nullptr unless
+   * seismograms are streamed
+   */
+  std::shared_ptr<specfem::writer::seismogram_stream>
+  instantiate_seismogram_stream(
+      const specfem::compute::assembly &assembly) const {
+    if (this->seismogram) {
+      return this->seismogram->instantiate_seismogram_stream(
+          assembly.receivers, this->time_scheme->get_dt(),
+          this->time_scheme->get_t0(),
+          this->receivers->get_nstep_between_samples(),
+          this->time_scheme->get_nsteps() /
+              this->receivers->get_nstep_between_samples(),
+          assembly.mpi_interfaces.mpi);
+    } else {
+      return nullptr;
+    }
+  }
+
+  /**
+   * @brief Get the number of seismogram steps kept in device memory
+   *
+   * @return int Length of the seismogram ring buffer. 0 if every seismogram
+   * step of the simulation is kept in memory
+   */
+  int get_seismogram_buffer_size() const {
+    return this->seismogram ? this->seismogram->get_buffer_size() : 0;
+  }
+
   std::shared_ptr<specfem::writer::writer> instantiate_wavefield_writer(
       const specfem::compute::assembly &assembly) const {
     if (this->wavefield) {
@@ -159,6 +213,42 @@ public:
     }
   }
 
+  /**
+   * @brief Instantiate the stream writing boundary values to disk during the
+   * forward simulation
+   *
+   * @param assembly Assembly object
+   * @return std::shared_ptr<specfem::writer::boundary_values_stream> nullptr
+   * unless boundary values are streamed
+   */
+  std::shared_ptr<specfem::writer::boundary_values_stream>
+  instantiate_boundary_values_writer(
+      const specfem::compute::assembly &assembly) const {
+    if (this->wavefield) {
+      return this->wavefield->instantiate_boundary_values_writer(assembly);
+    } else {
+      return nullptr;
+    }
+  }
+
+  /**
+   * @brief Instantiate the stream reading boundary values from disk during the
+   * backward simulation
+   *
+   * @param assembly Assembly object
+   * @return std::shared_ptr<specfem::reader::boundary_values_stream> nullptr
+   * unless boundary values are streamed
+   */
+  std::shared_ptr<specfem::reader::boundary_values_stream>
+  instantiate_boundary_values_reader(
+      const specfem::compute::assembly &assembly) const {
+    if (this->wavefield) {
+      return this->wavefield->instantiate_boundary_values_reader(assembly);
+    } else {
+      return nullptr;
+    }
+  }
+
   std::shared_ptr<specfem::writer::writer>
   instantiate_kernel_writer(const specfem::compute::assembly &assembly) const {
     if (this->kernel) {
@@ -177,11 +267,97 @@ public:
       const type_real dt, const specfem::compute::assembly &assembly,
       std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme,
       const qp_type &quadrature) const {
-    return this->solver->instantiate(dt, assembly, time_scheme, quadrature);
+    return this->solver->instantiate(
+        dt, assembly, time_scheme, quadrature,
+        this->instantiate_boundary_values_writer(assembly),
+        this->instantiate_boundary_values_reader(assembly),
+        this->instantiate_seismogram_stream(assembly));
   }
 
+  /**
+   * @brief Instantiate the solver using the number of quadrature points
+   * defined in the quadrature configuration
+   *
+   * @param dt Time step
+   * @param assembly Assembly object
+   * @param time_scheme Time scheme object
+   * @return std::shared_ptr<specfem::solver::solver> Solver object
+   */
+  std::shared_ptr<specfem::solver::solver> instantiate_solver(
+      const type_real dt, const specfem::compute::assembly &assembly,
+      std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme) const {
+    return this->solver->instantiate(
+        dt, assembly, time_scheme, this->quadrature->get_ngll(),
+        this->instantiate_boundary_values_writer(assembly),
+        this->instantiate_boundary_values_reader(assembly),
+        this->instantiate_seismogram_stream(assembly));
+  }
+
+  /**
+   * @brief Get the number of GLL points in each dimension
+   *
+   * @return int Number of GLL points
+   */
+  int get_ngll() const { return this->quadrature->get_ngll(); }
+
   int get_nsteps() const { return this->time_scheme->get_nsteps(); }
 
+  /**
+   * @brief Check if the forward wavefield is recomputed from snapshots during
+   * combined simulations
+   *
+   * @return bool True if checkpointing is enabled
+   */
+  bool use_checkpointing() const { return this->checkpointing != nullptr; }
+
+  /**
+   * @brief Check if boundary values are streamed to or from disk during the
+   * time loop instead of being stored in memory for every time step
+   *
+   * @return bool True if boundary values are streamed
+   */
+  bool stream_boundary_values() const {
+    return this->wavefield && this->wavefield->get_stream_boundary_values();
+  }
+
+  /**
+   * @brief Get the ordering of spectral elements and global points used
+   * during assembly
+   *
+   * @return specfem::compute::element_ordering Element ordering
+   */
+  specfem::compute::element_ordering get_element_ordering() const {
+    return this->element_ordering;
+  }
+
+  /**
+   * @brief Get the strategy used to add element contributions to global
+   * points
+   *
+   * @return specfem::compute::element_assembly Element assembly strategy
+   */
+  specfem::compute::element_assembly get_element_assembly() const {
+    return this->element_assembly;
+  }
+
+  /**
+   * @brief Check if the phases of the time loop are timed
+   *
+   * @return bool True if a table of the time spent in every phase is printed
+   * at the end of the simulation
+   */
+  bool enable_instrumentation() const { return this->instrumentation; }
+
+  /**
+   * @brief Get the file to which the time spent in every phase of the time
+   * loop is written as JSON
+   *
+   * @return std::string Path to the file. Empty if no file is written
+   */
+  std::string get_instrumentation_file() const {
+    return this->instrumentation_file;
+  }
+
 private:
   std::unique_ptr<specfem::runtime_configuration::header> header; ///< Pointer
                                                                   ///< to header
@@ -204,10 +380,25 @@ private:
       wavefield; ///< Pointer to
                  ///< wavefield object
   std::unique_ptr<specfem::runtime_configuration::kernel> kernel;
+  std::unique_ptr<specfem::runtime_configuration::checkpointing>
+      checkpointing; ///< Pointer to checkpointing object
   std::unique_ptr<specfem::runtime_configuration::database_configuration>
       databases; ///< Get database filenames
   std::unique_ptr<specfem::runtime_configuration::solver::solver>
       solver; ///< Pointer to solver object
+  specfem::compute::element_ordering element_ordering =
+      specfem::compute::element_ordering::none; ///< Ordering of elements and
+                                                ///< global points
+  specfem::compute::element_assembly element_assembly =
+      specfem::compute::element_assembly::atomic; ///< Strategy used to add
+                                                  ///< element contributions
+                                                  ///< to global points
+#ifdef ENABLE_PROFILING
+  bool instrumentation = true; ///< Time the phases of the time loop
+#else
+  bool instrumentation = false; ///< Time the phases of the time loop
+#endif
+  std::string instrumentation_file; ///< JSON file for the phase timers
 };
 } // namespace runtime_configuration
 } // namespace specfem
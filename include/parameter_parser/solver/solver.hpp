@@ -2,10 +2,16 @@
 #define _SPECFEM_RUNTIME_CONFIGURATION_SOLVER_SOLVER_HPP_
 
 #include "compute/interface.hpp"
+#include "parallel_configuration/chunk_tuning.hpp"
+#include "reader/boundary_values_stream.hpp"
 #include "solver/solver.hpp"
 #include "timescheme/newmark.hpp"
+#include "writer/boundary_values_stream.hpp"
+#include "writer/seismogram_stream.hpp"
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace specfem {
 namespace runtime_configuration {
@@ -31,6 +37,19 @@ public:
   solver(const std::string simulation_type)
       : simulation_type(simulation_type) {}
 
+  /**
+   * @brief Construct a new solver object that recomputes the forward
+   * wavefield from snapshots during combined simulations
+   *
+   * @param simulation_type Type of the simulation (combined)
+   * @param checkpoint_memory_budget Memory available for wavefield snapshots
+   * in bytes
+   */
+  solver(const std::string simulation_type,
+         const std::size_t checkpoint_memory_budget)
+      : simulation_type(simulation_type),
+        checkpoint_memory_budget(checkpoint_memory_budget) {}
+
   /**
    * @brief Instantiate the solver based on the simulation parameters
    *
@@ -40,13 +59,70 @@ public:
    * @param assembly Assembly object
    * @param time_scheme Time scheme object
    * @param quadrature Quadrature points object
+   * @param boundary_values_writer Stream writing boundary values during
+   * forward simulations. nullptr if boundary values are kept in memory
+   * @param boundary_values_reader Stream reading boundary values during
+   * combined simulations. nullptr if boundary values are kept in memory
+   * @param seismogram_writer Stream writing seismograms during forward
+   * simulations. nullptr if seismograms are written after the time loop
    * @return std::shared_ptr<specfem::solver::solver> Solver object
    */
   template <typename qp_type>
   std::shared_ptr<specfem::solver::solver>
   instantiate(const type_real dt, const specfem::compute::assembly &assembly,
               std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme,
-              const qp_type &quadrature) const;
+              const qp_type &quadrature,
+              const std::shared_ptr<specfem::writer::boundary_values_stream>
+                  boundary_values_writer = nullptr,
+              const std::shared_ptr<specfem::reader::boundary_values_stream>
+                  boundary_values_reader = nullptr,
+              const std::shared_ptr<specfem::writer::seismogram_stream>
+                  seismogram_writer = nullptr) const;
+
+  /**
+   * @brief Instantiate the solver for the number of quadrature points
+   * selected at runtime
+   *
+   * Dispatches to the compile-time instantiation of the solver for the
+   * requested number of GLL points. Every supported value has its own set of
+   * kernels where the loops over quadrature points are fully resolved at
+   * compile time.
+   *
+   * @param dt Time step
+   * @param assembly Assembly object
+   * @param time_scheme Time scheme object
+   * @param ngll Number of GLL points in each dimension
+   * @param boundary_values_writer Stream writing boundary values during
+   * forward simulations. nullptr if boundary values are kept in memory
+   * @param boundary_values_reader Stream reading boundary values during
+   * combined simulations. nullptr if boundary values are kept in memory
+   * @param seismogram_writer Stream writing seismograms during forward
+   * simulations. nullptr if seismograms are written after the time loop
+   * @return std::shared_ptr<specfem::solver::solver> Solver object
+   */
+  std::shared_ptr<specfem::solver::solver>
+  instantiate(const type_real dt, const specfem::compute::assembly &assembly,
+              std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme,
+              const int ngll,
+              const std::shared_ptr<specfem::writer::boundary_values_stream>
+                  boundary_values_writer = nullptr,
+              const std::shared_ptr<specfem::reader::boundary_values_stream>
+                  boundary_values_reader = nullptr,
+              const std::shared_ptr<specfem::writer::seismogram_stream>
+                  seismogram_writer = nullptr) const;
+
+  /**
+   * @brief Set the auto-tuning of the chunk configuration of the stiffness
+   * kernels
+   *
+   * Kernels are tuned when the solver is instantiated.
+   *
+   * @param chunk_tuning Tuning parameters
+   */
+  void
+  set_chunk_tuning(const specfem::parallel_config::chunk_tuning &chunk_tuning) {
+    this->chunk_tuning = chunk_tuning;
+  }
 
   /**
    * @brief Get the type of the simulation (forward or combined)
@@ -65,6 +141,11 @@ public:
 
 private:
   std::string simulation_type; ///< Type of the simulation (forward or combined)
+  std::size_t checkpoint_memory_budget = 0; ///< Memory available for wavefield
+                                            ///< snapshots in bytes. 0 if
+                                            ///< checkpointing is disabled
+  specfem::parallel_config::chunk_tuning chunk_tuning; ///< Auto-tuning of the
+                                                       ///< chunk configuration
 };
 } // namespace solver
 } // namespace runtime_configuration
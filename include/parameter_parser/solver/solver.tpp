@@ -7,37 +7,60 @@
 #include "timescheme/newmark.hpp"
 #include <iostream>
 #include <memory>
+#include <stdexcept>
 
 template <typename qp_type>
 std::shared_ptr<specfem::solver::solver>
 specfem::runtime_configuration::solver::solver::instantiate(const type_real dt,
     const specfem::compute::assembly &assembly,
     std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme,
-    const qp_type &quadrature) const {
+    const qp_type &quadrature,
+    const std::shared_ptr<specfem::writer::boundary_values_stream>
+        boundary_values_writer,
+    const std::shared_ptr<specfem::reader::boundary_values_stream>
+        boundary_values_reader,
+    const std::shared_ptr<specfem::writer::seismogram_stream>
+        seismogram_writer) const {
 
   if (this->simulation_type == "forward") {
     std::cout << "Instantiating Kernels \n";
     std::cout << "-------------------------------\n";
-    const auto kernels = specfem::kernels::kernels<specfem::wavefield::type::forward,
+    auto kernels = specfem::kernels::kernels<specfem::wavefield::type::forward,
                                                    specfem::dimension::type::dim2, qp_type>(
         dt, assembly, quadrature);
+    kernels.tune_chunk_config(this->chunk_tuning);
     return std::make_shared<
         specfem::solver::time_marching<specfem::simulation::type::forward,
                                        specfem::dimension::type::dim2, qp_type>>(
-        kernels, time_scheme);
+        kernels, time_scheme, boundary_values_writer, seismogram_writer);
   } else if (this->simulation_type == "combined") {
     std::cout << "Instantiating Kernels \n";
     std::cout << "-------------------------------\n";
-    const auto adjoint_kernels = specfem::kernels::kernels<specfem::wavefield::type::adjoint,
+    auto adjoint_kernels = specfem::kernels::kernels<specfem::wavefield::type::adjoint,
                                                    specfem::dimension::type::dim2, qp_type>(dt,
         assembly, quadrature);
-    const auto backward_kernels = specfem::kernels::kernels<specfem::wavefield::type::backward,
+    auto backward_kernels = specfem::kernels::kernels<specfem::wavefield::type::backward,
                                                    specfem::dimension::type::dim2, qp_type>(dt,
         assembly, quadrature);
+    adjoint_kernels.tune_chunk_config(this->chunk_tuning);
+    backward_kernels.tune_chunk_config(this->chunk_tuning);
+    if (this->checkpoint_memory_budget > 0) {
+      // Recompute the forward wavefield from snapshots
+      auto forward_kernels = specfem::kernels::kernels<specfem::wavefield::type::forward,
+                                                   specfem::dimension::type::dim2, qp_type>(dt,
+          assembly, quadrature);
+      forward_kernels.tune_chunk_config(this->chunk_tuning);
+      return std::make_shared<
+          specfem::solver::time_marching<specfem::simulation::type::combined,
+                                         specfem::dimension::type::dim2, qp_type>>(
+          assembly, adjoint_kernels, backward_kernels, forward_kernels,
+          time_scheme, this->checkpoint_memory_budget);
+    }
     return std::make_shared<
         specfem::solver::time_marching<specfem::simulation::type::combined,
                                        specfem::dimension::type::dim2, qp_type>>(
-        assembly, adjoint_kernels, backward_kernels, time_scheme);
+        assembly, adjoint_kernels, backward_kernels, time_scheme,
+        boundary_values_reader);
   } else {
     throw std::runtime_error("Simulation type not recognized");
   }
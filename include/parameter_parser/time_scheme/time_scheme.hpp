@@ -66,12 +66,21 @@ public:
 
   int get_nsteps() const { return this->nstep; }
 
+  /**
+   * @brief Check if fused update kernels are used within the time loop
+   *
+   * @return bool True if fused update kernels are used
+   */
+  bool get_fused_update() const { return this->fused_update; }
+
 private:
   int nstep;              ///< number of time steps
   type_real dt;           ///< delta time for the timescheme
   type_real t0 = 0.0;     ///< start time
   std::string timescheme; ///< Time scheme e.g. Newmark, Runge-Kutta, LDDRK
   specfem::simulation::type type;
+  bool fused_update = false; ///< Fuse mass matrix division, corrector and
+                             ///< predictor phases
 };
 } // namespace time_scheme
 } // namespace runtime_configuration
@@ -4,6 +4,7 @@
 #include "receiver/interface.hpp"
 #include "specfem_setup.hpp"
 #include "writer/interface.hpp"
+#include "writer/seismogram_stream.hpp"
 #include "yaml-cpp/yaml.h"
 #include <memory>
 #include <tuple>
@@ -27,6 +28,22 @@ public:
    */
   seismogram(const std::string output_format, const std::string output_folder)
       : output_format(output_format), output_folder(output_folder){};
+
+  /**
+   * @brief Construct a new seismogram object streaming seismograms during the
+   * time loop
+   *
+   * @param output_format Outpul seismogram file format (binary or HDF5)
+   * @param output_folder Path to folder location where seismogram will be
+   * stored
+   * @param buffer_size Number of seismogram steps kept in memory between
+   * writes
+   * @param ascii_export Export per-station ASCII files after the time loop
+   */
+  seismogram(const std::string output_format, const std::string output_folder,
+             const int buffer_size, const bool ascii_export)
+      : output_format(output_format), output_folder(output_folder),
+        buffer_size(buffer_size), ascii_export(ascii_export){};
   /**
    * @brief Construct a new seismogram object
    *
@@ -43,16 +60,62 @@ public:
    * to instantiate the writer
    * @param dt Time interval between timesteps
    * @param t0 Starting time of simulation
-   * @return specfem::writer::writer* Pointer to an instantiated writer object
+   * @return specfem::writer::writer* Pointer to an instantiated writer object.
+   * nullptr if seismograms are streamed during the time loop
    */
   std::shared_ptr<specfem::writer::writer>
   instantiate_seismogram_writer(const specfem::compute::receivers &receivers,
                                 const type_real dt, const type_real t0,
                                 const int nsteps_between_samples) const;
 
+  /**
+   * @brief Instantiate a stream writing seismograms during the time loop
+   *
+   * @param receivers Receivers whose seismograms are streamed
+   * @param dt Time interval between timesteps
+   * @param t0 Starting time of simulation
+   * @param nsteps_between_samples Number of timesteps between seismogram
+   * samples
+   * @param nsig_steps Number of seismogram steps in the simulation
+   * @param mpi MPI object. Every rank streams to its own file
+   * @return std::shared_ptr<specfem::writer::seismogram_stream> Seismogram
+   * stream. nullptr if seismograms are written after the time loop
+   */
+  std::shared_ptr<specfem::writer::seismogram_stream>
+  instantiate_seismogram_stream(const specfem::compute::receivers &receivers,
+                                const type_real dt, const type_real t0,
+                                const int nsteps_between_samples,
+                                const int nsig_steps,
+                                const specfem::MPI::MPI *mpi) const;
+
+  /**
+   * @brief Check if seismograms are streamed to disk during the time loop
+   *
+   * @return bool True if the output format is binary or HDF5
+   */
+  bool stream() const;
+
+  /**
+   * @brief Get the number of seismogram steps kept in memory
+   *
+   * @return int Length of the seismogram ring buffer. 0 if every seismogram
+   * step is kept in memory
+   */
+  int get_buffer_size() const { return this->stream() ? buffer_size : 0; }
+
 private:
+  /**
+   * @brief Get the output format
+   *
+   */
+  specfem::enums::seismogram::format get_format() const;
+
   std::string output_format; ///< format of output file
   std::string output_folder; ///< Path to output folder
+  int buffer_size = 1024;    ///< Number of seismogram steps kept in memory
+                             ///< when seismograms are streamed
+  bool ascii_export = false; ///< Export per-station ASCII files when
+                             ///< seismograms are streamed
 };
 
 } // namespace runtime_configuration
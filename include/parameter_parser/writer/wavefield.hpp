@@ -2,9 +2,12 @@
 #define _SPECFEM_RUNTIME_CONFIGURATION_WAVEFIELD_HPP
 
 #include "compute/assembly/assembly.hpp"
+#include "reader/boundary_values_stream.hpp"
 #include "reader/reader.hpp"
+#include "writer/boundary_values_stream.hpp"
 #include "writer/writer.hpp"
 #include "yaml-cpp/yaml.h"
+#include <memory>
 
 namespace specfem {
 namespace runtime_configuration {
@@ -12,9 +15,11 @@ class wavefield {
 
 public:
   wavefield(const std::string output_format, const std::string output_folder,
-            const specfem::simulation::type type)
+            const specfem::simulation::type type,
+            const bool stream_boundary_values = false)
       : output_format(output_format), output_folder(output_folder),
-        simulation_type(type) {}
+        simulation_type(type), stream_boundary_values(stream_boundary_values) {
+  }
 
   wavefield(const YAML::Node &Node, const specfem::simulation::type type);
 
@@ -24,14 +29,50 @@ public:
   std::shared_ptr<specfem::reader::reader> instantiate_wavefield_reader(
       const specfem::compute::assembly &assembly) const;
 
+  /**
+   * @brief Instantiate the stream writing boundary values during the forward
+   * simulation
+   *
+   * @param assembly SPECFEM++ assembly
+   * @return std::shared_ptr<specfem::writer::boundary_values_stream> nullptr
+   * unless boundary values are streamed during a forward simulation
+   */
+  std::shared_ptr<specfem::writer::boundary_values_stream>
+  instantiate_boundary_values_writer(
+      const specfem::compute::assembly &assembly) const;
+
+  /**
+   * @brief Instantiate the stream reading boundary values during the backward
+   * simulation
+   *
+   * @param assembly SPECFEM++ assembly
+   * @return std::shared_ptr<specfem::reader::boundary_values_stream> nullptr
+   * unless boundary values are streamed during a combined simulation
+   */
+  std::shared_ptr<specfem::reader::boundary_values_stream>
+  instantiate_boundary_values_reader(
+      const specfem::compute::assembly &assembly) const;
+
   inline specfem::simulation::type get_simulation_type() const {
     return this->simulation_type;
   }
 
+  /**
+   * @brief Check if boundary values are streamed to or from disk during the
+   * time loop
+   *
+   */
+  inline bool get_stream_boundary_values() const {
+    return this->stream_boundary_values;
+  }
+
 private:
   std::string output_format;                 ///< format of output file
   std::string output_folder;                 ///< Path to output folder
   specfem::simulation::type simulation_type; ///< Type of simulation
+  bool stream_boundary_values; ///< Stream boundary values to or from disk
+                               ///< instead of storing every time step in
+                               ///< memory
 };
 } // namespace runtime_configuration
 } // namespace specfem
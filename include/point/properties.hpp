@@ -93,6 +93,23 @@ public:
       : properties(lambdaplus2mu, mu, rho,
                    std::integral_constant<bool, UseSIMD>{}) {}
   ///@}
+
+  /**
+   * @brief Equality operator
+   *
+   */
+  KOKKOS_FUNCTION
+  bool operator==(const properties &rhs) const {
+    return rho == rhs.rho && mu == rhs.mu &&
+           lambdaplus2mu == rhs.lambdaplus2mu;
+  }
+
+  /**
+   * @brief Inequality operator
+   *
+   */
+  KOKKOS_FUNCTION
+  bool operator!=(const properties &rhs) const { return !(*this == rhs); }
 };
 
 /**
@@ -170,6 +187,24 @@ public:
       : properties(lambdaplus2mu_inverse, rho_inverse, kappa,
                    std::integral_constant<bool, UseSIMD>{}) {}
   ///@}
+
+  /**
+   * @brief Equality operator
+   *
+   */
+  KOKKOS_FUNCTION
+  bool operator==(const properties &rhs) const {
+    return rho_inverse == rhs.rho_inverse &&
+           lambdaplus2mu_inverse == rhs.lambdaplus2mu_inverse &&
+           kappa == rhs.kappa;
+  }
+
+  /**
+   * @brief Inequality operator
+   *
+   */
+  KOKKOS_FUNCTION
+  bool operator!=(const properties &rhs) const { return !(*this == rhs); }
 };
 
 } // namespace point
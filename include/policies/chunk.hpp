@@ -289,7 +289,21 @@ public:
    * @param ngllx Number of GLL points in the x-direction
    */
   element_chunk(const IndexViewType &view, int ngllz, int ngllx)
-      : policy_type(view.extent(0) / (tile_size * simd_size) +
+      : element_chunk(execution_space(), view, ngllz, ngllx) {}
+
+  /**
+   * @brief Construct a new element chunk policy launched on an execution
+   * space instance
+   *
+   * @param space Execution space instance on which the policy is launched
+   * @param view View of elements to chunk
+   * @param ngllz Number of GLL points in the z-direction
+   * @param ngllx Number of GLL points in the x-direction
+   */
+  element_chunk(const execution_space &space, const IndexViewType &view,
+                int ngllz, int ngllx)
+      : policy_type(space,
+                    view.extent(0) / (tile_size * simd_size) +
                         (view.extent(0) % (tile_size * simd_size) != 0),
                     num_threads, vector_lanes),
         elements(view), ngllz(ngllz), ngllx(ngllx) {
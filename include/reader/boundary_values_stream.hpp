@@ -0,0 +1,57 @@
+#pragma once
+
+#include "IO/async/block_reader.hpp"
+#include "compute/interface.hpp"
+#include <memory>
+#include <string>
+
+namespace specfem {
+namespace reader {
+
+/**
+ * @brief Read boundary values streamed to disk by the forward simulation
+ *
+ * Time steps are prefetched in reverse order by a background thread with
+ * double buffering, so that reading the values of the next time step
+ * overlaps with the computation of the current one. Only one time step is
+ * kept in device memory.
+ */
+class boundary_values_stream {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Open the boundary values file and start prefetching
+   *
+   * @param input_folder Path to the folder containing the boundary values
+   * @param assembly SPECFEM++ assembly
+   */
+  boundary_values_stream(const std::string &input_folder,
+                         const specfem::compute::assembly &assembly);
+  ///@}
+
+  /**
+   * @brief Transfer the boundary values of a time step to the device
+   *
+   * Time steps must be read in reverse order, starting from the last time
+   * step of the forward simulation.
+   *
+   * @param istep Time step
+   */
+  void read(const int istep);
+
+private:
+  specfem::compute::boundary_values boundary_values; ///< Boundary values used
+                                                     ///< for backward
+                                                     ///< reconstruction during
+                                                     ///< adjoint simulations
+  std::unique_ptr<specfem::IO::async_block_reader> reader; ///< Background
+                                                           ///< reader
+  int next_step; ///< Next time step in the prefetch order
+};
+
+} // namespace reader
+} // namespace specfem
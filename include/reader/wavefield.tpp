@@ -29,6 +29,12 @@ void specfem::reader::wavefield<IOLibrary>::read() {
   acoustic.openDataset("PotentialDotDot", buffer.acoustic.h_field_dot_dot)
       .read();
 
+  // Streamed boundary values are read during the time loop
+  if (boundary_values.is_streamed()) {
+    buffer.copy_to_device();
+    return;
+  }
+
   typename IOLibrary::Group boundary = file.openGroup("/Boundary");
   typename IOLibrary::Group stacey = boundary.openGroup("/Stacey");
 
@@ -43,6 +43,19 @@ public:
   void
   compute_receiver_array(const specfem::compute::mesh &mesh,
                          specfem::kokkos::HostView3d<type_real> receiver_array);
+  /**
+   * @brief Compute the receiver array (lagrangians) for this station from its
+   * previously computed local coordinates
+   *
+   * @param lcoord Local coordinates of the station
+   * @param mesh Assembled mesh
+   * @param receiver_array view to store the source array
+   */
+  void compute_receiver_array(
+      const specfem::point::local_coordinates<specfem::dimension::type::dim2>
+          &lcoord,
+      const specfem::compute::mesh &mesh,
+      specfem::kokkos::HostView3d<type_real> receiver_array);
   /**
    * @brief Get the name of network where this station lies
    *
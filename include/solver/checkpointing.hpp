@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace specfem {
+namespace solver {
+namespace checkpointing {
+
+/**
+ * @brief Operations performed while reversing a forward simulation from a
+ * limited number of wavefield snapshots
+ *
+ */
+enum class action_type {
+  advance, ///< Run forward time steps [step, step + nsteps)
+  store,   ///< Store the current forward wavefield in a snapshot slot
+  restore, ///< Restore the forward wavefield from a snapshot slot
+  reverse  ///< Forward wavefield at step is available for the adjoint step
+};
+
+/**
+ * @brief Single operation within a checkpointing schedule
+ *
+ */
+struct action {
+  action_type type; ///< Type of the operation
+  int step;         ///< Forward state index (number of time steps executed)
+  int nsteps;       ///< Number of forward time steps (advance only)
+  int slot;         ///< Snapshot slot (store and restore only)
+};
+
+/**
+ * @brief Binomial (Revolve style) checkpointing schedule
+ *
+ * Computes the sequence of operations required to provide the forward
+ * wavefield states \f$ X_{n}, X_{n-1}, \dots, X_{1} \f$ in reverse order while
+ * keeping at most @p nslots wavefield snapshots in memory. \f$ X_{j} \f$ is the
+ * forward wavefield after @c j time steps, \f$ X_{0} \f$ is the initial state
+ * which is stored in slot 0 before the schedule is executed.
+ *
+ * Segments are split such that no forward time step is recomputed more often
+ * than the binomial bound allows (Griewank & Walther, Algorithm 799).
+ */
+class binomial_schedule {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Construct a checkpointing schedule
+   *
+   * @param nsteps Number of time steps in the simulation
+   * @param nslots Number of snapshot slots (including the slot used to store
+   * the initial state)
+   */
+  binomial_schedule(const int nsteps, const int nslots);
+  ///@}
+
+  /**
+   * @brief Get the list of operations
+   *
+   * @return const std::vector<action>& Operations in execution order
+   */
+  const std::vector<action> &get_actions() const { return actions; }
+
+  /**
+   * @brief Get the total number of forward time steps executed by the schedule
+   *
+   * @return std::size_t Number of forward time steps (at least nsteps)
+   */
+  std::size_t get_forward_steps() const { return forward_steps; }
+
+  /**
+   * @brief Get the number of forward time steps executed in addition to a
+   * single forward sweep
+   *
+   * @return std::size_t Number of recomputed forward time steps
+   */
+  std::size_t get_recomputed_steps() const {
+    return forward_steps - static_cast<std::size_t>(nsteps);
+  }
+
+  /**
+   * @brief Get the maximum number of snapshot slots used simultaneously
+   *
+   * @return int Number of snapshot slots
+   */
+  int get_max_slots() const { return max_slots; }
+
+private:
+  void reverse(const int lo, const int lo_slot, const int hi, const int nfree);
+  void advance(const int from, const int from_slot, const int to);
+
+  int nsteps;                    ///< Number of time steps
+  int nslots;                    ///< Number of snapshot slots
+  int current = -1;              ///< Forward state held in the wavefield
+  int max_slots = 1;             ///< Number of slots used simultaneously
+  std::size_t forward_steps = 0; ///< Forward time steps executed
+  std::vector<action> actions;   ///< Operations in execution order
+};
+
+} // namespace checkpointing
+} // namespace solver
+} // namespace specfem
@@ -6,8 +6,14 @@
 #include "enumerations/wavefield.hpp"
 #include "kernels/frechet_kernels.hpp"
 #include "kernels/kernels.hpp"
+#include "reader/boundary_values_stream.hpp"
 #include "solver.hpp"
 #include "timescheme/newmark.hpp"
+#include "writer/boundary_values_stream.hpp"
+#include "writer/seismogram_stream.hpp"
+#include <cstddef>
+#include <memory>
+#include <optional>
 
 namespace specfem {
 namespace solver {
@@ -41,12 +47,22 @@ public:
    *
    * @param kernels Computational kernels
    * @param time_scheme Time scheme
+   * @param boundary_values_writer Stream writing boundary values to disk after
+   * every time step. nullptr if boundary values are kept in memory
+   * @param seismogram_writer Stream writing seismograms to disk during the
+   * time loop. nullptr if seismograms are written after the time loop
    */
   time_marching(
       const specfem::kernels::kernels<specfem::wavefield::type::forward,
                                       DimensionType, qp_type> &kernels,
-      const std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme)
-      : kernels(kernels), time_scheme(time_scheme) {}
+      const std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme,
+      const std::shared_ptr<specfem::writer::boundary_values_stream>
+          boundary_values_writer = nullptr,
+      const std::shared_ptr<specfem::writer::seismogram_stream>
+          seismogram_writer = nullptr)
+      : kernels(kernels), time_scheme(time_scheme),
+        boundary_values_writer(boundary_values_writer),
+        seismogram_writer(seismogram_writer) {}
 
   ///@}
 
@@ -56,11 +72,40 @@ public:
   void run() override;
 
 private:
+  /**
+   * @name Time loop steps
+   *
+   * Phases of @ref run
+   */
+  ///@{
+  /**
+   * @brief Initialize the kernels before the first time step
+   */
+  void initialize();
+
+  /**
+   * @brief Advance the wavefield by a single time step
+   *
+   * @param istep Index of the time step
+   */
+  void step(const int istep);
+
+  /**
+   * @brief Report the update traffic and close the boundary values and
+   * seismogram streams after the last time step
+   */
+  void finalize();
+  ///@}
+
   specfem::kernels::kernels<specfem::wavefield::type::forward, DimensionType,
                             qp_type>
       kernels; ///< Computational kernels
   std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme; ///< Time
                                                                   ///< scheme
+  std::shared_ptr<specfem::writer::boundary_values_stream>
+      boundary_values_writer; ///< Stream writing boundary values to disk
+  std::shared_ptr<specfem::writer::seismogram_stream>
+      seismogram_writer; ///< Stream writing seismograms to disk
 };
 
 /**
@@ -83,6 +128,9 @@ public:
    * @param adjoint_kernels Adjoint computational kernels
    * @param backward_kernels Backward computational kernels
    * @param time_scheme Time scheme
+   * @param boundary_values_reader Stream reading boundary values from disk
+   * before every backward time step. nullptr if boundary values are kept in
+   * memory
    */
   time_marching(
       const specfem::compute::assembly &assembly,
@@ -90,10 +138,44 @@ public:
                                       DimensionType, qp_type> &adjoint_kernels,
       const specfem::kernels::kernels<specfem::wavefield::type::backward,
                                       DimensionType, qp_type> &backward_kernels,
-      const std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme)
+      const std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme,
+      const std::shared_ptr<specfem::reader::boundary_values_stream>
+          boundary_values_reader = nullptr)
       : assembly(assembly), adjoint_kernels(adjoint_kernels),
         frechet_kernels(assembly), backward_kernels(backward_kernels),
-        time_scheme(time_scheme) {}
+        time_scheme(time_scheme),
+        boundary_values_reader(boundary_values_reader) {}
+
+  /**
+   * @brief Construct a new time marching solver that recomputes the forward
+   * wavefield from snapshots
+   *
+   * The forward wavefield is recomputed using a binomial checkpointing
+   * schedule instead of being reconstructed from stored boundary values.
+   *
+   * @param assembly Spectral element assembly object
+   * @param adjoint_kernels Adjoint computational kernels
+   * @param backward_kernels Backward computational kernels. Used to compute
+   * seismograms of the recomputed forward wavefield.
+   * @param forward_kernels Forward computational kernels
+   * @param time_scheme Time scheme
+   * @param checkpoint_memory_budget Memory available for wavefield snapshots
+   * in bytes
+   */
+  time_marching(
+      const specfem::compute::assembly &assembly,
+      const specfem::kernels::kernels<specfem::wavefield::type::adjoint,
+                                      DimensionType, qp_type> &adjoint_kernels,
+      const specfem::kernels::kernels<specfem::wavefield::type::backward,
+                                      DimensionType, qp_type> &backward_kernels,
+      const specfem::kernels::kernels<specfem::wavefield::type::forward,
+                                      DimensionType, qp_type> &forward_kernels,
+      const std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme,
+      const std::size_t checkpoint_memory_budget)
+      : assembly(assembly), adjoint_kernels(adjoint_kernels),
+        frechet_kernels(assembly), backward_kernels(backward_kernels),
+        forward_kernels(forward_kernels), time_scheme(time_scheme),
+        checkpoint_memory_budget(checkpoint_memory_budget) {}
   ///@}
 
   /**
@@ -102,6 +184,12 @@ public:
   void run() override;
 
 private:
+  /**
+   * @brief Run the time marching solver recomputing the forward wavefield from
+   * snapshots
+   */
+  void run_checkpointed();
+
   constexpr static int NGLL = qp_type::NGLL;
   specfem::kernels::kernels<specfem::wavefield::type::adjoint, DimensionType,
                             qp_type>
@@ -109,11 +197,19 @@ private:
   specfem::kernels::kernels<specfem::wavefield::type::backward, DimensionType,
                             qp_type>
       backward_kernels; ///< Backward computational kernels
+  std::optional<specfem::kernels::kernels<specfem::wavefield::type::forward,
+                                          DimensionType, qp_type> >
+      forward_kernels; ///< Forward computational kernels. Only defined when
+                       ///< the forward wavefield is recomputed
   specfem::kernels::frechet_kernels<DimensionType, NGLL>
       frechet_kernels;                 ///< Misfit kernels
   specfem::compute::assembly assembly; ///< Spectral element assembly object
   std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme; ///< Time
                                                                   ///< scheme
+  std::size_t checkpoint_memory_budget = 0; ///< Memory available for
+                                            ///< wavefield snapshots in bytes
+  std::shared_ptr<specfem::reader::boundary_values_stream>
+      boundary_values_reader; ///< Stream reading boundary values from disk
 };
 } // namespace solver
 } // namespace specfem
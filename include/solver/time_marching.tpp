@@ -1,46 +1,113 @@
 #ifndef _SPECFEM_SOLVER_TIME_MARCHING_TPP
 #define _SPECFEM_SOLVER_TIME_MARCHING_TPP
 
+#include "checkpointing.hpp"
+#include "compute/fields/snapshots.hpp"
 #include "domain/domain.hpp"
 #include "solver.hpp"
 #include "time_marching.hpp"
 #include "timescheme/newmark.hpp"
 #include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
 
 template <specfem::dimension::type DimensionType, typename qp_type>
 void specfem::solver::time_marching<specfem::simulation::type::forward,
                                     DimensionType, qp_type>::run() {
 
-  constexpr auto acoustic = specfem::element::medium_tag::acoustic;
-  constexpr auto elastic = specfem::element::medium_tag::elastic;
+  this->initialize();
+
+  const int nstep = time_scheme->get_max_timestep();
+
+  for (const auto [istep, dt] : time_scheme->iterate_forward()) {
+    this->step(istep);
+
+    if (istep % 10 == 0) {
+      std::cout << "Progress : executed " << istep << " steps of " << nstep
+                << " steps" << std::endl;
+    }
+  }
+
+  std::cout << std::endl;
 
+  this->finalize();
+
+  return;
+}
+
+template <specfem::dimension::type DimensionType, typename qp_type>
+void specfem::solver::time_marching<specfem::simulation::type::forward,
+                                    DimensionType, qp_type>::initialize() {
   kernels.initialize(time_scheme->get_timestep());
+  return;
+}
+
+template <specfem::dimension::type DimensionType, typename qp_type>
+void specfem::solver::time_marching<specfem::simulation::type::forward,
+                                    DimensionType,
+                                    qp_type>::step(const int istep) {
+
+  constexpr auto acoustic = specfem::element::medium_tag::acoustic;
+  constexpr auto elastic = specfem::element::medium_tag::elastic;
 
   const int nstep = time_scheme->get_max_timestep();
 
-  for (const auto [istep, dt] : time_scheme->iterate_forward()) {
-    time_scheme->apply_predictor_phase_forward(acoustic);
-    time_scheme->apply_predictor_phase_forward(elastic);
+  time_scheme->apply_predictor_phase_forward(acoustic);
+  time_scheme->apply_predictor_phase_forward(elastic);
+
+  if (time_scheme->use_fused_update()) {
+    // The predictor phase of the next time step is folded into the update
+    // unless the wavefield of this time step is read afterwards
+    const bool predict =
+        !time_scheme->compute_seismogram(istep) && (istep < nstep - 1);
 
+    kernels.template compute_forces<acoustic>(istep);
+    time_scheme->apply_fused_update_forward(acoustic, predict);
+
+    kernels.template compute_forces<elastic>(istep);
+    time_scheme->apply_fused_update_forward(elastic, predict);
+  } else {
     kernels.template update_wavefields<acoustic>(istep);
     time_scheme->apply_corrector_phase_forward(acoustic);
 
     kernels.template update_wavefields<elastic>(istep);
     time_scheme->apply_corrector_phase_forward(elastic);
+  }
 
-    if (time_scheme->compute_seismogram(istep)) {
-      kernels.compute_seismograms(time_scheme->get_seismogram_step());
-      time_scheme->increment_seismogram_step();
-    }
+  if (boundary_values_writer) {
+    boundary_values_writer->write(istep);
+  }
 
-    if (istep % 10 == 0) {
-      std::cout << "Progress : executed " << istep << " steps of " << nstep
-                << " steps" << std::endl;
+  if (time_scheme->compute_seismogram(istep)) {
+    const int isig_step = time_scheme->get_seismogram_step();
+    kernels.compute_seismograms(isig_step);
+    time_scheme->increment_seismogram_step();
+
+    if (seismogram_writer) {
+      seismogram_writer->write(isig_step);
     }
   }
 
+  return;
+}
+
+template <specfem::dimension::type DimensionType, typename qp_type>
+void specfem::solver::time_marching<specfem::simulation::type::forward,
+                                    DimensionType, qp_type>::finalize() {
+
+  time_scheme->print_update_traffic(std::cout);
   std::cout << std::endl;
 
+  if (boundary_values_writer) {
+    boundary_values_writer->close();
+  }
+
+  if (seismogram_writer) {
+    seismogram_writer->close();
+  }
+
   return;
 }
 
@@ -51,23 +118,42 @@ void specfem::solver::time_marching<specfem::simulation::type::combined,
   constexpr auto acoustic = specfem::element::medium_tag::acoustic;
   constexpr auto elastic = specfem::element::medium_tag::elastic;
 
+  if (forward_kernels) {
+    this->run_checkpointed();
+    return;
+  }
+
   adjoint_kernels.initialize(time_scheme->get_timestep());
   backward_kernels.initialize(time_scheme->get_timestep());
 
   const int nstep = time_scheme->get_max_timestep();
+  const bool fused_update = time_scheme->use_fused_update();
 
   for (const auto [istep, dt] : time_scheme->iterate_backward()) {
-    // Adjoint time step
+    // Adjoint time step. The adjoint wavefield is read by the Frechet kernels
+    // after every time step, so the predictor phase is never fused
     time_scheme->apply_predictor_phase_forward(acoustic);
     time_scheme->apply_predictor_phase_forward(elastic);
 
-    adjoint_kernels.template update_wavefields<acoustic>(istep);
-    time_scheme->apply_corrector_phase_forward(acoustic);
+    if (fused_update) {
+      adjoint_kernels.template compute_forces<acoustic>(istep);
+      time_scheme->apply_fused_update_forward(acoustic, false);
 
-    adjoint_kernels.template update_wavefields<elastic>(istep);
-    time_scheme->apply_corrector_phase_forward(elastic);
+      adjoint_kernels.template compute_forces<elastic>(istep);
+      time_scheme->apply_fused_update_forward(elastic, false);
+    } else {
+      adjoint_kernels.template update_wavefields<acoustic>(istep);
+      time_scheme->apply_corrector_phase_forward(acoustic);
+
+      adjoint_kernels.template update_wavefields<elastic>(istep);
+      time_scheme->apply_corrector_phase_forward(elastic);
+    }
 
     // Backward time step
+    if (boundary_values_reader) {
+      boundary_values_reader->read(istep);
+    }
+
     time_scheme->apply_predictor_phase_backward(elastic);
     time_scheme->apply_predictor_phase_backward(acoustic);
 
@@ -102,6 +188,181 @@ void specfem::solver::time_marching<specfem::simulation::type::combined,
 
   std::cout << std::endl;
 
+  time_scheme->print_update_traffic(std::cout);
+  std::cout << std::endl;
+
+  return;
+}
+
+template <specfem::dimension::type DimensionType, typename qp_type>
+void specfem::solver::time_marching<specfem::simulation::type::combined,
+                                    DimensionType,
+                                    qp_type>::run_checkpointed() {
+
+  constexpr auto acoustic = specfem::element::medium_tag::acoustic;
+  constexpr auto elastic = specfem::element::medium_tag::elastic;
+
+  using specfem::solver::checkpointing::action_type;
+
+  const type_real dt = time_scheme->get_timestep();
+  const int nstep = time_scheme->get_max_timestep();
+
+  adjoint_kernels.initialize(dt);
+  backward_kernels.initialize(dt);
+  forward_kernels->initialize(dt);
+
+  const auto &forward_field = assembly.fields.forward;
+
+  const std::size_t snapshot_size =
+      specfem::compute::wavefield_snapshots::snapshot_size(forward_field);
+
+  const int nsnapshots =
+      static_cast<int>(std::min(checkpoint_memory_budget / snapshot_size,
+                                static_cast<std::size_t>(nstep)));
+
+  if (nsnapshots < 1) {
+    std::ostringstream message;
+    message << "Error in checkpointed combined simulation. \n"
+            << "Memory budget of " << checkpoint_memory_budget / 1048576.0
+            << " MB cannot hold a single wavefield snapshot ("
+            << snapshot_size / 1048576.0 << " MB).";
+    throw std::runtime_error(message.str());
+  }
+
+  const specfem::solver::checkpointing::binomial_schedule schedule(nstep,
+                                                                  nsnapshots);
+
+  const specfem::compute::wavefield_snapshots snapshots(
+      schedule.get_max_slots(), forward_field);
+
+  const bool fused_update = time_scheme->use_fused_update();
+
+  // Time scheme used to recompute the forward wavefield
+  specfem::time_scheme::newmark<specfem::simulation::type::forward>
+      forward_time_scheme(nstep, 1, dt, 0.0, fused_update);
+  forward_time_scheme.link_assembly(assembly);
+
+  // Memory that would be required to store the boundary values of every time
+  // step
+  const std::size_t boundary_size = static_cast<std::size_t>(nstep) *
+                                    assembly.boundary_values.step_size();
+
+  std::cout << "Checkpointing:\n"
+            << "  Wavefield snapshots           : "
+            << schedule.get_max_slots() << " ("
+            << schedule.get_max_slots() * snapshot_size / 1048576.0
+            << " MB of " << checkpoint_memory_budget / 1048576.0
+            << " MB budget)\n"
+            << "  Boundary values not stored    : "
+            << boundary_size / 1048576.0 << " MB\n"
+            << "  Forward time steps scheduled  : "
+            << schedule.get_forward_steps() << " (" << nstep
+            << " steps in the simulation)\n"
+            << std::endl;
+
+  // Store the initial state of the forward wavefield
+  snapshots.store(0, forward_field);
+
+  std::chrono::duration<double> recompute_time(0.0);
+
+  for (const auto &action : schedule.get_actions()) {
+    switch (action.type) {
+    case action_type::advance: {
+      const auto start = std::chrono::high_resolution_clock::now();
+      const int end = action.step + action.nsteps;
+      for (int istep = action.step; istep < end; ++istep) {
+        forward_time_scheme.apply_predictor_phase_forward(acoustic);
+        forward_time_scheme.apply_predictor_phase_forward(elastic);
+
+        if (fused_update) {
+          // The wavefield is only read after the last step of the advance
+          const bool predict = (istep < end - 1);
+
+          forward_kernels->template compute_forces<acoustic>(istep);
+          forward_time_scheme.apply_fused_update_forward(acoustic, predict);
+
+          forward_kernels->template compute_forces<elastic>(istep);
+          forward_time_scheme.apply_fused_update_forward(elastic, predict);
+        } else {
+          forward_kernels->template update_wavefields<acoustic>(istep);
+          forward_time_scheme.apply_corrector_phase_forward(acoustic);
+
+          forward_kernels->template update_wavefields<elastic>(istep);
+          forward_time_scheme.apply_corrector_phase_forward(elastic);
+        }
+      }
+      Kokkos::fence();
+      recompute_time += std::chrono::high_resolution_clock::now() - start;
+      break;
+    }
+    case action_type::store:
+      snapshots.store(action.slot, forward_field);
+      break;
+    case action_type::restore:
+      snapshots.restore(action.slot, forward_field);
+      break;
+    case action_type::reverse: {
+      // Forward wavefield after action.step time steps is aligned with the
+      // adjoint wavefield at time step action.step - 1
+      const int istep = action.step - 1;
+
+      // Adjoint time step
+      time_scheme->apply_predictor_phase_forward(acoustic);
+      time_scheme->apply_predictor_phase_forward(elastic);
+
+      if (fused_update) {
+        adjoint_kernels.template compute_forces<acoustic>(istep);
+        time_scheme->apply_fused_update_forward(acoustic, false);
+
+        adjoint_kernels.template compute_forces<elastic>(istep);
+        time_scheme->apply_fused_update_forward(elastic, false);
+      } else {
+        adjoint_kernels.template update_wavefields<acoustic>(istep);
+        time_scheme->apply_corrector_phase_forward(acoustic);
+
+        adjoint_kernels.template update_wavefields<elastic>(istep);
+        time_scheme->apply_corrector_phase_forward(elastic);
+      }
+
+      specfem::compute::deep_copy_on_device(assembly.fields.backward,
+                                            forward_field);
+
+      frechet_kernels.compute_derivatives(dt);
+
+      if (time_scheme->compute_seismogram(istep)) {
+        backward_kernels.compute_seismograms(
+            time_scheme->get_seismogram_step());
+        time_scheme->increment_seismogram_step();
+      }
+
+      if (istep % 10 == 0) {
+        std::cout << "Progress : executed " << istep << " steps of " << nstep
+                  << " steps" << std::endl;
+      }
+      break;
+    }
+    }
+  }
+
+  const std::size_t recomputed_steps = schedule.get_recomputed_steps();
+
+  std::cout << std::endl
+            << "Checkpointing summary:\n"
+            << "  Forward time steps executed   : "
+            << schedule.get_forward_steps() << "\n"
+            << "  Forward time steps recomputed : " << recomputed_steps << " ("
+            << 100.0 * recomputed_steps / nstep
+            << "% of a forward simulation)\n"
+            << "  Time spent on forward steps   : " << recompute_time.count()
+            << " secs\n"
+            << std::endl;
+
+  std::cout << "Forward wavefield recomputation:\n";
+  forward_time_scheme.print_update_traffic(std::cout);
+  std::cout << std::endl << "Adjoint and backward wavefields:\n";
+  time_scheme->print_update_traffic(std::cout);
+  std::cout << std::endl;
+
   return;
 }
 
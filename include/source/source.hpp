@@ -74,11 +74,34 @@ public:
       const specfem::compute::properties &properties,
       specfem::kokkos::HostView3d<type_real> source_array) = 0;
 
+  /**
+   * @brief Tabulate the source time function for a range of time steps
+   *
+   * @param t0 Initial time
+   * @param dt Time step
+   * @param first_step First time step of the range
+   * @param nsteps Number of time steps in the range
+   * @param source_time_function Values of the source time function within the
+   * range (nsteps x ncomponents)
+   */
   void compute_source_time_function(
-      const type_real t0, const type_real dt, const int nsteps,
+      const type_real t0, const type_real dt, const int first_step,
+      const int nsteps,
       specfem::kokkos::HostView2d<type_real> source_time_function) const {
     return this->forcing_function->compute_source_time_function(
-        t0, dt, nsteps, source_time_function);
+        t0, dt, first_step, nsteps, source_time_function);
+  }
+
+  /**
+   * @brief Get the parameters needed to evaluate the source time function on
+   * the device
+   *
+   * @return specfem::forcing_function::analytic_parameters Parameters of the
+   * source time function
+   */
+  specfem::forcing_function::analytic_parameters
+  get_analytic_parameters() const {
+    return this->forcing_function->get_analytic_parameters();
   }
 
   virtual specfem::wavefield::type get_wavefield_type() const = 0;
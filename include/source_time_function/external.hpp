@@ -5,6 +5,7 @@
 #include "kokkos_abstractions.h"
 #include "source_time_function/source_time_function.hpp"
 #include "yaml-cpp/yaml.h"
+#include <ios>
 #include <tuple>
 #include <vector>
 
@@ -15,7 +16,8 @@ public:
   external(const YAML::Node &external, const int nsteps, const type_real dt);
 
   void compute_source_time_function(
-      const type_real t0, const type_real dt, const int nsteps,
+      const type_real t0, const type_real dt, const int first_step,
+      const int nsteps,
       specfem::kokkos::HostView2d<type_real> source_time_function) override;
 
   void update_tshift(type_real tshift) override {
@@ -48,6 +50,13 @@ private:
   std::string x_component = "";
   std::string y_component = "";
   std::string z_component = "";
+  constexpr static int offset_stride = 1024; ///< Number of lines between the
+                                             ///< offsets stored in
+                                             ///< line_offsets
+  std::vector<std::vector<std::streampos> >
+      line_offsets; ///< Position of every offset_stride-th line within the
+                    ///< file of every component, used to read a range of time
+                    ///< steps without reading the whole file
 };
 } // namespace forcing_function
 } // namespace specfem
@@ -51,8 +51,20 @@ public:
 
   std::string print() const override;
 
+  analytic_parameters get_analytic_parameters() const override {
+    analytic_parameters parameters;
+    parameters.type = analytic_type::ricker;
+    parameters.f0 = this->__f0;
+    parameters.tshift = this->__tshift;
+    parameters.factor = this->__factor;
+    parameters.use_trick_for_better_pressure =
+        this->__use_trick_for_better_pressure;
+    return parameters;
+  }
+
   void compute_source_time_function(
-      const type_real t0, const type_real dt, const int nsteps,
+      const type_real t0, const type_real dt, const int first_step,
+      const int nsteps,
       specfem::kokkos::HostView2d<type_real> source_time_function) override;
 
 private:
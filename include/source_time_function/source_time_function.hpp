@@ -3,6 +3,7 @@
 
 #include "kokkos_abstractions.h"
 #include "specfem_setup.hpp"
+#include "utilities.hpp"
 #include <Kokkos_Core.hpp>
 #include <ostream>
 
@@ -15,6 +16,53 @@ namespace forcing_function {
  *
  */
 
+/**
+ * @brief Source time functions with a closed form expression
+ *
+ */
+enum class analytic_type {
+  none,   ///< No closed form. Tabulated on the host at every time step
+  ricker, ///< Ricker wavelet
+  dirac   ///< Dirac approximated by a narrow Gaussian
+};
+
+/**
+ * @brief Parameters of an analytic source time function
+ *
+ * Trivially copyable, so that the source time function can be evaluated on
+ * the device at every time step instead of being tabulated for every step.
+ */
+struct analytic_parameters {
+  analytic_type type = analytic_type::none; ///< Type of source time function
+  type_real f0 = 0.0;                       ///< Dominant frequency
+  type_real tshift = 0.0;                   ///< Time shift
+  type_real factor = 0.0;                   ///< Scaling factor
+  bool use_trick_for_better_pressure = false; ///< Use a higher order
+                                              ///< derivative of the Gaussian
+
+  /**
+   * @brief Compute the value of the source time function at time t
+   *
+   * @param t Time
+   * @return type_real Value of the source time function (0 if the source
+   * time function has no closed form)
+   */
+  KOKKOS_INLINE_FUNCTION type_real compute(const type_real t) const {
+    switch (type) {
+    case analytic_type::ricker:
+      return use_trick_for_better_pressure
+                 ? -1.0 * factor * impl::d4gaussian(t - tshift, f0)
+                 : -1.0 * factor * impl::d2gaussian(t - tshift, f0);
+    case analytic_type::dirac:
+      return use_trick_for_better_pressure
+                 ? -1.0 * factor * impl::d2gaussian(t - tshift, f0)
+                 : -1.0 * factor * impl::gaussian(t - tshift, f0);
+    default:
+      return 0.0;
+    }
+  }
+};
+
 /**
  * @brief Source time function base class
  *
@@ -42,12 +90,34 @@ public:
 
   virtual std::string print() const = 0;
 
+  /**
+   * @brief Get the parameters needed to evaluate the source time function on
+   * the device
+   *
+   * @return analytic_parameters Parameters of the source time function. The
+   * type is @c analytic_type::none if the source time function has to be
+   * tabulated using compute_source_time_function
+   */
+  virtual analytic_parameters get_analytic_parameters() const { return {}; }
+
   // virtual void print(std::ostream &out) const;
 
   virtual ~stf() = default;
 
+  /**
+   * @brief Tabulate the source time function for a range of time steps
+   *
+   * @param t0 Initial time
+   * @param dt Time step
+   * @param first_step First time step of the range
+   * @param nsteps Number of time steps in the range
+   * @param source_time_function Values of the source time function at time
+   * steps @p first_step to @p first_step + @p nsteps - 1 (nsteps x
+   * ncomponents)
+   */
   virtual void compute_source_time_function(
-      const type_real t0, const type_real dt, const int nsteps,
+      const type_real t0, const type_real dt, const int first_step,
+      const int nsteps,
       specfem::kokkos::HostView2d<type_real> source_time_function) = 0;
 };
 
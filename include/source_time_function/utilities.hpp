@@ -1,7 +1,14 @@
+#ifndef _SOURCE_TIME_FUNCTION_UTILITIES_HPP
+#define _SOURCE_TIME_FUNCTION_UTILITIES_HPP
+
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
 #include <cmath>
 
+namespace specfem {
+namespace forcing_function {
+namespace impl {
+
 KOKKOS_INLINE_FUNCTION
 type_real gaussian(const type_real t, const type_real f0) {
   // Gaussian wavelet i.e. second integral of a Ricker wavelet
@@ -35,3 +42,9 @@ type_real d4gaussian(const type_real t, const type_real f0) {
 
   return d4gaussian;
 }
+
+} // namespace impl
+} // namespace forcing_function
+} // namespace specfem
+
+#endif
@@ -75,6 +75,16 @@ public:
    * @return int rank of the main proc
    */
   int get_main() const { return 0; }
+#ifdef MPI_PARALLEL
+  /**
+   * @brief Get the MPI communicator
+   *
+   * Used for point-to-point communication that is not wrapped by this class
+   *
+   * @return MPI_Comm MPI communicator
+   */
+  MPI_Comm get_comm() const { return this->comm; }
+#endif
   /**
    * @brief MPI_Abort
    *
@@ -3,7 +3,21 @@
 
 #include <Kokkos_Core.hpp>
 
+// Precision is selected at configure time with SPECFEM_PRECISION.
+//  - type_real: precision of geometry, material properties and element
+//    (stiffness) evaluations
+//  - type_field: precision in which wavefields and misfit kernels are stored
+//    and accumulated
+#if defined(SPECFEM_DOUBLE_PRECISION)
+using type_real = double;
+using type_field = double;
+#elif defined(SPECFEM_MIXED_PRECISION)
 using type_real = float;
+using type_field = double;
+#else
+using type_real = float;
+using type_field = float;
+#endif
 const static int ndim{ 2 };
 const static int fint{ 4 }, fdouble{ 8 }, fbool{ 4 }, fchar{ 512 };
 const static bool use_best_location{ true };
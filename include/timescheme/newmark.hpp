@@ -4,10 +4,42 @@
 #include "enumerations/wavefield.hpp"
 #include "specfem_setup.hpp"
 #include "timescheme.hpp"
+#include <cstddef>
+#include <ostream>
 
 namespace specfem {
 namespace time_scheme {
 
+namespace impl {
+/**
+ * @brief Memory traffic of a point-wise update kernel accumulated over the
+ * time loop
+ *
+ * Kernels are timed by the instrumentation registry when it is enabled.
+ */
+struct kernel_traffic {
+  int calls = 0;         ///< Number of launches
+  std::size_t bytes = 0; ///< Bytes read and written by all launches
+};
+
+/**
+ * @brief Memory traffic of the Newmark update kernels
+ *
+ */
+struct newmark_traffic {
+  kernel_traffic predictor; ///< Predictor phase
+  kernel_traffic corrector; ///< Corrector phase
+  kernel_traffic divide;    ///< Division by the mass matrix (launched by the
+                            ///< domain, estimated from the corrector phase)
+  kernel_traffic fused;     ///< Fused division by the mass matrix, corrector
+                            ///< and predictor phases
+  kernel_traffic reset;     ///< Reset of the acceleration after a fused
+                            ///< predictor phase
+  std::size_t unfused_bytes = 0; ///< Bytes that would have been moved without
+                                 ///< fused updates
+};
+} // namespace impl
+
 /**
  * @brief Newmark Time Scheme
  *
@@ -46,11 +78,13 @@ public:
    * samples
    * @param dt Time increment
    * @param t0 Initial time
+   * @param fused_update Use fused update kernels within the time loop
    */
   newmark(const int nstep, const int nstep_between_samples, const type_real dt,
-          const type_real t0)
-      : time_scheme(nstep, nstep_between_samples, dt), deltat(dt),
-        deltatover2(dt / 2.0), deltasquareover2(dt * dt / 2.0), t0(t0) {}
+          const type_real t0, const bool fused_update = false)
+      : time_scheme(nstep, nstep_between_samples, dt, fused_update),
+        deltat(dt), deltatover2(dt / 2.0), deltasquareover2(dt * dt / 2.0),
+        t0(t0) {}
 
   ///@}
 
@@ -77,6 +111,17 @@ public:
   void apply_corrector_phase_forward(
       const specfem::element::medium_tag tag) override;
 
+  /**
+   * @brief Divide the acceleration by the mass matrix and apply the corrector
+   * phase (and optionally the predictor phase of the next time step) for
+   * forward simulation in a single sweep
+   *
+   * @param tag Medium tag for elements to apply the update
+   * @param predict Apply the predictor phase of the next time step
+   */
+  void apply_fused_update_forward(const specfem::element::medium_tag tag,
+                                  const bool predict) override;
+
   /**
    * @brief Apply the predictor phase for backward simulation on fields within
    * the elements within a medium. (Empty implementation)
@@ -115,11 +160,23 @@ public:
    */
   type_real get_timestep() const override { return this->deltat; }
 
+  /**
+   * @brief Print memory traffic, time and bandwidth of the update kernels
+   *
+   * @param out Output stream
+   */
+  void print_update_traffic(std::ostream &out) const override;
+
 private:
   type_real t0;     ///< Initial time
   type_real deltat; ///< Time increment
   type_real deltatover2;
   type_real deltasquareover2;
+  bool acoustic_predicted = false; ///< Predictor phase of the acoustic
+                                   ///< wavefield applied by a fused update
+  bool elastic_predicted = false;  ///< Predictor phase of the elastic
+                                   ///< wavefield applied by a fused update
+  impl::newmark_traffic traffic;   ///< Traffic of the update kernels
   specfem::compute::simulation_field<specfem::wavefield::type::forward>
       field; ///< forward wavefield
 };
@@ -155,11 +212,13 @@ public:
    * samples
    * @param dt Time increment
    * @param t0 Initial time
+   * @param fused_update Use fused update kernels within the time loop
    */
   newmark(const int nstep, const int nstep_between_samples, const type_real dt,
-          const type_real t0)
-      : time_scheme(nstep, nstep_between_samples, dt), deltat(dt),
-        deltatover2(dt / 2.0), deltasquareover2(dt * dt / 2.0), t0(t0) {}
+          const type_real t0, const bool fused_update = false)
+      : time_scheme(nstep, nstep_between_samples, dt, fused_update),
+        deltat(dt), deltatover2(dt / 2.0), deltasquareover2(dt * dt / 2.0),
+        t0(t0) {}
 
   ///@}
 
@@ -186,6 +245,17 @@ public:
   void apply_corrector_phase_forward(
       const specfem::element::medium_tag tag) override;
 
+  /**
+   * @brief Divide the acceleration by the mass matrix and apply the corrector
+   * phase (and optionally the predictor phase of the next time step) for
+   * forward simulation in a single sweep
+   *
+   * @param tag Medium tag for elements to apply the update
+   * @param predict Apply the predictor phase of the next time step
+   */
+  void apply_fused_update_forward(const specfem::element::medium_tag tag,
+                                  const bool predict) override;
+
   /**
    * @brief Apply the predictor phase for backward simulation on fields within
    * the elements within a medium.
@@ -225,11 +295,23 @@ public:
    */
   type_real get_timestep() const override { return this->deltat; }
 
+  /**
+   * @brief Print memory traffic, time and bandwidth of the update kernels
+   *
+   * @param out Output stream
+   */
+  void print_update_traffic(std::ostream &out) const override;
+
 private:
   type_real t0;     ///< Initial time
   type_real deltat; ///< Time increment
   type_real deltatover2;
   type_real deltasquareover2;
+  bool acoustic_predicted = false; ///< Predictor phase of the acoustic
+                                   ///< wavefield applied by a fused update
+  bool elastic_predicted = false;  ///< Predictor phase of the elastic
+                                   ///< wavefield applied by a fused update
+  impl::newmark_traffic traffic;   ///< Traffic of the update kernels
   specfem::compute::simulation_field<specfem::wavefield::type::adjoint>
       adjoint_field; ///< adjoint wavefield
   specfem::compute::simulation_field<specfem::wavefield::type::backward>
@@ -1,9 +1,15 @@
 #ifndef _SPECFEM_TIMESCHEME_NEWMARK_TPP_
 #define _SPECFEM_TIMESCHEME_NEWMARK_TPP_
 
+#include "instrumentation/instrumentation.hpp"
 #include "parallel_configuration/range_config.hpp"
 #include "policies/range.hpp"
 #include "timescheme/newmark.hpp"
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
 
 namespace {
 template <specfem::element::medium_tag MediumType,
@@ -193,6 +199,327 @@ void predictor_phase_impl(
 //         field_dot_dot(iglob, idim) = 0;
 //       });
 // }
+
+template <specfem::element::medium_tag MediumType,
+          specfem::wavefield::type WavefieldType, bool Predict>
+void fused_update_impl(
+    const specfem::compute::simulation_field<WavefieldType> &field,
+    const type_real deltat, const type_real deltatover2,
+    const type_real deltasquareover2) {
+
+  constexpr int components =
+      specfem::medium::medium<specfem::dimension::type::dim2,
+                              MediumType>::components;
+  const int nglob = field.template get_nglob<MediumType>();
+  constexpr bool using_simd = true;
+  using LoadFieldType =
+      specfem::point::field<specfem::dimension::type::dim2, MediumType, false,
+                            Predict, true, true, using_simd>;
+  using AddFieldType =
+      specfem::point::field<specfem::dimension::type::dim2, MediumType,
+                            Predict, true, false, false, using_simd>;
+  using StoreFieldType =
+      specfem::point::field<specfem::dimension::type::dim2, MediumType, false,
+                            false, true, false, using_simd>;
+
+  using ParallelConfig = specfem::parallel_config::default_range_config<
+      specfem::datatype::simd<type_real, using_simd>,
+      Kokkos::DefaultExecutionSpace>;
+
+  using RangePolicyType = specfem::policy::range<ParallelConfig>;
+
+  RangePolicyType range_policy(nglob);
+
+  Kokkos::parallel_for(
+      "specfem::TimeScheme::Newmark::fused_update_impl",
+      static_cast<typename RangePolicyType::policy_type &>(range_policy),
+      KOKKOS_LAMBDA(const int iglob) {
+        const auto iterator = range_policy.range_iterator(iglob);
+        const auto index = iterator(0);
+
+        LoadFieldType load;
+        AddFieldType add;
+        StoreFieldType store;
+
+        specfem::compute::load_on_device(index.index, field, load);
+
+        const auto acceleration = load.divide_mass_matrix();
+
+        // Increments are added rather than stored so that displacement and
+        // velocity accumulate in the storage precision (type_field)
+        for (int idim = 0; idim < components; ++idim) {
+          // Corrector phase of the current time step
+          add.velocity(idim) = deltatover2 * acceleration(idim);
+          store.acceleration(idim) = acceleration(idim);
+
+          // Predictor phase of the next time step. The acceleration is kept
+          // since coupling terms of other media still read it
+          if constexpr (Predict) {
+            add.displacement(idim) =
+                deltat * (load.velocity(idim) + add.velocity(idim)) +
+                deltasquareover2 * acceleration(idim);
+            add.velocity(idim) += deltatover2 * acceleration(idim);
+          }
+        }
+
+        specfem::compute::add_on_device(index.index, add, field);
+        specfem::compute::store_on_device(index.index, store, field);
+      });
+
+  return;
+}
+
+template <specfem::element::medium_tag MediumType,
+          specfem::wavefield::type WavefieldType>
+void reset_acceleration_impl(
+    const specfem::compute::simulation_field<WavefieldType> &field) {
+
+  constexpr int components =
+      specfem::medium::medium<specfem::dimension::type::dim2,
+                              MediumType>::components;
+  const int nglob = field.template get_nglob<MediumType>();
+  constexpr bool using_simd = true;
+  using StoreFieldType =
+      specfem::point::field<specfem::dimension::type::dim2, MediumType, false,
+                            false, true, false, using_simd>;
+
+  using ParallelConfig = specfem::parallel_config::default_range_config<
+      specfem::datatype::simd<type_real, using_simd>,
+      Kokkos::DefaultExecutionSpace>;
+
+  using RangePolicyType = specfem::policy::range<ParallelConfig>;
+
+  RangePolicyType range_policy(nglob);
+
+  Kokkos::parallel_for(
+      "specfem::TimeScheme::Newmark::reset_acceleration_impl",
+      static_cast<typename RangePolicyType::policy_type &>(range_policy),
+      KOKKOS_LAMBDA(const int iglob) {
+        const auto iterator = range_policy.range_iterator(iglob);
+        const auto index = iterator(0);
+
+        StoreFieldType store;
+
+        for (int idim = 0; idim < components; ++idim) {
+          store.acceleration(idim) = 0;
+        }
+
+        specfem::compute::store_on_device(index.index, store, field);
+      });
+
+  return;
+}
+
+// Number of values of a field moved per global point and component by each
+// kernel
+constexpr int predictor_streams = 6; // read u, v, a; write u, v, a
+constexpr int corrector_streams = 3; // read v, a; write v
+constexpr int divide_streams = 3;    // read a, 1/m; write a
+constexpr int fused_streams = 5;     // read v, a, 1/m; write v, a
+constexpr int fused_predictor_streams = 7; // read u, v, a, 1/m; write u, v, a
+constexpr int reset_streams = 1;           // write a
+
+template <specfem::element::medium_tag MediumType,
+          specfem::wavefield::type WavefieldType>
+std::size_t
+stream_size(const specfem::compute::simulation_field<WavefieldType> &field) {
+  constexpr int components =
+      specfem::medium::medium<specfem::dimension::type::dim2,
+                              MediumType>::components;
+  return sizeof(type_field) * components *
+         static_cast<std::size_t>(field.template get_nglob<MediumType>());
+}
+
+// Launch an update kernel and account for its traffic. The kernel is only
+// timed (and fenced) by its region when the instrumentation registry is
+// enabled
+template <specfem::element::medium_tag MediumType,
+          specfem::wavefield::type WavefieldType, typename KernelType>
+void launch(const std::string &phase,
+            specfem::time_scheme::impl::newmark_traffic &traffic,
+            specfem::time_scheme::impl::kernel_traffic &kernel_traffic,
+            const std::size_t bytes, const std::size_t unfused_bytes,
+            const KernelType &kernel) {
+  {
+    specfem::instrumentation::region region(phase, WavefieldType, MediumType,
+                                            bytes);
+    kernel();
+  }
+
+  kernel_traffic.calls++;
+  kernel_traffic.bytes += bytes;
+  traffic.unfused_bytes += unfused_bytes;
+  return;
+}
+
+template <specfem::element::medium_tag MediumType,
+          specfem::wavefield::type WavefieldType>
+void predictor_phase(
+    const specfem::compute::simulation_field<WavefieldType> &field,
+    const type_real deltat, const type_real deltatover2,
+    const type_real deltasquareover2, bool &predicted,
+    specfem::time_scheme::impl::newmark_traffic &traffic) {
+
+  const std::size_t size = stream_size<MediumType>(field);
+
+  // The predictor phase was already applied by the fused update of the
+  // previous time step. Only the acceleration needs to be reset
+  if (predicted) {
+    launch<MediumType, WavefieldType>(
+        "reset_acceleration", traffic, traffic.reset, reset_streams * size,
+        predictor_streams * size, [&]() {
+          reset_acceleration_impl<MediumType, WavefieldType>(field);
+        });
+    predicted = false;
+    return;
+  }
+
+  launch<MediumType, WavefieldType>(
+      "predictor", traffic, traffic.predictor, predictor_streams * size,
+      predictor_streams * size, [&]() {
+        predictor_phase_impl<MediumType, WavefieldType>(
+            field, deltat, deltatover2, deltasquareover2);
+      });
+  return;
+}
+
+template <specfem::element::medium_tag MediumType,
+          specfem::wavefield::type WavefieldType>
+void corrector_phase(
+    const specfem::compute::simulation_field<WavefieldType> &field,
+    const type_real deltatover2,
+    specfem::time_scheme::impl::newmark_traffic &traffic) {
+
+  const std::size_t size = stream_size<MediumType>(field);
+
+  launch<MediumType, WavefieldType>(
+      "corrector", traffic, traffic.corrector, corrector_streams * size,
+      corrector_streams * size, [&]() {
+        corrector_phase_impl<MediumType, WavefieldType>(field, deltatover2);
+      });
+
+  // The domain divides the acceleration by the mass matrix before every
+  // corrector phase
+  traffic.divide.calls++;
+  traffic.divide.bytes += divide_streams * size;
+  traffic.unfused_bytes += divide_streams * size;
+  return;
+}
+
+template <specfem::element::medium_tag MediumType,
+          specfem::wavefield::type WavefieldType>
+void fused_update_phase(
+    const specfem::compute::simulation_field<WavefieldType> &field,
+    const type_real deltat, const type_real deltatover2,
+    const type_real deltasquareover2, const bool predict, bool &predicted,
+    specfem::time_scheme::impl::newmark_traffic &traffic) {
+
+  const std::size_t size = stream_size<MediumType>(field);
+  constexpr std::size_t unfused_streams = divide_streams + corrector_streams;
+
+  if (predict) {
+    launch<MediumType, WavefieldType>(
+        "fused_update", traffic, traffic.fused,
+        fused_predictor_streams * size, unfused_streams * size, [&]() {
+          fused_update_impl<MediumType, WavefieldType, true>(
+              field, deltat, deltatover2, deltasquareover2);
+        });
+    predicted = true;
+  } else {
+    launch<MediumType, WavefieldType>(
+        "fused_update", traffic, traffic.fused, fused_streams * size,
+        unfused_streams * size, [&]() {
+          fused_update_impl<MediumType, WavefieldType, false>(
+              field, deltat, deltatover2, deltasquareover2);
+        });
+  }
+
+  return;
+}
+
+// Time spent in a phase by the wavefields updated by a time scheme, as
+// recorded by the instrumentation registry. 0 if the registry is disabled
+double
+phase_time(const std::string &phase,
+           const std::vector<specfem::wavefield::type> &wavefields) {
+  double time = 0.0;
+  for (const auto &timer :
+       specfem::instrumentation::registry::get().get_timers()) {
+    if (timer.phase != phase)
+      continue;
+    for (const auto wavefield : wavefields) {
+      if (timer.wavefield == specfem::instrumentation::to_string(wavefield))
+        time += timer.time;
+    }
+  }
+  return time;
+}
+
+void print_traffic(std::ostream &out,
+                   const specfem::time_scheme::impl::newmark_traffic &traffic,
+                   const std::vector<specfem::wavefield::type> &wavefields) {
+  const auto print_kernel =
+      [&out, &wavefields](
+          const std::string &name,
+          const specfem::time_scheme::impl::kernel_traffic &kernel) {
+        if (kernel.calls == 0)
+          return;
+
+        const double time = phase_time(name, wavefields);
+
+        out << "  " << std::left << std::setw(20) << name << std::right
+            << std::setw(8) << kernel.calls << std::setw(14) << std::fixed
+            << std::setprecision(3) << kernel.bytes / 1e9;
+        if (time > 0.0) {
+          out << std::setw(12) << time << std::setw(18)
+              << kernel.bytes / 1e9 / time;
+        } else {
+          out << std::setw(12) << "-" << std::setw(18) << "-";
+        }
+        out << "\n";
+      };
+
+  const std::size_t total = traffic.predictor.bytes + traffic.corrector.bytes +
+                            traffic.divide.bytes + traffic.fused.bytes +
+                            traffic.reset.bytes;
+
+  const auto flags = out.flags();
+  const auto precision = out.precision();
+
+  out << "Newmark update kernels:\n"
+      << "------------------------------\n"
+      << "  " << std::left << std::setw(20) << "Kernel" << std::right
+      << std::setw(8) << "Calls" << std::setw(14) << "Traffic (GB)"
+      << std::setw(12) << "Time (s)" << std::setw(18) << "Bandwidth (GB/s)"
+      << "\n";
+
+  print_kernel("predictor", traffic.predictor);
+  print_kernel("divide_mass_matrix", traffic.divide);
+  print_kernel("corrector", traffic.corrector);
+  print_kernel("fused_update", traffic.fused);
+  print_kernel("reset_acceleration", traffic.reset);
+
+  out << "  Total traffic            : " << std::fixed << std::setprecision(3)
+      << total / 1e9 << " GB\n"
+      << "  Traffic without fusion   : " << traffic.unfused_bytes / 1e9
+      << " GB\n";
+
+  if (traffic.unfused_bytes > 0) {
+    out << "  Traffic saved            : " << std::setprecision(1)
+        << 100.0 * (1.0 - static_cast<double>(total) / traffic.unfused_bytes)
+        << " %\n";
+  }
+
+  out << "  divide_mass_matrix is launched by the domain. Its traffic is "
+         "estimated\n";
+  if (!specfem::instrumentation::registry::get().is_enabled()) {
+    out << "  Kernels are only timed when profiling is enabled\n";
+  }
+
+  out.flags(flags);
+  out.precision(precision);
+  return;
+}
 } // namespace
 
 void specfem::time_scheme::newmark<specfem::simulation::type::forward>::
@@ -203,9 +530,9 @@ void specfem::time_scheme::newmark<specfem::simulation::type::forward>::
   constexpr auto acoustic = specfem::element::medium_tag::acoustic;
 
   if (tag == elastic) {
-    corrector_phase_impl<elastic, wavefield>(field, deltatover2);
+    corrector_phase<elastic, wavefield>(field, deltatover2, traffic);
   } else if (tag == acoustic) {
-    corrector_phase_impl<acoustic, wavefield>(field, deltatover2);
+    corrector_phase<acoustic, wavefield>(field, deltatover2, traffic);
   } else {
     static_assert("medium type not supported");
   }
@@ -221,11 +548,35 @@ void specfem::time_scheme::newmark<specfem::simulation::type::forward>::
   constexpr auto acoustic = specfem::element::medium_tag::acoustic;
 
   if (tag == elastic) {
-    predictor_phase_impl<elastic, wavefield>(field, deltat, deltatover2,
-                                             deltasquareover2);
+    predictor_phase<elastic, wavefield>(field, deltat, deltatover2,
+                                        deltasquareover2, elastic_predicted,
+                                        traffic);
+  } else if (tag == acoustic) {
+    predictor_phase<acoustic, wavefield>(field, deltat, deltatover2,
+                                         deltasquareover2, acoustic_predicted,
+                                         traffic);
+  } else {
+    static_assert("medium type not supported");
+  }
+  return;
+}
+
+void specfem::time_scheme::newmark<specfem::simulation::type::forward>::
+    apply_fused_update_forward(const specfem::element::medium_tag tag,
+                               const bool predict) {
+
+  constexpr auto wavefield = specfem::wavefield::type::forward;
+  constexpr auto elastic = specfem::element::medium_tag::elastic;
+  constexpr auto acoustic = specfem::element::medium_tag::acoustic;
+
+  if (tag == elastic) {
+    fused_update_phase<elastic, wavefield>(field, deltat, deltatover2,
+                                           deltasquareover2, predict,
+                                           elastic_predicted, traffic);
   } else if (tag == acoustic) {
-    predictor_phase_impl<acoustic, wavefield>(field, deltat, deltatover2,
-                                              deltasquareover2);
+    fused_update_phase<acoustic, wavefield>(field, deltat, deltatover2,
+                                            deltasquareover2, predict,
+                                            acoustic_predicted, traffic);
   } else {
     static_assert("medium type not supported");
   }
@@ -239,9 +590,9 @@ void specfem::time_scheme::newmark<specfem::simulation::type::combined>::
   constexpr auto acoustic = specfem::element::medium_tag::acoustic;
 
   if (tag == elastic) {
-    corrector_phase_impl<elastic, wavefield>(adjoint_field, deltatover2);
+    corrector_phase<elastic, wavefield>(adjoint_field, deltatover2, traffic);
   } else if (tag == acoustic) {
-    corrector_phase_impl<acoustic, wavefield>(adjoint_field, deltatover2);
+    corrector_phase<acoustic, wavefield>(adjoint_field, deltatover2, traffic);
   } else {
     static_assert("medium type not supported");
   }
@@ -256,11 +607,11 @@ void specfem::time_scheme::newmark<specfem::simulation::type::combined>::
   constexpr auto acoustic = specfem::element::medium_tag::acoustic;
 
   if (tag == elastic) {
-    corrector_phase_impl<elastic, wavefield>(backward_field,
-                                             -1.0 * deltatover2);
+    corrector_phase<elastic, wavefield>(backward_field, -1.0 * deltatover2,
+                                        traffic);
   } else if (tag == acoustic) {
-    corrector_phase_impl<acoustic, wavefield>(backward_field,
-                                              -1.0 * deltatover2);
+    corrector_phase<acoustic, wavefield>(backward_field, -1.0 * deltatover2,
+                                         traffic);
   } else {
     static_assert("medium type not supported");
   }
@@ -276,11 +627,13 @@ void specfem::time_scheme::newmark<specfem::simulation::type::combined>::
   constexpr auto acoustic = specfem::element::medium_tag::acoustic;
 
   if (tag == elastic) {
-    predictor_phase_impl<elastic, wavefield>(adjoint_field, deltat, deltatover2,
-                                             deltasquareover2);
+    predictor_phase<elastic, wavefield>(adjoint_field, deltat, deltatover2,
+                                        deltasquareover2, elastic_predicted,
+                                        traffic);
   } else if (tag == acoustic) {
-    predictor_phase_impl<acoustic, wavefield>(adjoint_field, deltat,
-                                              deltatover2, deltasquareover2);
+    predictor_phase<acoustic, wavefield>(adjoint_field, deltat, deltatover2,
+                                         deltasquareover2, acoustic_predicted,
+                                         traffic);
   } else {
     static_assert("medium type not supported");
   }
@@ -293,18 +646,58 @@ void specfem::time_scheme::newmark<specfem::simulation::type::combined>::
   constexpr auto elastic = specfem::element::medium_tag::elastic;
   constexpr auto acoustic = specfem::element::medium_tag::acoustic;
 
+  // Fused updates are not applied to the backward wavefield
+  bool predicted = false;
+
+  if (tag == elastic) {
+    predictor_phase<elastic, wavefield>(backward_field, -1.0 * deltat,
+                                        -1.0 * deltatover2, deltasquareover2,
+                                        predicted, traffic);
+  } else if (tag == acoustic) {
+    predictor_phase<acoustic, wavefield>(backward_field, -1.0 * deltat,
+                                         -1.0 * deltatover2, deltasquareover2,
+                                         predicted, traffic);
+  } else {
+    static_assert("medium type not supported");
+  }
+  return;
+}
+
+void specfem::time_scheme::newmark<specfem::simulation::type::combined>::
+    apply_fused_update_forward(const specfem::element::medium_tag tag,
+                               const bool predict) {
+
+  constexpr auto wavefield = specfem::wavefield::type::adjoint;
+  constexpr auto elastic = specfem::element::medium_tag::elastic;
+  constexpr auto acoustic = specfem::element::medium_tag::acoustic;
+
   if (tag == elastic) {
-    predictor_phase_impl<elastic, wavefield>(
-        backward_field, -1.0 * deltat, -1.0 * deltatover2, deltasquareover2);
+    fused_update_phase<elastic, wavefield>(adjoint_field, deltat,
+                                           deltatover2, deltasquareover2,
+                                           predict, elastic_predicted, traffic);
   } else if (tag == acoustic) {
-    predictor_phase_impl<acoustic, wavefield>(
-        backward_field, -1.0 * deltat, -1.0 * deltatover2, deltasquareover2);
+    fused_update_phase<acoustic, wavefield>(adjoint_field, deltat,
+                                            deltatover2, deltasquareover2,
+                                            predict, acoustic_predicted,
+                                            traffic);
   } else {
     static_assert("medium type not supported");
   }
   return;
 }
 
+void specfem::time_scheme::newmark<specfem::simulation::type::forward>::
+    print_update_traffic(std::ostream &out) const {
+  print_traffic(out, traffic, { specfem::wavefield::type::forward });
+}
+
+void specfem::time_scheme::newmark<specfem::simulation::type::combined>::
+    print_update_traffic(std::ostream &out) const {
+  print_traffic(out, traffic,
+                { specfem::wavefield::type::adjoint,
+                  specfem::wavefield::type::backward });
+}
+
 void specfem::time_scheme::newmark<specfem::simulation::type::forward>::print(
     std::ostream &message) const {
   message << "  Time Scheme:\n"
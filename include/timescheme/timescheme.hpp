@@ -96,11 +96,12 @@ public:
    * @param nstep Number of timesteps
    * @param nstep_between_samples Number of timesteps between seismogram samples
    * @param dt Time step
+   * @param fused_update Use fused update kernels within the time loop
    */
   time_scheme(const int nstep, const int nstep_between_samples,
-              const type_real dt)
+              const type_real dt, const bool fused_update = false)
       : nstep(nstep), nstep_between_samples(nstep_between_samples),
-        seismogram_timestep(0), dt(dt) {}
+        seismogram_timestep(0), dt(dt), fused_update(fused_update) {}
   ///@}
 
   /**
@@ -182,6 +183,39 @@ public:
   virtual void
   apply_corrector_phase_backward(const specfem::element::medium_tag tag) = 0;
 
+  /**
+   * @brief Divide the acceleration by the mass matrix and apply the corrector
+   * phase for forward simulation in a single sweep over the global points of
+   * a medium
+   *
+   * Replaces @c divide_mass_matrix followed by @ref
+   * apply_corrector_phase_forward. If @p predict is true, the predictor phase
+   * of the next time step is applied within the same sweep. The wavefield then
+   * no longer holds the state of the current time step, and the next call to
+   * @ref apply_predictor_phase_forward only resets the acceleration.
+   *
+   * @param tag Medium tag for elements to apply the update
+   * @param predict Apply the predictor phase of the next time step
+   */
+  virtual void
+  apply_fused_update_forward(const specfem::element::medium_tag tag,
+                             const bool predict) = 0;
+
+  /**
+   * @brief Check if fused update kernels are used within the time loop
+   *
+   * @return bool True if fused update kernels are used
+   */
+  bool use_fused_update() const { return fused_update; }
+
+  /**
+   * @brief Print memory traffic, time and bandwidth of the point-wise update
+   * kernels launched during the time loop
+   *
+   * @param out Output stream
+   */
+  virtual void print_update_traffic(std::ostream &out) const = 0;
+
   virtual void link_assembly(const specfem::compute::assembly &assembly) = 0;
 
   virtual specfem::enums::time_scheme::type timescheme() const = 0;
@@ -205,6 +239,7 @@ private:
   int nstep_between_samples; ///< Number of timesteps between seismogram output
                              ///< samples
   type_real dt;              ///< Time increment
+  bool fused_update;         ///< Use fused update kernels
 };
 
 std::ostream &operator<<(std::ostream &out,
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "IO/async/block_writer.hpp"
+#include "compute/interface.hpp"
+#include "specfem_mpi/interface.hpp"
+#include <memory>
+#include <string>
+
+namespace specfem {
+namespace writer {
+
+/**
+ * @brief Stream boundary values to disk while the forward simulation runs
+ *
+ * Boundary values of a time step are copied to a host buffer after the time
+ * step has been computed and written to a binary file by a background thread.
+ * Only one time step is kept in device memory and at most two are kept in host
+ * memory, independent of the number of time steps in the simulation.
+ */
+class boundary_values_stream {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Create the output file and start the I/O thread
+   *
+   * @param assembly SPECFEM++ assembly
+   * @param output_folder Path to the output folder
+   */
+  boundary_values_stream(const specfem::compute::assembly &assembly,
+                         const std::string &output_folder);
+  ///@}
+
+  /**
+   * @brief Queue the boundary values of a time step for writing
+   *
+   * Must be called after the time step has been computed and before the
+   * boundary values of the next time step are computed.
+   *
+   * @param istep Time step
+   */
+  void write(const int istep);
+
+  /**
+   * @brief Wait until every queued time step has been written and close the
+   * file
+   *
+   */
+  void close();
+
+  /**
+   * @brief Path to the file storing boundary values within a folder
+   *
+   * When running on several MPI ranks, the rank is appended to the filename
+   * (e.g. BoundaryValues.bin.00003)
+   *
+   * @param folder Path to the folder
+   * @param mpi MPI object
+   * @return std::string Path to the file
+   */
+  static std::string filename(const std::string &folder,
+                              const specfem::MPI::MPI *mpi);
+
+private:
+  std::string output_file; ///< Path to output file
+  specfem::compute::boundary_values boundary_values; ///< Boundary values used
+                                                     ///< for backward
+                                                     ///< reconstruction during
+                                                     ///< adjoint simulations
+  std::unique_ptr<specfem::IO::async_block_writer> writer; ///< Background
+                                                           ///< writer
+};
+
+} // namespace writer
+} // namespace specfem
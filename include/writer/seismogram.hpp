@@ -6,6 +6,7 @@
 #include "receiver/interface.hpp"
 #include "specfem_setup.hpp"
 #include "writer.hpp"
+#include <string>
 #include <vector>
 
 namespace specfem {
@@ -42,6 +43,21 @@ public:
    */
   void write() override;
 
+  /**
+   * @brief Paths to the ASCII files of both components of a seismogram
+   *
+   * @param output_folder Path to the output folder
+   * @param network_name Network name of the receiver
+   * @param station_name Station name of the receiver
+   * @param type Type of the seismogram
+   * @return std::vector<std::string> Paths to the files of the X and Z
+   * components
+   */
+  static std::vector<std::string>
+  filenames(const std::string &output_folder, const std::string &network_name,
+            const std::string &station_name,
+            const specfem::enums::seismogram::type type);
+
 private:
   int nreceivers;                          ///< Number of receivers
   specfem::enums::seismogram::format type; ///< Output format of the seismogram
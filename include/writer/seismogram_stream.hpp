@@ -0,0 +1,172 @@
+#pragma once
+
+#include "compute/interface.hpp"
+#include "enumerations/specfem_enums.hpp"
+#include "specfem_mpi/interface.hpp"
+#include "specfem_setup.hpp"
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace specfem {
+namespace writer {
+
+namespace impl {
+class seismogram_file;
+} // namespace impl
+
+/**
+ * @brief Header of binary seismogram files written by @ref seismogram_stream
+ *
+ * The header is followed by the samples of every seismogram step, stored as
+ * little-endian values of type_real in row-major order
+ * <tt>[nsteps][ntypes][nreceivers][ncomponents]</tt>. Receivers are stored in
+ * the order of the stations file.
+ */
+struct seismogram_header {
+  char magic[8];            ///< File signature
+  std::uint32_t version;    ///< Version of the file format
+  std::uint32_t real_size;  ///< Size of a sample in bytes
+  std::int32_t nsteps;      ///< Number of seismogram steps
+  std::int32_t ntypes;      ///< Number of seismogram types
+  std::int32_t nreceivers;  ///< Number of receivers
+  std::int32_t ncomponents; ///< Number of components (X, Z)
+  double dt;                ///< Time between seismogram steps
+  double t0;                ///< Time of the first seismogram step
+  std::int32_t types[3];    ///< Seismogram types (displacement = 0,
+                            ///< velocity = 1, acceleration = 2)
+  std::int32_t padding;     ///< Unused
+
+  constexpr static char signature[8] = { 'S', 'P', 'F', 'M', 'S', 'E', 'I',
+                                         'S' }; ///< Expected file signature
+  constexpr static std::uint32_t current_version = 1; ///< Version written
+};
+
+/**
+ * @brief Stream seismograms to disk while the simulation runs
+ *
+ * Seismograms are computed into a ring buffer of seismogram steps on the
+ * device. Every time the ring buffer is full it is copied to the host and
+ * written to disk by a background thread while the simulation continues.
+ * Device and host memory are bounded by the length of the ring buffer,
+ * independent of the number of time steps. A write only has to complete
+ * before the ring buffer is full again.
+ *
+ * Seismograms are written to a single binary file (@ref seismogram_header)
+ * or to the dataset @c seismograms of an HDF5 file with the same layout. The
+ * per-station ASCII files written by @ref specfem::writer::seismogram can
+ * optionally be exported from the file after the simulation.
+ */
+class seismogram_stream {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Create the output file
+   *
+   * @param receivers Receivers whose seismograms are streamed. The length of
+   * the ring buffer is given by the seismogram view
+   * @param type Format of the output file (binary or hdf5)
+   * @param output_folder Path to the output folder
+   * @param dt Time interval between subsequent timesteps
+   * @param t0 Solver start time
+   * @param nstep_between_samples Number of timesteps between seismogram
+   * samples
+   * @param nsteps Number of seismogram steps in the simulation
+   * @param ascii_export Export per-station ASCII files when the stream is
+   * closed
+   * @param mpi MPI object. Every rank writes the receivers of its partition
+   * to its own file
+   */
+  seismogram_stream(const specfem::compute::receivers &receivers,
+                    const specfem::enums::seismogram::format type,
+                    const std::string &output_folder, const type_real dt,
+                    const type_real t0, const int nstep_between_samples,
+                    const int nsteps, const bool ascii_export = false,
+                    const specfem::MPI::MPI *mpi = nullptr);
+  ///@}
+
+  /**
+   * @brief Wait for pending writes. Errors are only reported by @ref close
+   *
+   */
+  ~seismogram_stream();
+
+  seismogram_stream(const seismogram_stream &) = delete;
+  seismogram_stream &operator=(const seismogram_stream &) = delete;
+
+  /**
+   * @brief Notify the stream that a seismogram step has been computed
+   *
+   * Flushes the ring buffer to disk once it is full or the last seismogram
+   * step has been computed. Must be called for every seismogram step in
+   * order, before the seismogram step that overwrites the same slot of the
+   * ring buffer is computed.
+   *
+   * @param isig_step Seismogram step
+   */
+  void write(const int isig_step);
+
+  /**
+   * @brief Flush the remaining seismogram steps, wait until they have been
+   * written and close the file
+   *
+   * Writes the per-station ASCII files if requested. Throws if any seismogram
+   * step could not be written.
+   */
+  void close();
+
+  /**
+   * @brief Path to the file storing seismograms within a folder
+   *
+   * When running on several MPI ranks, the rank is appended to the filename
+   * (e.g. seismograms.bin.00003)
+   *
+   * @param folder Path to the folder
+   * @param type Format of the file (binary or hdf5)
+   * @param mpi MPI object
+   * @return std::string Path to the file
+   */
+  static std::string filename(const std::string &folder,
+                              const specfem::enums::seismogram::format type,
+                              const specfem::MPI::MPI *mpi = nullptr);
+
+private:
+  /**
+   * @brief Copy the ring buffer to the host and write it in the background
+   *
+   */
+  void flush();
+
+  /**
+   * @brief Write per-station ASCII files from the output file
+   *
+   */
+  void export_ascii();
+
+  specfem::compute::receivers receivers; ///< Receivers whose seismograms are
+                                         ///< streamed
+  specfem::enums::seismogram::format type; ///< Format of the output file
+  std::string output_folder;               ///< Path to output folder
+  type_real dt;      ///< Time interval between subsequent seismogram steps
+  type_real t0;      ///< Solver start time
+  int nsteps;        ///< Number of seismogram steps in the simulation
+  int nbuffer;       ///< Length of the ring buffer
+  bool ascii_export; ///< Export per-station ASCII files
+  const specfem::MPI::MPI *mpi; ///< MPI object
+  int nflushed = 0;  ///< Seismogram steps handed over to the background thread
+  int ncomputed = 0; ///< Seismogram steps computed so far
+  bool closed = false; ///< File has been closed
+
+  std::unique_ptr<impl::seismogram_file> file; ///< Output file
+  std::vector<type_real> buffer; ///< Host copy of the ring buffer
+  std::future<void> pending;     ///< Write running in the background
+};
+
+} // namespace writer
+} // namespace specfem
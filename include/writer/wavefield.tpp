@@ -13,15 +13,17 @@ specfem::writer::wavefield<OutputLibrary>::wavefield(
 template <typename OutputLibrary>
 void specfem::writer::wavefield<OutputLibrary>::write() {
 
+  // Streamed boundary values are written during the time loop
+  const bool write_boundary_values = !boundary_values.is_streamed();
+
   forward.copy_to_host();
-  boundary_values.copy_to_host();
+  if (write_boundary_values)
+    boundary_values.copy_to_host();
 
   typename OutputLibrary::File file(output_folder + "/ForwardWavefield");
 
   typename OutputLibrary::Group elastic = file.createGroup("/Elastic");
   typename OutputLibrary::Group acoustic = file.createGroup("/Acoustic");
-  typename OutputLibrary::Group boundary = file.createGroup("/Boundary");
-  typename OutputLibrary::Group stacey = boundary.createGroup("/Stacey");
 
   elastic.createDataset("Displacement", forward.elastic.h_field).write();
   elastic.createDataset("Velocity", forward.elastic.h_field_dot).write();
@@ -32,18 +34,23 @@ void specfem::writer::wavefield<OutputLibrary>::write() {
   acoustic.createDataset("PotentialDotDot", forward.acoustic.h_field_dot_dot)
       .write();
 
-  stacey
-      .createDataset("IndexMapping",
-                     boundary_values.stacey.h_property_index_mapping)
-      .write();
-  stacey
-      .createDataset("ElasticAcceleration",
-                     boundary_values.stacey.elastic.h_values)
-      .write();
-  stacey
-      .createDataset("AcousticAcceleration",
-                     boundary_values.stacey.acoustic.h_values)
-      .write();
+  if (write_boundary_values) {
+    typename OutputLibrary::Group boundary = file.createGroup("/Boundary");
+    typename OutputLibrary::Group stacey = boundary.createGroup("/Stacey");
+
+    stacey
+        .createDataset("IndexMapping",
+                       boundary_values.stacey.h_property_index_mapping)
+        .write();
+    stacey
+        .createDataset("ElasticAcceleration",
+                       boundary_values.stacey.elastic.h_values)
+        .write();
+    stacey
+        .createDataset("AcousticAcceleration",
+                       boundary_values.stacey.acoustic.h_values)
+        .write();
+  }
 
   std::cout << "Wavefield written to " << output_folder + "/ForwardWavefield"
             << std::endl;
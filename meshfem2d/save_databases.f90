@@ -48,7 +48,13 @@ subroutine save_databases()
    do iproc = 0, NPROC-1
 
       ! filename
-      prname = database_filename
+      ! note: partitioned meshes are written to one database per slice, with the slice
+      !       number appended to the database filename (e.g. database.bin.00003)
+      if (NPROC > 1) then
+         write(prname,'(a,a,i5.5)') trim(database_filename),'.',iproc
+      else
+         prname = database_filename
+      endif
 
       ! user output
       if (myrank == 0) then
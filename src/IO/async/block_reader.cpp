@@ -0,0 +1,160 @@
+#include "IO/async/block_reader.hpp"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+specfem::IO::async_block_reader::async_block_reader(
+    const std::string &filename, const std::size_t block_size,
+    const std::vector<int> &order, const int nbuffers)
+    : filename(filename), block_size(block_size), order(order) {
+
+  if (nbuffers < 2) {
+    std::ostringstream message;
+    message << "Error creating asynchronous reader for " << filename << ". \n"
+            << "At least 2 buffers are required. Got " << nbuffers;
+    throw std::runtime_error(message.str());
+  }
+
+  file = std::fopen(filename.c_str(), "rb");
+  if (file == nullptr) {
+    std::ostringstream message;
+    message << "Error creating asynchronous reader. \n"
+            << "Could not open " << filename << " for reading.";
+    throw std::runtime_error(message.str());
+  }
+
+  const auto fail = [&](const std::string &reason) {
+    std::fclose(file);
+    std::ostringstream message;
+    message << "Error reading " << filename << ". \n" << reason;
+    throw std::runtime_error(message.str());
+  };
+
+  async_block_header header;
+  if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+      !std::equal(header.magic, header.magic + 8,
+                  async_block_header::signature)) {
+    fail("File was not written by an asynchronous block writer.");
+  }
+
+  if (header.block_size != block_size) {
+    std::ostringstream reason;
+    reason << "Block size in file (" << header.block_size
+           << " bytes) does not match the expected block size (" << block_size
+           << " bytes).";
+    fail(reason.str());
+  }
+
+  nblocks = static_cast<int>(header.nblocks);
+
+  std::fseek(file, 0, SEEK_END);
+  const long file_size = std::ftell(file);
+  if (file_size < 0 ||
+      static_cast<std::size_t>(file_size) <
+          sizeof(header) + static_cast<std::size_t>(nblocks) * block_size) {
+    fail("File is truncated.");
+  }
+
+  for (const int iblock : order) {
+    if (iblock < 0 || iblock >= nblocks) {
+      std::ostringstream reason;
+      reason << "Block " << iblock << " requested but the file contains "
+             << nblocks << " blocks.";
+      fail(reason.str());
+    }
+  }
+
+  buffers.resize(nbuffers, std::vector<char>(block_size));
+  for (int ibuffer = 0; ibuffer < nbuffers; ++ibuffer) {
+    free_buffers.push_back(ibuffer);
+  }
+
+  thread = std::thread(&async_block_reader::run, this);
+}
+
+specfem::IO::async_block_reader::~async_block_reader() { this->stop(); }
+
+void specfem::IO::async_block_reader::run() {
+  for (const int iblock : order) {
+    int ibuffer;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock,
+                     [this] { return !free_buffers.empty() || stopping; });
+
+      if (stopping)
+        return;
+
+      ibuffer = free_buffers.front();
+      free_buffers.pop_front();
+    }
+
+    const long offset = static_cast<long>(
+        sizeof(async_block_header) +
+        static_cast<std::size_t>(iblock) * block_size);
+
+    const bool success =
+        (std::fseek(file, offset, SEEK_SET) == 0) &&
+        (std::fread(buffers[ibuffer].data(), 1, block_size, file) ==
+         block_size);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!success) {
+        std::ostringstream message;
+        message << "Error reading block " << iblock << " from " << filename;
+        error = std::make_exception_ptr(std::runtime_error(message.str()));
+        condition.notify_all();
+        return;
+      }
+      ready.push_back(ibuffer);
+    }
+
+    condition.notify_all();
+  }
+}
+
+const char *specfem::IO::async_block_reader::next() {
+  std::unique_lock<std::mutex> lock(mutex);
+
+  if (current >= 0) {
+    free_buffers.push_back(current);
+    current = -1;
+    condition.notify_all();
+  }
+
+  if (consumed >= order.size()) {
+    std::ostringstream message;
+    message << "Error reading " << filename << ". \n"
+            << "All " << order.size() << " blocks have been consumed.";
+    throw std::runtime_error(message.str());
+  }
+
+  condition.wait(lock, [this] { return !ready.empty() || error; });
+
+  if (ready.empty()) {
+    std::rethrow_exception(error);
+  }
+
+  current = ready.front();
+  ready.pop_front();
+  consumed++;
+
+  return buffers[current].data();
+}
+
+void specfem::IO::async_block_reader::stop() {
+  if (!thread.joinable())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+
+  condition.notify_all();
+  thread.join();
+  std::fclose(file);
+
+  return;
+}
@@ -0,0 +1,166 @@
+#include "IO/async/block_writer.hpp"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+constexpr char specfem::IO::async_block_header::signature[8];
+
+specfem::IO::async_block_writer::async_block_writer(
+    const std::string &filename, const std::size_t block_size,
+    const int nblocks, const int nbuffers)
+    : filename(filename), block_size(block_size), nblocks(nblocks) {
+
+  if (nblocks < 0 || nbuffers < 2) {
+    std::ostringstream message;
+    message << "Error creating asynchronous writer for " << filename << ". \n"
+            << "Invalid number of blocks (" << nblocks << ") or buffers ("
+            << nbuffers << "). At least 2 buffers are required.";
+    throw std::runtime_error(message.str());
+  }
+
+  file = std::fopen(filename.c_str(), "wb");
+  if (file == nullptr) {
+    std::ostringstream message;
+    message << "Error creating asynchronous writer. \n"
+            << "Could not open " << filename << " for writing.";
+    throw std::runtime_error(message.str());
+  }
+
+  async_block_header header;
+  std::copy(async_block_header::signature, async_block_header::signature + 8,
+            header.magic);
+  header.block_size = block_size;
+  header.nblocks = nblocks;
+
+  if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+    std::fclose(file);
+    std::ostringstream message;
+    message << "Error creating asynchronous writer. \n"
+            << "Could not write header to " << filename;
+    throw std::runtime_error(message.str());
+  }
+
+  buffers.resize(nbuffers, std::vector<char>(block_size));
+  for (int ibuffer = 0; ibuffer < nbuffers; ++ibuffer) {
+    free_buffers.push_back(ibuffer);
+  }
+
+  thread = std::thread(&async_block_writer::run, this);
+}
+
+specfem::IO::async_block_writer::~async_block_writer() {
+  try {
+    this->close();
+  } catch (...) {
+  }
+}
+
+char *specfem::IO::async_block_writer::acquire() {
+  std::unique_lock<std::mutex> lock(mutex);
+
+  if (closing || acquired >= 0) {
+    throw std::runtime_error(
+        "Error acquiring buffer. Writer is closed or the previously acquired "
+        "buffer has not been submitted");
+  }
+
+  condition.wait(lock, [this] { return !free_buffers.empty() || error; });
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  acquired = free_buffers.front();
+  free_buffers.pop_front();
+
+  return buffers[acquired].data();
+}
+
+void specfem::IO::async_block_writer::submit(const int iblock) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (acquired < 0) {
+      throw std::runtime_error(
+          "Error submitting block. No buffer has been acquired");
+    }
+
+    if (iblock < 0 || iblock >= nblocks) {
+      std::ostringstream message;
+      message << "Error submitting block " << iblock << " to " << filename
+              << ". \n"
+              << "Block index must be in [0, " << nblocks << ")";
+      throw std::runtime_error(message.str());
+    }
+
+    pending.emplace_back(acquired, iblock);
+    acquired = -1;
+  }
+
+  condition.notify_all();
+}
+
+void specfem::IO::async_block_writer::run() {
+  while (true) {
+    std::pair<int, int> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [this] { return !pending.empty() || closing; });
+
+      if (pending.empty())
+        return;
+
+      job = pending.front();
+      pending.pop_front();
+    }
+
+    const auto [ibuffer, iblock] = job;
+    const long offset = static_cast<long>(
+        sizeof(async_block_header) +
+        static_cast<std::size_t>(iblock) * block_size);
+
+    const bool success =
+        (std::fseek(file, offset, SEEK_SET) == 0) &&
+        (std::fwrite(buffers[ibuffer].data(), 1, block_size, file) ==
+         block_size);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!success && !error) {
+        std::ostringstream message;
+        message << "Error writing block " << iblock << " to " << filename;
+        error = std::make_exception_ptr(std::runtime_error(message.str()));
+      }
+      free_buffers.push_back(ibuffer);
+    }
+
+    condition.notify_all();
+  }
+}
+
+void specfem::IO::async_block_writer::close() {
+  if (closed)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    closing = true;
+  }
+
+  condition.notify_all();
+  thread.join();
+
+  if (std::fclose(file) != 0 && !error) {
+    std::ostringstream message;
+    message << "Error closing " << filename;
+    error = std::make_exception_ptr(std::runtime_error(message.str()));
+  }
+
+  closed = true;
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  return;
+}
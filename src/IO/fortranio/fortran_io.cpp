@@ -1,4 +1,5 @@
 #include "IO/fortranio/fortran_io.hpp"
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <fstream>
 #include <iostream>
@@ -15,15 +16,12 @@ void specfem::IO::fortran_read_value(bool *value, std::ifstream &stream,
                                      int &buffer_length) {
 
   buffer_length -= fbool;
-  char *ivalue = new char[fbool];
   if (buffer_length < 0) {
     throw std::runtime_error("Error reading fortran file");
   }
-  stream.read(ivalue, fbool);
-
-  *value = *reinterpret_cast<bool *>(ivalue);
-
-  delete[] ivalue;
+  int ivalue;
+  stream.read(reinterpret_cast<char *>(&ivalue), fbool);
+  *value = (ivalue != 0);
   return;
 }
 
@@ -31,37 +29,29 @@ void specfem::IO::fortran_read_value(int *value, std::ifstream &stream,
                                      int &buffer_length) {
 
   buffer_length -= fint;
-  char *ivalue = new char[fint];
   if (buffer_length < 0) {
     throw std::runtime_error("Error reading fortran file");
   }
-  stream.read(ivalue, fint);
-  *value = *reinterpret_cast<int *>(ivalue);
-  delete[] ivalue;
+  stream.read(reinterpret_cast<char *>(value), fint);
   return;
 }
 
 void specfem::IO::fortran_read_value(type_real *value, std::ifstream &stream,
                                      int &buffer_length) {
 
-  double *temp;
   buffer_length -= fdouble;
-  char *ivalue = new char[fdouble];
   if (buffer_length < 0) {
-    std::cout << "buffer_length: " << buffer_length << std::endl;
     throw std::runtime_error("Error reading fortran file");
   }
-  stream.read(ivalue, fdouble);
-  temp = reinterpret_cast<double *>(ivalue);
-  *value = static_cast<type_real>(*temp);
-  delete[] ivalue;
+  double temp;
+  stream.read(reinterpret_cast<char *>(&temp), fdouble);
+  *value = static_cast<type_real>(temp);
   return;
 }
 
 void specfem::IO::fortran_read_value(std::string *value, std::ifstream &stream,
                                      int &buffer_length) {
-  // reading a string has few errors. There seem to unknown characters at the
-  // end of the string
+  // Fortran strings are padded with blanks and are not null terminated
   char temp[fchar];
   value->clear();
   buffer_length -= fchar;
@@ -69,7 +59,7 @@ void specfem::IO::fortran_read_value(std::string *value, std::ifstream &stream,
     throw std::runtime_error("Error reading fortran file");
   }
   stream.read(reinterpret_cast<char *>(&temp), fchar);
-  value->append(temp);
+  value->append(temp, std::find(temp, temp + fchar, '\0'));
   boost::algorithm::trim(*value);
   return;
 }
@@ -0,0 +1,99 @@
+#include "IO/fortranio/fortran_reader.hpp"
+#include <cstring>
+#include <fcntl.h>
+#include <sstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+specfem::IO::fortran_reader::fortran_reader(const std::string &filename)
+    : filename(filename) {
+
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    std::ostringstream message;
+    message << "Could not open " << filename << " for reading.";
+    throw std::runtime_error(message.str());
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    close(fd);
+    std::ostringstream message;
+    message << "Could not get the size of " << filename << ".";
+    throw std::runtime_error(message.str());
+  }
+
+  this->size = static_cast<std::size_t>(info.st_size);
+
+  // Empty files cannot be mapped
+  if (this->size == 0) {
+    close(fd);
+    return;
+  }
+
+  void *mapping = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+
+  if (mapping == MAP_FAILED) {
+    std::ostringstream message;
+    message << "Could not map " << filename << " in memory.";
+    throw std::runtime_error(message.str());
+  }
+
+  // Records are read once, front to back
+  madvise(mapping, this->size, MADV_SEQUENTIAL);
+
+  this->data = static_cast<const char *>(mapping);
+}
+
+specfem::IO::fortran_reader::~fortran_reader() {
+  if (this->data != nullptr) {
+    munmap(const_cast<char *>(this->data), this->size);
+  }
+}
+
+specfem::IO::impl::fortran_record
+specfem::IO::fortran_reader::next_record() {
+  const std::size_t record = this->position;
+
+  if (this->size - record < static_cast<std::size_t>(fint)) {
+    this->fail(record, "Unexpected end of file.");
+  }
+
+  int length;
+  std::memcpy(&length, this->data + record, fint);
+
+  if (length < 0 ||
+      this->size - record - fint <
+          static_cast<std::size_t>(length) + static_cast<std::size_t>(fint)) {
+    std::ostringstream reason;
+    reason << "Record of " << length
+           << " bytes extends past the end of the file.";
+    this->fail(record, reason.str());
+  }
+
+  int trailing_length;
+  std::memcpy(&trailing_length, this->data + record + fint + length, fint);
+
+  if (trailing_length != length) {
+    std::ostringstream reason;
+    reason << "Leading (" << length << " bytes) and trailing ("
+           << trailing_length << " bytes) record markers do not match.";
+    this->fail(record, reason.str());
+  }
+
+  this->position = record + 2 * fint + length;
+
+  return { this->data + record + fint, length };
+}
+
+void specfem::IO::fortran_reader::fail(const std::size_t record,
+                                       const std::string &reason) const {
+  std::ostringstream message;
+  message << "Error reading fortran file " << this->filename
+          << " at byte offset " << record << ". \n"
+          << reason;
+  throw std::runtime_error(message.str());
+}
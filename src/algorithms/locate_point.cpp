@@ -2,84 +2,13 @@
 #include "compute/compute_mesh.hpp"
 #include "jacobian/interface.hpp"
 #include "point/coordinates.hpp"
+#include <Kokkos_Core.hpp>
+#include <limits>
+#include <tuple>
+#include <vector>
 
 namespace {
 
-std::tuple<int, int, int> rough_location(
-    const specfem::point::global_coordinates<specfem::dimension::type::dim2>
-        &global,
-    const specfem::kokkos::HostView4d<type_real> coord) {
-
-  /***
-   *  Roughly locate closest quadrature point to the source
-   ***/
-
-  const int nspec = coord.extent(1);
-  const int ngllz = coord.extent(2);
-  const int ngllx = coord.extent(3);
-
-  type_real dist_min = std::numeric_limits<type_real>::max();
-  int ispec_selected, ix_selected, iz_selected;
-
-  for (int ispec = 0; ispec < nspec; ispec++) {
-    for (int j = 0; j < ngllz; j++) {
-      for (int i = 0; i < ngllx; i++) {
-        const specfem::point::global_coordinates<specfem::dimension::type::dim2>
-            cart_coord = { coord(0, ispec, j, i), coord(1, ispec, j, i) };
-        const type_real distance = specfem::point::distance(global, cart_coord);
-        if (distance < dist_min) {
-          ispec_selected = ispec;
-          ix_selected = i;
-          iz_selected = j;
-          dist_min = distance;
-        }
-      }
-    }
-  }
-
-  return std::make_tuple(ix_selected, iz_selected, ispec_selected);
-}
-
-std::vector<int> get_best_candidates(
-    const int ispec_guess,
-    const Kokkos::View<int ***, Kokkos::LayoutLeft, Kokkos::HostSpace>
-        index_mapping) {
-
-  const int nspec = index_mapping.extent(0);
-  const int ngllx = index_mapping.extent(1);
-  const int ngllz = index_mapping.extent(2);
-
-  std::vector<int> iglob_guess;
-  iglob_guess.push_back(index_mapping(ispec_guess, 0, 0));
-  iglob_guess.push_back(index_mapping(ispec_guess, ngllz - 1, 0));
-  iglob_guess.push_back(index_mapping(ispec_guess, 0, ngllx - 1));
-  iglob_guess.push_back(index_mapping(ispec_guess, ngllz - 1, ngllx - 1));
-
-  std::vector<int> ispec_candidates;
-  ispec_candidates.push_back(ispec_guess);
-
-  for (int ispec = 0; ispec < nspec; ispec++) {
-    if (ispec == ispec_guess)
-      continue;
-
-    // loop over only corners
-    for (int j : { 0, ngllz - 1 }) {
-      for (int i : { 0, ngllx - 1 }) {
-        // check if this element is in contact with initial guess
-        if (std::find(iglob_guess.begin(), iglob_guess.end(),
-                      index_mapping(ispec, j, i)) != iglob_guess.end()) {
-          // do not count the element twice
-          if (ispec_candidates.size() > 0 &&
-              ispec_candidates[ispec_candidates.size() - 1] != ispec)
-            ispec_candidates.push_back(ispec);
-        }
-      }
-    }
-  }
-
-  return ispec_candidates;
-}
-
 std::tuple<type_real, type_real> get_best_location(
     const specfem::point::global_coordinates<specfem::dimension::type::dim2>
         &global,
@@ -117,39 +46,40 @@ std::tuple<type_real, type_real> get_best_location(
   return std::make_tuple(xi, gamma);
 }
 
-} // namespace
-
 specfem::point::local_coordinates<specfem::dimension::type::dim2>
-specfem::algorithms::locate_point(
-    const specfem::point::global_coordinates<specfem::dimension::type::dim2>
-        &coordinates,
-    const specfem::compute::mesh &mesh) {
+locate(const specfem::point::global_coordinates<specfem::dimension::type::dim2>
+           &coordinates,
+       const specfem::compute::mesh &mesh,
+       const specfem::compute::spatial_index &spatial_index) {
 
-  const auto global_coordinates = mesh.points.h_coord;
-  const auto index_mapping = mesh.points.h_index_mapping;
   const auto xi = mesh.quadratures.gll.h_xi;
   const auto gamma = mesh.quadratures.gll.h_xi;
-  const auto shape2D = mesh.quadratures.gll.shape_functions.h_shape2D;
   const int ngnod = mesh.control_nodes.ngnod;
   const int N = mesh.quadratures.gll.N;
 
   int ix_guess, iz_guess, ispec_guess;
 
   std::tie(ix_guess, iz_guess, ispec_guess) =
-      rough_location(coordinates, global_coordinates);
+      spatial_index.closest_quadrature_point(mesh.points, coordinates);
 
-  const auto best_candidates = get_best_candidates(ispec_guess, index_mapping);
+  // The closest element and the elements sharing a corner with it
+  std::vector<int> best_candidates = { ispec_guess };
+  for (int i = spatial_index.h_adjacency_offsets(ispec_guess);
+       i < spatial_index.h_adjacency_offsets(ispec_guess + 1); ++i) {
+    best_candidates.push_back(spatial_index.h_adjacency(i));
+  }
 
   type_real final_dist = std::numeric_limits<type_real>::max();
 
   int ispec_selected_source;
   type_real xi_source, gamma_source;
 
-  specfem::kokkos::HostView2d<type_real> s_coord("s_coord", 2, ngnod);
+  // Unmanaged view, such that points can be located within parallel regions
+  std::vector<type_real> s_coord_data(2 * ngnod);
+  specfem::kokkos::HostView2d<type_real> s_coord(s_coord_data.data(), 2,
+                                                 ngnod);
 
   for (auto &ispec : best_candidates) {
-    auto sv_shape2D = Kokkos::subview(shape2D, iz_guess, ix_guess, Kokkos::ALL);
-
     type_real xi_guess = xi(ix_guess);
     type_real gamma_guess = gamma(iz_guess);
 
@@ -163,8 +93,8 @@ specfem::algorithms::locate_point(
         get_best_location(coordinates, s_coord, xi_guess, gamma_guess);
 
     // compute the distance
-    auto [x, z] = jacobian::compute_locations(s_coord, mesh.control_nodes.ngnod,
-                                              xi_guess, gamma_guess);
+    auto [x, z] = specfem::jacobian::compute_locations(
+        s_coord, mesh.control_nodes.ngnod, xi_guess, gamma_guess);
     const specfem::point::global_coordinates<specfem::dimension::type::dim2>
         cart_coord = { x, z };
 
@@ -184,6 +114,54 @@ specfem::algorithms::locate_point(
   return { ispec_selected_source, xi_source, gamma_source };
 }
 
+} // namespace
+
+specfem::point::local_coordinates<specfem::dimension::type::dim2>
+specfem::algorithms::locate_point(
+    const specfem::point::global_coordinates<specfem::dimension::type::dim2>
+        &coordinates,
+    const specfem::compute::mesh &mesh) {
+
+  if (mesh.spatial_index.nspec != mesh.nspec) {
+    return locate(coordinates, mesh,
+                  specfem::compute::spatial_index(mesh.points));
+  }
+
+  return locate(coordinates, mesh, mesh.spatial_index);
+}
+
+specfem::kokkos::HostView1d<
+    specfem::point::local_coordinates<specfem::dimension::type::dim2> >
+specfem::algorithms::locate_point(
+    const specfem::kokkos::HostView1d<
+        specfem::point::global_coordinates<specfem::dimension::type::dim2> >
+        &coordinates,
+    const specfem::compute::mesh &mesh) {
+
+  const int npoints = coordinates.extent(0);
+
+  specfem::kokkos::HostView1d<
+      specfem::point::local_coordinates<specfem::dimension::type::dim2> >
+      local_coordinates("specfem::algorithms::locate_point::local_coordinates",
+                        npoints);
+
+  const auto spatial_index = (mesh.spatial_index.nspec != mesh.nspec)
+                                 ? specfem::compute::spatial_index(mesh.points)
+                                 : mesh.spatial_index;
+
+  Kokkos::parallel_for(
+      "specfem::algorithms::locate_point",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, npoints),
+      [&](const int ipoint) {
+        local_coordinates(ipoint) =
+            locate(coordinates(ipoint), mesh, spatial_index);
+      });
+
+  Kokkos::fence();
+
+  return local_coordinates;
+}
+
 specfem::point::global_coordinates<specfem::dimension::type::dim2>
 specfem::algorithms::locate_point(
     const specfem::point::local_coordinates<specfem::dimension::type::dim2>
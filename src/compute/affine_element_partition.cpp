@@ -0,0 +1,65 @@
+#include "compute/affine_element_partition.hpp"
+#include "kokkos_abstractions.h"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+specfem::compute::affine_element_partition::affine_element_partition(
+    const specfem::compute::partial_derivatives &partial_derivatives,
+    const specfem::kokkos::HostView1d<int> elements,
+    const specfem::kokkos::HostView1d<int> range_offsets,
+    const int block_size)
+    : nranges(range_offsets.extent(0) - 1) {
+
+  if (block_size < 1) {
+    throw std::runtime_error(
+        "Affine element partition block size must be positive");
+  }
+
+  const int nelements = elements.extent(0);
+
+  element_index_mapping = specfem::kokkos::DeviceView1d<int>(
+      "specfem::compute::affine_element_partition::element_index_mapping",
+      nelements);
+  h_element_index_mapping = Kokkos::create_mirror_view(element_index_mapping);
+  h_range_offsets = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::affine_element_partition::range_offsets",
+      nranges + 1);
+  h_affine_offsets = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::affine_element_partition::affine_offsets", nranges);
+
+  Kokkos::deep_copy(h_range_offsets, range_offsets);
+
+  const auto is_affine_block = [&](const int start, const int end) {
+    for (int ielement = start; ielement < end; ielement++) {
+      if (!partial_derivatives.h_is_affine(elements(ielement)))
+        return false;
+    }
+    return true;
+  };
+
+  for (int irange = 0; irange < nranges; irange++) {
+    const int range_start = h_range_offsets(irange);
+    const int range_end = h_range_offsets(irange + 1);
+
+    // Affine blocks first, then the remaining blocks. Both passes visit
+    // blocks in ascending order
+    int offset = range_start;
+    for (const bool affine : { true, false }) {
+      for (int start = range_start; start < range_end; start += block_size) {
+        const int end = std::min(start + block_size, range_end);
+        if (is_affine_block(start, end) != affine)
+          continue;
+        for (int ielement = start; ielement < end; ielement++) {
+          h_element_index_mapping(offset++) = elements(ielement);
+        }
+      }
+      if (affine)
+        h_affine_offsets(irange) = offset;
+    }
+  }
+
+  Kokkos::deep_copy(element_index_mapping, h_element_index_mapping);
+
+  return;
+}
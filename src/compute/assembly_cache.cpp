@@ -0,0 +1,309 @@
+#include "compute/assembly_cache.hpp"
+#include "kokkos_abstractions.h"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+constexpr char signature[8] = { 'S', 'P', 'E', 'C', 'A', 'S', 'M', '\0' };
+constexpr std::uint32_t version = 2;
+
+struct assembly_cache_header {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t real_size; ///< sizeof(type_real) used to write the cache
+  std::uint64_t key;
+  std::int32_t nspec;
+  std::int32_t ngllz;
+  std::int32_t ngllx;
+  std::int32_t ordering;
+  double xmin, xmax, zmin, zmax;
+};
+
+// 64-bit FNV-1a hash
+constexpr std::uint64_t fnv_offset = 14695981039346656037ULL;
+constexpr std::uint64_t fnv_prime = 1099511628211ULL;
+
+std::uint64_t hash_bytes(std::uint64_t hash, const void *data,
+                         const std::size_t size) {
+  const auto *bytes = static_cast<const unsigned char *>(data);
+  for (std::size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= fnv_prime;
+  }
+  return hash;
+}
+
+// Arrays are padded to 8 bytes so that every array within a mapped file is
+// aligned for its value type
+std::size_t padded(const std::size_t bytes) { return (bytes + 7) & ~7ULL; }
+
+template <typename ViewType> std::size_t stored_size(const ViewType &view) {
+  return padded(view.span() * sizeof(typename ViewType::value_type));
+}
+
+template <typename ViewType>
+void write_view(std::FILE *file, const ViewType &view, bool &success) {
+  using value_type = typename ViewType::value_type;
+  const std::size_t bytes = view.span() * sizeof(value_type);
+  const char padding[8] = {};
+  success = success &&
+            (std::fwrite(view.data(), sizeof(value_type), view.span(), file) ==
+             view.span()) &&
+            (std::fwrite(padding, 1, padded(bytes) - bytes, file) ==
+             padded(bytes) - bytes);
+}
+
+// Copy an array stored within a mapped file into a host view
+template <typename ViewType>
+void read_view(const char *&position, const ViewType &view) {
+  using value_type = typename ViewType::value_type;
+  using UnmanagedViewType =
+      Kokkos::View<typename ViewType::data_type,
+                   typename ViewType::array_layout, Kokkos::HostSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+  const UnmanagedViewType source(
+      const_cast<value_type *>(reinterpret_cast<const value_type *>(position)),
+      view.layout());
+  Kokkos::deep_copy(view, source);
+  position += stored_size(view);
+}
+
+} // namespace
+
+specfem::compute::assembly_cache::assembly_cache(
+    const std::string &directory, const std::string &database_file)
+    : directory(directory) {
+
+  std::ifstream stream(database_file, std::ios::binary);
+  if (!stream.is_open()) {
+    std::ostringstream message;
+    message << "Error creating assembly cache. \n"
+            << "Could not open mesh database " << database_file;
+    throw std::runtime_error(message.str());
+  }
+
+  std::vector<char> buffer(1 << 20);
+  database_hash = fnv_offset;
+  while (stream) {
+    stream.read(buffer.data(), buffer.size());
+    database_hash = hash_bytes(database_hash, buffer.data(), stream.gcount());
+  }
+
+  return;
+}
+
+std::uint64_t specfem::compute::assembly_cache::get_key(
+    const specfem::quadrature::quadratures &quadratures,
+    const specfem::compute::element_ordering ordering) const {
+
+  const int N = quadratures.gll.get_N();
+  const auto xi = quadratures.gll.get_hxi();
+  const auto weights = quadratures.gll.get_hw();
+  const std::int32_t ordering_value = static_cast<std::int32_t>(ordering);
+  const std::uint32_t real_size = sizeof(type_real);
+
+  std::uint64_t key = database_hash;
+  key = hash_bytes(key, &version, sizeof(version));
+  key = hash_bytes(key, &real_size, sizeof(real_size));
+  key = hash_bytes(key, &N, sizeof(N));
+  key = hash_bytes(key, xi.data(), sizeof(type_real) * xi.extent(0));
+  key = hash_bytes(key, weights.data(), sizeof(type_real) * weights.extent(0));
+  key = hash_bytes(key, &ordering_value, sizeof(ordering_value));
+
+  return key;
+}
+
+std::string specfem::compute::assembly_cache::get_filename(
+    const specfem::quadrature::quadratures &quadratures,
+    const specfem::compute::element_ordering ordering) const {
+
+  std::ostringstream filename;
+  filename << directory << "/assembly_" << std::hex << std::setw(16)
+           << std::setfill('0') << get_key(quadratures, ordering) << ".bin";
+  return filename.str();
+}
+
+bool specfem::compute::assembly_cache::load(
+    const specfem::mesh::mesh &mesh,
+    const specfem::quadrature::quadratures &quadratures,
+    const specfem::compute::element_ordering ordering,
+    specfem::compute::mesh &compute_mesh,
+    specfem::compute::partial_derivatives &partial_derivatives) const {
+
+  if (!this->enabled())
+    return false;
+
+  const std::string filename = get_filename(quadratures, ordering);
+
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat info;
+  if (fstat(fd, &info) != 0 ||
+      static_cast<std::size_t>(info.st_size) < sizeof(assembly_cache_header)) {
+    close(fd);
+    return false;
+  }
+
+  const std::size_t file_size = info.st_size;
+  void *data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+
+  if (data == MAP_FAILED)
+    return false;
+
+  assembly_cache_header header;
+  std::memcpy(&header, data, sizeof(header));
+
+  const int nspec = mesh.nspec;
+  const int ngll = quadratures.gll.get_N();
+
+  specfem::compute::mesh_to_compute_mapping mapping;
+  mapping.nspec = nspec;
+  mapping.ordering = ordering;
+  mapping.compute_to_mesh = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::mesh_to_compute_mapping", nspec);
+  mapping.mesh_to_compute = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::mesh_to_compute_mapping", nspec);
+  mapping.outer = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::mesh_to_compute_mapping::outer", nspec);
+
+  specfem::compute::points points(nspec, ngll, ngll);
+  specfem::compute::partial_derivatives derivatives(nspec, ngll, ngll);
+
+  const std::size_t expected_size =
+      sizeof(assembly_cache_header) + stored_size(mapping.compute_to_mesh) +
+      stored_size(mapping.mesh_to_compute) + stored_size(mapping.outer) +
+      stored_size(points.h_index_mapping) + stored_size(points.h_coord) +
+      stored_size(derivatives.h_xix) + stored_size(derivatives.h_xiz) +
+      stored_size(derivatives.h_gammax) + stored_size(derivatives.h_gammaz) +
+      stored_size(derivatives.h_jacobian);
+
+  const bool valid =
+      std::equal(header.magic, header.magic + 8, signature) &&
+      header.version == version && header.real_size == sizeof(type_real) &&
+      header.key == get_key(quadratures, ordering) && header.nspec == nspec &&
+      header.ngllz == ngll && header.ngllx == ngll &&
+      header.ordering == static_cast<std::int32_t>(ordering) &&
+      file_size == expected_size;
+
+  if (!valid) {
+    munmap(data, file_size);
+    return false;
+  }
+
+  const char *position =
+      static_cast<const char *>(data) + sizeof(assembly_cache_header);
+
+  read_view(position, mapping.compute_to_mesh);
+  read_view(position, mapping.mesh_to_compute);
+  read_view(position, mapping.outer);
+  read_view(position, points.h_index_mapping);
+  read_view(position, points.h_coord);
+  read_view(position, derivatives.h_xix);
+  read_view(position, derivatives.h_xiz);
+  read_view(position, derivatives.h_gammax);
+  read_view(position, derivatives.h_gammaz);
+  read_view(position, derivatives.h_jacobian);
+
+  munmap(data, file_size);
+
+  points.xmin = header.xmin;
+  points.xmax = header.xmax;
+  points.zmin = header.zmin;
+  points.zmax = header.zmax;
+
+  Kokkos::deep_copy(points.index_mapping, points.h_index_mapping);
+  Kokkos::deep_copy(points.coord, points.h_coord);
+  derivatives.sync_views();
+
+  compute_mesh = specfem::compute::mesh(mapping, points, mesh.control_nodes,
+                                        quadratures);
+  partial_derivatives = derivatives;
+
+  return true;
+}
+
+void specfem::compute::assembly_cache::store(
+    const specfem::quadrature::quadratures &quadratures,
+    const specfem::compute::mesh &compute_mesh,
+    const specfem::compute::partial_derivatives &partial_derivatives) const {
+
+  if (!this->enabled())
+    return;
+
+  struct stat info;
+  if (stat(directory.c_str(), &info) != 0) {
+    mkdir(directory.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+  }
+
+  const auto ordering = compute_mesh.mapping.ordering;
+  const std::string filename = get_filename(quadratures, ordering);
+
+  // Write to a temporary file that is renamed once complete
+  std::ostringstream temporary;
+  temporary << filename << ".tmp." << getpid();
+
+  std::FILE *file = std::fopen(temporary.str().c_str(), "wb");
+  if (file == nullptr) {
+    std::ostringstream message;
+    message << "Error writing assembly cache. \n"
+            << "Could not open " << temporary.str() << " for writing.";
+    throw std::runtime_error(message.str());
+  }
+
+  const auto &points = compute_mesh.points;
+
+  assembly_cache_header header = {};
+  std::copy(signature, signature + 8, header.magic);
+  header.version = version;
+  header.real_size = sizeof(type_real);
+  header.key = get_key(quadratures, ordering);
+  header.nspec = compute_mesh.nspec;
+  header.ngllz = compute_mesh.ngllz;
+  header.ngllx = compute_mesh.ngllx;
+  header.ordering = static_cast<std::int32_t>(ordering);
+  header.xmin = points.xmin;
+  header.xmax = points.xmax;
+  header.zmin = points.zmin;
+  header.zmax = points.zmax;
+
+  bool success = (std::fwrite(&header, sizeof(header), 1, file) == 1);
+
+  write_view(file, compute_mesh.mapping.compute_to_mesh, success);
+  write_view(file, compute_mesh.mapping.mesh_to_compute, success);
+  write_view(file, compute_mesh.mapping.outer, success);
+  write_view(file, points.h_index_mapping, success);
+  write_view(file, points.h_coord, success);
+  write_view(file, partial_derivatives.h_xix, success);
+  write_view(file, partial_derivatives.h_xiz, success);
+  write_view(file, partial_derivatives.h_gammax, success);
+  write_view(file, partial_derivatives.h_gammaz, success);
+  write_view(file, partial_derivatives.h_jacobian, success);
+
+  success = (std::fclose(file) == 0) && success;
+
+  if (!success ||
+      std::rename(temporary.str().c_str(), filename.c_str()) != 0) {
+    std::remove(temporary.str().c_str());
+    std::ostringstream message;
+    message << "Error writing assembly cache " << filename;
+    throw std::runtime_error(message.str());
+  }
+
+  return;
+}
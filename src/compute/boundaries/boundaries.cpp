@@ -50,3 +50,21 @@ specfem::compute::boundaries::boundaries(
 
   Kokkos::deep_copy(this->stacey_index_mapping, this->h_stacey_index_mapping);
 }
+
+specfem::compute::memory_footprint
+specfem::compute::boundaries::get_memory_footprint() const {
+  specfem::compute::memory_footprint footprint;
+
+  footprint.add(boundary_tags)
+      .add(acoustic_free_surface_index_mapping,
+           h_acoustic_free_surface_index_mapping)
+      .add(stacey_index_mapping, h_stacey_index_mapping)
+      .add(acoustic_free_surface.quadrature_point_boundary_tag,
+           acoustic_free_surface.h_quadrature_point_boundary_tag)
+      .add(stacey.quadrature_point_boundary_tag,
+           stacey.h_quadrature_point_boundary_tag)
+      .add(stacey.edge_normal, stacey.h_edge_normal)
+      .add(stacey.edge_weight, stacey.h_edge_weight);
+
+  return footprint;
+}
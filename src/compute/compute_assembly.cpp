@@ -1,6 +1,36 @@
 
 #include "compute/assembly/assembly.hpp"
 #include "mesh/mesh.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+// Keep the sources or receivers located within the partition of this rank
+template <typename T>
+std::vector<std::shared_ptr<T> >
+local_points(const std::vector<std::shared_ptr<T> > &points,
+             const specfem::compute::mesh &mesh,
+             const specfem::MPI::MPI *mpi) {
+  std::vector<
+      specfem::point::global_coordinates<specfem::dimension::type::dim2> >
+      coordinates;
+  for (const auto &point : points) {
+    coordinates.push_back({ point->get_x(), point->get_z() });
+  }
+
+  const auto owned = specfem::compute::owned_points(coordinates, mesh, mpi);
+
+  std::vector<std::shared_ptr<T> > local;
+  for (int ipoint = 0; ipoint < points.size(); ipoint++) {
+    if (owned[ipoint])
+      local.push_back(points[ipoint]);
+  }
+  return local;
+}
+
+} // namespace
 
 specfem::compute::assembly::assembly(
     const specfem::mesh::mesh &mesh,
@@ -10,17 +40,35 @@ specfem::compute::assembly::assembly(
         &receivers,
     const std::vector<specfem::enums::seismogram::type> &stypes,
     const type_real t0, const type_real dt, const int max_timesteps,
-    const int max_sig_step, const specfem::simulation::type simulation) {
-  this->mesh = { mesh.tags, mesh.control_nodes, quadratures };
-  this->partial_derivatives = { this->mesh };
+    const int max_sig_step, const specfem::simulation::type simulation,
+    const bool checkpointing, const bool stream_boundary_values,
+    const specfem::compute::element_ordering ordering,
+    const specfem::compute::element_assembly element_assembly,
+    const specfem::compute::assembly_cache &cache,
+    const int seismogram_buffer_size)
+    : element_assembly(element_assembly) {
+  if (!cache.load(mesh, quadratures, ordering, this->mesh,
+                  this->partial_derivatives)) {
+    this->mesh = { mesh.tags, mesh.control_nodes, quadratures, ordering,
+                   mesh.mpi_interfaces };
+    this->partial_derivatives = { this->mesh };
+    cache.store(quadratures, this->mesh, this->partial_derivatives);
+  }
+  this->mpi_interfaces = { mesh, this->mesh.points, this->mesh.mapping };
   this->properties = { this->mesh.nspec,   this->mesh.ngllz, this->mesh.ngllx,
                        this->mesh.mapping, mesh.tags,        mesh.materials };
   this->kernels = { this->mesh.nspec, this->mesh.ngllz, this->mesh.ngllx,
                     this->mesh.mapping, mesh.tags };
-  this->sources = { sources,          this->mesh, this->partial_derivatives,
-                    this->properties, t0,         dt,
+  this->sources = { local_points(sources, this->mesh, mpi_interfaces.mpi),
+                    this->mesh,
+                    this->partial_derivatives,
+                    this->properties,
+                    t0,
+                    dt,
                     max_timesteps };
-  this->receivers = { max_sig_step, receivers, stypes, this->mesh };
+  this->receivers = { max_sig_step,
+                      local_points(receivers, this->mesh, mpi_interfaces.mpi),
+                      stypes, this->mesh, seismogram_buffer_size };
   this->boundaries = { this->mesh.nspec,   this->mesh.ngllz,
                        this->mesh.ngllx,   mesh,
                        this->mesh.mapping, this->mesh.quadratures,
@@ -31,8 +79,57 @@ specfem::compute::assembly::assembly(
                                this->partial_derivatives,
                                this->properties,
                                this->mesh.mapping };
-  this->fields = { this->mesh, this->properties, simulation };
-  this->boundary_values = { max_timesteps, this->mesh, this->properties,
-                            this->boundaries };
+  this->fields = { this->mesh, this->properties, simulation, checkpointing };
+  // Boundary values are only needed when the forward wavefield is
+  // reconstructed by time reversal. When they are streamed to or from disk
+  // only the current time step is resident in device memory
+  const int boundary_value_steps = checkpointing ? 0 : max_timesteps;
+  const int boundary_value_slots =
+      stream_boundary_values ? std::min(1, boundary_value_steps)
+                             : boundary_value_steps;
+  this->boundary_values = { boundary_value_steps, boundary_value_slots,
+                            this->mesh, this->properties, this->boundaries };
   return;
 }
+
+std::vector<std::tuple<std::string, specfem::compute::memory_footprint> >
+specfem::compute::assembly::get_memory_footprint() const {
+  return { { "mesh", mesh.get_memory_footprint() },
+           { "partial_derivatives",
+             partial_derivatives.get_memory_footprint() },
+           { "properties", properties.get_memory_footprint() },
+           { "kernels", kernels.get_memory_footprint() },
+           { "sources", sources.get_memory_footprint() },
+           { "receivers", receivers.get_memory_footprint() },
+           { "boundaries", boundaries.get_memory_footprint() },
+           { "coupled_interfaces", coupled_interfaces.get_memory_footprint() },
+           { "mpi_interfaces", mpi_interfaces.get_memory_footprint() },
+           { "fields", fields.get_memory_footprint() },
+           { "boundary_values", boundary_values.get_memory_footprint() } };
+}
+
+std::string specfem::compute::assembly::print_memory_footprint() const {
+  const auto to_mb = [](const std::size_t bytes) {
+    return static_cast<double>(bytes) / 1048576.0;
+  };
+
+  std::ostringstream message;
+  message << "Memory footprint (MB):\n"
+          << "  " << std::left << std::setw(22) << "Container" << std::right
+          << std::setw(12) << "Device" << std::setw(12) << "Host" << "\n";
+
+  specfem::compute::memory_footprint total;
+  message << std::fixed << std::setprecision(3);
+  for (const auto &[name, footprint] : this->get_memory_footprint()) {
+    message << "  " << std::left << std::setw(22) << name << std::right
+            << std::setw(12) << to_mb(footprint.device) << std::setw(12)
+            << to_mb(footprint.host) << "\n";
+    total += footprint;
+  }
+
+  message << "  " << std::left << std::setw(22) << "total" << std::right
+          << std::setw(12) << to_mb(total.device) << std::setw(12)
+          << to_mb(total.host) << "\n";
+
+  return message.str();
+}
@@ -19,8 +19,9 @@ template class specfem::compute::boundary_value_container<
     specfem::dimension::type::dim2, specfem::element::boundary_tag::stacey>;
 
 specfem::compute::boundary_values::boundary_values(
-    const int nstep, const specfem::compute::mesh mesh,
+    const int nstep, const int nslots, const specfem::compute::mesh mesh,
     const specfem::compute::properties properties,
     const specfem::compute::boundaries boundaries)
-    : stacey(nstep, mesh, properties, boundaries),
-      composite_stacey_dirichlet(nstep, mesh, properties, boundaries) {}
+    : stacey(nstep, nslots, mesh, properties, boundaries),
+      composite_stacey_dirichlet(nstep, nslots, mesh, properties, boundaries) {
+}
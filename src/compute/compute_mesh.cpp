@@ -6,7 +6,10 @@
 #include "quadrature/interface.hpp"
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -15,34 +18,186 @@ struct qp {
   int iloc = 0, iglob = 0;
 };
 
-type_real get_tolerance(std::vector<qp> cart_cord, const int nspec,
-                        const int ngllxz) {
+// Points closer than the tolerance are merged into a single global point. The
+// tolerance is relative to the smallest element in the mesh
+type_real
+get_tolerance(const specfem::kokkos::HostView4d<double> global_coordinates) {
+
+  const int nspec = global_coordinates.extent(0);
+  const int ngll = global_coordinates.extent(1);
+
+  type_real xtypdist;
+  Kokkos::parallel_reduce(
+      "specfem::compute::mesh::get_tolerance",
+      specfem::kokkos::HostRange(0, nspec),
+      [=](const int ispec, type_real &l_xtypdist) {
+        type_real xmax = std::numeric_limits<type_real>::lowest();
+        type_real xmin = std::numeric_limits<type_real>::max();
+        type_real zmax = std::numeric_limits<type_real>::lowest();
+        type_real zmin = std::numeric_limits<type_real>::max();
+        for (int iz = 0; iz < ngll; iz++) {
+          for (int ix = 0; ix < ngll; ix++) {
+            const type_real x = global_coordinates(ispec, iz, ix, 0);
+            const type_real z = global_coordinates(ispec, iz, ix, 1);
+            xmax = std::max(xmax, x);
+            xmin = std::min(xmin, x);
+            zmax = std::max(zmax, z);
+            zmin = std::min(zmin, z);
+          }
+        }
+        l_xtypdist = std::min(l_xtypdist, xmax - xmin);
+        l_xtypdist = std::min(l_xtypdist, zmax - zmin);
+      },
+      Kokkos::Min<type_real>(xtypdist));
+
+  return 1e-6 * xtypdist;
+}
+
+/**
+ * @brief Distance of a point along a Hilbert curve filling a n x n grid
+ *
+ * @param n Size of the grid. Needs to be a power of 2
+ * @param x x index of the point within the grid
+ * @param z z index of the point within the grid
+ * @return std::uint64_t Distance along the curve
+ */
+std::uint64_t hilbert_index(const std::uint32_t n, std::uint32_t x,
+                            std::uint32_t z) {
+  std::uint64_t d = 0;
+  for (std::uint32_t s = n / 2; s > 0; s /= 2) {
+    const std::uint32_t rx = (x & s) > 0;
+    const std::uint32_t rz = (z & s) > 0;
+    d += static_cast<std::uint64_t>(s) * s * ((3 * rx) ^ rz);
+    // Rotate the quadrant so that the curve is continuous
+    if (rz == 0) {
+      if (rx == 1) {
+        x = n - 1 - x;
+        z = n - 1 - z;
+      }
+      std::swap(x, z);
+    }
+  }
+  return d;
+}
 
-  assert(cart_cord.size() == ngllxz * nspec);
+// Find the elements sharing a point with the partition of another MPI rank.
+// Points within an interface edge are only shared by the elements on either
+// side of the edge, so every element touching the interface has one of the
+// interface control nodes as a corner
+std::vector<bool>
+find_outer_elements(const specfem::mesh::control_nodes &control_nodes,
+                    const specfem::mesh::interfaces::interface &mpi_interfaces,
+                    const int nspec) {
+
+  std::vector<bool> outer(nspec, false);
+  std::vector<int> nodes;
+
+  for (int iinterface = 0; iinterface < mpi_interfaces.ninterfaces;
+       iinterface++) {
+    for (int ie = 0; ie < mpi_interfaces.my_nelmnts_neighbors(iinterface);
+         ie++) {
+      outer[mpi_interfaces.my_interfaces(iinterface, ie, 0)] = true;
+      for (int inode = 2; inode < 4; inode++) {
+        const int node = mpi_interfaces.my_interfaces(iinterface, ie, inode);
+        if (node >= 0)
+          nodes.push_back(node);
+      }
+    }
+  }
+
+  if (nodes.empty())
+    return outer;
+
+  std::sort(nodes.begin(), nodes.end());
 
-  type_real xtypdist = std::numeric_limits<type_real>::max();
+  constexpr int ncorners = 4;
   for (int ispec = 0; ispec < nspec; ispec++) {
-    type_real xmax = std::numeric_limits<type_real>::min();
-    type_real xmin = std::numeric_limits<type_real>::max();
-    type_real ymax = std::numeric_limits<type_real>::min();
-    type_real ymin = std::numeric_limits<type_real>::max();
-    for (int xz = 0; xz < ngllxz; xz++) {
-      int iloc = ispec * (ngllxz) + xz;
-      xmax = std::max(xmax, cart_cord[iloc].x);
-      xmin = std::min(xmin, cart_cord[iloc].x);
-      ymax = std::max(ymax, cart_cord[iloc].z);
-      ymin = std::min(ymin, cart_cord[iloc].z);
+    for (int icorner = 0; icorner < ncorners; icorner++) {
+      if (std::binary_search(nodes.begin(), nodes.end(),
+                             control_nodes.knods(icorner, ispec))) {
+        outer[ispec] = true;
+      }
     }
+  }
+
+  return outer;
+}
 
-    xtypdist = std::min(xtypdist, xmax - xmin);
-    xtypdist = std::min(xtypdist, ymax - ymin);
+/**
+ * @brief Sort elements along a Hilbert curve through their centers
+ *
+ * @param control_nodes Control nodes of the mesh
+ * @param ispecs Element indices (mesh ordering) to sort
+ */
+void sort_along_hilbert_curve(const specfem::mesh::control_nodes &control_nodes,
+                              std::vector<int> &ispecs) {
+
+  if (ispecs.size() < 2)
+    return;
+
+  const int ngnod = control_nodes.ngnod;
+
+  std::vector<type_real> xcenter(ispecs.size(), 0.0);
+  std::vector<type_real> zcenter(ispecs.size(), 0.0);
+
+  for (int i = 0; i < ispecs.size(); i++) {
+    for (int in = 0; in < ngnod; in++) {
+      const int index = control_nodes.knods(in, ispecs[i]);
+      xcenter[i] += control_nodes.coord(0, index) / ngnod;
+      zcenter[i] += control_nodes.coord(1, index) / ngnod;
+    }
   }
 
-  return 1e-6 * xtypdist;
+  const auto [xmin, xmax] = std::minmax_element(xcenter.begin(), xcenter.end());
+  const auto [zmin, zmax] = std::minmax_element(zcenter.begin(), zcenter.end());
+
+  // Use the same scale in x and z so that the curve does not stretch along the
+  // longer side of the domain
+  const type_real extent = std::max(*xmax - *xmin, *zmax - *zmin);
+  constexpr std::uint32_t n = 1 << 16;
+
+  const auto scale = [extent](const type_real value, const type_real min) {
+    if (extent <= 0.0)
+      return std::uint32_t(0);
+    return static_cast<std::uint32_t>((value - min) / extent * (n - 1));
+  };
+
+  std::vector<std::pair<std::uint64_t, int> > keys(ispecs.size());
+  for (int i = 0; i < ispecs.size(); i++) {
+    keys[i] = { hilbert_index(n, scale(xcenter[i], *xmin),
+                              scale(zcenter[i], *zmin)),
+                ispecs[i] };
+  }
+
+  std::stable_sort(
+      keys.begin(), keys.end(),
+      [](const auto &a, const auto &b) { return a.first < b.first; });
+
+  for (int i = 0; i < ispecs.size(); i++) {
+    ispecs[i] = keys[i].second;
+  }
+
+  return;
 }
 
-specfem::compute::points
-assign_numbering(specfem::kokkos::HostView4d<double> global_coordinates) {
+// Points are numbered in the order they are first touched. With the default
+// ordering the loop runs over quadrature points first, otherwise over elements
+// first so that points of an element and of the elements following it have
+// nearby global indices.
+void loop_to_point(const int iloop, const int nspec, const int ngll,
+                   const bool element_major, int &ispec, int &iz, int &ix) {
+  const int ngllxz = ngll * ngll;
+  ispec = element_major ? iloop / ngllxz : iloop % nspec;
+  const int ixz = element_major ? iloop % ngllxz : iloop / nspec;
+  iz = element_major ? ixz / ngll : ixz % ngll;
+  ix = element_major ? ixz % ngll : ixz / ngll;
+}
+
+// Reference numbering : sort every quadrature point by coordinates and merge
+// neighbouring points within a tolerance
+specfem::compute::points assign_numbering_by_coordinates(
+    const specfem::kokkos::HostView4d<double> global_coordinates,
+    const specfem::compute::element_ordering ordering) {
 
   int nspec = global_coordinates.extent(0);
   int ngll = global_coordinates.extent(1);
@@ -76,7 +231,7 @@ assign_numbering(specfem::kokkos::HostView4d<double> global_coordinates) {
   int ig = 0;
   cart_cord[0].iglob = ig;
 
-  type_real xtol = get_tolerance(cart_cord, nspec, ngllxz);
+  const type_real xtol = get_tolerance(global_coordinates);
 
   for (int iloc = 1; iloc < cart_cord.size(); iloc++) {
     // check if the previous point is same as current
@@ -101,41 +256,42 @@ assign_numbering(specfem::kokkos::HostView4d<double> global_coordinates) {
 
   // Assign numbering to corresponding ispec, iz, ix
   std::vector<int> iglob_counted(nglob, -1);
-  int iloc = 0;
   int inum = 0;
   type_real xmin = std::numeric_limits<type_real>::max();
-  type_real xmax = std::numeric_limits<type_real>::min();
+  type_real xmax = std::numeric_limits<type_real>::lowest();
   type_real zmin = std::numeric_limits<type_real>::max();
-  type_real zmax = std::numeric_limits<type_real>::min();
-  for (int ix = 0; ix < ngll; ix++) {
-    for (int iz = 0; iz < ngll; iz++) {
-      for (int ispec = 0; ispec < nspec; ispec++) {
-        if (iglob_counted[copy_cart_cord[iloc].iglob] == -1) {
-
-          const type_real x_cor = copy_cart_cord[iloc].x;
-          const type_real z_cor = copy_cart_cord[iloc].z;
-          if (xmin > x_cor)
-            xmin = x_cor;
-          if (zmin > z_cor)
-            zmin = z_cor;
-          if (xmax < x_cor)
-            xmax = x_cor;
-          if (zmax < z_cor)
-            zmax = z_cor;
-
-          iglob_counted[copy_cart_cord[iloc].iglob] = inum;
-          points.h_index_mapping(ispec, iz, ix) = inum;
-          points.h_coord(0, ispec, iz, ix) = x_cor;
-          points.h_coord(1, ispec, iz, ix) = z_cor;
-          inum++;
-        } else {
-          points.h_index_mapping(ispec, iz, ix) =
-              iglob_counted[copy_cart_cord[iloc].iglob];
-          points.h_coord(0, ispec, iz, ix) = copy_cart_cord[iloc].x;
-          points.h_coord(1, ispec, iz, ix) = copy_cart_cord[iloc].z;
-        }
-        iloc++;
-      }
+  type_real zmax = std::numeric_limits<type_real>::lowest();
+  const bool element_major =
+      (ordering != specfem::compute::element_ordering::none);
+
+  for (int iloop = 0; iloop < nspec * ngllxz; iloop++) {
+    int ispec, iz, ix;
+    loop_to_point(iloop, nspec, ngll, element_major, ispec, iz, ix);
+    const int iloc = ix * nspec * ngll + iz * nspec + ispec;
+
+    if (iglob_counted[copy_cart_cord[iloc].iglob] == -1) {
+
+      const type_real x_cor = copy_cart_cord[iloc].x;
+      const type_real z_cor = copy_cart_cord[iloc].z;
+      if (xmin > x_cor)
+        xmin = x_cor;
+      if (zmin > z_cor)
+        zmin = z_cor;
+      if (xmax < x_cor)
+        xmax = x_cor;
+      if (zmax < z_cor)
+        zmax = z_cor;
+
+      iglob_counted[copy_cart_cord[iloc].iglob] = inum;
+      points.h_index_mapping(ispec, iz, ix) = inum;
+      points.h_coord(0, ispec, iz, ix) = x_cor;
+      points.h_coord(1, ispec, iz, ix) = z_cor;
+      inum++;
+    } else {
+      points.h_index_mapping(ispec, iz, ix) =
+          iglob_counted[copy_cart_cord[iloc].iglob];
+      points.h_coord(0, ispec, iz, ix) = copy_cart_cord[iloc].x;
+      points.h_coord(1, ispec, iz, ix) = copy_cart_cord[iloc].z;
     }
   }
 
@@ -154,6 +310,297 @@ assign_numbering(specfem::kokkos::HostView4d<double> global_coordinates) {
   return points;
 }
 
+// Control nodes (corners) at the start and end of every element edge. Edge
+// points are numbered from the start to the end of the edge
+constexpr int ncorners = 4;
+constexpr int nedges = 4;
+constexpr int edge_corners[nedges][2] = {
+  { 0, 1 }, { 1, 2 }, { 3, 2 }, { 0, 3 }
+};
+
+/**
+ * @brief Number the quadrature points using the connectivity of the elements
+ *
+ * Corner points are identified by their control node, edge points by the edge
+ * they lie on (the pair of corner control nodes) and their position along it.
+ * Interior points belong to a single element. Points are then numbered in the
+ * same first touch order as @ref assign_numbering_by_coordinates, so both
+ * numberings are identical on conforming meshes.
+ *
+ * Every step runs in parallel and only the corner control nodes are sorted,
+ * to check that no two of them coincide.
+ *
+ * @param global_coordinates Coordinates of the quadrature points
+ * @param knods Control nodes of every element (compute ordering)
+ * @param ordering Element ordering
+ * @param points Numbering of the quadrature points (output)
+ * @return bool false if points sharing a global index do not coincide or if
+ * distinct corner control nodes coincide, in which case @p points is invalid
+ */
+bool assign_numbering_by_topology(
+    const specfem::kokkos::HostView4d<double> global_coordinates,
+    const specfem::kokkos::HostMirror2d<int> knods,
+    const specfem::compute::element_ordering ordering,
+    specfem::compute::points &points) {
+
+  const int nspec = global_coordinates.extent(0);
+  const int ngll = global_coordinates.extent(1);
+  const int ngllxz = ngll * ngll;
+  const int last = ngll - 1;
+  const int nedge_points = ngll - 2;
+
+  if (knods.extent(1) < ncorners)
+    return false;
+
+  int max_node;
+  Kokkos::parallel_reduce(
+      "specfem::compute::mesh::assign_numbering::max_node",
+      specfem::kokkos::HostMDrange<2>({ 0, 0 }, { nspec, ncorners }),
+      [=](const int ispec, const int icorner, int &l_max_node) {
+        l_max_node = std::max(l_max_node, knods(ispec, icorner));
+      },
+      Kokkos::Max<int>(max_node));
+
+  const int npgeo = max_node + 1;
+
+  // Elements sharing every corner control node (compressed row storage)
+  specfem::kokkos::HostView1d<int> node_offsets(
+      "specfem::compute::mesh::assign_numbering::node_offsets", npgeo + 1);
+  specfem::kokkos::HostView1d<int> node_elements(
+      "specfem::compute::mesh::assign_numbering::node_elements",
+      nspec * ncorners);
+
+  Kokkos::parallel_for(
+      "specfem::compute::mesh::assign_numbering::count_elements",
+      specfem::kokkos::HostMDrange<2>({ 0, 0 }, { nspec, ncorners }),
+      [=](const int ispec, const int icorner) {
+        Kokkos::atomic_add(&node_offsets(knods(ispec, icorner) + 1), 1);
+      });
+
+  int nnode_elements;
+  Kokkos::parallel_scan(
+      "specfem::compute::mesh::assign_numbering::node_offsets",
+      specfem::kokkos::HostRange(0, npgeo + 1),
+      [=](const int inode, int &update, const bool final) {
+        update += node_offsets(inode);
+        if (final)
+          node_offsets(inode) = update;
+      },
+      nnode_elements);
+
+  assert(nnode_elements == nspec * ncorners);
+
+  specfem::kokkos::HostView1d<int> node_cursor(
+      "specfem::compute::mesh::assign_numbering::node_cursor", npgeo);
+  Kokkos::deep_copy(node_cursor,
+                    Kokkos::subview(node_offsets, Kokkos::make_pair(0, npgeo)));
+
+  Kokkos::parallel_for(
+      "specfem::compute::mesh::assign_numbering::node_elements",
+      specfem::kokkos::HostMDrange<2>({ 0, 0 }, { nspec, ncorners }),
+      [=](const int ispec, const int icorner) {
+        const int index = Kokkos::atomic_fetch_add(
+            &node_cursor(knods(ispec, icorner)), 1);
+        node_elements(index) = ispec;
+      });
+
+  // Every edge is owned by the element sharing it with the lowest index
+  specfem::kokkos::HostView2d<int> edge_owner(
+      "specfem::compute::mesh::assign_numbering::edge_owner", nspec, nedges);
+
+  Kokkos::parallel_for(
+      "specfem::compute::mesh::assign_numbering::edge_owner",
+      specfem::kokkos::HostMDrange<2>({ 0, 0 }, { nspec, nedges }),
+      [=](const int ispec, const int iedge) {
+        const int start = knods(ispec, edge_corners[iedge][0]);
+        const int end = knods(ispec, edge_corners[iedge][1]);
+        int owner = ispec * nedges + iedge;
+        for (int i = node_offsets(start); i < node_offsets(start + 1); i++) {
+          const int jspec = node_elements(i);
+          if (jspec == ispec)
+            continue;
+          for (int jedge = 0; jedge < nedges; jedge++) {
+            const int jstart = knods(jspec, edge_corners[jedge][0]);
+            const int jend = knods(jspec, edge_corners[jedge][1]);
+            if ((jstart == start && jend == end) ||
+                (jstart == end && jend == start)) {
+              owner = std::min(owner, jspec * nedges + jedge);
+            }
+          }
+        }
+        edge_owner(ispec, iedge) = owner;
+      });
+
+  // Key identifying every distinct point : control node for corners, owner
+  // edge and position along it for edge points, element and position within
+  // it for interior points
+  const int nkeys = npgeo + nspec * nedges * nedge_points +
+                    nspec * nedge_points * nedge_points;
+
+  specfem::kokkos::HostView3d<int> keys(
+      "specfem::compute::mesh::assign_numbering::keys", nspec, ngll, ngll);
+
+  Kokkos::parallel_for(
+      "specfem::compute::mesh::assign_numbering::keys",
+      specfem::kokkos::HostMDrange<3>({ 0, 0, 0 }, { nspec, ngll, ngll }),
+      [=](const int ispec, const int iz, const int ix) {
+        const bool xedge = (ix == 0 || ix == last);
+        const bool zedge = (iz == 0 || iz == last);
+        if (xedge && zedge) {
+          const int icorner =
+              (iz == 0) ? ((ix == 0) ? 0 : 1) : ((ix == 0) ? 3 : 2);
+          keys(ispec, iz, ix) = knods(ispec, icorner);
+        } else if (xedge || zedge) {
+          const int iedge =
+              (iz == 0) ? 0 : ((ix == last) ? 1 : ((iz == last) ? 2 : 3));
+          const int ipoint = (iedge == 0 || iedge == 2) ? ix : iz;
+          // Measure the position from the control node with the lowest index
+          // so that both elements sharing the edge agree
+          const int start = knods(ispec, edge_corners[iedge][0]);
+          const int end = knods(ispec, edge_corners[iedge][1]);
+          const int position = (start < end) ? ipoint : last - ipoint;
+          keys(ispec, iz, ix) =
+              npgeo + edge_owner(ispec, iedge) * nedge_points + position - 1;
+        } else {
+          keys(ispec, iz, ix) =
+              npgeo + nspec * nedges * nedge_points +
+              ((ispec * nedge_points) + iz - 1) * nedge_points + ix - 1;
+        }
+      });
+
+  const bool element_major =
+      (ordering != specfem::compute::element_ordering::none);
+  const int npoints = nspec * ngllxz;
+
+  // Iteration at which every distinct point is first touched
+  specfem::kokkos::HostView1d<int> first_touch(
+      "specfem::compute::mesh::assign_numbering::first_touch", nkeys);
+  Kokkos::deep_copy(first_touch, std::numeric_limits<int>::max());
+
+  Kokkos::parallel_for(
+      "specfem::compute::mesh::assign_numbering::first_touch",
+      specfem::kokkos::HostRange(0, npoints), [=](const int iloop) {
+        int ispec, iz, ix;
+        loop_to_point(iloop, nspec, ngll, element_major, ispec, iz, ix);
+        Kokkos::atomic_min(&first_touch(keys(ispec, iz, ix)), iloop);
+      });
+
+  specfem::kokkos::HostView1d<int> global_index(
+      "specfem::compute::mesh::assign_numbering::global_index", nkeys);
+
+  int nglob;
+  Kokkos::parallel_scan(
+      "specfem::compute::mesh::assign_numbering::global_index",
+      specfem::kokkos::HostRange(0, npoints),
+      [=](const int iloop, int &inum, const bool final) {
+        int ispec, iz, ix;
+        loop_to_point(iloop, nspec, ngll, element_major, ispec, iz, ix);
+        const int key = keys(ispec, iz, ix);
+        if (first_touch(key) == iloop) {
+          if (final)
+            global_index(key) = inum;
+          inum++;
+        }
+      },
+      nglob);
+
+  const auto h_index_mapping = points.h_index_mapping;
+  const auto h_coord = points.h_coord;
+
+  Kokkos::parallel_for(
+      "specfem::compute::mesh::assign_numbering::index_mapping",
+      specfem::kokkos::HostMDrange<3>({ 0, 0, 0 }, { nspec, ngll, ngll }),
+      [=](const int ispec, const int iz, const int ix) {
+        h_index_mapping(ispec, iz, ix) = global_index(keys(ispec, iz, ix));
+        h_coord(0, ispec, iz, ix) = global_coordinates(ispec, iz, ix, 0);
+        h_coord(1, ispec, iz, ix) = global_coordinates(ispec, iz, ix, 1);
+      });
+
+  // Validate the numbering : every point has to coincide with the point
+  // first touched with the same key
+  const type_real xtol = get_tolerance(global_coordinates);
+
+  int nmismatch;
+  Kokkos::parallel_reduce(
+      "specfem::compute::mesh::assign_numbering::validate",
+      specfem::kokkos::HostMDrange<3>({ 0, 0, 0 }, { nspec, ngll, ngll }),
+      [=](const int ispec, const int iz, const int ix, int &l_nmismatch) {
+        int jspec, jz, jx;
+        loop_to_point(first_touch(keys(ispec, iz, ix)), nspec, ngll,
+                      element_major, jspec, jz, jx);
+        for (int idim = 0; idim < 2; idim++) {
+          if (std::abs(global_coordinates(ispec, iz, ix, idim) -
+                       global_coordinates(jspec, jz, jx, idim)) > xtol) {
+            l_nmismatch++;
+            return;
+          }
+        }
+      },
+      nmismatch);
+
+  if (nmismatch > 0)
+    return false;
+
+  // Distinct control nodes at the same location (e.g. a mesh that is not
+  // conforming) would leave duplicate points. Checking the corners is enough
+  // since edge and interior points are only shared through them.
+  std::vector<qp> corners;
+  for (int inode = 0; inode < npgeo; inode++) {
+    if (first_touch(inode) == std::numeric_limits<int>::max())
+      continue;
+    int ispec, iz, ix;
+    loop_to_point(first_touch(inode), nspec, ngll, element_major, ispec, iz,
+                  ix);
+    qp corner;
+    corner.x = global_coordinates(ispec, iz, ix, 0);
+    corner.z = global_coordinates(ispec, iz, ix, 1);
+    corners.push_back(corner);
+  }
+
+  std::sort(corners.begin(), corners.end(), [](const qp &qp1, const qp &qp2) {
+    if (qp1.x != qp2.x) {
+      return qp1.x < qp2.x;
+    }
+
+    return qp1.z < qp2.z;
+  });
+
+  for (int i = 1; i < corners.size(); i++) {
+    if ((std::abs(corners[i].x - corners[i - 1].x) <= xtol) &&
+        (std::abs(corners[i].z - corners[i - 1].z) <= xtol)) {
+      return false;
+    }
+  }
+
+  type_real xmin, xmax, zmin, zmax;
+  Kokkos::parallel_reduce(
+      "specfem::compute::mesh::assign_numbering::bounds",
+      specfem::kokkos::HostMDrange<3>({ 0, 0, 0 }, { nspec, ngll, ngll }),
+      [=](const int ispec, const int iz, const int ix, type_real &l_xmin,
+          type_real &l_xmax, type_real &l_zmin, type_real &l_zmax) {
+        const type_real x = global_coordinates(ispec, iz, ix, 0);
+        const type_real z = global_coordinates(ispec, iz, ix, 1);
+        l_xmin = std::min(l_xmin, x);
+        l_xmax = std::max(l_xmax, x);
+        l_zmin = std::min(l_zmin, z);
+        l_zmax = std::max(l_zmax, z);
+      },
+      Kokkos::Min<type_real>(xmin), Kokkos::Max<type_real>(xmax),
+      Kokkos::Min<type_real>(zmin), Kokkos::Max<type_real>(zmax));
+
+  points.xmin = xmin;
+  points.xmax = xmax;
+  points.zmin = zmin;
+  points.zmax = zmax;
+
+  assert(nglob != npoints);
+
+  Kokkos::deep_copy(points.index_mapping, points.h_index_mapping);
+  Kokkos::deep_copy(points.coord, points.h_coord);
+
+  return true;
+}
+
 } // namespace
 
 specfem::compute::control_nodes::control_nodes(
@@ -223,8 +670,18 @@ specfem::compute::shape_functions::shape_functions(
 
 specfem::compute::mesh_to_compute_mapping::mesh_to_compute_mapping(
     const specfem::mesh::tags &tags)
-    : compute_to_mesh("specfem::compute::mesh_to_compute_mapping", tags.nspec),
-      mesh_to_compute("specfem::compute::mesh_to_compute_mapping", tags.nspec) {
+    : mesh_to_compute_mapping(tags, specfem::mesh::control_nodes(),
+                              specfem::compute::element_ordering::none) {}
+
+specfem::compute::mesh_to_compute_mapping::mesh_to_compute_mapping(
+    const specfem::mesh::tags &tags,
+    const specfem::mesh::control_nodes &control_nodes,
+    const specfem::compute::element_ordering ordering,
+    const specfem::mesh::interfaces::interface &mpi_interfaces)
+    : nspec(tags.nspec), ordering(ordering),
+      compute_to_mesh("specfem::compute::mesh_to_compute_mapping", tags.nspec),
+      mesh_to_compute("specfem::compute::mesh_to_compute_mapping", tags.nspec),
+      outer("specfem::compute::mesh_to_compute_mapping::outer", tags.nspec) {
 
   const int nspec = tags.nspec;
 
@@ -276,41 +733,44 @@ specfem::compute::mesh_to_compute_mapping::mesh_to_compute_mapping(
 
   assert(total_nspecs == nspec);
 
-  int ispec = 0;
-  for (const auto &ispecs : elastic_isotropic_ispec) {
-    compute_to_mesh(ispec) = ispecs;
-    mesh_to_compute(ispecs) = ispec;
-    ispec++;
-  }
-
-  for (const auto &ispecs : elastic_isotropic_stacey_ispec) {
-    compute_to_mesh(ispec) = ispecs;
-    mesh_to_compute(ispecs) = ispec;
-    ispec++;
-  }
-
-  for (const auto &ispecs : acoustic_isotropic_ispec) {
-    compute_to_mesh(ispec) = ispecs;
-    mesh_to_compute(ispecs) = ispec;
-    ispec++;
-  }
-
-  for (const auto &ispecs : free_surface_ispec) {
-    compute_to_mesh(ispec) = ispecs;
-    mesh_to_compute(ispecs) = ispec;
-    ispec++;
+  // Reorder elements within every group. Groups stay contiguous since the
+  // kernels iterate over the elements of a group as a single range.
+  if (ordering == specfem::compute::element_ordering::hilbert) {
+    for (auto *ispecs :
+         { &elastic_isotropic_ispec, &acoustic_isotropic_ispec,
+           &free_surface_ispec, &elastic_isotropic_stacey_ispec,
+           &acoustic_isotropic_stacey_ispec,
+           &acoustic_isotropic_stacey_dirichlet_ispec }) {
+      sort_along_hilbert_curve(control_nodes, *ispecs);
+    }
   }
 
-  for (const auto &ispecs : acoustic_isotropic_stacey_ispec) {
-    compute_to_mesh(ispec) = ispecs;
-    mesh_to_compute(ispecs) = ispec;
-    ispec++;
+  // Elements touching an MPI interface are placed first within every group,
+  // so that they can be computed before the halo exchange starts
+  const auto outer_elements =
+      find_outer_elements(control_nodes, mpi_interfaces, nspec);
+  for (auto *ispecs :
+       { &elastic_isotropic_ispec, &acoustic_isotropic_ispec,
+         &free_surface_ispec, &elastic_isotropic_stacey_ispec,
+         &acoustic_isotropic_stacey_ispec,
+         &acoustic_isotropic_stacey_dirichlet_ispec }) {
+    std::stable_partition(
+        ispecs->begin(), ispecs->end(),
+        [&outer_elements](const int ispec) { return outer_elements[ispec]; });
   }
 
-  for (const auto &ispecs : acoustic_isotropic_stacey_dirichlet_ispec) {
-    compute_to_mesh(ispec) = ispecs;
-    mesh_to_compute(ispecs) = ispec;
-    ispec++;
+  int ispec = 0;
+  for (const auto *ispecs :
+       { &elastic_isotropic_ispec, &elastic_isotropic_stacey_ispec,
+         &acoustic_isotropic_ispec, &free_surface_ispec,
+         &acoustic_isotropic_stacey_ispec,
+         &acoustic_isotropic_stacey_dirichlet_ispec }) {
+    for (const auto &ispec_mesh : *ispecs) {
+      compute_to_mesh(ispec) = ispec_mesh;
+      mesh_to_compute(ispec_mesh) = ispec;
+      outer(ispec) = outer_elements[ispec_mesh] ? 1 : 0;
+      ispec++;
+    }
   }
 
   assert(ispec == nspec);
@@ -319,9 +779,12 @@ specfem::compute::mesh_to_compute_mapping::mesh_to_compute_mapping(
 specfem::compute::mesh::mesh(
     const specfem::mesh::tags &tags,
     const specfem::mesh::control_nodes &m_control_nodes,
-    const specfem::quadrature::quadratures &m_quadratures) {
+    const specfem::quadrature::quadratures &m_quadratures,
+    const specfem::compute::element_ordering ordering,
+    const specfem::mesh::interfaces::interface &mpi_interfaces) {
 
-  this->mapping = specfem::compute::mesh_to_compute_mapping(tags);
+  this->mapping = specfem::compute::mesh_to_compute_mapping(
+      tags, m_control_nodes, ordering, mpi_interfaces);
   this->control_nodes =
       specfem::compute::control_nodes(this->mapping, m_control_nodes);
   this->quadratures =
@@ -331,9 +794,29 @@ specfem::compute::mesh::mesh(
   ngllz = this->quadratures.gll.N;
 
   this->points = this->assemble();
+  this->spatial_index = specfem::compute::spatial_index(this->points);
+}
+
+specfem::compute::mesh::mesh(
+    const specfem::compute::mesh_to_compute_mapping &mapping,
+    const specfem::compute::points &points,
+    const specfem::mesh::control_nodes &m_control_nodes,
+    const specfem::quadrature::quadratures &m_quadratures)
+    : points(points), mapping(mapping) {
+
+  this->control_nodes =
+      specfem::compute::control_nodes(this->mapping, m_control_nodes);
+  this->quadratures =
+      specfem::compute::quadrature(m_quadratures, m_control_nodes);
+  nspec = this->control_nodes.nspec;
+  ngllx = this->quadratures.gll.N;
+  ngllz = this->quadratures.gll.N;
+
+  this->spatial_index = specfem::compute::spatial_index(this->points);
 }
 
-specfem::compute::points specfem::compute::mesh::assemble() {
+specfem::compute::points specfem::compute::mesh::assemble(
+    const specfem::compute::global_numbering numbering) {
 
   const int ngnod = control_nodes.ngnod;
   const int nspec = control_nodes.nspec;
@@ -354,25 +837,21 @@ specfem::compute::points specfem::compute::mesh::assemble() {
       "specfem::compute::mesh::assemble::global_coordinates", nspec, ngll, ngll,
       2);
 
-  for (int ispec = 0; ispec < nspec; ispec++) {
-    for (int iz = 0; iz < ngll; iz++) {
-      for (int ix = 0; ix < ngll; ix++) {
-        auto shape_functions =
-            specfem::jacobian::define_shape_functions(xi(ix), gamma(iz), ngnod);
-
+  Kokkos::parallel_for(
+      "specfem::compute::mesh::assemble::global_coordinates",
+      specfem::kokkos::HostMDrange<3>({ 0, 0, 0 }, { nspec, ngll, ngll }),
+      [=](const int ispec, const int iz, const int ix) {
         double xcor = 0.0;
         double zcor = 0.0;
 
         for (int in = 0; in < ngnod; in++) {
-          xcor += coord(0, ispec, in) * shape_functions[in];
-          zcor += coord(1, ispec, in) * shape_functions[in];
+          xcor += coord(0, ispec, in) * shape2D(iz, ix, in);
+          zcor += coord(1, ispec, in) * shape2D(iz, ix, in);
         }
 
         global_coordinates(ispec, iz, ix, 0) = xcor;
         global_coordinates(ispec, iz, ix, 1) = zcor;
-      }
-    }
-  }
+      });
 
   // // Compute the cartesian coordinates of the GLL points
   // Kokkos::parallel_for(
@@ -411,7 +890,43 @@ specfem::compute::points specfem::compute::mesh::assemble() {
 
   // Kokkos::fence();
 
-  return assign_numbering(global_coordinates);
+  if (numbering == specfem::compute::global_numbering::topology) {
+    specfem::compute::points points(nspec, ngll, ngll);
+    if (assign_numbering_by_topology(global_coordinates,
+                                     this->control_nodes.h_index_mapping,
+                                     this->mapping.ordering, points)) {
+      return points;
+    }
+  }
+
+  return assign_numbering_by_coordinates(global_coordinates,
+                                         this->mapping.ordering);
+}
+
+specfem::compute::memory_footprint
+specfem::compute::mesh::get_memory_footprint() const {
+  specfem::compute::memory_footprint footprint;
+
+  footprint.add(control_nodes.index_mapping, control_nodes.h_index_mapping)
+      .add(control_nodes.coord, control_nodes.h_coord)
+      .add(points.index_mapping, points.h_index_mapping)
+      .add(points.coord, points.h_coord)
+      .add(quadratures.gll.xi, quadratures.gll.h_xi)
+      .add(quadratures.gll.weights, quadratures.gll.h_weights)
+      .add(quadratures.gll.hprime, quadratures.gll.h_hprime)
+      .add(quadratures.gll.shape_functions.shape2D,
+           quadratures.gll.shape_functions.h_shape2D)
+      .add(quadratures.gll.shape_functions.dshape2D,
+           quadratures.gll.shape_functions.h_dshape2D)
+      .add(mapping.compute_to_mesh)
+      .add(mapping.mesh_to_compute)
+      .add(mapping.outer)
+      .add(spatial_index.h_cell_offsets)
+      .add(spatial_index.h_cell_elements)
+      .add(spatial_index.h_adjacency_offsets)
+      .add(spatial_index.h_adjacency);
+
+  return footprint;
 }
 
 // specfem::compute::compute::compute(
@@ -4,6 +4,9 @@
 #include "macros.hpp"
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 specfem::compute::partial_derivatives::partial_derivatives(const int nspec,
                                                            const int ngllz,
@@ -21,7 +24,9 @@ specfem::compute::partial_derivatives::partial_derivatives(const int nspec,
       h_xiz(Kokkos::create_mirror_view(xiz)),
       h_gammax(Kokkos::create_mirror_view(gammax)),
       h_gammaz(Kokkos::create_mirror_view(gammaz)),
-      h_jacobian(Kokkos::create_mirror_view(jacobian)) {
+      h_jacobian(Kokkos::create_mirror_view(jacobian)),
+      h_is_affine("specfem::compute::partial_derivatives::is_affine", nspec),
+      affine(nspec) {
   return;
 };
 
@@ -41,7 +46,9 @@ specfem::compute::partial_derivatives::partial_derivatives(
       h_xiz(Kokkos::create_mirror_view(xiz)),
       h_gammax(Kokkos::create_mirror_view(gammax)),
       h_gammaz(Kokkos::create_mirror_view(gammaz)),
-      h_jacobian(Kokkos::create_mirror_view(jacobian)) {
+      h_jacobian(Kokkos::create_mirror_view(jacobian)),
+      h_is_affine("specfem::compute::partial_derivatives::is_affine", nspec),
+      affine(nspec) {
 
   const int ngnod = mesh.control_nodes.ngnod;
   const int ngllxz = ngllz * ngllx;
@@ -97,6 +104,8 @@ specfem::compute::partial_derivatives::partial_derivatives(
   Kokkos::deep_copy(gammaz, h_gammaz);
   Kokkos::deep_copy(jacobian, h_jacobian);
 
+  this->compute_affine_elements();
+
   return;
 }
 
@@ -106,4 +115,107 @@ void specfem::compute::partial_derivatives::sync_views() {
   Kokkos::deep_copy(gammax, h_gammax);
   Kokkos::deep_copy(gammaz, h_gammaz);
   Kokkos::deep_copy(jacobian, h_jacobian);
+
+  this->compute_affine_elements();
+}
+
+void specfem::compute::partial_derivatives::compute_affine_elements() {
+  // Partial derivatives of an affine element only differ by round-off
+  constexpr type_real tolerance =
+      100 * std::numeric_limits<type_real>::epsilon();
+
+  naffine = 0;
+
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    const type_real xix0 = h_xix(ispec, 0, 0);
+    const type_real xiz0 = h_xiz(ispec, 0, 0);
+    const type_real gammax0 = h_gammax(ispec, 0, 0);
+    const type_real gammaz0 = h_gammaz(ispec, 0, 0);
+    const type_real jacobian0 = h_jacobian(ispec, 0, 0);
+
+    const type_real metric_tolerance =
+        tolerance * std::max({ std::abs(xix0), std::abs(xiz0),
+                               std::abs(gammax0), std::abs(gammaz0) });
+    const type_real jacobian_tolerance = tolerance * std::abs(jacobian0);
+
+    bool is_affine = true;
+    for (int iz = 0; iz < ngllz && is_affine; ++iz) {
+      for (int ix = 0; ix < ngllx && is_affine; ++ix) {
+        is_affine =
+            (std::abs(h_xix(ispec, iz, ix) - xix0) <= metric_tolerance) &&
+            (std::abs(h_xiz(ispec, iz, ix) - xiz0) <= metric_tolerance) &&
+            (std::abs(h_gammax(ispec, iz, ix) - gammax0) <=
+             metric_tolerance) &&
+            (std::abs(h_gammaz(ispec, iz, ix) - gammaz0) <=
+             metric_tolerance) &&
+            (std::abs(h_jacobian(ispec, iz, ix) - jacobian0) <=
+             jacobian_tolerance);
+      }
+    }
+
+    h_is_affine(ispec) = is_affine;
+    affine.h_xix(ispec) = xix0;
+    affine.h_xiz(ispec) = xiz0;
+    affine.h_gammax(ispec) = gammax0;
+    affine.h_gammaz(ispec) = gammaz0;
+    affine.h_jacobian(ispec) = jacobian0;
+
+    if (is_affine)
+      naffine++;
+  }
+
+  affine.sync_views();
+
+  return;
+}
+
+specfem::compute::memory_footprint
+specfem::compute::partial_derivatives::get_memory_footprint() const {
+  specfem::compute::memory_footprint footprint;
+
+  footprint.add(xix, h_xix)
+      .add(xiz, h_xiz)
+      .add(gammax, h_gammax)
+      .add(gammaz, h_gammaz)
+      .add(jacobian, h_jacobian)
+      .add(h_is_affine);
+
+  footprint += affine.get_memory_footprint();
+
+  return footprint;
+}
+
+specfem::compute::affine_partial_derivatives::affine_partial_derivatives(
+    const int nspec)
+    : nspec(nspec),
+      xix("specfem::compute::affine_partial_derivatives::xix", nspec),
+      xiz("specfem::compute::affine_partial_derivatives::xiz", nspec),
+      gammax("specfem::compute::affine_partial_derivatives::gammax", nspec),
+      gammaz("specfem::compute::affine_partial_derivatives::gammaz", nspec),
+      jacobian("specfem::compute::affine_partial_derivatives::jacobian", nspec),
+      h_xix(Kokkos::create_mirror_view(xix)),
+      h_xiz(Kokkos::create_mirror_view(xiz)),
+      h_gammax(Kokkos::create_mirror_view(gammax)),
+      h_gammaz(Kokkos::create_mirror_view(gammaz)),
+      h_jacobian(Kokkos::create_mirror_view(jacobian)) {}
+
+void specfem::compute::affine_partial_derivatives::sync_views() {
+  Kokkos::deep_copy(xix, h_xix);
+  Kokkos::deep_copy(xiz, h_xiz);
+  Kokkos::deep_copy(gammax, h_gammax);
+  Kokkos::deep_copy(gammaz, h_gammaz);
+  Kokkos::deep_copy(jacobian, h_jacobian);
+}
+
+specfem::compute::memory_footprint
+specfem::compute::affine_partial_derivatives::get_memory_footprint() const {
+  specfem::compute::memory_footprint footprint;
+
+  footprint.add(xix, h_xix)
+      .add(xiz, h_xiz)
+      .add(gammax, h_gammax)
+      .add(gammaz, h_gammaz)
+      .add(jacobian, h_jacobian);
+
+  return footprint;
 }
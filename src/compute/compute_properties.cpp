@@ -94,3 +94,16 @@ specfem::compute::properties::properties(
 
   return;
 }
+
+specfem::compute::memory_footprint
+specfem::compute::properties::get_memory_footprint() const {
+  specfem::compute::memory_footprint footprint;
+
+  footprint.add(property_index_mapping, h_property_index_mapping)
+      .add(element_types, h_element_types)
+      .add(element_property, h_element_property);
+  footprint += elastic_isotropic.get_memory_footprint();
+  footprint += acoustic_isotropic.get_memory_footprint();
+
+  return footprint;
+}
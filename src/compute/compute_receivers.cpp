@@ -7,11 +7,13 @@
 #include "specfem_mpi/interface.hpp"
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
+#include <algorithm>
 #include <vector>
 
 specfem::compute::receivers::receivers(const int nreceivers,
                                        const int max_sig_step, const int N,
-                                       const int n_seis_types)
+                                       const int n_seis_types,
+                                       const int buffer_size)
     : nreceivers(nreceivers), station_names(nreceivers),
       network_names(nreceivers),
       receiver_array("specfem::compute::receiver::receiver_array", nreceivers,
@@ -23,43 +25,50 @@ specfem::compute::receivers::receivers(const int nreceivers,
       h_cos_recs(Kokkos::create_mirror_view(cos_recs)),
       sin_recs("specfem::compute::receivers::sin_recs", nreceivers),
       h_sin_recs(Kokkos::create_mirror_view(sin_recs)),
-      seismogram("specfem::compute::receivers::seismogram", max_sig_step,
+      seismogram("specfem::compute::receivers::seismogram",
+                 (buffer_size > 0) ? std::min(buffer_size, max_sig_step)
+                                   : max_sig_step,
                  n_seis_types, nreceivers, ndim),
       h_seismogram(Kokkos::create_mirror_view(seismogram)),
       seismogram_types("specfem::compute::receivers::seismogram_types",
                        n_seis_types),
       h_seismogram_types(Kokkos::create_mirror_view(seismogram_types)),
       receiver_field("specfem::compute::receivers::receiver_field", N, N,
-                     n_seis_types, nreceivers, max_sig_step),
-      h_receiver_field(Kokkos::create_mirror_view(receiver_field)) {}
+                     n_seis_types, nreceivers) {}
 
 specfem::compute::receivers::receivers(
     const int max_sig_step,
     const std::vector<std::shared_ptr<specfem::receivers::receiver> >
         &receivers,
     const std::vector<specfem::enums::seismogram::type> &stypes,
-    const specfem::compute::mesh &mesh) {
+    const specfem::compute::mesh &mesh, const int buffer_size) {
 
   const int nreceivers = receivers.size();
   const int N = mesh.quadratures.gll.N;
   const int n_seis_types = stypes.size();
 
-  *this =
-      specfem::compute::receivers(nreceivers, max_sig_step, N, n_seis_types);
+  *this = specfem::compute::receivers(nreceivers, max_sig_step, N,
+                                      n_seis_types, buffer_size);
+
+  // Locate all receivers at once
+  specfem::kokkos::HostView1d<
+      specfem::point::global_coordinates<specfem::dimension::type::dim2> >
+      coordinates("specfem::compute::receivers::coordinates", nreceivers);
+  for (int irec = 0; irec < nreceivers; irec++) {
+    coordinates(irec) = { receivers[irec]->get_x(), receivers[irec]->get_z() };
+  }
+
+  const auto lcoord = specfem::algorithms::locate_point(coordinates, mesh);
 
   for (int irec = 0; irec < nreceivers; irec++) {
     station_names[irec] = receivers[irec]->get_station_name();
     network_names[irec] = receivers[irec]->get_network_name();
     auto sv_receiver_array = Kokkos::subview(
         this->h_receiver_array, irec, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
-    receivers[irec]->compute_receiver_array(mesh, sv_receiver_array);
+    receivers[irec]->compute_receiver_array(lcoord(irec), mesh,
+                                            sv_receiver_array);
 
-    specfem::point::global_coordinates<specfem::dimension::type::dim2> coord = {
-      receivers[irec]->get_x(), receivers[irec]->get_z()
-    };
-    auto lcoord = specfem::algorithms::locate_point(coord, mesh);
-
-    this->h_ispec_array(irec) = lcoord.ispec;
+    this->h_ispec_array(irec) = lcoord(irec).ispec;
     const auto angle = receivers[irec]->get_angle();
 
     this->h_cos_recs(irec) =
@@ -86,3 +95,28 @@ void specfem::compute::receivers::sync_seismograms() {
 
   return;
 }
+
+void specfem::compute::receivers::sync_receiver_field() {
+  if (h_receiver_field.size() != receiver_field.size()) {
+    h_receiver_field = Kokkos::create_mirror_view(receiver_field);
+  }
+
+  Kokkos::deep_copy(h_receiver_field, receiver_field);
+
+  return;
+}
+
+specfem::compute::memory_footprint
+specfem::compute::receivers::get_memory_footprint() const {
+  specfem::compute::memory_footprint footprint;
+
+  footprint.add(receiver_array, h_receiver_array)
+      .add(ispec_array, h_ispec_array)
+      .add(cos_recs, h_cos_recs)
+      .add(sin_recs, h_sin_recs)
+      .add(seismogram, h_seismogram)
+      .add(seismogram_types, h_seismogram_types)
+      .add(receiver_field, h_receiver_field);
+
+  return footprint;
+}
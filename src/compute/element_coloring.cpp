@@ -0,0 +1,113 @@
+#include "compute/element_coloring.hpp"
+#include "kokkos_abstractions.h"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+specfem::compute::element_coloring::element_coloring(
+    const specfem::compute::points &points,
+    const specfem::kokkos::HostView1d<int> elements, const int block_size) {
+
+  if (block_size < 1) {
+    throw std::runtime_error("Element coloring block size must be positive");
+  }
+
+  const int nelements = elements.extent(0);
+  const int nblocks = nelements / block_size + (nelements % block_size != 0);
+  const int ngllz = points.ngllz;
+  const int ngllx = points.ngllx;
+
+  // Colors already used by blocks touching a global point. Greedy coloring of
+  // a 2D quadrilateral mesh needs at most 4 colors for structured meshes and
+  // seldom more than 8 otherwise
+  constexpr int max_colors = 64;
+  int nglob = 0;
+  for (int ielement = 0; ielement < nelements; ielement++) {
+    const int ispec = elements(ielement);
+    for (int iz = 0; iz < ngllz; iz++) {
+      for (int ix = 0; ix < ngllx; ix++) {
+        nglob = std::max(nglob, points.h_index_mapping(ispec, iz, ix) + 1);
+      }
+    }
+  }
+  std::vector<std::uint64_t> used_colors(nglob, 0);
+
+  std::vector<int> block_color(nblocks);
+  for (int iblock = 0; iblock < nblocks; iblock++) {
+    const int start = iblock * block_size;
+    const int end = std::min(start + block_size, nelements);
+
+    std::uint64_t used = 0;
+    for (int ielement = start; ielement < end; ielement++) {
+      const int ispec = elements(ielement);
+      for (int iz = 0; iz < ngllz; iz++) {
+        for (int ix = 0; ix < ngllx; ix++) {
+          used |= used_colors[points.h_index_mapping(ispec, iz, ix)];
+        }
+      }
+    }
+
+    int color = 0;
+    while (color < max_colors && (used & (std::uint64_t(1) << color)))
+      color++;
+
+    if (color == max_colors) {
+      std::ostringstream message;
+      message << "Error coloring elements. \n"
+              << "More than " << max_colors
+              << " colors are required to color " << nelements
+              << " elements.";
+      throw std::runtime_error(message.str());
+    }
+
+    for (int ielement = start; ielement < end; ielement++) {
+      const int ispec = elements(ielement);
+      for (int iz = 0; iz < ngllz; iz++) {
+        for (int ix = 0; ix < ngllx; ix++) {
+          used_colors[points.h_index_mapping(ispec, iz, ix)] |=
+              (std::uint64_t(1) << color);
+        }
+      }
+    }
+
+    block_color[iblock] = color;
+    ncolors = std::max(ncolors, color + 1);
+  }
+
+  h_color_offsets = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::element_coloring::color_offsets", ncolors + 1);
+
+  for (int iblock = 0; iblock < nblocks; iblock++) {
+    const int start = iblock * block_size;
+    const int end = std::min(start + block_size, nelements);
+    h_color_offsets(block_color[iblock] + 1) += end - start;
+  }
+
+  for (int icolor = 0; icolor < ncolors; icolor++) {
+    h_color_offsets(icolor + 1) += h_color_offsets(icolor);
+  }
+
+  element_index_mapping = specfem::kokkos::DeviceView1d<int>(
+      "specfem::compute::element_coloring::element_index_mapping", nelements);
+  h_element_index_mapping = Kokkos::create_mirror_view(element_index_mapping);
+
+  // Blocks are visited in ascending order, so a partial block is always the
+  // last block of its color
+  std::vector<int> position(h_color_offsets.data(),
+                            h_color_offsets.data() + ncolors);
+  for (int iblock = 0; iblock < nblocks; iblock++) {
+    const int start = iblock * block_size;
+    const int end = std::min(start + block_size, nelements);
+    int &offset = position[block_color[iblock]];
+    for (int ielement = start; ielement < end; ielement++) {
+      h_element_index_mapping(offset++) = elements(ielement);
+    }
+  }
+
+  Kokkos::deep_copy(element_index_mapping, h_element_index_mapping);
+
+  return;
+}
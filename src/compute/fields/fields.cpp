@@ -20,13 +20,18 @@ template class specfem::compute::simulation_field<
 
 specfem::compute::fields::fields(const specfem::compute::mesh &mesh,
                                  const specfem::compute::properties &properties,
-                                 const specfem::simulation::type simulation)
+                                 const specfem::simulation::type simulation,
+                                 const bool checkpointing)
     : // Initialize the forward field only if the simulation type is forward
+      // or if the forward wavefield is recomputed during combined simulations
       forward([&]() -> specfem::compute::simulation_field<
                         specfem::wavefield::type::forward> {
         if (simulation == specfem::simulation::type::forward) {
           return { mesh, properties };
         } else if (simulation == specfem::simulation::type::combined) {
+          if (checkpointing) {
+            return { mesh, properties };
+          }
           return {};
         } else {
           throw std::runtime_error("Invalid simulation type");
@@ -55,11 +60,15 @@ specfem::compute::fields::fields(const specfem::compute::mesh &mesh,
         }
       }()),
       // Initialize the buffer field only if the simulation type is adjoint
+      // and the forward wavefield is read from disk
       buffer([&]() -> specfem::compute::simulation_field<
                        specfem::wavefield::type::buffer> {
         if (simulation == specfem::simulation::type::forward) {
           return {};
         } else if (simulation == specfem::simulation::type::combined) {
+          if (checkpointing) {
+            return {};
+          }
           return { mesh, properties };
         } else {
           throw std::runtime_error("Invalid simulation type");
@@ -0,0 +1,247 @@
+#include "compute/mpi_interfaces/mpi_interfaces.hpp"
+#include "algorithms/locate_point.hpp"
+#include "kokkos_abstractions.h"
+#include "specfem_setup.hpp"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#ifdef MPI_PARALLEL
+#include <mpi.h>
+#endif
+
+namespace {
+
+struct interface_point {
+  int iglob;
+  type_real x;
+  type_real z;
+};
+
+// Corners of an element in the order of the control nodes
+constexpr int ncorners = 4;
+
+int find_corner(const specfem::kokkos::HostView2d<int> knods, const int ispec,
+                const int node) {
+  for (int icorner = 0; icorner < ncorners; icorner++) {
+    if (knods(icorner, ispec) == node)
+      return icorner;
+  }
+
+  std::ostringstream message;
+  message << "Error computing MPI interfaces. Control node " << node
+          << " is not a corner of element " << ispec;
+  throw std::runtime_error(message.str());
+}
+
+// Tolerance used to compare the coordinates of interface points. It has to
+// be the same on every rank, so it is computed from the extent of the whole
+// domain
+type_real get_tolerance(const specfem::compute::points &points,
+                        const specfem::MPI::MPI *mpi) {
+  const type_real extent = std::max(points.xmax - points.xmin,
+                                    points.zmax - points.zmin);
+  return 1e-6 * mpi->all_reduce(extent, specfem::MPI::max);
+}
+
+// Check that every neighbor found the same number of points on the interface
+void check_interface_sizes(const specfem::kokkos::HostView1d<int> neighbors,
+                           const specfem::kokkos::HostView1d<int> offsets,
+                           const specfem::MPI::MPI *mpi) {
+#ifdef MPI_PARALLEL
+  const MPI_Comm comm = mpi->get_comm();
+  const int nneighbors = neighbors.extent(0);
+  std::vector<int> sizes(nneighbors);
+  std::vector<int> neighbor_sizes(nneighbors);
+  std::vector<MPI_Request> requests(2 * nneighbors);
+
+  for (int i = 0; i < nneighbors; i++) {
+    sizes[i] = offsets(i + 1) - offsets(i);
+    MPI_Irecv(&neighbor_sizes[i], 1, MPI_INT, neighbors(i), 0, comm,
+              &requests[i]);
+    MPI_Isend(&sizes[i], 1, MPI_INT, neighbors(i), 0, comm,
+              &requests[nneighbors + i]);
+  }
+
+  MPI_Waitall(2 * nneighbors, requests.data(), MPI_STATUSES_IGNORE);
+
+  for (int i = 0; i < nneighbors; i++) {
+    if (sizes[i] != neighbor_sizes[i]) {
+      const int rank = mpi->get_rank();
+      std::ostringstream message;
+      message << "Error computing MPI interfaces. Rank " << rank << " shares "
+              << sizes[i] << " points with rank " << neighbors(i)
+              << ", which shares " << neighbor_sizes[i] << " points with rank "
+              << rank;
+      throw std::runtime_error(message.str());
+    }
+  }
+#endif
+  return;
+}
+
+} // namespace
+
+specfem::compute::mpi_interfaces::mpi_interfaces(
+    const specfem::mesh::mesh &mesh, const specfem::compute::points &points,
+    const specfem::compute::mesh_to_compute_mapping &mapping)
+    : nneighbors(mesh.mpi_interfaces.ninterfaces), mpi(mesh.mpi) {
+
+  if (nneighbors > 0 && mpi == nullptr) {
+    std::ostringstream message;
+    message << "Error computing MPI interfaces. The mesh shares points with "
+            << nneighbors << " other partitions but has no MPI object";
+    throw std::runtime_error(message.str());
+  }
+
+  const auto &interfaces = mesh.mpi_interfaces;
+  const auto knods = mesh.control_nodes.knods;
+  const int ngllx = points.ngllx;
+  const int ngllz = points.ngllz;
+
+  // GLL points at the corners of an element
+  const int corner_ix[ncorners] = { 0, ngllx - 1, ngllx - 1, 0 };
+  const int corner_iz[ncorners] = { 0, 0, ngllz - 1, ngllz - 1 };
+
+  // Interfaces are empty when the mesh is not partitioned
+  const type_real tolerance = (mpi != nullptr) ? get_tolerance(points, mpi)
+                                               : type_real(0.0);
+
+  this->h_neighbors = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::mpi_interfaces::neighbors", nneighbors);
+  this->h_offsets = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::mpi_interfaces::offsets", nneighbors + 1);
+
+  std::vector<std::vector<interface_point> > interface_points(nneighbors);
+
+  for (int iinterface = 0; iinterface < nneighbors; iinterface++) {
+    this->h_neighbors(iinterface) = interfaces.my_neighbors(iinterface);
+    auto &list = interface_points[iinterface];
+
+    for (int ie = 0; ie < interfaces.my_nelmnts_neighbors(iinterface); ie++) {
+      const int ispec_mesh = interfaces.my_interfaces(iinterface, ie, 0);
+      const int itype = interfaces.my_interfaces(iinterface, ie, 1);
+      const int ispec = mapping.mesh_to_compute(ispec_mesh);
+
+      const int corner1 = find_corner(
+          knods, ispec_mesh, interfaces.my_interfaces(iinterface, ie, 2));
+      // Corner interfaces only share a single point
+      const int corner2 =
+          (itype == 1)
+              ? corner1
+              : find_corner(knods, ispec_mesh,
+                            interfaces.my_interfaces(iinterface, ie, 3));
+
+      const int ixmin = std::min(corner_ix[corner1], corner_ix[corner2]);
+      const int ixmax = std::max(corner_ix[corner1], corner_ix[corner2]);
+      const int izmin = std::min(corner_iz[corner1], corner_iz[corner2]);
+      const int izmax = std::max(corner_iz[corner1], corner_iz[corner2]);
+
+      for (int iz = izmin; iz <= izmax; iz++) {
+        for (int ix = ixmin; ix <= ixmax; ix++) {
+          list.push_back({ points.h_index_mapping(ispec, iz, ix),
+                           points.h_coord(0, ispec, iz, ix),
+                           points.h_coord(1, ispec, iz, ix) });
+        }
+      }
+    }
+
+    // Points shared by several interface elements are only exchanged once
+    std::sort(list.begin(), list.end(),
+              [](const interface_point &a, const interface_point &b) {
+                return a.iglob < b.iglob;
+              });
+    list.erase(std::unique(list.begin(), list.end(),
+                           [](const interface_point &a,
+                              const interface_point &b) {
+                             return a.iglob == b.iglob;
+                           }),
+               list.end());
+
+    // Both ranks need to order the points identically. Coordinates computed
+    // on either side of the interface only agree up to round-off
+    std::sort(list.begin(), list.end(),
+              [tolerance](const interface_point &a, const interface_point &b) {
+                if (std::abs(a.x - b.x) > tolerance)
+                  return a.x < b.x;
+                return a.z < b.z;
+              });
+
+    this->h_offsets(iinterface + 1) = this->h_offsets(iinterface) + list.size();
+  }
+
+  this->npoints = this->h_offsets(nneighbors);
+
+  this->index_mapping = specfem::kokkos::DeviceView1d<int>(
+      "specfem::compute::mpi_interfaces::index_mapping", this->npoints);
+  this->h_index_mapping = Kokkos::create_mirror_view(this->index_mapping);
+
+  for (int iinterface = 0; iinterface < nneighbors; iinterface++) {
+    const int offset = this->h_offsets(iinterface);
+    const auto &list = interface_points[iinterface];
+    for (int ipoint = 0; ipoint < list.size(); ipoint++) {
+      this->h_index_mapping(offset + ipoint) = list[ipoint].iglob;
+    }
+  }
+
+  Kokkos::deep_copy(this->index_mapping, this->h_index_mapping);
+
+  if (nneighbors > 0)
+    check_interface_sizes(this->h_neighbors, this->h_offsets, mpi);
+
+  return;
+}
+
+std::vector<bool> specfem::compute::owned_points(
+    const std::vector<
+        specfem::point::global_coordinates<specfem::dimension::type::dim2> >
+        &coordinates,
+    const specfem::compute::mesh &mesh, const specfem::MPI::MPI *mpi) {
+
+  const int npoints = coordinates.size();
+  std::vector<bool> owned(npoints, true);
+
+#ifdef MPI_PARALLEL
+  if (mpi == nullptr || mpi->get_size() == 1 || npoints == 0)
+    return owned;
+
+  const int rank = mpi->get_rank();
+
+  specfem::kokkos::HostView1d<
+      specfem::point::global_coordinates<specfem::dimension::type::dim2> >
+      h_coordinates("specfem::compute::owned_points::coordinates", npoints);
+  for (int ipoint = 0; ipoint < npoints; ipoint++) {
+    h_coordinates(ipoint) = coordinates[ipoint];
+  }
+
+  const auto lcoord = specfem::algorithms::locate_point(h_coordinates, mesh);
+
+  // Layout of MPI_DOUBLE_INT
+  struct distance_rank {
+    double distance;
+    int rank;
+  };
+
+  std::vector<distance_rank> local(npoints);
+  std::vector<distance_rank> global(npoints);
+
+  for (int ipoint = 0; ipoint < npoints; ipoint++) {
+    const auto located =
+        specfem::algorithms::locate_point(lcoord(ipoint), mesh);
+    local[ipoint].distance = std::hypot(located.x - coordinates[ipoint].x,
+                                        located.z - coordinates[ipoint].z);
+    local[ipoint].rank = rank;
+  }
+
+  MPI_Allreduce(local.data(), global.data(), npoints, MPI_DOUBLE_INT,
+                MPI_MINLOC, mpi->get_comm());
+
+  for (int ipoint = 0; ipoint < npoints; ipoint++) {
+    owned[ipoint] = (global[ipoint].rank == rank);
+  }
+#endif
+
+  return owned;
+}
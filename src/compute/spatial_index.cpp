@@ -0,0 +1,282 @@
+#include "compute/spatial_index.hpp"
+#include "compute/compute_mesh.hpp"
+#include "kokkos_abstractions.h"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+// Range of cells [first, last] covering the interval [lower, upper]
+std::tuple<int, int> cell_range(const type_real lower, const type_real upper,
+                                const type_real origin, const type_real size,
+                                const int ncells) {
+  const int first = static_cast<int>(std::floor((lower - origin) / size));
+  const int last = static_cast<int>(std::floor((upper - origin) / size));
+  return std::make_tuple(std::clamp(first, 0, ncells - 1),
+                         std::clamp(last, 0, ncells - 1));
+}
+
+} // namespace
+
+specfem::compute::spatial_index::spatial_index(
+    const specfem::compute::points &points)
+    : nspec(points.nspec) {
+
+  const int ngllz = points.ngllz;
+  const int ngllx = points.ngllx;
+  const auto coord = points.h_coord;
+  const auto index_mapping = points.h_index_mapping;
+
+  // Bounding box of every element
+  std::vector<type_real> bounds(4 * nspec);
+  type_real x_lower = std::numeric_limits<type_real>::max();
+  type_real x_upper = std::numeric_limits<type_real>::lowest();
+  type_real z_lower = std::numeric_limits<type_real>::max();
+  type_real z_upper = std::numeric_limits<type_real>::lowest();
+
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    type_real ex_lower = std::numeric_limits<type_real>::max();
+    type_real ex_upper = std::numeric_limits<type_real>::lowest();
+    type_real ez_lower = std::numeric_limits<type_real>::max();
+    type_real ez_upper = std::numeric_limits<type_real>::lowest();
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        ex_lower = std::min(ex_lower, coord(0, ispec, iz, ix));
+        ex_upper = std::max(ex_upper, coord(0, ispec, iz, ix));
+        ez_lower = std::min(ez_lower, coord(1, ispec, iz, ix));
+        ez_upper = std::max(ez_upper, coord(1, ispec, iz, ix));
+      }
+    }
+    bounds[4 * ispec + 0] = ex_lower;
+    bounds[4 * ispec + 1] = ex_upper;
+    bounds[4 * ispec + 2] = ez_lower;
+    bounds[4 * ispec + 3] = ez_upper;
+    x_lower = std::min(x_lower, ex_lower);
+    x_upper = std::max(x_upper, ex_upper);
+    z_lower = std::min(z_lower, ez_lower);
+    z_upper = std::max(z_upper, ez_upper);
+  }
+
+  // Choose about one cell per element with the aspect ratio of the mesh
+  const type_real width = std::max(x_upper - x_lower, type_real(0));
+  const type_real height = std::max(z_upper - z_lower, type_real(0));
+  if (width > 0 && height > 0) {
+    ncells_x = std::clamp(static_cast<int>(std::round(
+                              std::sqrt(nspec * width / height))),
+                          1, std::max(1, nspec));
+    ncells_z = std::max(1, static_cast<int>(std::round(
+                               static_cast<type_real>(nspec) / ncells_x)));
+  } else {
+    ncells_x = (width > 0) ? std::max(1, nspec) : 1;
+    ncells_z = (height > 0) ? std::max(1, nspec) : 1;
+  }
+
+  xmin = x_lower;
+  zmin = z_lower;
+  cell_size_x = (width > 0) ? width / ncells_x : type_real(1);
+  cell_size_z = (height > 0) ? height / ncells_z : type_real(1);
+
+  // Bin the elements into cells
+  const int ncells = ncells_x * ncells_z;
+  h_cell_offsets = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::spatial_index::cell_offsets", ncells + 1);
+
+  const auto element_cells = [&](const int ispec) {
+    const auto [ix_first, ix_last] =
+        cell_range(bounds[4 * ispec + 0], bounds[4 * ispec + 1], xmin,
+                   cell_size_x, ncells_x);
+    const auto [iz_first, iz_last] =
+        cell_range(bounds[4 * ispec + 2], bounds[4 * ispec + 3], zmin,
+                   cell_size_z, ncells_z);
+    return std::make_tuple(ix_first, ix_last, iz_first, iz_last);
+  };
+
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    const auto [ix_first, ix_last, iz_first, iz_last] = element_cells(ispec);
+    for (int iz = iz_first; iz <= iz_last; ++iz) {
+      for (int ix = ix_first; ix <= ix_last; ++ix) {
+        h_cell_offsets(iz * ncells_x + ix + 1) += 1;
+      }
+    }
+  }
+
+  for (int icell = 0; icell < ncells; ++icell) {
+    h_cell_offsets(icell + 1) += h_cell_offsets(icell);
+  }
+
+  h_cell_elements = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::spatial_index::cell_elements",
+      h_cell_offsets(ncells));
+
+  std::vector<int> cell_fill(ncells, 0);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    const auto [ix_first, ix_last, iz_first, iz_last] = element_cells(ispec);
+    for (int iz = iz_first; iz <= iz_last; ++iz) {
+      for (int ix = ix_first; ix <= ix_last; ++ix) {
+        const int icell = iz * ncells_x + ix;
+        h_cell_elements(h_cell_offsets(icell) + cell_fill[icell]++) = ispec;
+      }
+    }
+  }
+
+  // Elements sharing a corner. Corner points are mapped to the elements that
+  // contain them
+  int nglob = 0;
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        nglob = std::max(nglob, index_mapping(ispec, iz, ix) + 1);
+      }
+    }
+  }
+
+  const auto corner = [&](const int ispec, const int icorner) {
+    const int iz = (icorner / 2) * (ngllz - 1);
+    const int ix = (icorner % 2) * (ngllx - 1);
+    return index_mapping(ispec, iz, ix);
+  };
+
+  std::vector<int> point_offsets(nglob + 1, 0);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    for (int icorner = 0; icorner < 4; ++icorner) {
+      point_offsets[corner(ispec, icorner) + 1] += 1;
+    }
+  }
+
+  for (int iglob = 0; iglob < nglob; ++iglob) {
+    point_offsets[iglob + 1] += point_offsets[iglob];
+  }
+
+  std::vector<int> point_elements(point_offsets[nglob]);
+  std::vector<int> point_fill(nglob, 0);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    for (int icorner = 0; icorner < 4; ++icorner) {
+      const int iglob = corner(ispec, icorner);
+      point_elements[point_offsets[iglob] + point_fill[iglob]++] = ispec;
+    }
+  }
+
+  std::vector<std::vector<int> > neighbours(nspec);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    auto &elements = neighbours[ispec];
+    for (int icorner = 0; icorner < 4; ++icorner) {
+      const int iglob = corner(ispec, icorner);
+      for (int i = point_offsets[iglob]; i < point_offsets[iglob + 1]; ++i) {
+        if (point_elements[i] != ispec) {
+          elements.push_back(point_elements[i]);
+        }
+      }
+    }
+    std::sort(elements.begin(), elements.end());
+    elements.erase(std::unique(elements.begin(), elements.end()),
+                   elements.end());
+  }
+
+  h_adjacency_offsets = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::spatial_index::adjacency_offsets", nspec + 1);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    h_adjacency_offsets(ispec + 1) =
+        h_adjacency_offsets(ispec) + neighbours[ispec].size();
+  }
+
+  h_adjacency = specfem::kokkos::HostView1d<int>(
+      "specfem::compute::spatial_index::adjacency", h_adjacency_offsets(nspec));
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    std::copy(neighbours[ispec].begin(), neighbours[ispec].end(),
+              h_adjacency.data() + h_adjacency_offsets(ispec));
+  }
+
+  return;
+}
+
+std::tuple<int, int, int>
+specfem::compute::spatial_index::closest_quadrature_point(
+    const specfem::compute::points &points,
+    const specfem::point::global_coordinates<specfem::dimension::type::dim2>
+        &coordinates) const {
+
+  const int ngllz = points.ngllz;
+  const int ngllx = points.ngllx;
+  const auto coord = points.h_coord;
+
+  const int icx = std::get<0>(cell_range(coordinates.x, coordinates.x, xmin,
+                                         cell_size_x, ncells_x));
+  const int icz = std::get<0>(cell_range(coordinates.z, coordinates.z, zmin,
+                                         cell_size_z, ncells_z));
+
+  // Guards the search against round-off in the binning of quadrature points
+  const type_real tolerance = 1e-4 * std::min(cell_size_x, cell_size_z);
+
+  type_real dist_min = std::numeric_limits<type_real>::max();
+  int ispec_selected = -1, ix_selected = -1, iz_selected = -1;
+
+  // Search rings of cells around the cell of the point until no unvisited
+  // cell can contain a closer quadrature point
+  for (int ring = 0;; ++ring) {
+    const int ix_first = icx - ring;
+    const int ix_last = icx + ring;
+    const int iz_first = icz - ring;
+    const int iz_last = icz + ring;
+
+    for (int iz = std::max(iz_first, 0); iz <= std::min(iz_last, ncells_z - 1);
+         ++iz) {
+      for (int ix = std::max(ix_first, 0);
+           ix <= std::min(ix_last, ncells_x - 1); ++ix) {
+        // Only visit the cells on the boundary of the ring
+        if (iz != iz_first && iz != iz_last && ix != ix_first && ix != ix_last)
+          continue;
+
+        const int icell = iz * ncells_x + ix;
+        for (int i = h_cell_offsets(icell); i < h_cell_offsets(icell + 1);
+             ++i) {
+          const int ispec = h_cell_elements(i);
+          for (int j = 0; j < ngllz; ++j) {
+            for (int k = 0; k < ngllx; ++k) {
+              const specfem::point::global_coordinates<
+                  specfem::dimension::type::dim2>
+                  cart_coord = { coord(0, ispec, j, k), coord(1, ispec, j, k) };
+              const type_real distance =
+                  specfem::point::distance(coordinates, cart_coord);
+              // Break ties like a scan in (ispec, iz, ix) order would
+              if (distance < dist_min ||
+                  (distance == dist_min &&
+                   std::make_tuple(ispec, j, k) <
+                       std::make_tuple(ispec_selected, iz_selected,
+                                       ix_selected))) {
+                ispec_selected = ispec;
+                iz_selected = j;
+                ix_selected = k;
+                dist_min = distance;
+              }
+            }
+          }
+        }
+      }
+    }
+
+    // Lower bound on the distance to quadrature points in unvisited cells
+    type_real bound = std::numeric_limits<type_real>::max();
+    if (ix_first > 0)
+      bound = std::min(bound, coordinates.x - (xmin + ix_first * cell_size_x));
+    if (ix_last < ncells_x - 1)
+      bound = std::min(bound,
+                       (xmin + (ix_last + 1) * cell_size_x) - coordinates.x);
+    if (iz_first > 0)
+      bound = std::min(bound, coordinates.z - (zmin + iz_first * cell_size_z));
+    if (iz_last < ncells_z - 1)
+      bound = std::min(bound,
+                       (zmin + (iz_last + 1) * cell_size_z) - coordinates.z);
+
+    // Every cell has been visited
+    if (bound == std::numeric_limits<type_real>::max())
+      break;
+
+    if (ispec_selected >= 0 && dist_min < bound - tolerance)
+      break;
+  }
+
+  return std::make_tuple(ix_selected, iz_selected, ispec_selected);
+}
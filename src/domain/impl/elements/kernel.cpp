@@ -77,10 +77,22 @@ constexpr static auto composite_stacey_dirichlet =
 
 // Explicit template instantiation
 
+GENERATE_KERNELS(elastic, isotropic, 4)
+
+GENERATE_KERNELS(acoustic, isotropic, 4)
+
 GENERATE_KERNELS(elastic, isotropic, 5)
 
 GENERATE_KERNELS(acoustic, isotropic, 5)
 
+GENERATE_KERNELS(elastic, isotropic, 6)
+
+GENERATE_KERNELS(acoustic, isotropic, 6)
+
+GENERATE_KERNELS(elastic, isotropic, 7)
+
+GENERATE_KERNELS(acoustic, isotropic, 7)
+
 GENERATE_KERNELS(elastic, isotropic, 8)
 
 GENERATE_KERNELS(acoustic, isotropic, 8)
@@ -3,8 +3,14 @@
 
 namespace {
 
+using static_4 =
+    specfem::enums::element::quadrature::static_quadrature_points<4>;
 using static_5 =
     specfem::enums::element::quadrature::static_quadrature_points<5>;
+using static_6 =
+    specfem::enums::element::quadrature::static_quadrature_points<6>;
+using static_7 =
+    specfem::enums::element::quadrature::static_quadrature_points<7>;
 using static_8 =
     specfem::enums::element::quadrature::static_quadrature_points<8>;
 
@@ -12,6 +18,30 @@ using static_8 =
 
 // Explicit template instantiation
 
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::forward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::elastic, static_4>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::adjoint, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::elastic, static_4>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::backward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::elastic, static_4>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::forward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::acoustic, static_4>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::adjoint, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::acoustic, static_4>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::backward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::acoustic, static_4>;
+
 template class specfem::domain::impl::kernels::kernels<
     specfem::wavefield::type::forward, specfem::dimension::type::dim2,
     specfem::element::medium_tag::elastic, static_5>;
@@ -36,6 +66,54 @@ template class specfem::domain::impl::kernels::kernels<
     specfem::wavefield::type::backward, specfem::dimension::type::dim2,
     specfem::element::medium_tag::acoustic, static_5>;
 
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::forward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::elastic, static_6>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::adjoint, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::elastic, static_6>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::backward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::elastic, static_6>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::forward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::acoustic, static_6>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::adjoint, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::acoustic, static_6>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::backward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::acoustic, static_6>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::forward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::elastic, static_7>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::adjoint, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::elastic, static_7>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::backward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::elastic, static_7>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::forward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::acoustic, static_7>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::adjoint, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::acoustic, static_7>;
+
+template class specfem::domain::impl::kernels::kernels<
+    specfem::wavefield::type::backward, specfem::dimension::type::dim2,
+    specfem::element::medium_tag::acoustic, static_7>;
+
 template class specfem::domain::impl::kernels::kernels<
     specfem::wavefield::type::forward, specfem::dimension::type::dim2,
     specfem::element::medium_tag::elastic, static_8>;
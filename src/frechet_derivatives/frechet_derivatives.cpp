@@ -1,12 +1,30 @@
 #include "frechet_derivatives/frechet_derivatives.hpp"
 
 // Explicit template instantiation
+template class specfem::frechet_derivatives::frechet_derivatives<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::elastic, 4>;
+
+template class specfem::frechet_derivatives::frechet_derivatives<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::acoustic, 4>;
+
 template class specfem::frechet_derivatives::frechet_derivatives<
     specfem::dimension::type::dim2, specfem::element::medium_tag::elastic, 5>;
 
 template class specfem::frechet_derivatives::frechet_derivatives<
     specfem::dimension::type::dim2, specfem::element::medium_tag::acoustic, 5>;
 
+template class specfem::frechet_derivatives::frechet_derivatives<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::elastic, 6>;
+
+template class specfem::frechet_derivatives::frechet_derivatives<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::acoustic, 6>;
+
+template class specfem::frechet_derivatives::frechet_derivatives<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::elastic, 7>;
+
+template class specfem::frechet_derivatives::frechet_derivatives<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::acoustic, 7>;
+
 template class specfem::frechet_derivatives::frechet_derivatives<
     specfem::dimension::type::dim2, specfem::element::medium_tag::elastic, 8>;
 
@@ -2,6 +2,14 @@
 #include "frechet_derivatives/impl/frechet_element.tpp"
 
 // Explicit template instantiation
+template class specfem::frechet_derivatives::impl::frechet_elements<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::elastic,
+    specfem::element::property_tag::isotropic, 4>;
+
+template class specfem::frechet_derivatives::impl::frechet_elements<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::acoustic,
+    specfem::element::property_tag::isotropic, 4>;
+
 template class specfem::frechet_derivatives::impl::frechet_elements<
     specfem::dimension::type::dim2, specfem::element::medium_tag::elastic,
     specfem::element::property_tag::isotropic, 5>;
@@ -10,6 +18,22 @@ template class specfem::frechet_derivatives::impl::frechet_elements<
     specfem::dimension::type::dim2, specfem::element::medium_tag::acoustic,
     specfem::element::property_tag::isotropic, 5>;
 
+template class specfem::frechet_derivatives::impl::frechet_elements<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::elastic,
+    specfem::element::property_tag::isotropic, 6>;
+
+template class specfem::frechet_derivatives::impl::frechet_elements<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::acoustic,
+    specfem::element::property_tag::isotropic, 6>;
+
+template class specfem::frechet_derivatives::impl::frechet_elements<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::elastic,
+    specfem::element::property_tag::isotropic, 7>;
+
+template class specfem::frechet_derivatives::impl::frechet_elements<
+    specfem::dimension::type::dim2, specfem::element::medium_tag::acoustic,
+    specfem::element::property_tag::isotropic, 7>;
+
 template class specfem::frechet_derivatives::impl::frechet_elements<
     specfem::dimension::type::dim2, specfem::element::medium_tag::elastic,
     specfem::element::property_tag::isotropic, 8>;
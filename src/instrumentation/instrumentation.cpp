@@ -0,0 +1,184 @@
+#include "instrumentation/instrumentation.hpp"
+#include <Kokkos_Core.hpp>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+std::string escape(const std::string &value) {
+  std::ostringstream escaped;
+  for (const char c : value) {
+    if (c == '"' || c == '\\') {
+      escaped << '\\';
+    }
+    escaped << c;
+  }
+  return escaped.str();
+}
+
+} // namespace
+
+std::string
+specfem::instrumentation::to_string(const specfem::wavefield::type wavefield) {
+  switch (wavefield) {
+  case specfem::wavefield::type::forward:
+    return "forward";
+  case specfem::wavefield::type::adjoint:
+    return "adjoint";
+  case specfem::wavefield::type::backward:
+    return "backward";
+  case specfem::wavefield::type::buffer:
+    return "buffer";
+  }
+  return "unknown";
+}
+
+std::string specfem::instrumentation::to_string(
+    const specfem::element::medium_tag medium) {
+  switch (medium) {
+  case specfem::element::medium_tag::elastic:
+    return "elastic";
+  case specfem::element::medium_tag::acoustic:
+    return "acoustic";
+  case specfem::element::medium_tag::poroelastic:
+    return "poroelastic";
+  }
+  return "unknown";
+}
+
+specfem::instrumentation::registry::registry() {
+#ifdef ENABLE_PROFILING
+  this->enabled = true;
+#else
+  this->enabled = false;
+#endif
+}
+
+specfem::instrumentation::registry &
+specfem::instrumentation::registry::get() {
+  static registry instance;
+  return instance;
+}
+
+void specfem::instrumentation::registry::record(const std::string &phase,
+                                                const std::string &wavefield,
+                                                const std::string &medium,
+                                                const double time,
+                                                const std::size_t bytes) {
+  const auto key = std::make_tuple(phase, wavefield, medium);
+  auto it = this->index.find(key);
+  if (it == this->index.end()) {
+    it = this->index.emplace(key, this->timers.size()).first;
+    phase_timer timer;
+    timer.phase = phase;
+    timer.wavefield = wavefield;
+    timer.medium = medium;
+    this->timers.push_back(timer);
+  }
+
+  auto &timer = this->timers[it->second];
+  timer.calls += 1;
+  timer.time += time;
+  timer.bytes += bytes;
+}
+
+void specfem::instrumentation::registry::reset() {
+  this->timers.clear();
+  this->index.clear();
+}
+
+void specfem::instrumentation::registry::print(std::ostream &out) const {
+  double total = 0.0;
+  for (const auto &timer : this->timers) {
+    total += timer.time;
+  }
+
+  out << "Time loop phases:\n";
+  out << std::left << std::setw(24) << "  Phase" << std::setw(10)
+      << "Wavefield" << std::setw(12) << "Medium" << std::right
+      << std::setw(8) << "Calls" << std::setw(12) << "Time (s)"
+      << std::setw(8) << "%" << std::setw(14) << "Traffic (GB)"
+      << std::setw(10) << "GB/s\n";
+
+  for (const auto &timer : this->timers) {
+    out << std::left << std::setw(24) << ("  " + timer.phase)
+        << std::setw(10) << timer.wavefield << std::setw(12) << timer.medium
+        << std::right << std::setw(8) << timer.calls << std::setw(12)
+        << std::fixed << std::setprecision(4) << timer.time << std::setw(8)
+        << std::setprecision(1)
+        << ((total > 0.0) ? 100.0 * timer.time / total : 0.0);
+    if (timer.bytes > 0) {
+      out << std::setw(14) << std::setprecision(3)
+          << static_cast<double>(timer.bytes) / 1e9 << std::setw(10)
+          << std::setprecision(2) << timer.bandwidth();
+    } else {
+      out << std::setw(14) << "-" << std::setw(10) << "-";
+    }
+    out << "\n";
+  }
+
+  out << std::left << std::setw(54) << "  Total" << std::right
+      << std::setw(12) << std::fixed << std::setprecision(4) << total
+      << "\n";
+  out << std::defaultfloat;
+}
+
+void specfem::instrumentation::registry::write_json(std::ostream &out) const {
+  out << "{\n  \"phases\": [";
+  for (std::size_t i = 0; i < this->timers.size(); ++i) {
+    const auto &timer = this->timers[i];
+    out << ((i == 0) ? "\n" : ",\n");
+    out << "    {\"phase\": \"" << escape(timer.phase) << "\", "
+        << "\"wavefield\": \"" << escape(timer.wavefield) << "\", "
+        << "\"medium\": \"" << escape(timer.medium) << "\", "
+        << "\"calls\": " << timer.calls << ", "
+        << "\"time\": " << std::setprecision(9) << timer.time << ", "
+        << "\"bytes\": " << timer.bytes << ", "
+        << "\"bandwidth\": " << timer.bandwidth() << "}";
+  }
+  out << "\n  ]\n}\n";
+  out << std::defaultfloat;
+}
+
+void specfem::instrumentation::registry::write_json(
+    const std::string &filename) const {
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    std::ostringstream message;
+    message << "Could not open instrumentation file " << filename;
+    throw std::runtime_error(message.str());
+  }
+  this->write_json(file);
+}
+
+specfem::instrumentation::region::region(const std::string &phase,
+                                         const std::string &wavefield,
+                                         const std::string &medium,
+                                         const std::size_t bytes)
+    : phase(phase), wavefield(wavefield), medium(medium), bytes(bytes),
+      timed(registry::get().is_enabled()) {
+  Kokkos::Profiling::pushRegion("specfem::" + wavefield + "::" + medium +
+                                "::" + phase);
+  if (this->timed) {
+    Kokkos::fence();
+    this->start = std::chrono::high_resolution_clock::now();
+  }
+}
+
+specfem::instrumentation::region::region(
+    const std::string &phase, const specfem::wavefield::type wavefield,
+    const specfem::element::medium_tag medium, const std::size_t bytes)
+    : region(phase, to_string(wavefield), to_string(medium), bytes) {}
+
+specfem::instrumentation::region::~region() {
+  if (this->timed) {
+    Kokkos::fence();
+    const std::chrono::duration<double> elapsed =
+        std::chrono::high_resolution_clock::now() - this->start;
+    registry::get().record(this->phase, this->wavefield, this->medium,
+                           elapsed.count(), this->bytes);
+  }
+  Kokkos::Profiling::popRegion();
+}
@@ -1,8 +1,17 @@
 #include "kernels/frechet_kernels.hpp"
 
 // Explicit template instantiation
+template class specfem::kernels::frechet_kernels<specfem::dimension::type::dim2,
+                                                 4>;
+
 template class specfem::kernels::frechet_kernels<specfem::dimension::type::dim2,
                                                  5>;
 
+template class specfem::kernels::frechet_kernels<specfem::dimension::type::dim2,
+                                                 6>;
+
+template class specfem::kernels::frechet_kernels<specfem::dimension::type::dim2,
+                                                 7>;
+
 template class specfem::kernels::frechet_kernels<specfem::dimension::type::dim2,
                                                  8>;
@@ -15,7 +15,8 @@ struct input_holder {
 
 std::vector<std::shared_ptr<specfem::material::material> >
 specfem::mesh::IO::fortran::read_material_properties(
-    std::ifstream &stream, const int numat, const specfem::MPI::MPI *mpi) {
+    specfem::IO::fortran_reader &stream, const int numat,
+    const specfem::MPI::MPI *mpi) {
 
   input_holder read_values;
 
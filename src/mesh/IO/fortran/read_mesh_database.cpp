@@ -10,7 +10,7 @@
 #include <tuple>
 
 std::tuple<int, int, int> specfem::mesh::IO::fortran::read_mesh_database_header(
-    std::ifstream &stream, const specfem::MPI::MPI *mpi) {
+    specfem::IO::fortran_reader &stream, const specfem::MPI::MPI *mpi) {
   // This subroutine reads header values of the database which are skipped
   std::string dummy_s;
   int dummy_i, dummy_i1, dummy_i2;
@@ -144,9 +144,9 @@ std::tuple<int, int, int> specfem::mesh::IO::fortran::read_mesh_database_header(
 }
 
 specfem::kokkos::HostView2d<type_real>
-specfem::mesh::IO::fortran::read_coorg_elements(std::ifstream &stream,
-                                                const int npgeo,
-                                                const specfem::MPI::MPI *mpi) {
+specfem::mesh::IO::fortran::read_coorg_elements(
+    specfem::IO::fortran_reader &stream, const int npgeo,
+    const specfem::MPI::MPI *mpi) {
 
   int ipoin = 0;
 
@@ -170,7 +170,7 @@ specfem::mesh::IO::fortran::read_coorg_elements(std::ifstream &stream,
 
 std::tuple<int, type_real, bool>
 specfem::mesh::IO::fortran::read_mesh_database_attenuation(
-    std::ifstream &stream, const specfem::MPI::MPI *mpi) {
+    specfem::IO::fortran_reader &stream, const specfem::MPI::MPI *mpi) {
 
   int n_sls;
   type_real attenuation_f0_reference;
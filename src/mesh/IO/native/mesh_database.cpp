@@ -0,0 +1,22 @@
+#include "mesh/IO/native/mesh_database.hpp"
+#include "IO/ASCII/ASCII.hpp"
+#include "IO/HDF5/HDF5.hpp"
+#include "mesh/IO/native/mesh_database.tpp"
+
+// Explicit instantiation
+
+template void specfem::mesh::IO::native::write_mesh<
+    specfem::IO::HDF5<specfem::IO::write> >(const std::string &,
+                                            const specfem::mesh::mesh &);
+
+template void specfem::mesh::IO::native::write_mesh<
+    specfem::IO::ASCII<specfem::IO::write> >(const std::string &,
+                                             const specfem::mesh::mesh &);
+
+template specfem::mesh::mesh specfem::mesh::IO::native::read_mesh<
+    specfem::IO::HDF5<specfem::IO::read> >(const std::string &,
+                                           const specfem::MPI::MPI *);
+
+template specfem::mesh::mesh specfem::mesh::IO::native::read_mesh<
+    specfem::IO::ASCII<specfem::IO::read> >(const std::string &,
+                                            const specfem::MPI::MPI *);
@@ -120,8 +120,8 @@ find_corners(const specfem::kokkos::HostView1d<int> ispec_edge,
 }
 
 specfem::mesh::absorbing_boundary::absorbing_boundary(
-    std::ifstream &stream, int num_abs_boundary_faces, const int nspec,
-    const specfem::MPI::MPI *mpi) {
+    specfem::IO::fortran_reader &stream, int num_abs_boundary_faces,
+    const int nspec, const specfem::MPI::MPI *mpi) {
 
   // I have to do this because std::vector<bool> is a fake container type that
   // causes issues when getting a reference
@@ -71,7 +71,7 @@ specfem::mesh::acoustic_free_surface::acoustic_free_surface(
 }
 
 specfem::mesh::acoustic_free_surface::acoustic_free_surface(
-    std::ifstream &stream, const int &nelem_acoustic_surface,
+    specfem::IO::fortran_reader &stream, const int &nelem_acoustic_surface,
     const Kokkos::View<int **, Kokkos::HostSpace> knods,
     const specfem::MPI::MPI *mpi) {
 
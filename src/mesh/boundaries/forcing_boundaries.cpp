@@ -112,8 +112,8 @@ specfem::mesh::forcing_boundary::forcing_boundary(
 }
 
 specfem::mesh::forcing_boundary::forcing_boundary(
-    std::ifstream &stream, const int nelement_acforcing, const int nspec,
-    const specfem::MPI::MPI *mpi) {
+    specfem::IO::fortran_reader &stream, const int nelement_acforcing,
+    const int nspec, const specfem::MPI::MPI *mpi) {
   bool codeacread1 = true, codeacread2 = true, codeacread3 = true,
        codeacread4 = true;
   std::vector<int> iedgeread(8, 0);
@@ -3,7 +3,8 @@
 #include "mesh/coupled_interfaces/interface_container.tpp"
 
 specfem::mesh::coupled_interfaces::coupled_interfaces::coupled_interfaces(
-    std::ifstream &stream, const int num_interfaces_elastic_acoustic,
+    specfem::IO::fortran_reader &stream,
+    const int num_interfaces_elastic_acoustic,
     const int num_interfaces_acoustic_poroelastic,
     const int num_interfaces_elastic_poroelastic, const specfem::MPI::MPI *mpi)
     : elastic_acoustic(num_interfaces_elastic_acoustic, stream, mpi),
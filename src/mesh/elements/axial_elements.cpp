@@ -14,8 +14,8 @@ specfem::mesh::elements::axial_elements::axial_elements(const int nspec) {
 }
 
 specfem::mesh::elements::axial_elements::axial_elements(
-    std::ifstream &stream, const int nelem_on_the_axis, const int nspec,
-    const specfem::MPI::MPI *mpi) {
+    specfem::IO::fortran_reader &stream, const int nelem_on_the_axis,
+    const int nspec, const specfem::MPI::MPI *mpi) {
   int ispec;
 
   *this = specfem::mesh::elements::axial_elements(nspec);
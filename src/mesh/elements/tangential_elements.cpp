@@ -29,7 +29,7 @@ specfem::mesh::elements::tangential_elements::tangential_elements(
 }
 
 specfem::mesh::elements::tangential_elements::tangential_elements(
-    std::ifstream &stream, const int nnodes_tangential_curve) {
+    specfem::IO::fortran_reader &stream, const int nnodes_tangential_curve) {
   type_real xread, yread;
 
   *this = specfem::mesh::elements::tangential_elements(nnodes_tangential_curve);
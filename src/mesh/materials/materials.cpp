@@ -18,7 +18,7 @@ struct input_holder {
 };
 
 std::vector<specfem::mesh::materials::material_specification> read_materials(
-    std::ifstream &stream, const int numat,
+    specfem::IO::fortran_reader &stream, const int numat,
     specfem::mesh::materials::material<elastic, isotropic> &elastic_isotropic,
     specfem::mesh::materials::material<acoustic, isotropic> &acoustic_isotropic,
     const specfem::MPI::MPI *mpi) {
@@ -130,7 +130,7 @@ std::vector<specfem::mesh::materials::material_specification> read_materials(
 }
 
 void read_material_indices(
-    std::ifstream &stream, const int nspec, const int numat,
+    specfem::IO::fortran_reader &stream, const int nspec, const int numat,
     const std::vector<specfem::mesh::materials::material_specification>
         &index_mapping,
     const specfem::kokkos::HostView1d<
@@ -184,7 +184,7 @@ void read_material_indices(
 // }
 
 specfem::mesh::materials::materials(
-    std::ifstream &stream, const int numat, const int nspec,
+    specfem::IO::fortran_reader &stream, const int numat, const int nspec,
     const specfem::kokkos::HostView2d<int> knods, const specfem::MPI::MPI *mpi)
     : n_materials(numat),
       material_index_mapping("specfem::mesh::material_index_mapping", nspec) {
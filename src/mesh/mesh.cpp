@@ -8,19 +8,19 @@
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
 #include <algorithm>
+#include <iomanip>
 #include <limits>
 #include <memory>
+#include <sstream>
 #include <vector>
 
 specfem::mesh::mesh::mesh(const std::string filename,
-                          const specfem::MPI::MPI *mpi) {
+                          const specfem::MPI::MPI *mpi)
+    : mpi(mpi) {
 
-  std::ifstream stream;
-  stream.open(filename);
-
-  if (!stream.is_open()) {
-    throw std::runtime_error("Could not open database file");
-  }
+  // The database is mapped in memory and decoded record by record without
+  // a read call per value
+  specfem::IO::fortran_reader stream(filename);
 
   try {
     auto [nspec, npgeo, nproc] =
@@ -32,6 +32,14 @@ specfem::mesh::mesh::mesh(const std::string filename,
     throw;
   }
 
+  if (this->nproc != mpi->get_size()) {
+    std::ostringstream message;
+    message << "Database " << filename << " is a partition of a mesh with "
+            << this->nproc << " partitions, but SPECFEM is running on "
+            << mpi->get_size() << " MPI ranks";
+    throw std::runtime_error(message.str());
+  }
+
   try {
     this->control_nodes.coord = specfem::mesh::IO::fortran::read_coorg_elements(
         stream, this->npgeo, mpi);
@@ -86,16 +94,11 @@ specfem::mesh::mesh::mesh(const std::string filename,
   //   throw;
   // }
 
-  // try {
-  //   this->interface = specfem::mesh::interfaces::interface(stream, mpi);
-  // } catch (std::runtime_error &e) {
-  //   throw;
-  // }
-
-  int ninterfaces;
-  int max_interface_size;
-
-  specfem::IO::fortran_read_line(stream, &ninterfaces, &max_interface_size);
+  try {
+    this->mpi_interfaces = specfem::mesh::interfaces::interface(stream, mpi);
+  } catch (std::runtime_error &e) {
+    throw;
+  }
 
   try {
     this->boundaries = specfem::mesh::boundaries(
@@ -155,13 +158,11 @@ specfem::mesh::mesh::mesh(const std::string filename,
   }
 
   // Check if database file was read completely
-  if (stream.get() && !stream.eof()) {
+  if (!stream.eof()) {
     throw std::runtime_error("The Database file wasn't fully read. Is there "
                              "anything written after axial elements?");
   }
 
-  stream.close();
-
   // Print material properties
 
   mpi->cout("Material systems:\n"
@@ -191,6 +192,17 @@ specfem::mesh::mesh::mesh(const std::string filename,
   return;
 }
 
+std::string specfem::mesh::partition_filename(const std::string &filename,
+                                              const specfem::MPI::MPI *mpi) {
+  if (mpi == nullptr || mpi->get_size() == 1)
+    return filename;
+
+  std::ostringstream partition;
+  partition << filename << "." << std::setw(5) << std::setfill('0')
+            << mpi->get_rank();
+  return partition.str();
+}
+
 std::string specfem::mesh::mesh::print() const {
 
   int n_elastic;
@@ -2,7 +2,8 @@
 #include "IO/fortranio/interface.hpp"
 #include "kokkos_abstractions.h"
 #include "specfem_mpi/interface.hpp"
-#include <tuple>
+#include <sstream>
+#include <stdexcept>
 
 specfem::mesh::interfaces::interface::interface(const int ninterfaces,
                                                 const int max_interface_size) {
@@ -10,69 +11,42 @@ specfem::mesh::interfaces::interface::interface(const int ninterfaces,
   this->ninterfaces = ninterfaces;
   this->max_interface_size = max_interface_size;
 
-#ifdef MPI_PARALLEL
-  if (ninterfaces > 0) {
-    this->my_neighbors = specfem::kokkos::HostView1d<int>(
-        "specfem::mesh::interfaces::my_neighbors", ninterfaces);
-    this->my_nelmnts_neighbors = specfem::kokkos::HostView1d<int>(
-        "specfem::mesh::interfaces::my_nelmnts_neighbors", ninterfaces);
-    this->my_interfaces = specfem::kokkos::HostView3d<int>(
-        "specfem::mesh::interfaces::my_interfaces", ninterfaces,
-        max_interface_size, 4);
-
-    // initialize values
-    for (int i = 0; i < ninterfaces; i++) {
-      this->my_neighbors(i) = -1;
-      this->my_nelmnts_neighbors(i) = 0;
-      for (int j = 0; j < max_interface_size; j++) {
-        for (int k = 0; k < 4; k++) {
-          this->my_interfaces(i, j, k) = -1;
-        }
-      }
-    }
-  } else {
-    this->my_neighbors = specfem::kokkos::HostView1d<int>(
-        "specfem::mesh::interfaces::my_neighbors", 1);
-    this->my_nelmnts_neighbors = specfem::kokkos::HostView1d<int>(
-        "specfem::mesh::interfaces::my_nelmnts_neighbors", 1);
-    this->my_interfaces = specfem::kokkos::HostView3d<int>(
-        "specfem::mesh::interfaces::my_interfaces", 1, 1, 1);
-
-    // initialize values
-    this->my_neighbors(1) = -1;
-    this->my_nelmnts_neighbors(1) = 0;
-    this->my_interfaces(1, 1, 1) = -1;
-  }
-#else
+#ifndef MPI_PARALLEL
   if (ninterfaces > 0)
     throw std::runtime_error("Found interfaces but SPECFEM compiled without "
                              "MPI. Compile SPECFEM with MPI");
+#endif
+
   this->my_neighbors = specfem::kokkos::HostView1d<int>(
-      "specfem::mesh::interfaces::my_neighbors", 1);
+      "specfem::mesh::interfaces::my_neighbors", ninterfaces);
   this->my_nelmnts_neighbors = specfem::kokkos::HostView1d<int>(
-      "specfem::mesh::interfaces::my_nelmnts_neighbors", 1);
+      "specfem::mesh::interfaces::my_nelmnts_neighbors", ninterfaces);
   this->my_interfaces = specfem::kokkos::HostView3d<int>(
-      "specfem::mesh::interfaces::my_interfaces", 1, 1, 1);
+      "specfem::mesh::interfaces::my_interfaces", ninterfaces,
+      max_interface_size, 4);
 
   // initialize values
-  this->my_neighbors(1) = -1;
-  this->my_nelmnts_neighbors(1) = 0;
-  this->my_interfaces(1, 1, 1) = -1;
-#endif
+  for (int i = 0; i < ninterfaces; i++) {
+    this->my_neighbors(i) = -1;
+    this->my_nelmnts_neighbors(i) = 0;
+    for (int j = 0; j < max_interface_size; j++) {
+      for (int k = 0; k < 4; k++) {
+        this->my_interfaces(i, j, k) = -1;
+      }
+    }
+  }
 
   return;
 }
 
-specfem::mesh::interfaces::interface::interface(std::ifstream &stream,
-                                                const specfem::MPI::MPI *mpi) {
+specfem::mesh::interfaces::interface::interface(
+    specfem::IO::fortran_reader &stream, const specfem::MPI::MPI *mpi) {
 
   // read number of interfaces
   // Where these 2 values are written needs to change in new database format
   int ninterfaces, max_interface_size;
   specfem::IO::fortran_read_line(stream, &ninterfaces, &max_interface_size);
 
-  // mpi->cout("Number of interaces = " + std::to_string(ninterfaces));
-
   // allocate interface variables
   *this = specfem::mesh::interfaces::interface(ninterfaces, max_interface_size);
 
@@ -80,9 +54,6 @@ specfem::mesh::interfaces::interface::interface(std::ifstream &stream,
   //       thus no further reading will be done below
 
   // reads in interfaces
-#ifdef MPI_PARALLEL
-
-  std::cout << "Compiling with MPI" << std::endl;
   for (int num_interface = 0; num_interface < this->ninterfaces;
        num_interface++) {
     // format: #process_interface_id  #number_of_elements_on_interface
@@ -92,6 +63,16 @@ specfem::mesh::interfaces::interface::interface(std::ifstream &stream,
     //     elements
     specfem::IO::fortran_read_line(stream, &this->my_neighbors(num_interface),
                                    &this->my_nelmnts_neighbors(num_interface));
+
+    if (this->my_nelmnts_neighbors(num_interface) > max_interface_size) {
+      std::ostringstream message;
+      message << "Error reading MPI interfaces. Interface with rank "
+              << this->my_neighbors(num_interface) << " has "
+              << this->my_nelmnts_neighbors(num_interface)
+              << " elements, more than the maximum of " << max_interface_size;
+      throw std::runtime_error(message.str());
+    }
+
     // loops over interface elements
     for (int ie = 0; ie < this->my_nelmnts_neighbors(num_interface); ie++) {
       //   format: #(1)spectral_element_id  #(2)interface_type  #(3)node_id1
@@ -100,14 +81,23 @@ specfem::mesh::interfaces::interface::interface(std::ifstream &stream,
       //   interface types:
       //       1  -  corner point only
       //       2  -  element edge
-      specfem::IO::fortran_read_line(
-          stream, &this->my_interfaces(num_interface, ie, 0),
-          &this->my_interfaces(num_interface, ie, 1),
-          &this->my_interfaces(num_interface, ie, 2),
-          &this->my_interfaces(num_interface, ie, 3));
+      int ispec, itype, node1, node2;
+      specfem::IO::fortran_read_line(stream, &ispec, &itype, &node1, &node2);
+
+      if (itype != 1 && itype != 2) {
+        std::ostringstream message;
+        message << "Error reading MPI interfaces. Unknown interface type "
+                << itype;
+        throw std::runtime_error(message.str());
+      }
+
+      // Element and node indices are written 1-based
+      this->my_interfaces(num_interface, ie, 0) = ispec - 1;
+      this->my_interfaces(num_interface, ie, 1) = itype;
+      this->my_interfaces(num_interface, ie, 2) = node1 - 1;
+      this->my_interfaces(num_interface, ie, 3) = (itype == 2) ? node2 - 1 : -1;
     }
   }
-#endif
 
   return;
 }
@@ -1,8 +1,8 @@
 #include "mesh/properties/properties.hpp"
 #include "IO/fortranio/interface.hpp"
 
-specfem::mesh::properties::properties(std::ifstream &stream,
-                                      const specfem::MPI::MPI *mpi) {
+specfem::mesh::properties::properties(
+    specfem::IO::fortran_reader &stream, const specfem::MPI::MPI *mpi) {
   // ---------------------------------------------------------------------
   // reading mesh properties
 
@@ -0,0 +1,127 @@
+#include "IO/ASCII/ASCII.hpp"
+#include "IO/HDF5/HDF5.hpp"
+#include "mesh/IO/native/mesh_database.hpp"
+#include "mesh/mesh.hpp"
+#include "specfem_mpi/interface.hpp"
+#include <Kokkos_Core.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+// Convert a Fortran binary mesh database to the native mesh format
+
+boost::program_options::options_description define_args() {
+  namespace po = boost::program_options;
+
+  po::options_description desc{ "======================================\n"
+                                "---------SPECFEM Mesh Converter-------\n"
+                                "======================================" };
+
+  desc.add_options()("help,h", "Print this help message")(
+      "input,i", po::value<std::string>(),
+      "Location of the Fortran binary database")(
+      "output,o", po::value<std::string>(),
+      "Location of the converted mesh (an .h5 file is created if using HDF5, "
+      "a folder if using ASCII)")(
+      "format,f", po::value<std::string>()->default_value("HDF5"),
+      "Format of the converted mesh : HDF5 or ASCII");
+
+  return desc;
+}
+
+int parse_args(int argc, char **argv,
+               boost::program_options::variables_map &vm) {
+
+  const auto desc = define_args();
+  boost::program_options::store(
+      boost::program_options::parse_command_line(argc, argv, desc), vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << std::endl;
+    return 0;
+  }
+
+  if (!vm.count("input") || !vm.count("output")) {
+    std::cout << desc << std::endl;
+    return 0;
+  }
+
+  return 1;
+}
+
+void execute(const std::string &input, const std::string &output,
+             const std::string &format, specfem::MPI::MPI *mpi) {
+
+  if (format != "HDF5" && format != "ASCII") {
+    std::ostringstream message;
+    message << "Unknown mesh format " << format
+            << ". Valid formats are HDF5 and ASCII.";
+    throw std::runtime_error(message.str());
+  }
+
+  // Partitioned databases are converted in parallel, every rank converts the
+  // database of its partition
+  const auto input_filename = specfem::mesh::partition_filename(input, mpi);
+  const auto output_filename = specfem::mesh::partition_filename(output, mpi);
+
+  const auto start_time = std::chrono::high_resolution_clock::now();
+
+  const specfem::mesh::mesh mesh(input_filename, mpi);
+
+  const auto read_time = std::chrono::high_resolution_clock::now();
+
+  if (format == "HDF5") {
+    specfem::mesh::IO::native::write_mesh<
+        specfem::IO::HDF5<specfem::IO::write> >(output_filename, mesh);
+  } else {
+    specfem::mesh::IO::native::write_mesh<
+        specfem::IO::ASCII<specfem::IO::write> >(output_filename, mesh);
+  }
+
+  const auto write_time = std::chrono::high_resolution_clock::now();
+
+  mpi->sync_all();
+
+  if (mpi->main_proc()) {
+    const std::chrono::duration<double> read_duration =
+        read_time - start_time;
+    const std::chrono::duration<double> write_duration =
+        write_time - read_time;
+
+    std::ostringstream message;
+    message << "Converted " << input << " to " << format << " mesh " << output
+            << "\n"
+            << "    Partitions : " << mpi->get_size() << "\n"
+            << "    Read time (rank 0) : " << read_duration.count()
+            << " seconds\n"
+            << "    Write time (rank 0) : " << write_duration.count()
+            << " seconds\n";
+    std::cout << message.str() << std::endl;
+  }
+
+  return;
+}
+
+int main(int argc, char **argv) {
+
+  // Initialize MPI
+  specfem::MPI::MPI *mpi = new specfem::MPI::MPI(&argc, &argv);
+  // Initialize Kokkos
+  Kokkos::initialize(argc, argv);
+  {
+    boost::program_options::variables_map vm;
+    if (parse_args(argc, argv, vm)) {
+      const std::string input = vm["input"].as<std::string>();
+      const std::string output = vm["output"].as<std::string>();
+      const std::string format = vm["format"].as<std::string>();
+      execute(input, output, format, mpi);
+    }
+  }
+  // Finalize Kokkos
+  Kokkos::finalize();
+  // Finalize MPI
+  delete mpi;
+  return 0;
+}
@@ -0,0 +1,100 @@
+#include "parallel_configuration/chunk_tuning.hpp"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace {
+
+// Cache files hold one "key description" entry per line. Keys do not contain
+// whitespace, descriptions span the rest of the line
+std::map<std::string, std::string> read_entries(const std::string &filename) {
+  std::map<std::string, std::string> entries;
+  std::ifstream file(filename);
+  std::string key;
+  std::string description;
+  while (file >> key && std::getline(file >> std::ws, description)) {
+    entries[key] = description;
+  }
+  return entries;
+}
+
+} // namespace
+
+specfem::parallel_config::chunk_tuning::chunk_tuning(
+    const std::string &cache_file, const int nsteps)
+    : enable(true), cache_file(cache_file), nsteps(nsteps) {
+  if (nsteps < 1) {
+    std::ostringstream message;
+    message << "Invalid number of chunk tuning steps : " << nsteps
+            << ". Needs to be positive";
+    throw std::runtime_error(message.str());
+  }
+}
+
+bool specfem::parallel_config::chunk_tuning::load(
+    const std::string &key, const std::vector<std::string> &candidates,
+    int &index) const {
+  if (this->cache_file.empty())
+    return false;
+
+  const auto entries = read_entries(this->cache_file);
+  const auto it = entries.find(key);
+  if (it == entries.end())
+    return false;
+
+  // The entry may have been written by a build with other candidates
+  const auto match =
+      std::find(candidates.begin(), candidates.end(), it->second);
+  if (match == candidates.end())
+    return false;
+
+  index = match - candidates.begin();
+  return true;
+}
+
+void specfem::parallel_config::chunk_tuning::store(
+    const std::string &key, const std::string &description) const {
+  if (this->cache_file.empty())
+    return;
+
+  auto entries = read_entries(this->cache_file);
+  entries[key] = description;
+
+  // Write to a temporary file that is renamed once complete
+  std::ostringstream temporary;
+  temporary << this->cache_file << ".tmp." << getpid();
+
+  {
+    std::ofstream file(temporary.str());
+    if (!file.is_open()) {
+      std::ostringstream message;
+      message << "Error writing chunk tuning cache. \n"
+              << "Could not open " << temporary.str() << " for writing.";
+      throw std::runtime_error(message.str());
+    }
+    for (const auto &[entry_key, entry_description] : entries) {
+      file << entry_key << " " << entry_description << "\n";
+    }
+  }
+
+  if (std::rename(temporary.str().c_str(), this->cache_file.c_str()) != 0) {
+    std::remove(temporary.str().c_str());
+    std::ostringstream message;
+    message << "Error writing chunk tuning cache " << this->cache_file;
+    throw std::runtime_error(message.str());
+  }
+
+  return;
+}
+
+std::string specfem::parallel_config::chunk_tuning::hardware_key() {
+  std::ostringstream key;
+  key << Kokkos::DefaultExecutionSpace::name() << ":"
+      << Kokkos::DefaultExecutionSpace().concurrency();
+  return key.str();
+}
@@ -0,0 +1,27 @@
+#include "parameter_parser/checkpointing.hpp"
+#include "yaml-cpp/yaml.h"
+#include <sstream>
+#include <stdexcept>
+
+specfem::runtime_configuration::checkpointing::checkpointing(
+    const YAML::Node &Node) {
+  try {
+    *this = specfem::runtime_configuration::checkpointing(
+        Node["memory-budget"].as<double>());
+  } catch (YAML::Exception &e) {
+    std::ostringstream message;
+    message << "Error reading checkpointing configuration. \n"
+            << "memory-budget (in MB) must be specified. \n"
+            << e.what();
+
+    throw std::runtime_error(message.str());
+  }
+
+  if (this->memory_budget <= 0.0) {
+    std::ostringstream message;
+    message << "Error reading checkpointing configuration. \n"
+            << "memory-budget must be positive. Got " << this->memory_budget;
+
+    throw std::runtime_error(message.str());
+  }
+}
@@ -1,6 +1,7 @@
 #include "parameter_parser/database_configuration.hpp"
 #include "yaml-cpp/yaml.h"
 #include <ostream>
+#include <string>
 
 specfem::runtime_configuration::database_configuration::database_configuration(
     const YAML::Node &Node) {
@@ -8,6 +9,30 @@ specfem::runtime_configuration::database_configuration::database_configuration(
     *this = specfem::runtime_configuration::database_configuration(
         Node["mesh-database"].as<std::string>(),
         Node["source-file"].as<std::string>());
+
+    if (const YAML::Node &n_cache = Node["assembly-cache"]) {
+      this->assembly_cache = n_cache.as<std::string>();
+    }
+
+    if (const YAML::Node &n_format = Node["mesh-format"]) {
+      this->mesh_format = n_format.as<std::string>();
+      if (this->mesh_format != "Fortran" && this->mesh_format != "HDF5" &&
+          this->mesh_format != "ASCII") {
+        std::ostringstream message;
+        message << "Error reading database configuration. \n"
+                << "Unknown mesh format " << this->mesh_format
+                << ". Valid formats are Fortran, HDF5 and ASCII.";
+        throw std::runtime_error(message.str());
+      }
+    }
+
+    // The assembly cache is keyed by a hash of the database file, ASCII
+    // meshes are folders
+    if (this->mesh_format == "ASCII" && !this->assembly_cache.empty()) {
+      throw std::runtime_error(
+          "Error reading database configuration. \n"
+          "The assembly cache cannot be used with ASCII meshes.");
+    }
   } catch (YAML::ParserException &e) {
     std::ostringstream message;
 
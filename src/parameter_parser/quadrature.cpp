@@ -23,8 +23,14 @@ specfem::runtime_configuration::quadrature::instantiate() {
 specfem::runtime_configuration::quadrature::quadrature(
     const std::string quadrature) {
 
-  if (quadrature == "GLL4") {
+  if (quadrature == "GLL3") {
+    *this = specfem::runtime_configuration::quadrature(0.0, 0.0, 4);
+  } else if (quadrature == "GLL4") {
     *this = specfem::runtime_configuration::quadrature(0.0, 0.0, 5);
+  } else if (quadrature == "GLL5") {
+    *this = specfem::runtime_configuration::quadrature(0.0, 0.0, 6);
+  } else if (quadrature == "GLL6") {
+    *this = specfem::runtime_configuration::quadrature(0.0, 0.0, 7);
   } else if (quadrature == "GLL7") {
     *this = specfem::runtime_configuration::quadrature(0.0, 0.0, 8);
   } else {
@@ -53,11 +53,56 @@ specfem::runtime_configuration::setup::setup(const std::string &parameter_file,
     throw std::runtime_error("Error reading specfem quadrature config.");
   }
 
+  if (const YAML::Node &n_ordering = simulation_setup["element-ordering"]) {
+    const std::string ordering = n_ordering.as<std::string>();
+    if (ordering == "none") {
+      this->element_ordering = specfem::compute::element_ordering::none;
+    } else if (ordering == "hilbert") {
+      this->element_ordering = specfem::compute::element_ordering::hilbert;
+    } else {
+      std::ostringstream message;
+      message << "Error reading specfem element ordering. \n"
+              << "Unknown element ordering : " << ordering
+              << ". Supported values are none and hilbert.";
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  if (const YAML::Node &n_assembly = simulation_setup["element-assembly"]) {
+    const std::string assembly = n_assembly.as<std::string>();
+    if (assembly == "atomic") {
+      this->element_assembly = specfem::compute::element_assembly::atomic;
+    } else if (assembly == "coloring") {
+      this->element_assembly = specfem::compute::element_assembly::coloring;
+    } else {
+      std::ostringstream message;
+      message << "Error reading specfem element assembly. \n"
+              << "Unknown element assembly : " << assembly
+              << ". Supported values are atomic and coloring.";
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  if (const YAML::Node &n_instrumentation =
+          simulation_setup["instrumentation"]) {
+    try {
+      this->instrumentation = n_instrumentation["enable"].as<bool>();
+      if (const YAML::Node &n_file = n_instrumentation["json-file"]) {
+        this->instrumentation_file = n_file.as<std::string>();
+      }
+    } catch (YAML::Exception &e) {
+      std::ostringstream message;
+      message << "Error reading specfem instrumentation configuration. \n"
+              << e.what();
+      throw std::runtime_error(message.str());
+    }
+  }
+
   if (const YAML::Node &n_run_setup = runtime_config["run-setup"]) {
     this->run_setup =
         std::make_unique<specfem::runtime_configuration::run_setup>(
             n_run_setup);
-  } else if (const YAML::Node &n_run_setup = default_yaml["run-setup"]) {
+  } else if (const YAML::Node &n_run_setup = default_config["run-setup"]) {
     this->run_setup =
         std::make_unique<specfem::runtime_configuration::run_setup>(
             n_run_setup);
@@ -133,12 +178,30 @@ specfem::runtime_configuration::setup::setup(const std::string &parameter_file,
     }
 
     if (const YAML::Node &n_adjoint = n_simulation_mode["combined"]) {
-      this->solver =
-          std::make_unique<specfem::runtime_configuration::solver::solver>(
-              "combined");
       number_of_simulation_modes++;
       simulation = specfem::simulation::type::combined;
-      if (const YAML::Node &n_reader = n_adjoint["reader"]) {
+      if (const YAML::Node &n_checkpointing = n_adjoint["checkpointing"]) {
+        this->checkpointing =
+            std::make_unique<specfem::runtime_configuration::checkpointing>(
+                n_checkpointing);
+        this->solver =
+            std::make_unique<specfem::runtime_configuration::solver::solver>(
+                "combined", this->checkpointing->get_memory_budget());
+        this->wavefield = nullptr;
+        if (n_adjoint["reader"]) {
+          std::ostringstream message;
+          message << "************************************************\n"
+                  << "Warning : Checkpointing is enabled. The forward "
+                     "wavefield is recomputed during the simulation. \n"
+                  << "         Wavefield reader configuration is ignored. \n"
+                  << "************************************************\n";
+          std::cout << message.str();
+        }
+      } else if (const YAML::Node &n_reader = n_adjoint["reader"]) {
+        this->solver =
+            std::make_unique<specfem::runtime_configuration::solver::solver>(
+                "combined");
+        this->checkpointing = nullptr;
         if (const YAML::Node &n_wavefield = n_reader["wavefield"]) {
           this->wavefield =
               std::make_unique<specfem::runtime_configuration::wavefield>(
@@ -151,7 +214,9 @@ specfem::runtime_configuration::setup::setup(const std::string &parameter_file,
         }
       } else {
         std::ostringstream message;
-        message << "Error reading adjoint reader configuration. \n";
+        message << "Error reading adjoint reader configuration. \n"
+                << "Either a wavefield reader or checkpointing must be "
+                   "specified. \n";
         throw std::runtime_error(message.str());
       }
 
@@ -197,6 +262,34 @@ specfem::runtime_configuration::setup::setup(const std::string &parameter_file,
     throw std::runtime_error("Error reading specfem simulation mode.");
   }
 
+  if (const YAML::Node &n_tuning = simulation_setup["chunk-tuning"]) {
+    try {
+      if (n_tuning["enable"].as<bool>()) {
+        const std::string cache_file =
+            n_tuning["cache-file"] ? n_tuning["cache-file"].as<std::string>()
+                                   : "";
+        const int nsteps =
+            n_tuning["steps"] ? n_tuning["steps"].as<int>() : 10;
+        this->solver->set_chunk_tuning(
+            specfem::parallel_config::chunk_tuning(cache_file, nsteps));
+#ifndef ENABLE_CHUNK_TUNING
+        std::ostringstream message;
+        message << "************************************************\n"
+                << "Warning : Chunk tuning is enabled but SPECFEM was built "
+                   "without ENABLE_CHUNK_TUNING. \n"
+                << "         The default chunk configuration is used. \n"
+                << "************************************************\n";
+        std::cout << message.str();
+#endif
+      }
+    } catch (YAML::Exception &e) {
+      std::ostringstream message;
+      message << "Error reading specfem chunk tuning configuration. \n"
+              << e.what();
+      throw std::runtime_error(message.str());
+    }
+  }
+
   try {
     const YAML::Node &n_time_marching = n_solver["time-marching"];
     const YAML::Node &n_timescheme = n_time_marching["time-scheme"];
@@ -209,6 +302,25 @@ specfem::runtime_configuration::setup::setup(const std::string &parameter_file,
     message << "Error reading specfem solver configuration. \n" << e.what();
     throw std::runtime_error(message.str());
   }
+
+  // Every run is a separate execution of SPECFEM++
+  if (this->run_setup->get_nruns() != 1) {
+    std::ostringstream message;
+    message << "Error reading specfem run setup. \n"
+            << "Only a single run is supported (number-of-runs = "
+            << this->run_setup->get_nruns() << ").";
+    throw std::runtime_error(message.str());
+  }
+
+  // Seismograms are only streamed from the forward time loop
+  if (this->seismogram && this->seismogram->stream() &&
+      simulation != specfem::simulation::type::forward) {
+    std::ostringstream message;
+    message << "Error reading seismogram writer configuration. \n"
+            << "Binary and HDF5 seismograms are only supported for forward "
+               "simulations.";
+    throw std::runtime_error(message.str());
+  }
 }
 
 std::string specfem::runtime_configuration::setup::print_header(
@@ -0,0 +1,58 @@
+#include "parameter_parser/solver/solver.hpp"
+#include "enumerations/quadrature.hpp"
+#include "parameter_parser/solver/solver.tpp"
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+template <int NGLL>
+using static_quadrature_points =
+    specfem::enums::element::quadrature::static_quadrature_points<NGLL>;
+} // namespace
+
+std::shared_ptr<specfem::solver::solver>
+specfem::runtime_configuration::solver::solver::instantiate(
+    const type_real dt, const specfem::compute::assembly &assembly,
+    std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme,
+    const int ngll,
+    const std::shared_ptr<specfem::writer::boundary_values_stream>
+        boundary_values_writer,
+    const std::shared_ptr<specfem::reader::boundary_values_stream>
+        boundary_values_reader,
+    const std::shared_ptr<specfem::writer::seismogram_stream>
+        seismogram_writer) const {
+
+  switch (ngll) {
+  case 4:
+    return this->instantiate(dt, assembly, time_scheme,
+                             static_quadrature_points<4>(),
+                             boundary_values_writer, boundary_values_reader,
+                             seismogram_writer);
+  case 5:
+    return this->instantiate(dt, assembly, time_scheme,
+                             static_quadrature_points<5>(),
+                             boundary_values_writer, boundary_values_reader,
+                             seismogram_writer);
+  case 6:
+    return this->instantiate(dt, assembly, time_scheme,
+                             static_quadrature_points<6>(),
+                             boundary_values_writer, boundary_values_reader,
+                             seismogram_writer);
+  case 7:
+    return this->instantiate(dt, assembly, time_scheme,
+                             static_quadrature_points<7>(),
+                             boundary_values_writer, boundary_values_reader,
+                             seismogram_writer);
+  case 8:
+    return this->instantiate(dt, assembly, time_scheme,
+                             static_quadrature_points<8>(),
+                             boundary_values_writer, boundary_values_reader,
+                             seismogram_writer);
+  default:
+    std::ostringstream message;
+    message << "Error instantiating solver. \n"
+            << "Solver kernels have not been compiled for " << ngll
+            << " GLL points. Supported values are 4, 5, 6, 7 and 8.";
+    throw std::runtime_error(message.str());
+  }
+}
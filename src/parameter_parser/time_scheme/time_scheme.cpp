@@ -14,11 +14,13 @@ specfem::runtime_configuration::time_scheme::time_scheme::instantiate(
 
       it = std::make_shared<
           specfem::time_scheme::newmark<specfem::simulation::type::forward> >(
-          this->nstep, nstep_between_samples, this->dt, this->t0);
+          this->nstep, nstep_between_samples, this->dt, this->t0,
+          this->fused_update);
     } else if (this->type == specfem::simulation::type::combined) {
       it = std::make_shared<
           specfem::time_scheme::newmark<specfem::simulation::type::combined> >(
-          this->nstep, nstep_between_samples, this->dt, this->t0);
+          this->nstep, nstep_between_samples, this->dt, this->t0,
+          this->fused_update);
     } else {
       std::ostringstream message;
       message << "Error in time scheme instantiation. \n"
@@ -53,6 +55,10 @@ specfem::runtime_configuration::time_scheme::time_scheme::time_scheme(
     *this = specfem::runtime_configuration::time_scheme::time_scheme(
         timescheme["type"].as<std::string>(), timescheme["dt"].as<type_real>(),
         timescheme["nstep"].as<int>(), t0, simulation);
+
+    if (timescheme["fused-update"]) {
+      this->fused_update = timescheme["fused-update"].as<bool>();
+    }
   } catch (YAML::ParserException &e) {
     std::ostringstream message;
 
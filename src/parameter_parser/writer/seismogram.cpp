@@ -31,27 +31,67 @@ specfem::runtime_configuration::seismogram::seismogram(
     throw std::runtime_error(message.str());
   }
 
-  *this =
-      specfem::runtime_configuration::seismogram(output_format, output_folder);
+  const int buffer_size = [&]() {
+    if (seismogram["buffer-size"]) {
+      return seismogram["buffer-size"].as<int>();
+    } else {
+      return 1024;
+    }
+  }();
+
+  if (buffer_size <= 0) {
+    std::ostringstream message;
+    message << "Seismogram buffer size must be positive. Got " << buffer_size;
+    throw std::runtime_error(message.str());
+  }
+
+  const bool ascii_export = [&]() {
+    if (seismogram["ascii-export"]) {
+      return seismogram["ascii-export"].as<bool>();
+    } else {
+      return false;
+    }
+  }();
+
+  *this = specfem::runtime_configuration::seismogram(
+      output_format, output_folder, buffer_size, ascii_export);
+
+  // Check the output format
+  this->get_format();
 
   return;
 }
 
+specfem::enums::seismogram::format
+specfem::runtime_configuration::seismogram::get_format() const {
+  if (this->output_format == "seismic_unix" || this->output_format == "su") {
+    return specfem::enums::seismogram::format::seismic_unix;
+  } else if (this->output_format == "ASCII" || this->output_format == "ascii") {
+    return specfem::enums::seismogram::format::ascii;
+  } else if (this->output_format == "binary" || this->output_format == "bin") {
+    return specfem::enums::seismogram::format::binary;
+  } else if (this->output_format == "HDF5" || this->output_format == "hdf5") {
+    return specfem::enums::seismogram::format::hdf5;
+  } else {
+    throw std::runtime_error("Unknown seismogram format");
+  }
+}
+
+bool specfem::runtime_configuration::seismogram::stream() const {
+  const auto type = this->get_format();
+  return (type == specfem::enums::seismogram::format::binary) ||
+         (type == specfem::enums::seismogram::format::hdf5);
+}
+
 std::shared_ptr<specfem::writer::writer>
 specfem::runtime_configuration::seismogram::instantiate_seismogram_writer(
     const specfem::compute::receivers &receivers, const type_real dt,
     const type_real t0, const int nstep_between_samples) const {
 
-  const auto type = [&]() {
-    if (this->output_format == "seismic_unix" || this->output_format == "su") {
-      return specfem::enums::seismogram::format::seismic_unix;
-    } else if (this->output_format == "ASCII" ||
-               this->output_format == "ascii") {
-      return specfem::enums::seismogram::format::ascii;
-    } else {
-      throw std::runtime_error("Unknown seismogram format");
-    }
-  }();
+  if (this->stream())
+    return nullptr;
+
+  const auto type = this->get_format();
 
   std::shared_ptr<specfem::writer::writer> writer =
       std::make_shared<specfem::writer::seismogram>(
@@ -59,3 +99,17 @@ specfem::runtime_configuration::seismogram::instantiate_seismogram_writer(
 
   return writer;
 }
+
+std::shared_ptr<specfem::writer::seismogram_stream>
+specfem::runtime_configuration::seismogram::instantiate_seismogram_stream(
+    const specfem::compute::receivers &receivers, const type_real dt,
+    const type_real t0, const int nstep_between_samples, const int nsig_steps,
+    const specfem::MPI::MPI *mpi) const {
+
+  if (!this->stream())
+    return nullptr;
+
+  return std::make_shared<specfem::writer::seismogram_stream>(
+      receivers, this->get_format(), this->output_folder, dt, t0,
+      nstep_between_samples, nsig_steps, this->ascii_export, mpi);
+}
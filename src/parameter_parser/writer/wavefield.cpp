@@ -1,8 +1,10 @@
 #include "parameter_parser/writer/wavefield.hpp"
 #include "IO/ASCII/ASCII.hpp"
 #include "IO/HDF5/HDF5.hpp"
+#include "reader/boundary_values_stream.hpp"
 #include "reader/reader.hpp"
 #include "reader/wavefield.hpp"
+#include "writer/boundary_values_stream.hpp"
 #include "writer/interface.hpp"
 #include "writer/wavefield.hpp"
 #include <boost/filesystem.hpp>
@@ -26,6 +28,14 @@ specfem::runtime_configuration::wavefield::wavefield(
     }
   }();
 
+  const bool stream_boundary_values = [&]() -> bool {
+    if (Node["stream-boundary-values"]) {
+      return Node["stream-boundary-values"].as<bool>();
+    } else {
+      return false;
+    }
+  }();
+
   if (!boost::filesystem::is_directory(
           boost::filesystem::path(output_folder))) {
     std::ostringstream message;
@@ -33,8 +43,8 @@ specfem::runtime_configuration::wavefield::wavefield(
     throw std::runtime_error(message.str());
   }
 
-  *this = specfem::runtime_configuration::wavefield(output_format,
-                                                    output_folder, type);
+  *this = specfem::runtime_configuration::wavefield(
+      output_format, output_folder, type, stream_boundary_values);
 
   return;
 }
@@ -90,3 +100,27 @@ specfem::runtime_configuration::wavefield::instantiate_wavefield_reader(
 
   return reader;
 }
+
+std::shared_ptr<specfem::writer::boundary_values_stream>
+specfem::runtime_configuration::wavefield::instantiate_boundary_values_writer(
+    const specfem::compute::assembly &assembly) const {
+  if (this->stream_boundary_values &&
+      this->simulation_type == specfem::simulation::type::forward) {
+    return std::make_shared<specfem::writer::boundary_values_stream>(
+        assembly, this->output_folder);
+  } else {
+    return nullptr;
+  }
+}
+
+std::shared_ptr<specfem::reader::boundary_values_stream>
+specfem::runtime_configuration::wavefield::instantiate_boundary_values_reader(
+    const specfem::compute::assembly &assembly) const {
+  if (this->stream_boundary_values &&
+      this->simulation_type == specfem::simulation::type::combined) {
+    return std::make_shared<specfem::reader::boundary_values_stream>(
+        this->output_folder, assembly);
+  } else {
+    return nullptr;
+  }
+}
@@ -0,0 +1,46 @@
+#include "reader/boundary_values_stream.hpp"
+#include "writer/boundary_values_stream.hpp"
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+specfem::reader::boundary_values_stream::boundary_values_stream(
+    const std::string &input_folder,
+    const specfem::compute::assembly &assembly)
+    : boundary_values(assembly.boundary_values),
+      next_step(assembly.boundary_values.stacey.nstep - 1) {
+
+  // Time steps are consumed in reverse order during time reversal
+  std::vector<int> order(boundary_values.stacey.nstep);
+  std::iota(order.rbegin(), order.rend(), 0);
+
+  reader = std::make_unique<specfem::IO::async_block_reader>(
+      specfem::writer::boundary_values_stream::filename(
+          input_folder, assembly.mpi_interfaces.mpi),
+      boundary_values.step_size(), order);
+
+  if (reader->get_nblocks() != boundary_values.stacey.nstep) {
+    std::ostringstream message;
+    message << "Error reading boundary values. \n"
+            << "The forward simulation stored " << reader->get_nblocks()
+            << " time steps but " << boundary_values.stacey.nstep
+            << " time steps are required.";
+    throw std::runtime_error(message.str());
+  }
+}
+
+void specfem::reader::boundary_values_stream::read(const int istep) {
+  if (istep != next_step) {
+    std::ostringstream message;
+    message << "Error reading boundary values. \n"
+            << "Time steps must be read in reverse order. Expected time step "
+            << next_step << " but got " << istep;
+    throw std::runtime_error(message.str());
+  }
+
+  const char *buffer = reader->next();
+  boundary_values.copy_step_to_device(
+      istep, reinterpret_cast<const type_real *>(buffer));
+  next_step--;
+}
@@ -18,6 +18,17 @@ void specfem::receivers::receiver::compute_receiver_array(
   specfem::point::local_coordinates<specfem::dimension::type::dim2> lcoord =
       specfem::algorithms::locate_point(gcoord, mesh);
 
+  this->compute_receiver_array(lcoord, mesh, receiver_array);
+
+  return;
+}
+
+void specfem::receivers::receiver::compute_receiver_array(
+    const specfem::point::local_coordinates<specfem::dimension::type::dim2>
+        &lcoord,
+    const specfem::compute::mesh &mesh,
+    specfem::kokkos::HostView3d<type_real> receiver_array) {
+
   const auto xi = mesh.quadratures.gll.h_xi;
   const auto gamma = mesh.quadratures.gll.h_xi;
   const auto N = mesh.quadratures.gll.N;
@@ -0,0 +1,125 @@
+#include "solver/checkpointing.hpp"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+// Length of the longest segment that can be reversed with nfree free snapshot
+// slots when no forward time step is executed more than t times.
+//   beta(nfree, t) = C(nfree + t + 1, nfree + 1) - 1
+// The value saturates at limit + 1 to avoid overflows.
+std::size_t max_segment_length(const int nfree, const int t,
+                               const std::size_t limit) {
+  const std::size_t n = static_cast<std::size_t>(nfree + t + 1);
+  const std::size_t k = std::min(static_cast<std::size_t>(t),
+                                 static_cast<std::size_t>(nfree + 1));
+
+  std::size_t binomial = 1;
+  for (std::size_t i = 1; i <= k; ++i) {
+    binomial = binomial * (n - k + i) / i;
+    if (binomial > limit + 1) {
+      return limit + 1;
+    }
+  }
+
+  return binomial - 1;
+}
+} // namespace
+
+specfem::solver::checkpointing::binomial_schedule::binomial_schedule(
+    const int nsteps, const int nslots)
+    : nsteps(nsteps), nslots(nslots) {
+
+  if (nsteps < 1) {
+    std::ostringstream message;
+    message << "Error computing checkpointing schedule. \n"
+            << "Number of time steps must be positive. Got " << nsteps;
+    throw std::runtime_error(message.str());
+  }
+
+  if (nslots < 1) {
+    std::ostringstream message;
+    message << "Error computing checkpointing schedule. \n"
+            << "At least one snapshot slot is required to store the initial "
+               "wavefield. Got "
+            << nslots;
+    throw std::runtime_error(message.str());
+  }
+
+  // The initial state is stored in slot 0 and is held in the wavefield when
+  // the schedule starts
+  this->current = 0;
+  this->reverse(0, 0, nsteps, nslots - 1);
+
+  return;
+}
+
+void specfem::solver::checkpointing::binomial_schedule::advance(
+    const int from, const int from_slot, const int to) {
+
+  if (this->current != from) {
+    this->actions.push_back({ action_type::restore, from, 0, from_slot });
+    this->current = from;
+  }
+
+  this->actions.push_back({ action_type::advance, from, to - from, -1 });
+  this->forward_steps += static_cast<std::size_t>(to - from);
+  this->current = to;
+
+  return;
+}
+
+void specfem::solver::checkpointing::binomial_schedule::reverse(
+    const int lo, const int lo_slot, const int hi, const int nfree) {
+
+  const int length = hi - lo;
+
+  if (length <= 0)
+    return;
+
+  if (length == 1) {
+    this->advance(lo, lo_slot, hi);
+    this->actions.push_back({ action_type::reverse, hi, 0, -1 });
+    return;
+  }
+
+  // No free slots left: recompute every state from the snapshot at lo
+  if (nfree == 0) {
+    for (int step = hi; step > lo; --step) {
+      this->advance(lo, lo_slot, step);
+      this->actions.push_back({ action_type::reverse, step, 0, -1 });
+    }
+    return;
+  }
+
+  const std::size_t limit = static_cast<std::size_t>(length);
+
+  // Smallest number of repetitions that allows reversing the segment
+  int t = 1;
+  while (max_segment_length(nfree, t, limit) < limit) {
+    t++;
+  }
+
+  // Place the next snapshot such that the segment after it can be reversed
+  // with one slot less and the segment before it with one repetition less
+  const int right = static_cast<int>(
+      std::min(max_segment_length(nfree - 1, t, limit), limit - 1));
+  const int mid = hi - right;
+  const int slot = this->nslots - nfree;
+
+  this->advance(lo, lo_slot, mid);
+  this->actions.push_back({ action_type::store, mid, 0, slot });
+  this->max_slots = std::max(this->max_slots, slot + 1);
+
+  this->reverse(mid, slot, hi, nfree - 1);
+
+  if (this->current != mid) {
+    this->actions.push_back({ action_type::restore, mid, 0, slot });
+    this->current = mid;
+  }
+  this->actions.push_back({ action_type::reverse, mid, 0, -1 });
+
+  this->reverse(lo, lo_slot, mid - 1, nfree);
+
+  return;
+}
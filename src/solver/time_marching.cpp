@@ -5,20 +5,41 @@
 #include "solver/time_marching.tpp"
 
 namespace {
+using qp4 = specfem::enums::element::quadrature::static_quadrature_points<4>;
 using qp5 = specfem::enums::element::quadrature::static_quadrature_points<5>;
+using qp6 = specfem::enums::element::quadrature::static_quadrature_points<6>;
+using qp7 = specfem::enums::element::quadrature::static_quadrature_points<7>;
 using qp8 = specfem::enums::element::quadrature::static_quadrature_points<8>;
 } // namespace
 
 // Explcit template instantiation
 
+template class specfem::solver::time_marching<
+    specfem::simulation::type::forward, specfem::dimension::type::dim2, qp4>;
+
 template class specfem::solver::time_marching<
     specfem::simulation::type::forward, specfem::dimension::type::dim2, qp5>;
 
+template class specfem::solver::time_marching<
+    specfem::simulation::type::forward, specfem::dimension::type::dim2, qp6>;
+
+template class specfem::solver::time_marching<
+    specfem::simulation::type::forward, specfem::dimension::type::dim2, qp7>;
+
 template class specfem::solver::time_marching<
     specfem::simulation::type::forward, specfem::dimension::type::dim2, qp8>;
 
+template class specfem::solver::time_marching<
+    specfem::simulation::type::combined, specfem::dimension::type::dim2, qp4>;
+
 template class specfem::solver::time_marching<
     specfem::simulation::type::combined, specfem::dimension::type::dim2, qp5>;
 
+template class specfem::solver::time_marching<
+    specfem::simulation::type::combined, specfem::dimension::type::dim2, qp6>;
+
+template class specfem::solver::time_marching<
+    specfem::simulation::type::combined, specfem::dimension::type::dim2, qp7>;
+
 template class specfem::solver::time_marching<
     specfem::simulation::type::combined, specfem::dimension::type::dim2, qp8>;
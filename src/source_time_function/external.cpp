@@ -1,8 +1,8 @@
 #include "source_time_function/external.hpp"
 #include "enumerations/specfem_enums.hpp"
 #include "kokkos_abstractions.h"
-#include "reader/seismogram.hpp"
 #include <fstream>
+#include <sstream>
 #include <tuple>
 #include <vector>
 
@@ -76,11 +76,47 @@ specfem::forcing_function::external::external(const YAML::Node &external,
   this->__dt = time2 - time;
   file.close();
 
+  // Index the files so that a range of time steps can be read without
+  // storing the source time function for every time step
+  const std::vector<std::string> filenames =
+      (this->ncomponents == 2)
+          ? std::vector<std::string>{ this->x_component, this->z_component }
+          : std::vector<std::string>{ this->y_component };
+
+  this->line_offsets.resize(filenames.size());
+  for (int icomp = 0; icomp < filenames.size(); ++icomp) {
+    if (filenames[icomp].empty())
+      continue;
+
+    std::ifstream file(filenames[icomp]);
+    if (!file.good()) {
+      throw std::runtime_error("Error: External source time function file " +
+                               filenames[icomp] + " does not exist");
+    }
+
+    int nlines = 0;
+    while (true) {
+      const std::streampos offset = file.tellg();
+      if (!std::getline(file, line))
+        break;
+      if (nlines % offset_stride == 0)
+        this->line_offsets[icomp].push_back(offset);
+      nlines++;
+    }
+
+    if (nlines != nsteps) {
+      throw std::runtime_error("Error in reading seismogram file : " +
+                               filenames[icomp] +
+                               " traces dont match with nsteps");
+    }
+  }
+
   return;
 }
 
 void specfem::forcing_function::external::compute_source_time_function(
-    const type_real t0, const type_real dt, const int nsteps,
+    const type_real t0, const type_real dt, const int first_step,
+    const int nsteps,
     specfem::kokkos::HostView2d<type_real> source_time_function) {
 
   const int ncomponents = source_time_function.extent(1);
@@ -102,14 +138,25 @@ void specfem::forcing_function::external::compute_source_time_function(
         "function does not match the simulation time step");
   }
 
+  if ((first_step < 0) || (first_step + nsteps > this->__nsteps)) {
+    throw std::runtime_error(
+        "The time steps requested from the external source time function "
+        "are outside of the file");
+  }
+
   std::vector<std::string> filename =
       (ncomponents == 2)
           ? std::vector<std::string>{ this->x_component, this->z_component }
           : std::vector<std::string>{ this->y_component };
 
-  // Check if files exist
+  // set source time function to 0
+  for (int i = 0; i < nsteps; i++) {
+    for (int icomp = 0; icomp < ncomponents; ++icomp) {
+      source_time_function(i, icomp) = 0.0;
+    }
+  }
+
   for (int icomp = 0; icomp < ncomponents; ++icomp) {
-    // Skip empty filenames
     if (filename[icomp].empty())
       continue;
 
@@ -118,25 +165,25 @@ void specfem::forcing_function::external::compute_source_time_function(
       throw std::runtime_error("Error: External source time function file " +
                                filename[icomp] + " does not exist");
     }
-  }
 
-  // set source time function to 0
-  for (int i = 0; i < nsteps; i++) {
-    for (int icomp = 0; icomp < ncomponents; ++icomp) {
-      source_time_function(i, icomp) = 0.0;
-    }
-  }
+    // Start from the closest indexed line preceding the range
+    const int ioffset = first_step / offset_stride;
+    file.seekg(this->line_offsets[icomp][ioffset]);
 
-  for (int icomp = 0; icomp < ncomponents; ++icomp) {
-    if (filename[icomp].empty())
-      continue;
+    std::string line;
+    for (int iline = ioffset * offset_stride; iline < first_step; iline++) {
+      std::getline(file, line);
+    }
 
-    specfem::kokkos::HostView2d<type_real> data("external", nsteps, 2);
-    specfem::reader::seismogram reader(
-        filename[icomp], specfem::enums::seismogram::format::ascii, data);
-    reader.read();
     for (int i = 0; i < nsteps; i++) {
-      source_time_function(i, icomp) = data(i, 1);
+      std::getline(file, line);
+      std::istringstream iss(line);
+      type_real time, value;
+      if (!(iss >> time >> value)) {
+        throw std::runtime_error("Seismogram file " + filename[icomp] +
+                                 " is not formatted correctly");
+      }
+      source_time_function(i, icomp) = value;
     }
   }
   return;
@@ -1,6 +1,5 @@
 #include "source_time_function/interface.hpp"
 #include "specfem_setup.hpp"
-#include "utilities.cpp"
 #include <Kokkos_Core.hpp>
 #include <cmath>
 
@@ -35,27 +34,20 @@ specfem::forcing_function::Ricker::Ricker(
 }
 
 type_real specfem::forcing_function::Ricker::compute(type_real t) {
-
-  type_real val;
-
-  if (this->__use_trick_for_better_pressure) {
-    val = -1.0 * this->__factor * d4gaussian(t - this->__tshift, this->__f0);
-  } else {
-    val = -1.0 * this->__factor * d2gaussian(t - this->__tshift, this->__f0);
-  }
-
-  return val;
+  return this->get_analytic_parameters().compute(t);
 }
 
 void specfem::forcing_function::Ricker::compute_source_time_function(
-    const type_real t0, const type_real dt, const int nsteps,
+    const type_real t0, const type_real dt, const int first_step,
+    const int nsteps,
     specfem::kokkos::HostView2d<type_real> source_time_function) {
 
   const int ncomponents = source_time_function.extent(1);
 
   for (int i = 0; i < nsteps; i++) {
     for (int icomp = 0; icomp < ncomponents; ++icomp) {
-      source_time_function(i, icomp) = this->compute(t0 + i * dt);
+      source_time_function(i, icomp) =
+          this->compute(t0 + (first_step + i) * dt);
     }
   }
 }
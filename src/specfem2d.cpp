@@ -1,7 +1,11 @@
+#include "IO/ASCII/ASCII.hpp"
+#include "IO/HDF5/HDF5.hpp"
 #include "compute/interface.hpp"
 // #include "coupled_interface/interface.hpp"
 // #include "domain/interface.hpp"
+#include "instrumentation/instrumentation.hpp"
 #include "kokkos_abstractions.h"
+#include "mesh/IO/native/mesh_database.hpp"
 #include "mesh/mesh.hpp"
 #include "parameter_parser/interface.hpp"
 #include "receiver/interface.hpp"
@@ -16,6 +20,7 @@
 #include <chrono>
 #include <ctime>
 #include <memory>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -23,6 +28,7 @@
 
 std::string print_end_message(
     std::chrono::time_point<std::chrono::high_resolution_clock> start_time,
+    std::chrono::duration<double> setup_time,
     std::chrono::duration<double> solver_time) {
   std::ostringstream message;
   // current date/time based on current system
@@ -36,6 +42,8 @@ std::string print_end_message(
           << "             Finished simulation\n"
           << "================================================\n\n"
           << "Total simulation time : " << diff.count() << " secs\n"
+          << "Total setup time (before time loop) : " << setup_time.count()
+          << " secs\n"
           << "Total solver time (time loop) : " << solver_time.count()
           << " secs\n"
           << "Simulation end time : " << ctime(&c_now)
@@ -89,7 +97,10 @@ void execute(const std::string &parameter_file, const std::string &default_file,
   // --------------------------------------------------------------
   auto start_time = std::chrono::high_resolution_clock::now();
   specfem::runtime_configuration::setup setup(parameter_file, default_file);
-  const auto [database_filename, source_filename] = setup.get_databases();
+  const auto [database, source_filename] = setup.get_databases();
+  // Partitioned meshes are read from one database per MPI rank
+  const auto database_filename =
+      specfem::mesh::partition_filename(database, mpi);
   mpi->cout(setup.print_header(start_time));
   // --------------------------------------------------------------
 
@@ -97,7 +108,17 @@ void execute(const std::string &parameter_file, const std::string &default_file,
   //                   Read mesh and materials
   // --------------------------------------------------------------
   const auto quadrature = setup.instantiate_quadrature();
-  const specfem::mesh::mesh mesh(database_filename, mpi);
+  const auto mesh_format = setup.get_mesh_format();
+  const specfem::mesh::mesh mesh = [&]() -> specfem::mesh::mesh {
+    if (mesh_format == "HDF5") {
+      return specfem::mesh::IO::native::read_mesh<
+          specfem::IO::HDF5<specfem::IO::read> >(database_filename, mpi);
+    } else if (mesh_format == "ASCII") {
+      return specfem::mesh::IO::native::read_mesh<
+          specfem::IO::ASCII<specfem::IO::read> >(database_filename, mpi);
+    }
+    return specfem::mesh::mesh(database_filename, mpi);
+  }();
   // --------------------------------------------------------------
 
   // --------------------------------------------------------------
@@ -152,12 +173,35 @@ void execute(const std::string &parameter_file, const std::string &default_file,
   mpi->cout("Generating assembly:");
   mpi->cout("-------------------------------");
   const type_real dt = setup.get_dt();
+  const auto assembly_cache =
+      setup.get_assembly_cache().empty()
+          ? specfem::compute::assembly_cache()
+          : specfem::compute::assembly_cache(
+                setup.get_assembly_cache(),
+                (mesh_format == "HDF5") ? database_filename + ".h5"
+                                        : database_filename);
+  if (assembly_cache.enabled() && mpi->main_proc()) {
+    std::cout << "Assembly cache : "
+              << assembly_cache.get_filename(quadrature,
+                                             setup.get_element_ordering())
+              << "\n"
+              << std::endl;
+  }
   specfem::compute::assembly assembly(
       mesh, quadrature, sources, receivers, setup.get_seismogram_types(),
       setup.get_t0(), dt, nsteps, max_seismogram_time_step,
-      setup.get_simulation_type());
+      setup.get_simulation_type(), setup.use_checkpointing(),
+      setup.stream_boundary_values(), setup.get_element_ordering(),
+      setup.get_element_assembly(), assembly_cache,
+      setup.get_seismogram_buffer_size());
   time_scheme->link_assembly(assembly);
 
+  if (assembly.boundary_values.stacey.nstep > 0 &&
+      assembly.boundary_values.step_size() > 0)
+    mpi->cout(assembly.boundary_values.print());
+
+  mpi->cout(assembly.print_memory_footprint());
+
   // --------------------------------------------------------------
 
   // --------------------------------------------------------------
@@ -178,9 +222,8 @@ void execute(const std::string &parameter_file, const std::string &default_file,
   // --------------------------------------------------------------
   //                   Instantiate Solver
   // --------------------------------------------------------------
-  specfem::enums::element::quadrature::static_quadrature_points<5> qp5;
   std::shared_ptr<specfem::solver::solver> solver =
-      setup.instantiate_solver(dt, assembly, time_scheme, qp5);
+      setup.instantiate_solver(dt, assembly, time_scheme);
   // --------------------------------------------------------------
 
   // --------------------------------------------------------------
@@ -190,12 +233,29 @@ void execute(const std::string &parameter_file, const std::string &default_file,
   mpi->cout("Executing time loop:");
   mpi->cout("-------------------------------");
 
+  auto &instrumentation = specfem::instrumentation::registry::get();
+  instrumentation.enable(setup.enable_instrumentation());
+
   const auto solver_start_time = std::chrono::high_resolution_clock::now();
+  const std::chrono::duration<double> setup_time =
+      solver_start_time - start_time;
   solver->run();
   const auto solver_end_time = std::chrono::high_resolution_clock::now();
 
   std::chrono::duration<double> solver_time =
       solver_end_time - solver_start_time;
+
+  if (instrumentation.is_enabled()) {
+    std::ostringstream timers;
+    instrumentation.print(timers);
+    mpi->cout(timers.str());
+
+    const std::string instrumentation_file =
+        setup.get_instrumentation_file();
+    if (!instrumentation_file.empty() && mpi->main_proc()) {
+      instrumentation.write_json(instrumentation_file);
+    }
+  }
   // --------------------------------------------------------------
 
   // --------------------------------------------------------------
@@ -237,7 +297,7 @@ void execute(const std::string &parameter_file, const std::string &default_file,
   // --------------------------------------------------------------
   //                   Print End Message
   // --------------------------------------------------------------
-  mpi->cout(print_end_message(start_time, solver_time));
+  mpi->cout(print_end_message(start_time, setup_time, solver_time));
   // --------------------------------------------------------------
 
   return;
@@ -0,0 +1,33 @@
+#include "writer/boundary_values_stream.hpp"
+#include "mesh/mesh.hpp"
+#include <iostream>
+
+specfem::writer::boundary_values_stream::boundary_values_stream(
+    const specfem::compute::assembly &assembly,
+    const std::string &output_folder)
+    : output_file(filename(output_folder, assembly.mpi_interfaces.mpi)),
+      boundary_values(assembly.boundary_values),
+      writer(std::make_unique<specfem::IO::async_block_writer>(
+          output_file, assembly.boundary_values.step_size(),
+          assembly.boundary_values.stacey.nstep)) {}
+
+std::string specfem::writer::boundary_values_stream::filename(
+    const std::string &folder, const specfem::MPI::MPI *mpi) {
+  return specfem::mesh::partition_filename(folder + "/BoundaryValues.bin",
+                                           mpi);
+}
+
+void specfem::writer::boundary_values_stream::write(const int istep) {
+  // The copy synchronizes with the kernels that computed the time step. Disk
+  // I/O then overlaps with the following time steps.
+  char *buffer = writer->acquire();
+  boundary_values.copy_step_to_host(istep,
+                                    reinterpret_cast<type_real *>(buffer));
+  writer->submit(istep);
+}
+
+void specfem::writer::boundary_values_stream::close() {
+  writer->close();
+
+  std::cout << "Boundary values written to " << output_file << std::endl;
+}
@@ -22,28 +22,9 @@ void specfem::writer::seismogram::write() {
       std::string network_name = receivers.network_names[irec];
       std::string station_name = receivers.station_names[irec];
       for (int isig = 0; isig < nsig_types; isig++) {
-        std::vector<std::string> filename;
-        auto stype = this->receivers.h_seismogram_types(isig);
-        switch (stype) {
-        case specfem::enums::seismogram::type::displacement:
-          filename = { this->output_folder + "/" + network_name + station_name +
-                           "BXX" + ".semd",
-                       this->output_folder + "/" + network_name + station_name +
-                           "BXZ" + ".semd" };
-          break;
-        case specfem::enums::seismogram::type::velocity:
-          filename = { this->output_folder + "/" + network_name + station_name +
-                           "BXX" + ".semv",
-                       this->output_folder + "/" + network_name + station_name +
-                           "BXZ" + ".semv" };
-          break;
-        case specfem::enums::seismogram::type::acceleration:
-          filename = { this->output_folder + "/" + network_name + station_name +
-                           "BXX" + ".sema",
-                       this->output_folder + "/" + network_name + station_name +
-                           "BXZ" + ".sema" };
-          break;
-        }
+        const auto filename = filenames(
+            this->output_folder, network_name, station_name,
+            this->receivers.h_seismogram_types(isig));
 
         for (int iorientation = 0; iorientation < filename.size();
              iorientation++) {
@@ -72,3 +53,22 @@ void specfem::writer::seismogram::write() {
 
   std::cout << std::endl;
 }
+
+std::vector<std::string> specfem::writer::seismogram::filenames(
+    const std::string &output_folder, const std::string &network_name,
+    const std::string &station_name,
+    const specfem::enums::seismogram::type type) {
+
+  const std::string prefix = output_folder + "/" + network_name + station_name;
+
+  switch (type) {
+  case specfem::enums::seismogram::type::displacement:
+    return { prefix + "BXX" + ".semd", prefix + "BXZ" + ".semd" };
+  case specfem::enums::seismogram::type::velocity:
+    return { prefix + "BXX" + ".semv", prefix + "BXZ" + ".semv" };
+  case specfem::enums::seismogram::type::acceleration:
+    return { prefix + "BXX" + ".sema", prefix + "BXZ" + ".sema" };
+  default:
+    throw std::runtime_error("Unknown seismogram type");
+  }
+}
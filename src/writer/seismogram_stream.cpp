@@ -0,0 +1,468 @@
+#include "writer/seismogram_stream.hpp"
+#include "IO/HDF5/impl/mutex.hpp"
+#include "IO/HDF5/impl/native_type.hpp"
+#include "IO/HDF5/impl/native_type.tpp"
+#include "mesh/mesh.hpp"
+#include "writer/seismogram.hpp"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#ifndef NO_HDF5
+#include "H5Cpp.h"
+#endif
+
+constexpr char specfem::writer::seismogram_header::signature[8];
+
+namespace specfem {
+namespace writer {
+namespace impl {
+
+/**
+ * @brief File storing seismogram steps
+ *
+ * A seismogram step holds @c sample_size values ordered as
+ * <tt>[ntypes][nreceivers][ncomponents]</tt>.
+ */
+class seismogram_file {
+public:
+  virtual ~seismogram_file() = default;
+
+  /**
+   * @brief Write consecutive seismogram steps
+   *
+   * @param first First seismogram step
+   * @param count Number of seismogram steps
+   * @param data Values of the seismogram steps
+   */
+  virtual void write(const int first, const int count,
+                     const type_real *data) = 0;
+
+  /**
+   * @brief Read consecutive seismogram steps
+   *
+   * @param first First seismogram step
+   * @param count Number of seismogram steps
+   * @param data Values of the seismogram steps
+   */
+  virtual void read(const int first, const int count, type_real *data) = 0;
+
+  /**
+   * @brief Close the file
+   *
+   */
+  virtual void close() = 0;
+};
+
+} // namespace impl
+} // namespace writer
+} // namespace specfem
+
+namespace {
+
+bool little_endian() {
+  const std::uint16_t one = 1;
+  unsigned char first_byte;
+  std::memcpy(&first_byte, &one, 1);
+  return first_byte == 1;
+}
+
+class binary_file : public specfem::writer::impl::seismogram_file {
+public:
+  binary_file(const std::string &filename,
+              const specfem::writer::seismogram_header &header)
+      : filename(filename),
+        sample_size(static_cast<std::size_t>(header.ntypes) *
+                    header.nreceivers * header.ncomponents) {
+
+    if (!little_endian()) {
+      std::ostringstream message;
+      message << "Error writing seismograms to " << filename << ". \n"
+              << "Binary seismograms are only supported on little-endian "
+                 "hosts.";
+      throw std::runtime_error(message.str());
+    }
+
+    file = std::fopen(filename.c_str(), "wb+");
+    if (file == nullptr) {
+      std::ostringstream message;
+      message << "Error writing seismograms. \n"
+              << "Could not open " << filename << " for writing.";
+      throw std::runtime_error(message.str());
+    }
+
+    if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+      std::fclose(file);
+      std::ostringstream message;
+      message << "Error writing seismograms. \n"
+              << "Could not write header to " << filename;
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  ~binary_file() override {
+    if (file != nullptr)
+      std::fclose(file);
+  }
+
+  void write(const int first, const int count,
+             const type_real *data) override {
+    const std::size_t nvalues = count * sample_size;
+    if (!(std::fseek(file, offset(first), SEEK_SET) == 0 &&
+          std::fwrite(data, sizeof(type_real), nvalues, file) == nvalues)) {
+      std::ostringstream message;
+      message << "Error writing seismogram steps [" << first << ", "
+              << first + count << ") to " << filename;
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  void read(const int first, const int count, type_real *data) override {
+    const std::size_t nvalues = count * sample_size;
+    if (!(std::fseek(file, offset(first), SEEK_SET) == 0 &&
+          std::fread(data, sizeof(type_real), nvalues, file) == nvalues)) {
+      std::ostringstream message;
+      message << "Error reading seismogram steps [" << first << ", "
+              << first + count << ") from " << filename;
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  void close() override {
+    const bool success = (std::fclose(file) == 0);
+    file = nullptr;
+    if (!success) {
+      std::ostringstream message;
+      message << "Error closing " << filename;
+      throw std::runtime_error(message.str());
+    }
+  }
+
+private:
+  long offset(const int first) const {
+    return static_cast<long>(sizeof(specfem::writer::seismogram_header) +
+                             first * sample_size * sizeof(type_real));
+  }
+
+  std::string filename;
+  std::size_t sample_size;
+  std::FILE *file = nullptr;
+};
+
+#ifndef NO_HDF5
+// Seismograms of every stream are written from their own background thread.
+// Every call into HDF5, including the destruction of HDF5 objects, holds the
+// process-wide HDF5 mutex
+class hdf5_file : public specfem::writer::impl::seismogram_file {
+public:
+  hdf5_file(const std::string &filename,
+            const specfem::writer::seismogram_header &header,
+            const specfem::compute::receivers &receivers)
+      : dims{ static_cast<hsize_t>(header.nsteps),
+              static_cast<hsize_t>(header.ntypes),
+              static_cast<hsize_t>(header.nreceivers),
+              static_cast<hsize_t>(header.ncomponents) } {
+
+    using specfem::IO::impl::HDF5::native_type;
+
+    const std::lock_guard<std::mutex> lock(specfem::IO::impl::HDF5::mutex());
+
+    file = std::make_unique<H5::H5File>(filename, H5F_ACC_TRUNC);
+
+    const H5::DataSpace dataspace(4, dims);
+    dataset = std::make_unique<H5::DataSet>(file->createDataSet(
+        "seismograms", native_type<type_real>::type(), dataspace));
+
+    const H5::DataSpace scalar;
+    dataset->createAttribute("dt", H5::PredType::NATIVE_DOUBLE, scalar)
+        .write(H5::PredType::NATIVE_DOUBLE, &header.dt);
+    dataset->createAttribute("t0", H5::PredType::NATIVE_DOUBLE, scalar)
+        .write(H5::PredType::NATIVE_DOUBLE, &header.t0);
+
+    const hsize_t ntypes = header.ntypes;
+    const H5::DataSpace types_space(1, &ntypes);
+    file->createDataSet("types", native_type<int>::type(), types_space)
+        .write(header.types, H5::PredType::NATIVE_INT32);
+
+    // Network and station names in the order of the receivers
+    const hsize_t nreceivers = header.nreceivers;
+    const H5::DataSpace names_space(1, &nreceivers);
+    const H5::StrType string_type(H5::PredType::C_S1, H5T_VARIABLE);
+    for (const auto &[name, names] :
+         { std::make_pair("network", &receivers.network_names),
+           std::make_pair("station", &receivers.station_names) }) {
+      std::vector<const char *> values;
+      for (const auto &value : *names)
+        values.push_back(value.c_str());
+      file->createDataSet(name, string_type, names_space)
+          .write(values.data(), string_type);
+    }
+  }
+
+  ~hdf5_file() override {
+    const std::lock_guard<std::mutex> lock(specfem::IO::impl::HDF5::mutex());
+    dataset.reset();
+    file.reset();
+  }
+
+  void write(const int first, const int count,
+             const type_real *data) override {
+    const std::lock_guard<std::mutex> lock(specfem::IO::impl::HDF5::mutex());
+    auto [memspace, filespace] = select(first, count);
+    dataset->write(data,
+                   specfem::IO::impl::HDF5::native_type<type_real>::type(),
+                   memspace, filespace);
+  }
+
+  void read(const int first, const int count, type_real *data) override {
+    const std::lock_guard<std::mutex> lock(specfem::IO::impl::HDF5::mutex());
+    auto [memspace, filespace] = select(first, count);
+    dataset->read(data,
+                  specfem::IO::impl::HDF5::native_type<type_real>::type(),
+                  memspace, filespace);
+  }
+
+  void close() override {
+    const std::lock_guard<std::mutex> lock(specfem::IO::impl::HDF5::mutex());
+    dataset->close();
+    file->close();
+  }
+
+private:
+  // Must be called while holding the HDF5 mutex
+  std::pair<H5::DataSpace, H5::DataSpace> select(const int first,
+                                                 const int count) const {
+    const hsize_t offset[4] = { static_cast<hsize_t>(first), 0, 0, 0 };
+    const hsize_t extent[4] = { static_cast<hsize_t>(count), dims[1], dims[2],
+                                dims[3] };
+    H5::DataSpace filespace = dataset->getSpace();
+    filespace.selectHyperslab(H5S_SELECT_SET, extent, offset);
+    return { H5::DataSpace(4, extent), filespace };
+  }
+
+  std::unique_ptr<H5::H5File> file;
+  std::unique_ptr<H5::DataSet> dataset;
+  hsize_t dims[4];
+};
+#endif
+
+} // namespace
+
+specfem::writer::seismogram_stream::seismogram_stream(
+    const specfem::compute::receivers &receivers,
+    const specfem::enums::seismogram::format type,
+    const std::string &output_folder, const type_real dt, const type_real t0,
+    const int nstep_between_samples, const int nsteps,
+    const bool ascii_export, const specfem::MPI::MPI *mpi)
+    : receivers(receivers), type(type), output_folder(output_folder),
+      dt(dt * nstep_between_samples), t0(t0), nsteps(nsteps),
+      nbuffer(receivers.get_buffer_size()), ascii_export(ascii_export),
+      mpi(mpi) {
+
+  const int ntypes = receivers.h_seismogram_types.extent(0);
+
+  if (nbuffer < std::min(nsteps, 1) || ntypes > 3) {
+    std::ostringstream message;
+    message << "Error creating seismogram stream. \n"
+            << "Invalid ring buffer of " << nbuffer << " seismogram steps for "
+            << ntypes << " seismogram types.";
+    throw std::runtime_error(message.str());
+  }
+
+  seismogram_header header = {};
+  std::copy(seismogram_header::signature, seismogram_header::signature + 8,
+            header.magic);
+  header.version = seismogram_header::current_version;
+  header.real_size = sizeof(type_real);
+  header.nsteps = nsteps;
+  header.ntypes = ntypes;
+  header.nreceivers = receivers.nreceivers;
+  header.ncomponents = ndim;
+  header.dt = this->dt;
+  header.t0 = t0;
+  for (int isig = 0; isig < ntypes; ++isig) {
+    header.types[isig] =
+        static_cast<std::int32_t>(receivers.h_seismogram_types(isig));
+  }
+
+  switch (type) {
+  case specfem::enums::seismogram::binary:
+    file = std::make_unique<binary_file>(filename(output_folder, type, mpi),
+                                         header);
+    break;
+  case specfem::enums::seismogram::hdf5:
+#ifndef NO_HDF5
+    file = std::make_unique<hdf5_file>(filename(output_folder, type, mpi),
+                                       header, receivers);
+    break;
+#else
+    throw std::runtime_error("SPECFEM++ was not compiled with HDF5 support");
+#endif
+  default:
+    std::ostringstream message;
+    message << "Error creating seismogram stream. \n"
+            << "Seismogram output type " << type << " cannot be streamed.";
+    throw std::runtime_error(message.str());
+  }
+
+  const std::size_t sample_size =
+      static_cast<std::size_t>(ntypes) * receivers.nreceivers * ndim;
+  buffer.resize(nbuffer * sample_size);
+}
+
+specfem::writer::seismogram_stream::~seismogram_stream() {
+  if (pending.valid())
+    pending.wait();
+}
+
+std::string specfem::writer::seismogram_stream::filename(
+    const std::string &folder, const specfem::enums::seismogram::format type,
+    const specfem::MPI::MPI *mpi) {
+  const std::string name = (type == specfem::enums::seismogram::hdf5)
+                               ? "/seismograms.h5"
+                               : "/seismograms.bin";
+  return specfem::mesh::partition_filename(folder + name, mpi);
+}
+
+void specfem::writer::seismogram_stream::write(const int isig_step) {
+  // Seismogram steps past the end of the simulation are not stored
+  if (isig_step >= nsteps)
+    return;
+
+  if (isig_step != ncomputed) {
+    std::ostringstream message;
+    message << "Error streaming seismograms. \n"
+            << "Expected seismogram step " << ncomputed << " but got "
+            << isig_step;
+    throw std::runtime_error(message.str());
+  }
+
+  ncomputed = isig_step + 1;
+
+  if (ncomputed - nflushed == nbuffer || ncomputed == nsteps)
+    this->flush();
+}
+
+void specfem::writer::seismogram_stream::flush() {
+  const int first = nflushed;
+  const int count = ncomputed - nflushed;
+  if (count == 0)
+    return;
+
+  // The previous write overlapped with the time steps since the last flush.
+  // It has to complete before its host buffer is reused
+  if (pending.valid())
+    pending.get();
+
+  receivers.sync_seismograms();
+
+  const auto h_seismogram = receivers.h_seismogram;
+  const int ntypes = h_seismogram.extent(1);
+  const int nreceivers = h_seismogram.extent(2);
+
+  std::size_t index = 0;
+  for (int isig_step = first; isig_step < first + count; ++isig_step) {
+    const int islot = isig_step % nbuffer;
+    for (int isig = 0; isig < ntypes; ++isig) {
+      for (int irec = 0; irec < nreceivers; ++irec) {
+        for (int icomp = 0; icomp < ndim; ++icomp) {
+          buffer[index++] = h_seismogram(islot, isig, irec, icomp);
+        }
+      }
+    }
+  }
+
+  // Disk I/O overlaps with the following time steps
+  pending = std::async(std::launch::async, [this, first, count]() {
+    file->write(first, count, buffer.data());
+  });
+
+  nflushed = ncomputed;
+}
+
+void specfem::writer::seismogram_stream::close() {
+  if (closed)
+    return;
+
+  closed = true;
+
+  this->flush();
+
+  if (pending.valid())
+    pending.get();
+
+  if (ascii_export)
+    this->export_ascii();
+
+  file->close();
+
+  std::cout << "Seismograms written to " << filename(output_folder, type, mpi)
+            << std::endl;
+}
+
+void specfem::writer::seismogram_stream::export_ascii() {
+  const int ntypes = receivers.h_seismogram_types.extent(0);
+  const int nreceivers = receivers.nreceivers;
+  const std::size_t sample_size =
+      static_cast<std::size_t>(ntypes) * nreceivers * ndim;
+
+  // Limits the number of files open at the same time
+  constexpr int receivers_per_batch = 64;
+
+  for (int first_receiver = 0; first_receiver < nreceivers;
+       first_receiver += receivers_per_batch) {
+    const int last_receiver =
+        std::min(first_receiver + receivers_per_batch, nreceivers);
+
+    std::vector<std::ofstream> files;
+    for (int irec = first_receiver; irec < last_receiver; ++irec) {
+      for (int isig = 0; isig < ntypes; ++isig) {
+        for (const auto &name : specfem::writer::seismogram::filenames(
+                 output_folder, receivers.network_names[irec],
+                 receivers.station_names[irec],
+                 receivers.h_seismogram_types(isig))) {
+          files.emplace_back(name);
+          if (!files.back().is_open()) {
+            std::ostringstream message;
+            message << "Error exporting seismograms. \n"
+                    << "Could not open " << name << " for writing.";
+            throw std::runtime_error(message.str());
+          }
+        }
+      }
+    }
+
+    // Read the file one ring buffer at a time
+    for (int first = 0; first < nsteps; first += nbuffer) {
+      const int count = std::min(nbuffer, nsteps - first);
+      file->read(first, count, buffer.data());
+
+      for (int istep = 0; istep < count; ++istep) {
+        const type_real time_t = (first + istep) * dt + t0;
+        const type_real *sample = buffer.data() + istep * sample_size;
+        int ifile = 0;
+        for (int irec = first_receiver; irec < last_receiver; ++irec) {
+          for (int isig = 0; isig < ntypes; ++isig) {
+            for (int icomp = 0; icomp < ndim; ++icomp) {
+              const type_real value =
+                  sample[(isig * nreceivers + irec) * ndim + icomp];
+              files[ifile++] << std::scientific << time_t << " "
+                             << std::scientific << value << "\n";
+            }
+          }
+        }
+      }
+    }
+  }
+
+  std::cout << "Seismograms exported to ASCII files in " << output_folder
+            << std::endl;
+}
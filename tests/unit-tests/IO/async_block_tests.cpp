@@ -0,0 +1,110 @@
+#include "IO/async/block_reader.hpp"
+#include "IO/async/block_writer.hpp"
+#include <cstring>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+// Fill a block with values that identify the block and the position within it
+void fill_block(char *buffer, const std::size_t block_size, const int iblock) {
+  for (std::size_t i = 0; i < block_size / sizeof(int); ++i) {
+    const int value = iblock * 1000 + static_cast<int>(i);
+    std::memcpy(buffer + i * sizeof(int), &value, sizeof(int));
+  }
+}
+
+void check_block(const char *buffer, const std::size_t block_size,
+                 const int iblock) {
+  for (std::size_t i = 0; i < block_size / sizeof(int); ++i) {
+    int value;
+    std::memcpy(&value, buffer + i * sizeof(int), sizeof(int));
+    ASSERT_EQ(value, iblock * 1000 + static_cast<int>(i))
+        << "Block " << iblock << ", entry " << i;
+  }
+}
+
+std::string filename(const std::string &name) {
+  return ::testing::TempDir() + "/" + name;
+}
+
+void write_blocks(const std::string &file, const std::size_t block_size,
+                  const std::vector<int> &order, const int nblocks,
+                  const int nbuffers) {
+  specfem::IO::async_block_writer writer(file, block_size, nblocks, nbuffers);
+  for (const int iblock : order) {
+    fill_block(writer.acquire(), block_size, iblock);
+    writer.submit(iblock);
+  }
+  writer.close();
+}
+} // namespace
+
+TEST(ASYNC_BLOCK_IO, forward_write_reverse_read) {
+  const std::string file = filename("async_block_forward.bin");
+  const int nblocks = 100;
+  const std::size_t block_size = 64 * sizeof(int);
+
+  std::vector<int> forward(nblocks);
+  std::iota(forward.begin(), forward.end(), 0);
+  write_blocks(file, block_size, forward, nblocks, 2);
+
+  const std::vector<int> reverse(forward.rbegin(), forward.rend());
+  specfem::IO::async_block_reader reader(file, block_size, reverse);
+  EXPECT_EQ(reader.get_nblocks(), nblocks);
+
+  for (const int iblock : reverse) {
+    check_block(reader.next(), block_size, iblock);
+  }
+
+  EXPECT_THROW(reader.next(), std::runtime_error);
+}
+
+TEST(ASYNC_BLOCK_IO, out_of_order_write) {
+  const std::string file = filename("async_block_shuffled.bin");
+  const int nblocks = 17;
+  const std::size_t block_size = 5 * sizeof(int);
+
+  std::vector<int> order;
+  for (int iblock = nblocks - 1; iblock >= 0; iblock -= 2)
+    order.push_back(iblock);
+  for (int iblock = nblocks - 2; iblock >= 0; iblock -= 2)
+    order.push_back(iblock);
+  write_blocks(file, block_size, order, nblocks, 4);
+
+  std::vector<int> forward(nblocks);
+  std::iota(forward.begin(), forward.end(), 0);
+  specfem::IO::async_block_reader reader(file, block_size, forward, 3);
+
+  for (const int iblock : forward) {
+    check_block(reader.next(), block_size, iblock);
+  }
+}
+
+TEST(ASYNC_BLOCK_IO, invalid_usage) {
+  const std::string file = filename("async_block_invalid.bin");
+  const std::size_t block_size = 8 * sizeof(int);
+
+  EXPECT_THROW(specfem::IO::async_block_writer(file, block_size, 4, 1),
+               std::runtime_error);
+
+  {
+    specfem::IO::async_block_writer writer(file, block_size, 4);
+    EXPECT_THROW(writer.submit(0), std::runtime_error);
+    writer.acquire();
+    EXPECT_THROW(writer.acquire(), std::runtime_error);
+    EXPECT_THROW(writer.submit(4), std::runtime_error);
+    writer.submit(3);
+    writer.close();
+  }
+
+  EXPECT_THROW(specfem::IO::async_block_reader(file, 2 * block_size, { 0 }),
+               std::runtime_error);
+  EXPECT_THROW(specfem::IO::async_block_reader(file, block_size, { 4 }),
+               std::runtime_error);
+  EXPECT_THROW(specfem::IO::async_block_reader(filename("does_not_exist.bin"),
+                                               block_size, { 0 }),
+               std::runtime_error);
+}
@@ -5,6 +5,7 @@
 #include "kokkos_abstractions.h"
 #include "mesh/mesh.hpp"
 #include <Kokkos_Core.hpp>
+#include <limits>
 
 TEST(ALGORITHMS, locate_point) {
 
@@ -95,6 +96,94 @@ TEST(ALGORITHMS, locate_point) {
   return;
 }
 
+TEST(ALGORITHMS, locate_point_batched) {
+
+  std::string database_file =
+      "../../../tests/unit-tests/algorithms/serial/database.bin";
+
+  // Read Mesh database
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+  specfem::mesh::mesh mesh(database_file, mpi);
+
+  // Quadratures
+  specfem::quadrature::gll::gll gll(0.0, 0.0, 5);
+  specfem::quadrature::quadratures quadratures(gll);
+
+  // Assemble
+  specfem::compute::mesh assembly(mesh.tags, mesh.control_nodes, quadratures);
+
+  const auto &points = assembly.points;
+  const int nspec = assembly.nspec;
+  const int ngllz = assembly.ngllz;
+  const int ngllx = assembly.ngllx;
+
+  // Points on a regular grid covering the mesh and a margin around it
+  const int nx = 23;
+  const int nz = 17;
+  const type_real margin_x = 0.1 * (points.xmax - points.xmin);
+  const type_real margin_z = 0.1 * (points.zmax - points.zmin);
+
+  specfem::kokkos::HostView1d<
+      specfem::point::global_coordinates<specfem::dimension::type::dim2> >
+      coordinates("coordinates", nx * nz);
+
+  for (int iz = 0; iz < nz; ++iz) {
+    for (int ix = 0; ix < nx; ++ix) {
+      coordinates(iz * nx + ix) = {
+        points.xmin - margin_x +
+            (points.xmax - points.xmin + 2 * margin_x) * ix / (nx - 1),
+        points.zmin - margin_z +
+            (points.zmax - points.zmin + 2 * margin_z) * iz / (nz - 1)
+      };
+    }
+  }
+
+  // The spatial index finds the same quadrature point as a scan over the
+  // whole mesh
+  for (int ipoint = 0; ipoint < nx * nz; ++ipoint) {
+    type_real dist_min = std::numeric_limits<type_real>::max();
+    int ispec_ref = -1, iz_ref = -1, ix_ref = -1;
+    for (int ispec = 0; ispec < nspec; ++ispec) {
+      for (int iz = 0; iz < ngllz; ++iz) {
+        for (int ix = 0; ix < ngllx; ++ix) {
+          const specfem::point::global_coordinates<
+              specfem::dimension::type::dim2>
+              point = { points.h_coord(0, ispec, iz, ix),
+                        points.h_coord(1, ispec, iz, ix) };
+          const type_real distance =
+              specfem::point::distance(coordinates(ipoint), point);
+          if (distance < dist_min) {
+            dist_min = distance;
+            ispec_ref = ispec;
+            iz_ref = iz;
+            ix_ref = ix;
+          }
+        }
+      }
+    }
+
+    const auto [ix, iz, ispec] =
+        assembly.spatial_index.closest_quadrature_point(points,
+                                                        coordinates(ipoint));
+    EXPECT_EQ(ispec, ispec_ref);
+    EXPECT_EQ(iz, iz_ref);
+    EXPECT_EQ(ix, ix_ref);
+  }
+
+  // Batched location matches locating one point at a time
+  const auto lcoord = specfem::algorithms::locate_point(coordinates, assembly);
+
+  for (int ipoint = 0; ipoint < nx * nz; ++ipoint) {
+    const auto reference =
+        specfem::algorithms::locate_point(coordinates(ipoint), assembly);
+    EXPECT_EQ(lcoord(ipoint).ispec, reference.ispec);
+    EXPECT_EQ(lcoord(ipoint).xi, reference.xi);
+    EXPECT_EQ(lcoord(ipoint).gamma, reference.gamma);
+  }
+
+  return;
+}
+
 int main(int argc, char *argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
@@ -88,6 +88,12 @@ TEST(COMPUTE_TESTS, compute_elastic_properties) {
   specfem::compute::properties compute_properties(
       nspec, ngllz, ngllx, compute_mesh.mapping, mesh.tags, mesh.materials);
 
+  // Mesh materials are per element: properties are stored once per element
+  const auto &elastic = compute_properties.elastic_isotropic;
+  EXPECT_TRUE(elastic.per_element);
+  EXPECT_EQ(elastic.rho.size(), 0);
+  EXPECT_EQ(elastic.element_rho.extent(0), elastic.nspec);
+
   specfem::testing::array3d<type_real, Kokkos::LayoutRight> rho_global(
       test_config.rho_file, nspec, ngllz, ngllx);
   specfem::testing::array3d<type_real, Kokkos::LayoutRight> mu_global(
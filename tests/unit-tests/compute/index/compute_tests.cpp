@@ -5,6 +5,8 @@
 #include "mesh/mesh.hpp"
 #include "quadrature/interface.hpp"
 #include "yaml-cpp/yaml.h"
+#include <boost/filesystem.hpp>
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -61,31 +63,9 @@ test_config get_test_config(std::string config_filename,
 }
 // ---------------------------------------------------------------------------
 
-/**
- *
- * This test should be run on single and multiple nodes
- *
- */
-TEST(COMPUTE_TESTS, compute_ibool) {
-
-  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
-
-  std::string config_filename =
-      "../../../tests/unit-tests/compute/index/test_config.yml";
-  test_config test_config = get_test_config(config_filename, mpi);
-
-  // Set up GLL quadrature points
-  specfem::quadrature::gll::gll gll(0.0, 0.0, 5);
-
-  specfem::quadrature::quadratures quadratures(gll);
-
-  // Read mesh generated MESHFEM
-  specfem::mesh::mesh mesh(test_config.database_filename, mpi);
-
-  // Setup compute structs
-  specfem::compute::mesh assembly(mesh.tags, mesh.control_nodes,
-                                  quadratures); // mesh assembly
-
+// Check that every global index maps to a single set of coordinates and
+// return the number of global points
+int check_index_mapping(const specfem::compute::mesh &assembly) {
   const auto h_index_mapping = assembly.points.h_index_mapping;
   const auto h_coord = assembly.points.h_coord;
 
@@ -123,6 +103,387 @@ TEST(COMPUTE_TESTS, compute_ibool) {
     }
   }
 
+  return static_cast<int>(nglob);
+}
+
+/**
+ *
+ * This test should be run on single and multiple nodes
+ *
+ */
+TEST(COMPUTE_TESTS, compute_ibool) {
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  std::string config_filename =
+      "../../../tests/unit-tests/compute/index/test_config.yml";
+  test_config test_config = get_test_config(config_filename, mpi);
+
+  // Set up GLL quadrature points
+  specfem::quadrature::gll::gll gll(0.0, 0.0, 5);
+
+  specfem::quadrature::quadratures quadratures(gll);
+
+  // Read mesh generated MESHFEM
+  specfem::mesh::mesh mesh(test_config.database_filename, mpi);
+
+  // Setup compute structs
+  specfem::compute::mesh assembly(mesh.tags, mesh.control_nodes,
+                                  quadratures); // mesh assembly
+
+  check_index_mapping(assembly);
+
+  return;
+}
+
+/**
+ *
+ * Elements reordered along a Hilbert curve must stay grouped by tag and
+ * global points must be numbered in the order elements first touch them
+ *
+ */
+TEST(COMPUTE_TESTS, compute_ibool_hilbert_ordering) {
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  std::string config_filename =
+      "../../../tests/unit-tests/compute/index/test_config.yml";
+  test_config test_config = get_test_config(config_filename, mpi);
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, 5);
+
+  specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::mesh::mesh mesh(test_config.database_filename, mpi);
+
+  specfem::compute::mesh reference(mesh.tags, mesh.control_nodes,
+                                   quadratures);
+  specfem::compute::mesh assembly(mesh.tags, mesh.control_nodes, quadratures,
+                                  specfem::compute::element_ordering::hilbert);
+
+  EXPECT_EQ(check_index_mapping(assembly), check_index_mapping(reference));
+
+  const int nspec = assembly.nspec;
+  const int ngllz = assembly.ngllz;
+  const int ngllx = assembly.ngllx;
+
+  // Element order is a permutation that keeps the sequence of tag groups
+  std::vector<bool> visited(nspec, false);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    const int ispec_mesh = assembly.mapping.compute_to_mesh(ispec);
+    ASSERT_FALSE(visited[ispec_mesh]);
+    visited[ispec_mesh] = true;
+    EXPECT_EQ(assembly.mapping.mesh_to_compute(ispec_mesh), ispec);
+    const auto tag = mesh.tags.tags_container(ispec_mesh);
+    const auto reference_tag =
+        mesh.tags.tags_container(reference.mapping.compute_to_mesh(ispec));
+    EXPECT_TRUE(tag.medium_tag == reference_tag.medium_tag);
+    EXPECT_TRUE(tag.property_tag == reference_tag.property_tag);
+    EXPECT_TRUE(tag.boundary_tag == reference_tag.boundary_tag);
+  }
+
+  // Global points are numbered in first touch order
+  int inum = 0;
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        const int index = assembly.points.h_index_mapping(ispec, iz, ix);
+        EXPECT_LE(index, inum);
+        if (index == inum)
+          inum++;
+      }
+    }
+  }
+
+  return;
+}
+
+/**
+ *
+ * The topology based numbering must match the numbering computed by sorting
+ * the coordinates of every quadrature point
+ *
+ */
+TEST(COMPUTE_TESTS, compute_ibool_topology_numbering) {
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  std::string config_filename =
+      "../../../tests/unit-tests/compute/index/test_config.yml";
+  test_config test_config = get_test_config(config_filename, mpi);
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, 5);
+
+  specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::mesh::mesh mesh(test_config.database_filename, mpi);
+
+  for (const auto ordering : { specfem::compute::element_ordering::none,
+                               specfem::compute::element_ordering::hilbert }) {
+    specfem::compute::mesh assembly(mesh.tags, mesh.control_nodes, quadratures,
+                                    ordering);
+
+    const auto reference =
+        assembly.assemble(specfem::compute::global_numbering::coordinates);
+
+    const int nspec = assembly.nspec;
+    const int ngllz = assembly.ngllz;
+    const int ngllx = assembly.ngllx;
+
+    for (int ispec = 0; ispec < nspec; ++ispec) {
+      for (int iz = 0; iz < ngllz; ++iz) {
+        for (int ix = 0; ix < ngllx; ++ix) {
+          ASSERT_EQ(assembly.points.h_index_mapping(ispec, iz, ix),
+                    reference.h_index_mapping(ispec, iz, ix));
+        }
+      }
+    }
+
+    EXPECT_FLOAT_EQ(assembly.points.xmin, reference.xmin);
+    EXPECT_FLOAT_EQ(assembly.points.xmax, reference.xmax);
+    EXPECT_FLOAT_EQ(assembly.points.zmin, reference.zmin);
+    EXPECT_FLOAT_EQ(assembly.points.zmax, reference.zmax);
+  }
+
+  return;
+}
+
+/**
+ *
+ * Elements touching an MPI interface must come first within their tag group
+ *
+ */
+TEST(COMPUTE_TESTS, compute_outer_elements) {
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  std::string config_filename =
+      "../../../tests/unit-tests/compute/index/test_config.yml";
+  test_config test_config = get_test_config(config_filename, mpi);
+
+  specfem::mesh::mesh mesh(test_config.database_filename, mpi);
+
+  const auto knods = mesh.control_nodes.knods;
+
+  // Share the first edge of the first element with another rank
+  specfem::mesh::interfaces::interface interfaces;
+  interfaces.ninterfaces = 1;
+  interfaces.max_interface_size = 1;
+  interfaces.my_neighbors =
+      specfem::kokkos::HostView1d<int>("my_neighbors", 1);
+  interfaces.my_nelmnts_neighbors =
+      specfem::kokkos::HostView1d<int>("my_nelmnts_neighbors", 1);
+  interfaces.my_interfaces =
+      specfem::kokkos::HostView3d<int>("my_interfaces", 1, 1, 4);
+  interfaces.my_neighbors(0) = 1;
+  interfaces.my_nelmnts_neighbors(0) = 1;
+  interfaces.my_interfaces(0, 0, 0) = 0;
+  interfaces.my_interfaces(0, 0, 1) = 2;
+  interfaces.my_interfaces(0, 0, 2) = knods(0, 0);
+  interfaces.my_interfaces(0, 0, 3) = knods(1, 0);
+
+  const specfem::compute::mesh_to_compute_mapping reference(mesh.tags);
+  const specfem::compute::mesh_to_compute_mapping mapping(
+      mesh.tags, mesh.control_nodes, specfem::compute::element_ordering::none,
+      interfaces);
+
+  const int nspec = mesh.nspec;
+
+  int nouter = 0;
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    const int ispec_mesh = mapping.compute_to_mesh(ispec);
+    EXPECT_EQ(mapping.mesh_to_compute(ispec_mesh), ispec);
+
+    // Every element with a corner on the shared edge is an outer element
+    bool expected = false;
+    for (int icorner = 0; icorner < 4; ++icorner) {
+      const int node = knods(icorner, ispec_mesh);
+      expected = expected || (node == knods(0, 0)) || (node == knods(1, 0));
+    }
+    EXPECT_EQ(mapping.outer(ispec), expected ? 1 : 0);
+    nouter += mapping.outer(ispec);
+
+    // The sequence of tag groups is unchanged
+    const auto tag = mesh.tags.tags_container(ispec_mesh);
+    const auto reference_tag =
+        mesh.tags.tags_container(reference.compute_to_mesh(ispec));
+    EXPECT_TRUE(tag.medium_tag == reference_tag.medium_tag);
+    EXPECT_TRUE(tag.property_tag == reference_tag.property_tag);
+    EXPECT_TRUE(tag.boundary_tag == reference_tag.boundary_tag);
+
+    // Inner elements are never followed by outer elements of the same group
+    if (ispec > 0 && !mapping.outer(ispec - 1)) {
+      const auto previous =
+          mesh.tags.tags_container(mapping.compute_to_mesh(ispec - 1));
+      if (previous.medium_tag == tag.medium_tag &&
+          previous.property_tag == tag.property_tag &&
+          previous.boundary_tag == tag.boundary_tag) {
+        EXPECT_EQ(mapping.outer(ispec), 0);
+      }
+    }
+  }
+
+  EXPECT_GE(nouter, 1);
+  EXPECT_EQ(mapping.outer(mapping.mesh_to_compute(0)), 1);
+
+  // Without interfaces every element is an inner element
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    EXPECT_EQ(reference.outer(ispec), 0);
+  }
+
+  return;
+}
+
+TEST(COMPUTE_TESTS, compute_element_coloring) {
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  std::string config_filename =
+      "../../../tests/unit-tests/compute/index/test_config.yml";
+  test_config test_config = get_test_config(config_filename, mpi);
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, 5);
+
+  specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::mesh::mesh mesh(test_config.database_filename, mpi);
+
+  specfem::compute::mesh assembly(mesh.tags, mesh.control_nodes, quadratures);
+
+  const int nspec = assembly.nspec;
+  const int ngllz = assembly.ngllz;
+  const int ngllx = assembly.ngllx;
+
+  int nglob = 0;
+  specfem::kokkos::HostView1d<int> elements("elements", nspec);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    elements(ispec) = ispec;
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        nglob = std::max(nglob,
+                         assembly.points.h_index_mapping(ispec, iz, ix) + 1);
+      }
+    }
+  }
+
+  for (const int block_size : { 1, 4 }) {
+    const specfem::compute::element_coloring coloring(assembly.points,
+                                                      elements, block_size);
+
+    ASSERT_GT(coloring.ncolors, 0);
+    ASSERT_EQ(coloring.h_color_offsets(0), 0);
+    ASSERT_EQ(coloring.h_color_offsets(coloring.ncolors), nspec);
+
+    // Every element is assigned to exactly one color
+    std::vector<int> color(nspec, -1);
+    for (int icolor = 0; icolor < coloring.ncolors; ++icolor) {
+      const int start = coloring.h_color_offsets(icolor);
+      const int end = coloring.h_color_offsets(icolor + 1);
+      ASSERT_LT(start, end);
+      for (int ielement = start; ielement < end; ++ielement) {
+        const int ispec = coloring.h_element_index_mapping(ielement);
+        ASSERT_EQ(color[ispec], -1);
+        color[ispec] = icolor;
+
+        // Blocks of consecutive elements are kept together
+        if ((ielement - start) % block_size != 0) {
+          EXPECT_EQ(ispec, coloring.h_element_index_mapping(ielement - 1) + 1);
+        }
+      }
+    }
+
+    // Blocks of the same color share no global points
+    std::vector<int> owner(nglob, -1);
+    for (int icolor = 0; icolor < coloring.ncolors; ++icolor) {
+      std::fill(owner.begin(), owner.end(), -1);
+      for (int ielement = coloring.h_color_offsets(icolor);
+           ielement < coloring.h_color_offsets(icolor + 1); ++ielement) {
+        const int ispec = coloring.h_element_index_mapping(ielement);
+        const int iblock = ispec / block_size;
+        for (int iz = 0; iz < ngllz; ++iz) {
+          for (int ix = 0; ix < ngllx; ++ix) {
+            const int iglob = assembly.points.h_index_mapping(ispec, iz, ix);
+            EXPECT_TRUE(owner[iglob] == -1 || owner[iglob] == iblock);
+            owner[iglob] = iblock;
+          }
+        }
+      }
+    }
+  }
+
+  return;
+}
+
+TEST(COMPUTE_TESTS, compute_assembly_cache) {
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  std::string config_filename =
+      "../../../tests/unit-tests/compute/index/test_config.yml";
+  test_config test_config = get_test_config(config_filename, mpi);
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, 5);
+
+  specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::mesh::mesh mesh(test_config.database_filename, mpi);
+
+  const auto ordering = specfem::compute::element_ordering::hilbert;
+
+  specfem::compute::mesh reference(mesh.tags, mesh.control_nodes, quadratures,
+                                   ordering);
+  specfem::compute::partial_derivatives reference_derivatives(reference);
+
+  const boost::filesystem::path directory =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("specfem-assembly-cache-%%%%-%%%%");
+
+  const specfem::compute::assembly_cache cache(directory.string(),
+                                               test_config.database_filename);
+
+  specfem::compute::mesh assembly;
+  specfem::compute::partial_derivatives partial_derivatives;
+
+  // Nothing is cached yet
+  ASSERT_FALSE(cache.load(mesh, quadratures, ordering, assembly,
+                          partial_derivatives));
+
+  cache.store(quadratures, reference, reference_derivatives);
+
+  // A different ordering is a different cache entry
+  ASSERT_FALSE(cache.load(mesh, quadratures,
+                          specfem::compute::element_ordering::none,
+                          assembly, partial_derivatives));
+
+  ASSERT_TRUE(cache.load(mesh, quadratures, ordering, assembly,
+                         partial_derivatives));
+
+  ASSERT_EQ(assembly.nspec, reference.nspec);
+  ASSERT_EQ(assembly.ngllz, reference.ngllz);
+  ASSERT_EQ(assembly.ngllx, reference.ngllx);
+
+  for (int ispec = 0; ispec < reference.nspec; ++ispec) {
+    EXPECT_EQ(assembly.mapping.compute_to_mesh(ispec),
+              reference.mapping.compute_to_mesh(ispec));
+    EXPECT_EQ(assembly.mapping.outer(ispec), reference.mapping.outer(ispec));
+    for (int iz = 0; iz < reference.ngllz; ++iz) {
+      for (int ix = 0; ix < reference.ngllx; ++ix) {
+        EXPECT_EQ(assembly.points.h_index_mapping(ispec, iz, ix),
+                  reference.points.h_index_mapping(ispec, iz, ix));
+        EXPECT_EQ(assembly.points.h_coord(0, ispec, iz, ix),
+                  reference.points.h_coord(0, ispec, iz, ix));
+        EXPECT_EQ(assembly.points.h_coord(1, ispec, iz, ix),
+                  reference.points.h_coord(1, ispec, iz, ix));
+        EXPECT_EQ(partial_derivatives.h_jacobian(ispec, iz, ix),
+                  reference_derivatives.h_jacobian(ispec, iz, ix));
+        EXPECT_EQ(partial_derivatives.h_xix(ispec, iz, ix),
+                  reference_derivatives.h_xix(ispec, iz, ix));
+      }
+    }
+  }
+
+  boost::filesystem::remove_all(directory);
+
   return;
 }
 
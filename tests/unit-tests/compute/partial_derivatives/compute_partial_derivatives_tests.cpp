@@ -155,6 +155,58 @@ TEST(COMPUTE_TESTS, compute_partial_derivatives) {
     }
   }
 
+  // Partial derivatives of affine elements are stored once per element
+  int naffine = 0;
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    if (!partial_derivatives.h_is_affine(ispec))
+      continue;
+
+    naffine++;
+    const int ispec_mesh = compute_mesh.mapping.compute_to_mesh(ispec);
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        const specfem::point::index<specfem::dimension::type::dim2> index(
+            ispec, iz, ix);
+        const auto point_partial_derivatives = [&]() {
+          specfem::point::partial_derivatives<specfem::dimension::type::dim2,
+                                              true, false>
+              point_partial_derivatives;
+          specfem::compute::load_on_host(index, partial_derivatives.affine,
+                                         point_partial_derivatives);
+          return point_partial_derivatives;
+        }();
+
+        EXPECT_NEAR(point_partial_derivatives.xix,
+                    xix_ref.data(ispec_mesh, iz, ix), xix_ref.tol);
+        EXPECT_NEAR(point_partial_derivatives.gammax,
+                    gammax_ref.data(ispec_mesh, iz, ix), gammax_ref.tol);
+        EXPECT_NEAR(point_partial_derivatives.gammaz,
+                    gammaz_ref.data(ispec_mesh, iz, ix), gammaz_ref.tol);
+        EXPECT_NEAR(point_partial_derivatives.jacobian,
+                    jacobian_ref.data(ispec_mesh, iz, ix), jacobian_ref.tol);
+      }
+    }
+  }
+  EXPECT_EQ(naffine, partial_derivatives.naffine);
+
+  // Affine elements are launched before the remaining elements
+  specfem::kokkos::HostView1d<int> elements("elements", nspec);
+  specfem::kokkos::HostView1d<int> range_offsets("range_offsets", 2);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    elements(ispec) = ispec;
+  }
+  range_offsets(1) = nspec;
+
+  const specfem::compute::affine_element_partition partition(
+      partial_derivatives, elements, range_offsets, 1);
+  ASSERT_EQ(partition.nranges, 1);
+  EXPECT_EQ(partition.h_affine_offsets(0), naffine);
+  for (int i = 0; i < nspec; ++i) {
+    EXPECT_EQ(partial_derivatives.h_is_affine(
+                  partition.h_element_index_mapping(i)),
+              i < naffine);
+  }
+
   return;
 }
 
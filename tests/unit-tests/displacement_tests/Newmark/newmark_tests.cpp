@@ -11,6 +11,9 @@
 #include "solver/solver.hpp"
 #include "timescheme/timescheme.hpp"
 #include "yaml-cpp/yaml.h"
+#include <algorithm>
+#include <array>
+#include <optional>
 
 // ------------------------------------- //
 // ------- Test configuration ----------- //
@@ -149,7 +152,10 @@ specfem::testing::array2d<type_real, Kokkos::LayoutLeft> compact_array(
   return local_array;
 }
 
-TEST(DISPLACEMENT_TESTS, newmark_scheme_tests) {
+// Run every test of the configuration file and compare the seismograms to the
+// reference traces. If a drift tolerance is given, the error in the last window
+// of the traces is also checked
+void run_newmark_tests(const std::optional<type_real> &drift_tolerance) {
   std::string config_filename = "../../../tests/unit-tests/displacement_tests/"
                                 "Newmark/test_config.yaml";
 
@@ -267,6 +273,13 @@ TEST(DISPLACEMENT_TESTS, newmark_scheme_tests) {
     }
     // --------------------------------------------------------------
 
+    // Reference traces are sampled at every time step
+    const int nstep_between_samples = nsteps / it->get_max_seismogram_step();
+
+    // Reference traces are computed in double precision. Errors in the last
+    // window of the traces measure the drift accumulated over the simulation
+    constexpr int nwindows = 4;
+
     for (int irec = 0; irec < receivers.size(); ++irec) {
       const auto network_name = receivers[irec]->get_network_name();
       const auto station_name = receivers[irec]->get_station_name();
@@ -279,10 +292,11 @@ TEST(DISPLACEMENT_TESTS, newmark_scheme_tests) {
       };
       type_real error_norm = 0.0;
       type_real compute_norm = 0.0;
+      std::array<type_real, nwindows> window_error = {};
 
       for (int i = 0; i < traces_filename.size(); ++i) {
         Kokkos::View<type_real **, Kokkos::LayoutRight, Kokkos::HostSpace>
-            traces("traces", seismograms.h_seismogram.extent(0), 2);
+            traces("traces", nsteps, 2);
         specfem::reader::seismogram reader(
             traces_filename[i], specfem::enums::seismogram::format::ascii,
             traces);
@@ -294,17 +308,30 @@ TEST(DISPLACEMENT_TESTS, newmark_scheme_tests) {
         const int nsig_steps = l_seismogram.extent(0);
 
         for (int isig_step = 0; isig_step < nsig_steps; ++isig_step) {
-          const type_real time_t = traces(isig_step, 0);
-          const type_real value = traces(isig_step, 1);
+          const int istep = isig_step * nstep_between_samples;
+          const type_real time_t = traces(istep, 0);
+          const type_real value = traces(istep, 1);
 
           const type_real computed_value = l_seismogram(isig_step, 0);
 
-          error_norm +=
+          const type_real error =
               std::sqrt((value - computed_value) * (value - computed_value));
+          const int iwindow =
+              std::min(nwindows - 1, (isig_step * nwindows) / nsig_steps);
+
+          error_norm += error;
+          window_error[iwindow] += error;
           compute_norm += std::sqrt(value * value);
         }
       }
 
+      const type_real drift = window_error[nwindows - 1] / compute_norm;
+
+      if (drift_tolerance) {
+        std::cout << " - Drift at " << network_name << "." << station_name
+                  << " : " << drift << "\n";
+      }
+
       if (error_norm / compute_norm > 1e-3 ||
           std::isnan(error_norm / compute_norm)) {
         FAIL() << "--------------------------------------------------\n"
@@ -317,6 +344,20 @@ TEST(DISPLACEMENT_TESTS, newmark_scheme_tests) {
                << "--------------------------------------------------\n\n"
                << std::endl;
       }
+
+      if (drift_tolerance &&
+          (drift > drift_tolerance.value() || std::isnan(drift))) {
+        FAIL() << "--------------------------------------------------\n"
+               << "\033[0;31m[FAILED]\033[0m Test failed\n"
+               << " - Test name: " << Test.name << "\n"
+               << " - Error: Traces drift away from the reference\n"
+               << " - Station: " << station_name << "\n"
+               << " - Network: " << network_name << "\n"
+               << " - Drift value: " << drift << "\n"
+               << " - Tolerance: " << drift_tolerance.value() << "\n"
+               << "--------------------------------------------------\n\n"
+               << std::endl;
+      }
     }
 
     std::cout << "--------------------------------------------------\n"
@@ -326,6 +367,19 @@ TEST(DISPLACEMENT_TESTS, newmark_scheme_tests) {
   }
 }
 
+TEST(DISPLACEMENT_TESTS, newmark_scheme_tests) { run_newmark_tests({}); }
+
+// The drift tolerance depends on the precision in which wavefields are
+// accumulated. It is set by CMake for every precision it was measured for
+TEST(DISPLACEMENT_TESTS, newmark_drift_tests) {
+#ifdef NEWMARK_DRIFT_TOLERANCE
+  run_newmark_tests(static_cast<type_real>(NEWMARK_DRIFT_TOLERANCE));
+#else
+  GTEST_SKIP() << "The drift tolerance has not been calibrated for this "
+                  "precision. Set NEWMARK_DRIFT_TOLERANCE from a measured run";
+#endif
+}
+
 int main(int argc, char *argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
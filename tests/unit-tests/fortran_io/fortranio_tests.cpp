@@ -1,6 +1,7 @@
 #include "IO/fortranio/interface.hpp"
 #include "specfem_setup.hpp"
 #include <boost/algorithm/string/trim.hpp>
+#include <cstdio>
 #include <fstream>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -43,3 +44,86 @@ TEST(iotests, fortran_io) {
 
   stream.close();
 }
+
+TEST(iotests, fortran_reader) {
+
+  std::string filename = "../../../tests/unit-tests/fortran_io/input.bin";
+  specfem::IO::fortran_reader reader(filename);
+
+  int ival;
+  bool bval;
+  std::string sval;
+  type_real dval;
+  std::vector<int> vval(100, 0);
+
+  specfem::IO::fortran_read_line(reader, &ival);
+  EXPECT_EQ(ival, 100);
+  specfem::IO::fortran_read_line(reader, &dval);
+  EXPECT_FLOAT_EQ(dval, 100.0);
+  specfem::IO::fortran_read_line(reader, &bval);
+  EXPECT_TRUE(bval);
+  specfem::IO::fortran_read_line(reader, &sval);
+  EXPECT_THAT(sval.c_str(), testing::StartsWith("Test case"));
+  specfem::IO::fortran_read_line(reader, &ival, &dval);
+  EXPECT_EQ(ival, 100);
+  EXPECT_FLOAT_EQ(dval, 100.0);
+  specfem::IO::fortran_read_line(reader, &bval, &sval);
+  EXPECT_TRUE(bval);
+  EXPECT_THAT(sval.c_str(), testing::StartsWith("Test case"));
+  specfem::IO::fortran_read_line(reader, &vval);
+
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(vval[i], 10);
+  }
+
+  EXPECT_TRUE(reader.eof());
+  EXPECT_THROW(specfem::IO::fortran_read_line(reader, &ival),
+               std::runtime_error);
+}
+
+TEST(iotests, fortran_reader_markers) {
+
+  const std::string filename = "fortran_reader_markers.bin";
+
+  // Record holding one int whose trailing marker is corrupted, followed by a
+  // record truncated by the end of the file
+  const int records[] = { 4, 100, 8, 4, 100, 4 };
+  {
+    std::ofstream stream(filename, std::ios::binary);
+    stream.write(reinterpret_cast<const char *>(records), sizeof(records));
+  }
+
+  int ival;
+  type_real dval;
+
+  {
+    specfem::IO::fortran_reader reader(filename);
+    EXPECT_THROW(specfem::IO::fortran_read_line(reader, &ival),
+                 std::runtime_error);
+  }
+
+  // Fix the trailing marker of the first record
+  const int fixed[] = { 4, 100, 4, 8, 100 };
+  {
+    std::ofstream stream(filename, std::ios::binary);
+    stream.write(reinterpret_cast<const char *>(fixed), sizeof(fixed));
+  }
+
+  {
+    specfem::IO::fortran_reader reader(filename);
+    // Values do not match the record
+    EXPECT_THROW(specfem::IO::fortran_read_line(reader, &dval),
+                 std::runtime_error);
+  }
+
+  {
+    specfem::IO::fortran_reader reader(filename);
+    specfem::IO::fortran_read_line(reader, &ival);
+    EXPECT_EQ(ival, 100);
+    EXPECT_EQ(reader.tell(), static_cast<std::size_t>(3 * fint));
+    EXPECT_THROW(specfem::IO::fortran_read_line(reader, &dval),
+                 std::runtime_error);
+  }
+
+  std::remove(filename.c_str());
+}
@@ -0,0 +1,100 @@
+#include "../Kokkos_Environment.hpp"
+#include "instrumentation/instrumentation.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+TEST(INSTRUMENTATION, record) {
+  auto &registry = specfem::instrumentation::registry::get();
+  registry.reset();
+
+  registry.record("stiffness", "forward", "elastic", 2.0, 4000000000);
+  registry.record("predictor", "forward", "elastic", 0.5, 0);
+  registry.record("stiffness", "forward", "elastic", 2.0, 4000000000);
+  registry.record("stiffness", "forward", "acoustic", 1.0, 0);
+
+  const auto &timers = registry.get_timers();
+  ASSERT_EQ(timers.size(), 3);
+
+  // Timers keep the order in which phases were first recorded
+  EXPECT_EQ(timers[0].phase, "stiffness");
+  EXPECT_EQ(timers[0].medium, "elastic");
+  EXPECT_EQ(timers[0].calls, 2);
+  EXPECT_DOUBLE_EQ(timers[0].time, 4.0);
+  EXPECT_EQ(timers[0].bytes, 8000000000);
+  EXPECT_DOUBLE_EQ(timers[0].bandwidth(), 2.0);
+
+  EXPECT_EQ(timers[1].phase, "predictor");
+  EXPECT_EQ(timers[1].calls, 1);
+  EXPECT_DOUBLE_EQ(timers[1].bandwidth(), 0.0);
+
+  EXPECT_EQ(timers[2].medium, "acoustic");
+
+  registry.reset();
+  EXPECT_TRUE(registry.get_timers().empty());
+}
+
+TEST(INSTRUMENTATION, region) {
+  auto &registry = specfem::instrumentation::registry::get();
+  registry.reset();
+
+  const bool enabled = registry.is_enabled();
+
+  registry.enable(false);
+  {
+    specfem::instrumentation::region region(
+        "source", specfem::wavefield::type::forward,
+        specfem::element::medium_tag::acoustic);
+  }
+  EXPECT_TRUE(registry.get_timers().empty());
+
+  registry.enable(true);
+  for (int istep = 0; istep < 3; ++istep) {
+    specfem::instrumentation::region region(
+        "source", specfem::wavefield::type::adjoint,
+        specfem::element::medium_tag::acoustic, 100);
+  }
+
+  const auto &timers = registry.get_timers();
+  ASSERT_EQ(timers.size(), 1);
+  EXPECT_EQ(timers[0].phase, "source");
+  EXPECT_EQ(timers[0].wavefield, "adjoint");
+  EXPECT_EQ(timers[0].medium, "acoustic");
+  EXPECT_EQ(timers[0].calls, 3);
+  EXPECT_EQ(timers[0].bytes, 300);
+  EXPECT_GE(timers[0].time, 0.0);
+
+  registry.enable(enabled);
+  registry.reset();
+}
+
+TEST(INSTRUMENTATION, output) {
+  auto &registry = specfem::instrumentation::registry::get();
+  registry.reset();
+
+  registry.record("stiffness", "forward", "elastic", 2.0, 4000000000);
+  registry.record("seismogram", "forward", "elastic", 1.0, 0);
+
+  std::ostringstream table;
+  registry.print(table);
+  EXPECT_NE(table.str().find("stiffness"), std::string::npos);
+  EXPECT_NE(table.str().find("seismogram"), std::string::npos);
+  EXPECT_NE(table.str().find("Total"), std::string::npos);
+
+  std::ostringstream json;
+  registry.write_json(json);
+  EXPECT_NE(json.str().find("{\"phase\": \"stiffness\", \"wavefield\": "
+                            "\"forward\", \"medium\": \"elastic\", "
+                            "\"calls\": 1, \"time\": 2, \"bytes\": "
+                            "4000000000, \"bandwidth\": 2}"),
+            std::string::npos);
+  EXPECT_NE(json.str().find("\"phase\": \"seismogram\""), std::string::npos);
+
+  registry.reset();
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
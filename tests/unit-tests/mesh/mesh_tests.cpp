@@ -1,7 +1,11 @@
 #include "../Kokkos_Environment.hpp"
 #include "../MPI_environment.hpp"
+#include "IO/ASCII/ASCII.hpp"
+#include "mesh/IO/native/mesh_database.hpp"
 #include "mesh/mesh.hpp"
 #include "yaml-cpp/yaml.h"
+#include <boost/filesystem.hpp>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -119,6 +123,109 @@ TEST(MESH_TESTS, fortran_binary_reader) {
   return;
 }
 
+/**
+ *
+ * Check that a mesh written in the native format is read back unchanged.
+ *
+ * The ASCII library is used so that the test does not depend on HDF5.
+ *
+ */
+TEST(MESH_TESTS, native_mesh_round_trip) {
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+  std::string config_filename =
+      "../../../tests/unit-tests/mesh/test_config.yaml";
+  std::vector<test_configuration::Test> Tests;
+  parse_test_config(YAML::LoadFile(config_filename), Tests);
+
+  const std::string native_filename = "native_mesh_round_trip";
+
+  for (auto Test : Tests) {
+    const specfem::mesh::mesh mesh(
+        Test.databases.filenames[Test.configuration.processors - 1], mpi);
+
+    specfem::mesh::IO::native::write_mesh<
+        specfem::IO::ASCII<specfem::IO::write> >(native_filename, mesh);
+
+    const auto native = specfem::mesh::IO::native::read_mesh<
+        specfem::IO::ASCII<specfem::IO::read> >(native_filename, mpi);
+
+    boost::filesystem::remove_all(native_filename);
+
+    ASSERT_EQ(native.nspec, mesh.nspec) << Test.name;
+    ASSERT_EQ(native.npgeo, mesh.npgeo) << Test.name;
+    ASSERT_EQ(native.nproc, mesh.nproc) << Test.name;
+
+    // Coordinates are written with 10 significant digits
+    for (int ipgeo = 0; ipgeo < mesh.npgeo; ipgeo++) {
+      for (int idim = 0; idim < 2; idim++) {
+        const type_real expected = mesh.control_nodes.coord(idim, ipgeo);
+        EXPECT_NEAR(native.control_nodes.coord(idim, ipgeo), expected,
+                    1e-8 * std::abs(expected) + 1e-12)
+            << Test.name;
+      }
+    }
+
+    for (int ispec = 0; ispec < mesh.nspec; ispec++) {
+      for (int ignod = 0; ignod < mesh.control_nodes.ngnod; ignod++) {
+        ASSERT_EQ(native.control_nodes.knods(ignod, ispec),
+                  mesh.control_nodes.knods(ignod, ispec))
+            << Test.name;
+      }
+
+      const auto &expected = mesh.materials.material_index_mapping(ispec);
+      const auto &material = native.materials.material_index_mapping(ispec);
+      ASSERT_EQ(material.type, expected.type) << Test.name;
+      ASSERT_EQ(material.property, expected.property) << Test.name;
+      ASSERT_EQ(material.index, expected.index) << Test.name;
+
+      ASSERT_EQ(native.tags.tags_container(ispec).medium_tag,
+                mesh.tags.tags_container(ispec).medium_tag)
+          << Test.name;
+      ASSERT_EQ(native.tags.tags_container(ispec).boundary_tag,
+                mesh.tags.tags_container(ispec).boundary_tag)
+          << Test.name;
+    }
+
+    ASSERT_EQ(native.materials.elastic_isotropic.material_properties.size(),
+              mesh.materials.elastic_isotropic.material_properties.size())
+        << Test.name;
+    ASSERT_EQ(native.materials.acoustic_isotropic.material_properties.size(),
+              mesh.materials.acoustic_isotropic.material_properties.size())
+        << Test.name;
+
+    const auto &absorbing = mesh.boundaries.absorbing_boundary;
+    ASSERT_EQ(native.boundaries.absorbing_boundary.nelements,
+              absorbing.nelements)
+        << Test.name;
+    for (int i = 0; i < absorbing.nelements; i++) {
+      ASSERT_EQ(native.boundaries.absorbing_boundary.index_mapping(i),
+                absorbing.index_mapping(i))
+          << Test.name;
+      ASSERT_EQ(native.boundaries.absorbing_boundary.type(i),
+                absorbing.type(i))
+          << Test.name;
+    }
+
+    const auto &elastic_acoustic = mesh.coupled_interfaces.elastic_acoustic;
+    ASSERT_EQ(native.coupled_interfaces.elastic_acoustic.num_interfaces,
+              elastic_acoustic.num_interfaces)
+        << Test.name;
+    for (int i = 0; i < elastic_acoustic.num_interfaces; i++) {
+      ASSERT_EQ(
+          native.coupled_interfaces.elastic_acoustic.medium1_index_mapping(i),
+          elastic_acoustic.medium1_index_mapping(i))
+          << Test.name;
+      ASSERT_EQ(
+          native.coupled_interfaces.elastic_acoustic.medium2_index_mapping(i),
+          elastic_acoustic.medium2_index_mapping(i))
+          << Test.name;
+    }
+  }
+
+  return;
+}
+
 int main(int argc, char *argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
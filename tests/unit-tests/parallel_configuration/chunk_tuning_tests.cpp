@@ -0,0 +1,106 @@
+#include "../Kokkos_Environment.hpp"
+#include "parallel_configuration/chunk_tuning.hpp"
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+struct test_config {
+  constexpr static int chunk_size = 4;
+  constexpr static int tile_size = 8;
+  constexpr static int num_threads = 16;
+  constexpr static int vector_lanes = 2;
+};
+} // namespace
+
+TEST(CHUNK_TUNING, cache) {
+  const std::string filename = "chunk_tuning_cache_test.txt";
+  std::remove(filename.c_str());
+
+  const specfem::parallel_config::chunk_tuning tuning(filename, 5);
+  EXPECT_TRUE(tuning.enabled());
+  EXPECT_EQ(tuning.get_nsteps(), 5);
+
+  const std::vector<std::string> candidates = {
+    "chunk 1, tile 1, threads 1, lanes 1",
+    "chunk 2, tile 2, threads 1, lanes 1",
+    "chunk 4, tile 4, threads 1, lanes 1"
+  };
+
+  int index = -1;
+  EXPECT_FALSE(tuning.load("Serial:1:forward:elastic", candidates, index));
+
+  tuning.store("Serial:1:forward:elastic", candidates[2]);
+  tuning.store("Serial:1:forward:acoustic", candidates[1]);
+
+  ASSERT_TRUE(tuning.load("Serial:1:forward:elastic", candidates, index));
+  EXPECT_EQ(index, 2);
+  ASSERT_TRUE(tuning.load("Serial:1:forward:acoustic", candidates, index));
+  EXPECT_EQ(index, 1);
+
+  // Storing an existing key replaces its entry
+  tuning.store("Serial:1:forward:elastic", candidates[0]);
+  ASSERT_TRUE(tuning.load("Serial:1:forward:elastic", candidates, index));
+  EXPECT_EQ(index, 0);
+
+  std::remove(filename.c_str());
+}
+
+TEST(CHUNK_TUNING, stale_cache) {
+  const std::string filename = "chunk_tuning_stale_cache_test.txt";
+  std::remove(filename.c_str());
+
+  const specfem::parallel_config::chunk_tuning tuning(filename, 1);
+  tuning.store("Serial:1:forward:elastic",
+               "chunk 4, tile 4, threads 1, lanes 1");
+
+  // A build with other candidates finds the candidate at another index
+  const std::vector<std::string> reordered = {
+    "chunk 4, tile 4, threads 1, lanes 1", "chunk 1, tile 1, threads 1, lanes 1"
+  };
+  int index = -1;
+  ASSERT_TRUE(tuning.load("Serial:1:forward:elastic", reordered, index));
+  EXPECT_EQ(index, 0);
+
+  // ... and ignores entries that are not one of its candidates
+  const std::vector<std::string> other = {
+    "chunk 1, tile 1, threads 1, lanes 1", "chunk 2, tile 2, threads 1, lanes 1"
+  };
+  index = -1;
+  EXPECT_FALSE(tuning.load("Serial:1:forward:elastic", other, index));
+  EXPECT_EQ(index, -1);
+
+  std::remove(filename.c_str());
+}
+
+TEST(CHUNK_TUNING, disabled) {
+  const specfem::parallel_config::chunk_tuning tuning;
+  EXPECT_FALSE(tuning.enabled());
+
+  // Without a cache file nothing is stored
+  const specfem::parallel_config::chunk_tuning uncached("", 1);
+  const std::vector<std::string> candidates = {
+    "chunk 1, tile 1, threads 1, lanes 1"
+  };
+  uncached.store("Serial:1:forward:elastic", candidates[0]);
+  int index = -1;
+  EXPECT_FALSE(uncached.load("Serial:1:forward:elastic", candidates, index));
+
+  EXPECT_THROW(specfem::parallel_config::chunk_tuning("", 0),
+               std::runtime_error);
+}
+
+TEST(CHUNK_TUNING, describe) {
+  const auto descriptions = specfem::parallel_config::describe_candidates<
+      std::tuple<test_config, test_config> >();
+  ASSERT_EQ(descriptions.size(), 2);
+  EXPECT_EQ(descriptions[0], "chunk 4, tile 8, threads 16, lanes 2");
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,265 @@
+#include "../Kokkos_Environment.hpp"
+#include "compute/interface.hpp"
+#include "writer/seismogram.hpp"
+#include "writer/seismogram_stream.hpp"
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef NO_HDF5
+#include "H5Cpp.h"
+#endif
+
+namespace {
+// Value of a seismogram sample that identifies its position
+type_real sample_value(const int isig_step, const int isig, const int irec,
+                       const int icomp) {
+  return 1000 * isig_step + 100 * isig + 10 * irec + icomp;
+}
+
+// Compute seismogram steps into the ring buffer and stream them
+void stream_seismograms(specfem::compute::receivers &receivers,
+                        specfem::writer::seismogram_stream &stream,
+                        const int nsteps) {
+  const int nbuffer = receivers.get_buffer_size();
+  const int ntypes = receivers.h_seismogram.extent(1);
+  const int nreceivers = receivers.h_seismogram.extent(2);
+
+  for (int isig_step = 0; isig_step < nsteps; ++isig_step) {
+    Kokkos::deep_copy(receivers.h_seismogram, receivers.seismogram);
+    for (int isig = 0; isig < ntypes; ++isig) {
+      for (int irec = 0; irec < nreceivers; ++irec) {
+        for (int icomp = 0; icomp < 2; ++icomp) {
+          receivers.h_seismogram(isig_step % nbuffer, isig, irec, icomp) =
+              sample_value(isig_step, isig, irec, icomp);
+        }
+      }
+    }
+    Kokkos::deep_copy(receivers.seismogram, receivers.h_seismogram);
+    stream.write(isig_step);
+  }
+
+  stream.close();
+}
+
+specfem::compute::receivers make_receivers(const int nreceivers,
+                                           const int nsteps,
+                                           const int buffer_size) {
+  specfem::compute::receivers receivers(nreceivers, nsteps, 5, 2,
+                                        buffer_size);
+  receivers.h_seismogram_types(0) =
+      specfem::enums::seismogram::type::displacement;
+  receivers.h_seismogram_types(1) =
+      specfem::enums::seismogram::type::velocity;
+  for (int irec = 0; irec < nreceivers; ++irec) {
+    receivers.network_names[irec] = "AA";
+    receivers.station_names[irec] = "S000" + std::to_string(irec);
+  }
+  return receivers;
+}
+} // namespace
+
+TEST(SEISMOGRAM_STREAM, binary_ring_buffer) {
+  const int nreceivers = 3;
+  const int nsteps = 10;
+  const std::string folder = ::testing::TempDir();
+
+  auto receivers = make_receivers(nreceivers, nsteps, 4);
+  ASSERT_EQ(receivers.get_buffer_size(), 4);
+  ASSERT_EQ(receivers.seismogram.extent(0), 4);
+
+  {
+    specfem::writer::seismogram_stream stream(
+        receivers, specfem::enums::seismogram::binary, folder, 0.5, -1.0, 2,
+        nsteps);
+    stream_seismograms(receivers, stream, nsteps);
+  }
+
+  std::ifstream file(specfem::writer::seismogram_stream::filename(
+                         folder, specfem::enums::seismogram::binary),
+                     std::ios::binary);
+  ASSERT_TRUE(file.is_open());
+
+  specfem::writer::seismogram_header header;
+  file.read(reinterpret_cast<char *>(&header), sizeof(header));
+  EXPECT_EQ(std::string(header.magic, 8), "SPFMSEIS");
+  EXPECT_EQ(header.real_size, sizeof(type_real));
+  EXPECT_EQ(header.nsteps, nsteps);
+  EXPECT_EQ(header.ntypes, 2);
+  EXPECT_EQ(header.nreceivers, nreceivers);
+  EXPECT_EQ(header.ncomponents, 2);
+  EXPECT_DOUBLE_EQ(header.dt, 1.0);
+  EXPECT_DOUBLE_EQ(header.t0, -1.0);
+  EXPECT_EQ(header.types[1],
+            static_cast<int>(specfem::enums::seismogram::type::velocity));
+
+  std::vector<type_real> samples(nsteps * 2 * nreceivers * 2);
+  file.read(reinterpret_cast<char *>(samples.data()),
+            samples.size() * sizeof(type_real));
+  ASSERT_TRUE(file.good());
+
+  int index = 0;
+  for (int isig_step = 0; isig_step < nsteps; ++isig_step) {
+    for (int isig = 0; isig < 2; ++isig) {
+      for (int irec = 0; irec < nreceivers; ++irec) {
+        for (int icomp = 0; icomp < 2; ++icomp) {
+          EXPECT_EQ(samples[index++],
+                    sample_value(isig_step, isig, irec, icomp))
+              << "Step " << isig_step << ", type " << isig << ", receiver "
+              << irec << ", component " << icomp;
+        }
+      }
+    }
+  }
+
+  // Nothing is stored after the last seismogram step
+  EXPECT_EQ(file.peek(), std::char_traits<char>::eof());
+}
+
+TEST(SEISMOGRAM_STREAM, ascii_export) {
+  const int nreceivers = 2;
+  const int nsteps = 7;
+  const std::string folder = ::testing::TempDir();
+
+  auto receivers = make_receivers(nreceivers, nsteps, 3);
+
+  {
+    specfem::writer::seismogram_stream stream(
+        receivers, specfem::enums::seismogram::binary, folder, 0.25, 0.0, 1,
+        nsteps, true);
+    stream_seismograms(receivers, stream, nsteps);
+  }
+
+  // Velocity of the second receiver along Z
+  const auto filenames = specfem::writer::seismogram::filenames(
+      folder, "AA", "S0001", specfem::enums::seismogram::type::velocity);
+  std::ifstream file(filenames[1]);
+  ASSERT_TRUE(file.is_open());
+
+  for (int isig_step = 0; isig_step < nsteps; ++isig_step) {
+    type_real time, value;
+    ASSERT_TRUE(file >> time >> value);
+    EXPECT_NEAR(time, 0.25 * isig_step, 1e-6);
+    EXPECT_EQ(value, sample_value(isig_step, 1, 1, 1));
+  }
+
+  type_real extra;
+  EXPECT_FALSE(file >> extra);
+}
+
+TEST(SEISMOGRAM_STREAM, out_of_order_step) {
+  auto receivers = make_receivers(1, 4, 2);
+  specfem::writer::seismogram_stream stream(
+      receivers, specfem::enums::seismogram::binary, ::testing::TempDir(), 1.0,
+      0.0, 1, 4);
+  stream.write(0);
+  EXPECT_THROW(stream.write(2), std::runtime_error);
+}
+
+TEST(SEISMOGRAM_STREAM, bounded_memory_footprint) {
+  // Receiver memory is bounded by the ring buffer, not by the number of
+  // seismogram steps
+  const auto short_run = make_receivers(4, 10, 8);
+  const auto long_run = make_receivers(4, 100000, 8);
+
+  EXPECT_EQ(short_run.get_memory_footprint().device,
+            long_run.get_memory_footprint().device);
+  EXPECT_EQ(short_run.get_memory_footprint().host,
+            long_run.get_memory_footprint().host);
+  EXPECT_EQ(long_run.receiver_field.extent(0), 5);
+  EXPECT_EQ(long_run.receiver_field.extent(3), 4);
+
+  // Host copy of the receiver field is only allocated on request
+  auto receivers = make_receivers(4, 10, 8);
+  EXPECT_EQ(receivers.h_receiver_field.size(), 0);
+  receivers.sync_receiver_field();
+  EXPECT_EQ(receivers.h_receiver_field.size(),
+            receivers.receiver_field.size());
+}
+
+#ifndef NO_HDF5
+TEST(SEISMOGRAM_STREAM, concurrent_hdf5_streams) {
+  // Every stream writes from its own background thread, and a stream is
+  // closed while the other streams are still writing
+  const int nstreams = 4;
+  const int nreceivers = 3;
+  const int nsteps = 20;
+  const int offset = 100000;
+
+  const boost::filesystem::path directory =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("specfem-seismogram-stream-%%%%-%%%%");
+
+  std::vector<std::string> folders;
+  std::vector<specfem::compute::receivers> receivers;
+  std::vector<std::unique_ptr<specfem::writer::seismogram_stream> > streams;
+  for (int istream = 0; istream < nstreams; ++istream) {
+    folders.push_back((directory / ("run" + std::to_string(istream))).string());
+    boost::filesystem::create_directories(folders.back());
+    receivers.push_back(make_receivers(nreceivers, nsteps, 2));
+    streams.push_back(std::make_unique<specfem::writer::seismogram_stream>(
+        receivers.back(), specfem::enums::seismogram::hdf5, folders.back(),
+        1.0, 0.0, 1, nsteps, true));
+  }
+
+  for (int isig_step = 0; isig_step < nsteps; ++isig_step) {
+    for (int istream = 0; istream < nstreams; ++istream) {
+      auto &h_seismogram = receivers[istream].h_seismogram;
+      for (int isig = 0; isig < 2; ++isig) {
+        for (int irec = 0; irec < nreceivers; ++irec) {
+          for (int icomp = 0; icomp < 2; ++icomp) {
+            h_seismogram(isig_step % 2, isig, irec, icomp) =
+                offset * istream + sample_value(isig_step, isig, irec, icomp);
+          }
+        }
+      }
+      Kokkos::deep_copy(receivers[istream].seismogram, h_seismogram);
+      streams[istream]->write(isig_step);
+    }
+  }
+
+  for (auto &stream : streams)
+    stream->close();
+  streams.clear();
+
+  for (int istream = 0; istream < nstreams; ++istream) {
+    std::vector<type_real> samples(nsteps * 2 * nreceivers * 2);
+    {
+      H5::H5File file(specfem::writer::seismogram_stream::filename(
+                          folders[istream], specfem::enums::seismogram::hdf5),
+                      H5F_ACC_RDONLY);
+      file.openDataSet("seismograms")
+          .read(samples.data(),
+                (sizeof(type_real) == sizeof(float))
+                    ? H5::PredType::NATIVE_FLOAT
+                    : H5::PredType::NATIVE_DOUBLE);
+    }
+
+    int index = 0;
+    for (int isig_step = 0; isig_step < nsteps; ++isig_step) {
+      for (int isig = 0; isig < 2; ++isig) {
+        for (int irec = 0; irec < nreceivers; ++irec) {
+          for (int icomp = 0; icomp < 2; ++icomp) {
+            EXPECT_EQ(samples[index++],
+                      offset * istream +
+                          sample_value(isig_step, isig, irec, icomp))
+                << "Stream " << istream << ", step " << isig_step;
+          }
+        }
+      }
+    }
+  }
+
+  boost::filesystem::remove_all(directory);
+}
+#endif
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,95 @@
+#include "solver/checkpointing.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+using specfem::solver::checkpointing::action_type;
+using specfem::solver::checkpointing::binomial_schedule;
+
+// Execute the schedule symbolically and check that every forward state is
+// delivered exactly once, in reverse order, and that snapshots are only
+// restored after they have been stored.
+void check_schedule(const binomial_schedule &schedule, const int nsteps,
+                    const int nslots) {
+  std::vector<int> slots(nslots, -1);
+  slots[0] = 0;
+  int current = 0;
+  int expected_reverse = nsteps;
+
+  for (const auto &action : schedule.get_actions()) {
+    switch (action.type) {
+    case action_type::advance:
+      ASSERT_EQ(action.step, current);
+      ASSERT_GT(action.nsteps, 0);
+      current += action.nsteps;
+      ASSERT_LE(current, nsteps);
+      break;
+    case action_type::store:
+      ASSERT_EQ(action.step, current);
+      ASSERT_GE(action.slot, 1);
+      ASSERT_LT(action.slot, nslots);
+      slots[action.slot] = current;
+      break;
+    case action_type::restore:
+      ASSERT_GE(action.slot, 0);
+      ASSERT_LT(action.slot, nslots);
+      ASSERT_EQ(slots[action.slot], action.step);
+      current = action.step;
+      break;
+    case action_type::reverse:
+      ASSERT_EQ(action.step, current);
+      ASSERT_EQ(action.step, expected_reverse);
+      expected_reverse--;
+      break;
+    }
+  }
+
+  EXPECT_EQ(expected_reverse, 0);
+  EXPECT_LE(schedule.get_max_slots(), nslots);
+}
+} // namespace
+
+TEST(CHECKPOINTING, enough_slots_for_every_step) {
+  const int nsteps = 100;
+  const binomial_schedule schedule(nsteps, nsteps);
+  check_schedule(schedule, nsteps, nsteps);
+  EXPECT_EQ(schedule.get_forward_steps(), nsteps);
+  EXPECT_EQ(schedule.get_recomputed_steps(), 0);
+}
+
+TEST(CHECKPOINTING, single_slot) {
+  const int nsteps = 50;
+  const binomial_schedule schedule(nsteps, 1);
+  check_schedule(schedule, nsteps, 1);
+  EXPECT_EQ(schedule.get_forward_steps(), nsteps * (nsteps + 1) / 2);
+}
+
+TEST(CHECKPOINTING, binomial_bound) {
+  // With 9 free slots every forward step is repeated at most 4 times when
+  // reversing 1000 steps: C(14, 10) - 1 = 1000
+  const int nsteps = 1000;
+  const int nslots = 10;
+  const binomial_schedule schedule(nsteps, nslots);
+  check_schedule(schedule, nsteps, nslots);
+  EXPECT_LE(schedule.get_forward_steps(), 4 * nsteps);
+  EXPECT_GT(schedule.get_recomputed_steps(), 0);
+}
+
+TEST(CHECKPOINTING, schedules_are_valid) {
+  for (int nsteps = 1; nsteps < 64; ++nsteps) {
+    for (int nslots = 1; nslots < 12; ++nslots) {
+      const binomial_schedule schedule(nsteps, nslots);
+      check_schedule(schedule, nsteps, nslots);
+    }
+  }
+}
+
+TEST(CHECKPOINTING, invalid_arguments) {
+  EXPECT_THROW(binomial_schedule(0, 4), std::runtime_error);
+  EXPECT_THROW(binomial_schedule(10, 0), std::runtime_error);
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
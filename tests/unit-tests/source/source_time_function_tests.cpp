@@ -0,0 +1,194 @@
+#include "../Kokkos_Environment.hpp"
+#include "compute/interface.hpp"
+#include "kokkos_abstractions.h"
+#include "source/source.hpp"
+#include "source_time_function/interface.hpp"
+#include "yaml-cpp/yaml.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+// Analytic source time functions evaluated on the device must match the values
+// tabulated on the host
+TEST(SOURCE_TIME_FUNCTION, analytic_matches_tabulated) {
+  const int nsteps = 200;
+  const type_real dt = 1e-3;
+  const type_real t0 = -0.05;
+
+  std::vector<std::unique_ptr<specfem::forcing_function::stf> > stfs;
+  stfs.emplace_back(std::make_unique<specfem::forcing_function::Ricker>(
+      nsteps, dt, 20.0, 0.01, 1e10, false));
+  stfs.emplace_back(std::make_unique<specfem::forcing_function::Ricker>(
+      nsteps, dt, 20.0, 0.0, 1e10, true));
+  stfs.emplace_back(std::make_unique<specfem::forcing_function::Dirac>(
+      nsteps, dt, 1.0 / (10.0 * dt), 0.0, 1e10, false));
+  stfs.emplace_back(std::make_unique<specfem::forcing_function::Dirac>(
+      nsteps, dt, 1.0 / (10.0 * dt), 0.02, 1e10, true));
+
+  for (const auto &stf : stfs) {
+    const auto parameters = stf->get_analytic_parameters();
+    ASSERT_NE(parameters.type, specfem::forcing_function::analytic_type::none);
+
+    specfem::kokkos::HostView2d<type_real> tabulated("tabulated", nsteps, 2);
+    stf->compute_source_time_function(t0, dt, 0, nsteps, tabulated);
+
+    specfem::kokkos::DeviceView1d<type_real> evaluated("evaluated", nsteps);
+    Kokkos::parallel_for(
+        "evaluate", specfem::kokkos::DeviceRange(0, nsteps),
+        KOKKOS_LAMBDA(const int istep) {
+          evaluated(istep) = parameters.compute(t0 + istep * dt);
+        });
+
+    const auto h_evaluated =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), evaluated);
+
+    type_real max_value = 0.0;
+    for (int istep = 0; istep < nsteps; istep++) {
+      max_value = std::max(max_value, std::abs(tabulated(istep, 0)));
+    }
+
+    for (int istep = 0; istep < nsteps; istep++) {
+      EXPECT_NEAR(h_evaluated(istep), tabulated(istep, 0), 1e-5 * max_value);
+      EXPECT_EQ(tabulated(istep, 0), tabulated(istep, 1));
+    }
+  }
+}
+
+namespace {
+// Source time function whose value is the time step, for either component
+class step_function : public specfem::forcing_function::stf {
+public:
+  step_function(int &max_steps) : max_steps(max_steps) {}
+
+  void compute_source_time_function(
+      const type_real t0, const type_real dt, const int first_step,
+      const int nsteps,
+      specfem::kokkos::HostView2d<type_real> source_time_function) override {
+    max_steps = std::max(max_steps, nsteps);
+    for (int i = 0; i < nsteps; i++) {
+      source_time_function(i, 0) = first_step + i;
+      source_time_function(i, 1) = -(first_step + i);
+    }
+  }
+
+  std::string print() const override { return "step function"; }
+
+private:
+  int &max_steps;
+};
+
+class step_source : public specfem::sources::source {
+public:
+  step_source(int &max_steps) {
+    this->forcing_function = std::make_unique<step_function>(max_steps);
+  }
+
+  void compute_source_array(
+      const specfem::compute::mesh &mesh,
+      const specfem::compute::partial_derivatives &partial_derivatives,
+      const specfem::compute::properties &properties,
+      specfem::kokkos::HostView3d<type_real> source_array) override {}
+
+  specfem::wavefield::type get_wavefield_type() const override {
+    return specfem::wavefield::type::forward;
+  }
+};
+} // namespace
+
+// The window of tabulated source time functions on the device follows the
+// time steps forward and backward in time, and only the time steps within the
+// window are tabulated
+TEST(SOURCE_TIME_FUNCTION, tabulated_window) {
+  const int nsteps = 10;
+  const int window = 4;
+
+  int max_steps = 0;
+
+  specfem::compute::source_medium<specfem::dimension::type::dim2,
+                                  specfem::element::medium_tag::elastic>
+      sources;
+  sources.nsteps = nsteps;
+  sources.window = window;
+  sources.window_start =
+      Kokkos::View<int, Kokkos::HostSpace>("window_start");
+  sources.source_time_function =
+      decltype(sources.source_time_function)("source_time_function", window,
+                                             1, 2);
+  sources.h_source_time_function =
+      Kokkos::create_mirror_view(sources.source_time_function);
+  sources.tabulated_sources.push_back(
+      std::make_shared<step_source>(max_steps));
+
+  // First window, as loaded when constructing the sources
+  sources.load_window(0);
+
+  const auto check = [&](const int timestep) {
+    const int iwindow = sources.load_source_time_function(timestep);
+    ASSERT_GE(iwindow, 0);
+    ASSERT_LT(iwindow, window);
+    const auto h_window = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), sources.source_time_function);
+    EXPECT_EQ(h_window(iwindow, 0, 0), timestep);
+    EXPECT_EQ(h_window(iwindow, 0, 1), -timestep);
+  };
+
+  for (int istep = 0; istep < nsteps; istep++) {
+    check(istep);
+  }
+
+  // The last window ends at the last time step
+  EXPECT_EQ(sources.window_start(), nsteps - window);
+
+  for (int istep = nsteps - 1; istep >= 0; istep--) {
+    check(istep);
+  }
+
+  EXPECT_EQ(sources.window_start(), 0);
+  EXPECT_EQ(max_steps, window);
+}
+
+// External source time functions read ranges of time steps from their files
+TEST(SOURCE_TIME_FUNCTION, external_range) {
+  const int nsteps = 2500;
+  const type_real dt = 0.5;
+  const std::string filename = "external_range.stf";
+
+  {
+    std::ofstream stream(filename);
+    for (int istep = 0; istep < nsteps; istep++) {
+      stream << istep * dt << " " << istep << "\n";
+    }
+  }
+
+  YAML::Node node;
+  node["format"] = "ascii";
+  node["stf"]["X-component"] = filename;
+
+  specfem::forcing_function::external stf(node, nsteps, dt);
+
+  const auto check = [&](const int first_step, const int count) {
+    specfem::kokkos::HostView2d<type_real> tabulated("tabulated", count, 2);
+    stf.compute_source_time_function(0.0, dt, first_step, count, tabulated);
+    for (int i = 0; i < count; i++) {
+      EXPECT_EQ(tabulated(i, 0), first_step + i);
+      EXPECT_EQ(tabulated(i, 1), 0.0);
+    }
+  };
+
+  // Ranges before, across and after the indexed lines, in any order
+  check(2200, 300);
+  check(1000, 50);
+  check(0, 10);
+  check(2047, 2);
+
+  specfem::kokkos::HostView2d<type_real> tabulated("tabulated", 10, 2);
+  EXPECT_THROW(
+      stf.compute_source_time_function(0.0, dt, nsteps - 5, 10, tabulated),
+      std::runtime_error);
+
+  std::remove(filename.c_str());
+}